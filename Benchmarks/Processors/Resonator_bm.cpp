@@ -0,0 +1,117 @@
+/*******************************************************************************
+ * ModalResonatorBank benchmarks
+ *
+ * Each voice is one bank of N modes (inharmonic partials, 0.2-1.2 s decays)
+ * excited by white noise and rendered in 512-sample blocks. The scalar
+ * baseline runs the same number of SvfFilter band-passes per voice, one
+ * processSample call per filter per sample, and sums them. "modes/s" counts
+ * mode-samples per second of CPU time, so the two are directly comparable.
+ *
+ * Args: { modes, voices }.
+ ******************************************************************************/
+
+#include <benchmark/benchmark.h>
+#include "filters/caspi_SvfFilter.h"
+#include "physical/caspi_ModalResonatorBank.h"
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+    constexpr float kSR    = 48000.f;
+    constexpr int   kBlock = 512;
+
+    using Bank = CASPI::Physical::ModalResonatorBank<float, 256>;
+    using Svf  = CASPI::Filters::SvfFilter<float>;
+
+    float modeFrequency (std::size_t k)
+    {
+        return 110.f * std::sqrt (static_cast<float> (k + 1) * (static_cast<float> (k) + 2.3f));
+    }
+
+    std::vector<float> makeNoise()
+    {
+        std::mt19937                          rng (1);
+        std::uniform_real_distribution<float> dist (-0.01f, 0.01f);
+        std::vector<float>                    noise (kBlock);
+        for (auto& s : noise)
+            s = dist (rng);
+        return noise;
+    }
+
+    void setCounters (benchmark::State& state, std::size_t modes, std::size_t voices)
+    {
+        const auto work           = static_cast<double> (kBlock * modes * voices);
+        state.counters["modes/s"] = benchmark::Counter (work, benchmark::Counter::kIsIterationInvariantRate);
+    }
+} // namespace
+
+static void BM_ModalResonatorBank (benchmark::State& state)
+{
+    const auto modes  = static_cast<std::size_t> (state.range (0));
+    const auto voices = static_cast<std::size_t> (state.range (1));
+
+    std::vector<Bank::Mode> table (modes);
+    for (std::size_t k = 0; k < modes; ++k)
+    {
+        const float f = std::fmod (modeFrequency (k), 20000.f);
+        table[k]      = { f, 0.2f + static_cast<float> (k % 11) * 0.1f, 1.f / static_cast<float> (k + 1) };
+    }
+
+    std::vector<std::unique_ptr<Bank>> banks;
+    for (std::size_t v = 0; v < voices; ++v)
+    {
+        banks.push_back (std::make_unique<Bank> (kSR));
+        banks.back()->setModes (table.data(), table.size());
+    }
+
+    const auto         noise = makeNoise();
+    std::vector<float> out (kBlock);
+    for (auto _ : state)
+    {
+        for (auto& bank : banks)
+        {
+            bank->processBlock (noise.data(), out.data(), kBlock);
+            benchmark::DoNotOptimize (out.data());
+        }
+    }
+
+    setCounters (state, modes, voices);
+}
+BENCHMARK (BM_ModalResonatorBank)->ArgsProduct ({ { 32, 64, 128, 256 }, { 1, 8 } });
+
+static void BM_SvfBandPassLoop (benchmark::State& state)
+{
+    const auto modes  = static_cast<std::size_t> (state.range (0));
+    const auto voices = static_cast<std::size_t> (state.range (1));
+
+    std::vector<std::unique_ptr<Svf>> filters;
+    for (std::size_t i = 0; i < modes * voices; ++i)
+    {
+        const float f = std::fmod (modeFrequency (i % modes), 20000.f);
+        filters.push_back (std::make_unique<Svf> (kSR, f, 50.f, CASPI::Filters::FilterMode::BandPass));
+    }
+
+    const auto         noise = makeNoise();
+    std::vector<float> out (kBlock);
+    for (auto _ : state)
+    {
+        for (std::size_t v = 0; v < voices; ++v)
+        {
+            for (int n = 0; n < kBlock; ++n)
+            {
+                float sum = 0.f;
+                for (std::size_t k = 0; k < modes; ++k)
+                    sum += filters[v * modes + k]->processSample (noise[static_cast<std::size_t> (n)]);
+                out[static_cast<std::size_t> (n)] = sum;
+            }
+            benchmark::DoNotOptimize (out.data());
+        }
+    }
+
+    setCounters (state, modes, voices);
+}
+BENCHMARK (BM_SvfBandPassLoop)->ArgsProduct ({ { 32, 64, 128, 256 }, { 1, 8 } });
@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * WaveguideBank benchmarks
+ *
+ * N sustained voices (T60 30 s, retriggered if they ever retire) spread
+ * over 55-1760 Hz, rendered in 512-sample blocks at 48 kHz. "xRealtime" is
+ * seconds of audio per second of CPU time and "voices/core" is
+ * N x xRealtime: how many such voices one core could run in real time.
+ *
+ * Args: { voices }. The Lagrange and Allpass variants select the delay-line
+ * interpolation; the Tube variant adds the per-sample breath excitation.
+ ******************************************************************************/
+
+#include <benchmark/benchmark.h>
+#include "physical/caspi_Waveguide.h"
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    constexpr float kSR    = 48000.f;
+    constexpr int   kBlock = 512;
+
+    using Bank = CASPI::Physical::WaveguideBank<float, 128>;
+
+    void runBank (benchmark::State& state, CASPI::Physical::WaveguideModel model, CASPI::Physical::DelayInterpolation interpolation)
+    {
+        const auto voices = static_cast<std::size_t> (state.range (0));
+
+        auto bank = std::make_unique<Bank> (kSR);
+        bank->setModel (model);
+        bank->setInterpolation (interpolation);
+        bank->setDecay (30.f);
+        bank->setBrightness (6000.f);
+        bank->amplitude.setBaseNormalised (1.f / static_cast<float> (voices));
+
+        auto note = [&] (std::size_t v)
+        {
+            return 55.f * std::exp2 (5.f * static_cast<float> (v) / static_cast<float> (voices));
+        };
+        for (std::size_t v = 0; v < voices; ++v)
+            bank->noteOn (note (v), 0.8f);
+
+        std::vector<float> out (kBlock);
+        for (auto _ : state)
+        {
+            bank->renderBlock (out.data(), kBlock);
+            benchmark::DoNotOptimize (out.data());
+
+            for (std::size_t v = bank->getNumActiveVoices(); v < voices; ++v)
+                bank->noteOn (note (v), 0.8f);
+        }
+
+        const double seconds          = static_cast<double> (kBlock) / static_cast<double> (kSR);
+        state.counters["xRealtime"]   = benchmark::Counter (seconds, benchmark::Counter::kIsIterationInvariantRate);
+        state.counters["voices/core"] = benchmark::Counter (seconds * static_cast<double> (voices), benchmark::Counter::kIsIterationInvariantRate);
+    }
+} // namespace
+
+static void BM_Waveguide_StringLagrange (benchmark::State& state)
+{
+    runBank (state, CASPI::Physical::WaveguideModel::PluckedString, CASPI::Physical::DelayInterpolation::Lagrange);
+}
+BENCHMARK (BM_Waveguide_StringLagrange)->Arg (1)->Arg (16)->Arg (64)->Arg (128);
+
+static void BM_Waveguide_StringAllpass (benchmark::State& state)
+{
+    runBank (state, CASPI::Physical::WaveguideModel::PluckedString, CASPI::Physical::DelayInterpolation::Allpass);
+}
+BENCHMARK (BM_Waveguide_StringAllpass)->Arg (1)->Arg (16)->Arg (64)->Arg (128);
+
+static void BM_Waveguide_Tube (benchmark::State& state)
+{
+    runBank (state, CASPI::Physical::WaveguideModel::Tube, CASPI::Physical::DelayInterpolation::Lagrange);
+}
+BENCHMARK (BM_Waveguide_Tube)->Arg (1)->Arg (16)->Arg (64)->Arg (128);
@@ -0,0 +1,245 @@
+/*******************************************************************************
+ * ADSR benchmarks
+ *
+ * One envelope cycling through a whole note (10 ms attack, 100 ms decay,
+ * 300 ms held, 200 ms release, 100 ms idle) in 512-sample blocks at
+ * 48 kHz, so every block mixes stage runs with the odd transition. The
+ * scalar variant calls render() per sample; the block variant calls
+ * renderBlock() once per block.
+ ******************************************************************************/
+
+#include <benchmark/benchmark.h>
+#include "controls/caspi_Envelope.h"
+#include "controls/caspi_EnvelopeBank.h"
+#include "controls/caspi_MSEG.h"
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+    constexpr int kBlock = 512;
+    constexpr int kNote  = 33600; // samples from noteOn to the next noteOn
+    constexpr int kHeld  = 19200;
+
+    template <typename FloatType, bool Block>
+    void runAdsr (benchmark::State& state)
+    {
+        CASPI::Envelope::ADSR<FloatType> env;
+        env.setSampleRate (FloatType (48000));
+        env.setADSR (FloatType (0.01), FloatType (0.1), FloatType (0.5), FloatType (0.2));
+
+        std::vector<FloatType> out (kBlock);
+        int                    position = 0;
+        for (auto _ : state)
+        {
+            // Note events land on block boundaries
+            if (position == 0)
+                env.noteOn();
+            else if (position == kHeld / kBlock * kBlock)
+                env.noteOff();
+
+            if constexpr (Block)
+                env.renderBlock (out.data(), kBlock);
+            else
+                for (int i = 0; i < kBlock; ++i)
+                    out[static_cast<std::size_t> (i)] = env.render();
+
+            benchmark::DoNotOptimize (out.data());
+            position = (position + kBlock) % (kNote / kBlock * kBlock);
+        }
+        state.SetItemsProcessed (state.iterations() * kBlock);
+    }
+} // namespace
+
+static void BM_ADSR_Scalar_Float (benchmark::State& state) { runAdsr<float, false> (state); }
+BENCHMARK (BM_ADSR_Scalar_Float);
+
+static void BM_ADSR_Block_Float (benchmark::State& state) { runAdsr<float, true> (state); }
+BENCHMARK (BM_ADSR_Block_Float);
+
+static void BM_ADSR_Scalar_Double (benchmark::State& state) { runAdsr<double, false> (state); }
+BENCHMARK (BM_ADSR_Scalar_Double);
+
+static void BM_ADSR_Block_Double (benchmark::State& state) { runAdsr<double, true> (state); }
+BENCHMARK (BM_ADSR_Block_Double);
+
+/*******************************************************************************
+ * EnvelopeBank benchmarks
+ *
+ * 32 voices with staggered notes in 512-sample blocks: one ADSR per voice
+ * through renderBlock(), against one EnvelopeBank advancing all 32. Items
+ * are voice-samples.
+ ******************************************************************************/
+
+namespace
+{
+    constexpr std::size_t kVoices = 32;
+
+    /** Voice v's note starts (v * kNote / kVoices) samples into the cycle. */
+    bool startsNote (std::size_t v, int position)
+    {
+        return position == static_cast<int> (v) * (kNote / kBlock / static_cast<int> (kVoices)) * kBlock;
+    }
+
+    bool endsNote (std::size_t v, int position)
+    {
+        const int cycle = kNote / kBlock * kBlock;
+        return position == (static_cast<int> (v) * (kNote / kBlock / static_cast<int> (kVoices)) * kBlock + kHeld / kBlock * kBlock) % cycle;
+    }
+
+    template <typename FloatType>
+    void runAdsrVoices (benchmark::State& state)
+    {
+        std::vector<CASPI::Envelope::ADSR<FloatType>> envs (kVoices);
+        for (auto& env : envs)
+        {
+            env.setSampleRate (FloatType (48000));
+            env.setADSR (FloatType (0.01), FloatType (0.1), FloatType (0.5), FloatType (0.2));
+        }
+
+        std::vector<FloatType> out (kBlock * kVoices);
+        int                    position = 0;
+        for (auto _ : state)
+        {
+            for (std::size_t v = 0; v < kVoices; ++v)
+            {
+                if (startsNote (v, position))
+                    envs[v].noteOn();
+                else if (endsNote (v, position))
+                    envs[v].noteOff();
+                envs[v].renderBlock (out.data() + v * kBlock, kBlock);
+            }
+
+            benchmark::DoNotOptimize (out.data());
+            position = (position + kBlock) % (kNote / kBlock * kBlock);
+        }
+        state.SetItemsProcessed (state.iterations() * kBlock * static_cast<int64_t> (kVoices));
+    }
+
+    template <typename FloatType>
+    void runEnvelopeBank (benchmark::State& state)
+    {
+        using Bank = CASPI::Envelope::EnvelopeBank<FloatType, kVoices>;
+
+        auto bank = std::make_unique<Bank>();
+        bank->setSampleRate (FloatType (48000));
+        bank->setADSR (FloatType (0.01), FloatType (0.1), FloatType (0.5), FloatType (0.2));
+
+        std::vector<FloatType> out (kBlock * Bank::kStride);
+        int                    position = 0;
+        for (auto _ : state)
+        {
+            for (std::size_t v = 0; v < kVoices; ++v)
+            {
+                if (startsNote (v, position))
+                    bank->noteOn (v);
+                else if (endsNote (v, position))
+                    bank->noteOff (v);
+            }
+            bank->renderBlock (out.data(), kBlock);
+
+            benchmark::DoNotOptimize (out.data());
+            position = (position + kBlock) % (kNote / kBlock * kBlock);
+        }
+        state.SetItemsProcessed (state.iterations() * kBlock * static_cast<int64_t> (kVoices));
+    }
+} // namespace
+
+static void BM_ADSR_Voices_Float (benchmark::State& state) { runAdsrVoices<float> (state); }
+BENCHMARK (BM_ADSR_Voices_Float);
+
+static void BM_EnvelopeBank_Float (benchmark::State& state) { runEnvelopeBank<float> (state); }
+BENCHMARK (BM_EnvelopeBank_Float);
+
+static void BM_ADSR_Voices_Double (benchmark::State& state) { runAdsrVoices<double> (state); }
+BENCHMARK (BM_ADSR_Voices_Double);
+
+static void BM_EnvelopeBank_Double (benchmark::State& state) { runEnvelopeBank<double> (state); }
+BENCHMARK (BM_EnvelopeBank_Double);
+
+/*******************************************************************************
+ * MSEG benchmarks
+ *
+ * 32 staggered voices sharing one five-point table with four curved
+ * segments (0.6 s long), in 512-sample blocks. The scalar variant
+ * evaluates valueAt() per sample, with std::exp2 on every curved sample;
+ * the block variant renders each voice's playhead as vectorised spans.
+ * Items are voice-samples.
+ ******************************************************************************/
+
+namespace
+{
+    template <typename FloatType>
+    typename CASPI::Envelope::MsegTable<FloatType>::Ptr makeMsegTable()
+    {
+        using Point = CASPI::Envelope::MsegPoint<FloatType>;
+        return CASPI::Envelope::MsegTable<FloatType>::create ({ Point { FloatType (0), FloatType (0), FloatType (0) },
+                                                                Point { FloatType (0.01), FloatType (1), FloatType (-0.6) },
+                                                                Point { FloatType (0.15), FloatType (0.4), FloatType (0.5) },
+                                                                Point { FloatType (0.4), FloatType (0.7), FloatType (-0.3) },
+                                                                Point { FloatType (0.6), FloatType (0), FloatType (0.8) } })
+            .value();
+    }
+
+    template <typename FloatType>
+    void runMsegScalar (benchmark::State& state)
+    {
+        const auto table = makeMsegTable<FloatType>();
+        const auto dt    = 1.0 / 48000.0;
+
+        std::vector<double>    time (kVoices, 0.0);
+        std::vector<FloatType> out (kBlock * kVoices);
+        int                    position = 0;
+        for (auto _ : state)
+        {
+            for (std::size_t v = 0; v < kVoices; ++v)
+            {
+                if (startsNote (v, position))
+                    time[v] = 0.0;
+                auto* dst = out.data() + v * kBlock;
+                for (int i = 0; i < kBlock; ++i, time[v] += dt)
+                    dst[i] = table->valueAt (time[v]);
+            }
+
+            benchmark::DoNotOptimize (out.data());
+            position = (position + kBlock) % (kNote / kBlock * kBlock);
+        }
+        state.SetItemsProcessed (state.iterations() * kBlock * static_cast<int64_t> (kVoices));
+    }
+
+    template <typename FloatType>
+    void runMsegBlock (benchmark::State& state)
+    {
+        const auto table = makeMsegTable<FloatType>();
+
+        std::vector<CASPI::Envelope::MsegPlayhead> playheads (kVoices);
+        std::vector<FloatType>                     out (kBlock * kVoices);
+        int                                        position = 0;
+        for (auto _ : state)
+        {
+            for (std::size_t v = 0; v < kVoices; ++v)
+            {
+                if (startsNote (v, position))
+                    table->noteOn (playheads[v]);
+                table->render (playheads[v], out.data() + v * kBlock, kBlock, 48000.0);
+            }
+
+            benchmark::DoNotOptimize (out.data());
+            position = (position + kBlock) % (kNote / kBlock * kBlock);
+        }
+        state.SetItemsProcessed (state.iterations() * kBlock * static_cast<int64_t> (kVoices));
+    }
+} // namespace
+
+static void BM_MSEG_Scalar_Float (benchmark::State& state) { runMsegScalar<float> (state); }
+BENCHMARK (BM_MSEG_Scalar_Float);
+
+static void BM_MSEG_Block_Float (benchmark::State& state) { runMsegBlock<float> (state); }
+BENCHMARK (BM_MSEG_Block_Float);
+
+static void BM_MSEG_Scalar_Double (benchmark::State& state) { runMsegScalar<double> (state); }
+BENCHMARK (BM_MSEG_Scalar_Double);
+
+static void BM_MSEG_Block_Double (benchmark::State& state) { runMsegBlock<double> (state); }
+BENCHMARK (BM_MSEG_Block_Double);
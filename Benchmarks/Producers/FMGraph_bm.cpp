@@ -0,0 +1,221 @@
+/*******************************************************************************
+ * FMGraph benchmarks
+ *
+ * Renders the 32 classic DX7 6-operator algorithms (FMAlgorithms::Dx7) and
+ * compares the sample-major path (renderSample() per frame), the
+ * operator-major block renderer (renderBlock()), the compile-time unrolled
+ * FMAlgorithmDSP, and 16 independent voices against the polyphonic
+ * FMGraphPolyDSP.
+ ******************************************************************************/
+
+#include <benchmark/benchmark.h>
+#include "synthesizers/caspi_FMAlgorithm.h"
+#include "synthesizers/caspi_FMGraph.h"
+
+#include <array>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    constexpr double kSR    = 48000.0;
+    constexpr int    kBlock = 512;
+
+    template <typename Algorithm>
+    CASPI::FMGraphBuilder<float> makeBuilder()
+    {
+        constexpr auto& topology = Algorithm::topology;
+
+        CASPI::FMGraphBuilder<float> builder;
+        for (std::size_t op = 0; op < 6; ++op)
+        {
+            builder.addOperator();
+            (void) builder.configureOperator (op, 440.f * static_cast<float> (op + 1), 1.f, 1.f);
+        }
+
+        for (const auto& e : topology.edges)
+            (void) builder.connect (e.source, e.target, 1.5f);
+
+        (void) builder.setOutputOperators (std::vector<std::size_t> (topology.outputs.begin(), topology.outputs.end()));
+        return builder;
+    }
+
+    struct Dx7Entry
+    {
+        CASPI::FMGraphBuilder<float> (*makeBuilder)();
+        std::size_t feedbackOperator;
+    };
+
+    template <int... N>
+    std::array<Dx7Entry, sizeof...(N)> makeDx7Table (std::integer_sequence<int, N...>)
+    {
+        return { { Dx7Entry { &makeBuilder<CASPI::FMAlgorithms::Dx7<N + 1>>,
+                              CASPI::FMAlgorithms::Dx7<N + 1>::feedbackOperator }... } };
+    }
+
+    const Dx7Entry& dx7 (int algorithm)
+    {
+        static const auto table = makeDx7Table (std::make_integer_sequence<int, 32> {});
+        return table[static_cast<std::size_t> (algorithm - 1)];
+    }
+
+    CASPI::FMGraphBuilder<float> makeAlgorithmBuilder (int algorithm)
+    {
+        return dx7 (algorithm).makeBuilder();
+    }
+
+    CASPI::FMGraphDSP<float> buildAlgorithm (int algorithm)
+    {
+        auto dsp = std::move (makeAlgorithmBuilder (algorithm).compile (static_cast<float> (kSR))).value();
+        dsp.getOperator (dx7 (algorithm).feedbackOperator)->setModulationFeedback (0.5f);
+        return dsp;
+    }
+
+    constexpr std::size_t kPolyVoices = 16;
+
+    template <std::size_t MaxVoices>
+    CASPI::FMGraphPolyDSP<float, MaxVoices> buildPolyAlgorithm (int algorithm)
+    {
+        auto dsp = std::move (makeAlgorithmBuilder (algorithm).template compilePoly<MaxVoices> (static_cast<float> (kSR))).value();
+        dsp.setOperatorFeedback (dx7 (algorithm).feedbackOperator, 0.5f);
+        for (std::size_t op = 0; op < 6; ++op)
+            dsp.setOperatorRatio (op, static_cast<float> (op + 1));
+        return dsp;
+    }
+} // namespace
+
+static void BM_FMGraph_Dx7_SampleLoop512 (benchmark::State& state)
+{
+    auto dsp = buildAlgorithm (static_cast<int> (state.range (0)));
+    std::vector<float> buf (kBlock);
+    for (auto _ : state)
+    {
+        for (int i = 0; i < kBlock; ++i)
+            buf[static_cast<std::size_t> (i)] = dsp.renderSample();
+        benchmark::DoNotOptimize (buf.data());
+    }
+    state.SetItemsProcessed (state.iterations() * kBlock);
+}
+BENCHMARK (BM_FMGraph_Dx7_SampleLoop512)->DenseRange (1, 32);
+
+static void BM_FMGraph_Dx7_RenderBlock512 (benchmark::State& state)
+{
+    auto dsp = buildAlgorithm (static_cast<int> (state.range (0)));
+    std::vector<float> buf (kBlock);
+    for (auto _ : state)
+    {
+        dsp.renderBlock (buf.data(), kBlock);
+        benchmark::DoNotOptimize (buf.data());
+    }
+    state.SetItemsProcessed (state.iterations() * kBlock);
+}
+BENCHMARK (BM_FMGraph_Dx7_RenderBlock512)->DenseRange (1, 32);
+
+static void BM_FMGraph_Dx7_RenderBlock512_PolynomialSine (benchmark::State& state)
+{
+    auto dsp = buildAlgorithm (static_cast<int> (state.range (0)));
+    dsp.setSineEvaluation (CASPI::SineEvaluation::Polynomial);
+    std::vector<float> buf (kBlock);
+    for (auto _ : state)
+    {
+        dsp.renderBlock (buf.data(), kBlock);
+        benchmark::DoNotOptimize (buf.data());
+    }
+    state.SetItemsProcessed (state.iterations() * kBlock);
+}
+BENCHMARK (BM_FMGraph_Dx7_RenderBlock512_PolynomialSine)->DenseRange (1, 32);
+
+// Operators at 2x / 4x the host rate, decimated back by the halfband cascade.
+// Arg 0: algorithm; arg 1: oversampling factor.
+static void BM_FMGraph_Dx7_RenderBlock512_Oversampled (benchmark::State& state)
+{
+    auto dsp = buildAlgorithm (static_cast<int> (state.range (0)));
+    dsp.setOversampling (static_cast<CASPI::FMOversampling> (state.range (1)));
+    std::vector<float> buf (kBlock);
+    for (auto _ : state)
+    {
+        dsp.renderBlock (buf.data(), kBlock);
+        benchmark::DoNotOptimize (buf.data());
+    }
+    state.SetItemsProcessed (state.iterations() * kBlock);
+}
+BENCHMARK (BM_FMGraph_Dx7_RenderBlock512_Oversampled)->ArgsProduct ({ { 1, 5, 32 }, { 1, 2, 4 } });
+
+// Compile-time topology: same graph, selected through FMGraphBuilder::compileAs<>()
+
+namespace
+{
+    template <int N>
+    void runUnrolled512 (benchmark::State& state)
+    {
+        using Algorithm = CASPI::FMAlgorithms::Dx7<N>;
+
+        auto dsp = std::move (makeBuilder<Algorithm>().template compileAs<Algorithm> (static_cast<float> (kSR))).value();
+        dsp.getOperator (Algorithm::feedbackOperator)->setModulationFeedback (0.5f);
+
+        std::vector<float> buf (kBlock);
+        for (auto _ : state)
+        {
+            dsp.renderBlock (buf.data(), kBlock);
+            benchmark::DoNotOptimize (buf.data());
+        }
+        state.SetItemsProcessed (state.iterations() * kBlock);
+    }
+
+    template <int... N>
+    std::array<void (*) (benchmark::State&), sizeof...(N)> makeUnrolledTable (std::integer_sequence<int, N...>)
+    {
+        return { { &runUnrolled512<N + 1>... } };
+    }
+} // namespace
+
+static void BM_FMGraph_Dx7_Unrolled512 (benchmark::State& state)
+{
+    static const auto runners = makeUnrolledTable (std::make_integer_sequence<int, 32> {});
+    runners[static_cast<std::size_t> (state.range (0) - 1)](state);
+}
+BENCHMARK (BM_FMGraph_Dx7_Unrolled512)->DenseRange (1, 32);
+
+// 16 voices: one FMGraphDSP per voice vs. FMGraphPolyDSP with voices in SIMD lanes.
+// Items are voice-frames.
+
+static void BM_FMGraph_Dx7_Voices16_PerVoiceDSP (benchmark::State& state)
+{
+    std::vector<CASPI::FMGraphDSP<float>> voices;
+    for (std::size_t v = 0; v < kPolyVoices; ++v)
+    {
+        voices.push_back (buildAlgorithm (static_cast<int> (state.range (0))));
+        voices.back().setFrequency (110.f * static_cast<float> (v + 1));
+    }
+
+    std::vector<float> mix (kBlock);
+    std::vector<float> voiceBuf (kBlock);
+    for (auto _ : state)
+    {
+        std::fill (mix.begin(), mix.end(), 0.f);
+        for (auto& voice : voices)
+        {
+            voice.renderBlock (voiceBuf.data(), kBlock);
+            CASPI::SIMD::ops::add (mix.data(), voiceBuf.data(), kBlock);
+        }
+        benchmark::DoNotOptimize (mix.data());
+    }
+    state.SetItemsProcessed (state.iterations() * kBlock * static_cast<int64_t> (kPolyVoices));
+}
+BENCHMARK (BM_FMGraph_Dx7_Voices16_PerVoiceDSP)->Arg (1)->Arg (5)->Arg (32);
+
+static void BM_FMGraph_Dx7_Voices16_PolyDSP (benchmark::State& state)
+{
+    auto dsp = buildPolyAlgorithm<kPolyVoices> (static_cast<int> (state.range (0)));
+    for (std::size_t v = 0; v < kPolyVoices; ++v)
+        dsp.noteOn (v, 110.f * static_cast<float> (v + 1));
+
+    std::vector<float> buf (kBlock);
+    for (auto _ : state)
+    {
+        dsp.renderBlock (buf.data(), kBlock);
+        benchmark::DoNotOptimize (buf.data());
+    }
+    state.SetItemsProcessed (state.iterations() * kBlock * static_cast<int64_t> (kPolyVoices));
+}
+BENCHMARK (BM_FMGraph_Dx7_Voices16_PolyDSP)->Arg (1)->Arg (5)->Arg (32);
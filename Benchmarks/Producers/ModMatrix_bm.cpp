@@ -0,0 +1,248 @@
+/*******************************************************************************
+ * ModMatrix benchmarks
+ *
+ * 256 linear routings from 64 sources onto 64 parameters, 512-frame
+ * blocks. Items are routing-samples.
+ *
+ *   PerSampleProcess : audio-rate modulation the block-rate way, one
+ *                      setSourceValue() + process() per sample
+ *   AudioRate        : audio-rate routings, one process(512) per block
+ *                      with a source buffer per source
+ *   BlockRate        : the same routings at block rate, for scale
+ ******************************************************************************/
+
+#include <benchmark/benchmark.h>
+#include "controls/caspi_ModMatrix.h"
+#include "controls/caspi_PolyModMatrix.h"
+#include "core/caspi_Parameter.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t kFrames   = 512;
+    constexpr std::size_t kSources  = 64;
+    constexpr std::size_t kParams   = 64;
+    constexpr std::size_t kRoutings = 256;
+
+    struct Patch
+    {
+            std::unique_ptr<CASPI::Controls::ModMatrix<float>> matrix = std::make_unique<CASPI::Controls::ModMatrix<float>>();
+            std::vector<CASPI::Core::ModulatableParameter<float>> params { kParams };
+            std::vector<float> sources = std::vector<float> (kSources * kFrames);
+
+            explicit Patch (CASPI::Controls::ModulationRate rate)
+            {
+                for (auto& p : params)
+                    (void) matrix->registerParameter (&p);
+                matrix->setMaxBlockSize (kFrames);
+
+                for (std::size_t i = 0; i < kRoutings; ++i)
+                {
+                    CASPI::Controls::ModulationRouting<float> r (i % kSources, (i * 7) % kParams, 0.1f + 0.003f * static_cast<float> (i % 50));
+                    r.rate = rate;
+                    matrix->addRouting (r);
+                }
+                matrix->process();
+
+                for (std::size_t i = 0; i < sources.size(); ++i)
+                    sources[i] = static_cast<float> ((i * 37) % 101) / 101.f - 0.5f;
+            }
+    };
+} // namespace
+
+static void BM_ModMatrix_PerSampleProcess (benchmark::State& state)
+{
+    Patch patch (CASPI::Controls::ModulationRate::Block);
+    for (auto _ : state)
+    {
+        for (std::size_t t = 0; t < kFrames; ++t)
+        {
+            for (std::size_t s = 0; s < kSources; ++s)
+                patch.matrix->setSourceValue (s, patch.sources[s * kFrames + t]);
+            patch.matrix->process();
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (kFrames * kRoutings));
+}
+BENCHMARK (BM_ModMatrix_PerSampleProcess);
+
+static void BM_ModMatrix_AudioRate (benchmark::State& state)
+{
+    Patch patch (CASPI::Controls::ModulationRate::Audio);
+    for (auto _ : state)
+    {
+        for (std::size_t s = 0; s < kSources; ++s)
+            patch.matrix->setSourceBuffer (s, patch.sources.data() + s * kFrames);
+        patch.matrix->process (kFrames);
+        benchmark::DoNotOptimize (patch.matrix->getModulationBuffer (0));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (kFrames * kRoutings));
+}
+BENCHMARK (BM_ModMatrix_AudioRate);
+
+static void BM_ModMatrix_BlockRate (benchmark::State& state)
+{
+    Patch patch (CASPI::Controls::ModulationRate::Block);
+    for (auto _ : state)
+    {
+        patch.matrix->process();
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (kRoutings));
+}
+BENCHMARK (BM_ModMatrix_BlockRate);
+
+/*******************************************************************************
+ * PolyModMatrix benchmarks
+ *
+ * 16 voices, 128 routings from 32 per-voice sources onto 16 per-voice
+ * parameters, once per block: one ModMatrix per voice against one
+ * PolyModMatrix. Items are routing-voice evaluations.
+ ******************************************************************************/
+
+namespace
+{
+    constexpr std::size_t kVoices       = 16;
+    constexpr std::size_t kPolySources  = 32;
+    constexpr std::size_t kPolyParams   = 16;
+    constexpr std::size_t kPolyRoutings = 128;
+
+    CASPI::Controls::ModulationRouting<float> polyRouting (std::size_t i)
+    {
+        return { i % kPolySources, (i * 5) % kPolyParams, 0.05f + 0.007f * static_cast<float> (i % 40) };
+    }
+
+    float polySource (std::size_t s, std::size_t v)
+    {
+        return static_cast<float> ((s * 13 + v * 7) % 29) / 29.f - 0.5f;
+    }
+} // namespace
+
+static void BM_ModMatrix_PerVoice (benchmark::State& state)
+{
+    std::vector<std::unique_ptr<CASPI::Controls::ModMatrix<float>>> matrices;
+    std::vector<CASPI::Core::ModulatableParameter<float>> params (kVoices * kPolyParams);
+    for (std::size_t v = 0; v < kVoices; ++v)
+    {
+        matrices.push_back (std::make_unique<CASPI::Controls::ModMatrix<float>>());
+        for (std::size_t p = 0; p < kPolyParams; ++p)
+            (void) matrices[v]->registerParameter (&params[v * kPolyParams + p]);
+        for (std::size_t i = 0; i < kPolyRoutings; ++i)
+            matrices[v]->addRouting (polyRouting (i));
+        for (std::size_t s = 0; s < kPolySources; ++s)
+            matrices[v]->setSourceValue (s, polySource (s, v));
+    }
+
+    for (auto _ : state)
+    {
+        for (auto& m : matrices)
+            m->process();
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (kVoices * kPolyRoutings));
+}
+BENCHMARK (BM_ModMatrix_PerVoice);
+
+static void BM_PolyModMatrix (benchmark::State& state)
+{
+    using Matrix = CASPI::Controls::PolyModMatrix<float, kVoices>;
+
+    auto matrix = std::make_unique<Matrix>();
+    std::vector<CASPI::Core::ModulatableParameter<float>> params (kVoices * kPolyParams);
+    for (std::size_t p = 0; p < kPolyParams; ++p)
+    {
+        Matrix::VoiceParameters perVoice {};
+        for (std::size_t v = 0; v < kVoices; ++v)
+            perVoice[v] = &params[v * kPolyParams + p];
+        (void) matrix->registerVoiceParameter (perVoice);
+    }
+    for (std::size_t i = 0; i < kPolyRoutings; ++i)
+        matrix->addRouting (polyRouting (i));
+    for (std::size_t s = 0; s < kPolySources; ++s)
+        for (std::size_t v = 0; v < kVoices; ++v)
+            matrix->setSourceValue (s, v, polySource (s, v));
+
+    for (auto _ : state)
+    {
+        matrix->process();
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (kVoices * kPolyRoutings));
+}
+BENCHMARK (BM_PolyModMatrix);
+
+/*******************************************************************************
+ * Curved routing benchmarks
+ *
+ * 1024 routings cycling through Exponential, Logarithmic and SCurve, from
+ * 64 sources onto 64 parameters, once per block. The matrix evaluates
+ * them grouped by curve with SIMD; the scalar reference runs the same
+ * routing list through applyCurve() one routing at a time. Items are
+ * routings.
+ ******************************************************************************/
+
+namespace
+{
+    constexpr std::size_t kCurvedRoutings = 1024;
+
+    CASPI::Controls::ModulationRouting<float> curvedRouting (std::size_t i)
+    {
+        constexpr CASPI::Controls::ModulationCurve curves[] = { CASPI::Controls::ModulationCurve::Exponential,
+                                                                CASPI::Controls::ModulationCurve::Logarithmic,
+                                                                CASPI::Controls::ModulationCurve::SCurve };
+
+        CASPI::Controls::ModulationRouting<float> r ((i * 11) % kSources, (i * 7) % kParams, 0.01f + 0.0005f * static_cast<float> (i % 30));
+        r.curve = curves[i % 3];
+        return r;
+    }
+} // namespace
+
+static void BM_ModMatrix_MixedCurves (benchmark::State& state)
+{
+    Patch patch (CASPI::Controls::ModulationRate::Block);
+    patch.matrix->clearRoutings();
+    for (std::size_t i = 0; i < kCurvedRoutings; ++i)
+        patch.matrix->addRouting (curvedRouting (i));
+    for (std::size_t s = 0; s < kSources; ++s)
+        patch.matrix->setSourceValue (s, patch.sources[s * kFrames]);
+    patch.matrix->process();
+
+    for (auto _ : state)
+    {
+        patch.matrix->process();
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (kCurvedRoutings));
+}
+BENCHMARK (BM_ModMatrix_MixedCurves);
+
+static void BM_ModMatrix_MixedCurves_ScalarReference (benchmark::State& state)
+{
+    auto routings = std::make_unique<CASPI::Controls::RoutingList<float, CASPI::Controls::MAX_MOD_ROUTINGS>>();
+    for (std::size_t i = 0; i < kCurvedRoutings; ++i)
+        routings->insert (curvedRouting (i));
+
+    std::vector<float> sources (kSources);
+    for (std::size_t s = 0; s < kSources; ++s)
+        sources[s] = static_cast<float> ((s * 37) % 101) / 101.f - 0.5f;
+    std::vector<float> accum (kParams);
+
+    for (auto _ : state)
+    {
+        std::fill (accum.begin(), accum.end(), 0.f);
+        for (const auto& r : *routings)
+        {
+            if (r.enabled)
+                accum[r.destinationId] += r.applyCurve (sources[r.sourceId]) * r.depth;
+        }
+        benchmark::DoNotOptimize (accum.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (kCurvedRoutings));
+}
+BENCHMARK (BM_ModMatrix_MixedCurves_ScalarReference);
@@ -3,7 +3,14 @@
  ******************************************************************************/
 
 #include <benchmark/benchmark.h>
+#include "oscillators/caspi_AdditiveOscillator.h"
 #include "oscillators/caspi_BlepOscillator.h"
+#include "oscillators/caspi_BlepOscillatorBank.h"
+#include "oscillators/caspi_LFO.h"
+#include "oscillators/caspi_Noise.h"
+#include "oscillators/caspi_WavetableOscillator.h"
+
+#include <memory>
 
 static constexpr float kSR        = 44100.f;
 static constexpr float kFreq      = 440.f;
@@ -73,6 +80,23 @@ static void BM_Triangle_renderBlock512 (benchmark::State& state)
 }
 BENCHMARK (BM_Triangle_renderBlock512);
 
+/* Band-limited step: 2-point polynomial vs tabulated windowed sinc, at Arg Hz */
+
+template <CASPI::Oscillators::BlepMode Mode>
+static void BM_Saw_renderBlock512_Blep (benchmark::State& state)
+{
+    auto osc = CASPI::Oscillators::BlepOscillator<float> (CASPI::Oscillators::WaveShape::Saw, kSR, static_cast<float> (state.range (0)));
+    osc.setBlepMode (Mode);
+    std::vector<float> buf (kBlock);
+    for (auto _ : state)
+    {
+        osc.renderBlock (buf.data(), kBlock);
+        benchmark::DoNotOptimize (buf.data());
+    }
+}
+BENCHMARK_TEMPLATE (BM_Saw_renderBlock512_Blep, CASPI::Oscillators::BlepMode::PolyBlep)->Arg (110)->Arg (440)->Arg (2500)->Arg (10000);
+BENCHMARK_TEMPLATE (BM_Saw_renderBlock512_Blep, CASPI::Oscillators::BlepMode::SincBlep)->Arg (110)->Arg (440)->Arg (2500)->Arg (10000);
+
 /* Naive baselines for throughput comparison */
 
 static void BM_NaiveSaw_renderBlock512 (benchmark::State& state)
@@ -109,4 +133,232 @@ static void BM_NaiveSquare_renderBlock512 (benchmark::State& state)
         benchmark::DoNotOptimize (buf.data());
     }
 }
-BENCHMARK (BM_NaiveSquare_renderBlock512);
\ No newline at end of file
+BENCHMARK (BM_NaiveSquare_renderBlock512);
+
+/* Unison saw into stereo: one BlepOscillatorBank vs N panned BlepOscillators */
+
+static void BM_Unison_Bank_renderBlock512 (benchmark::State& state)
+{
+    const auto voices = static_cast<std::size_t> (state.range (0));
+
+    CASPI::Oscillators::BlepOscillatorBank<float> bank (CASPI::Oscillators::WaveShape::Saw, kSR, kFreq, voices);
+    bank.setDetune (25.f);
+    bank.setStereoSpread (0.8f);
+
+    std::vector<float> left (kBlock), right (kBlock);
+    for (auto _ : state)
+    {
+        bank.renderBlock (left.data(), right.data(), kBlock);
+        benchmark::DoNotOptimize (left.data());
+        benchmark::DoNotOptimize (right.data());
+    }
+}
+BENCHMARK (BM_Unison_Bank_renderBlock512)->Arg (1)->Arg (7)->Arg (16);
+
+static void BM_Unison_Scalar_renderBlock512 (benchmark::State& state)
+{
+    using Osc         = CASPI::Oscillators::BlepOscillator<float>;
+    const auto voices = static_cast<std::size_t> (state.range (0));
+
+    std::vector<std::unique_ptr<Osc>> oscs;
+    std::vector<float> gainsLeft, gainsRight;
+    for (std::size_t k = 0; k < voices; ++k)
+    {
+        const float offset = voices > 1 ? 2.f * static_cast<float> (k) / static_cast<float> (voices - 1) - 1.f : 0.f;
+        const float angle  = (0.8f * offset + 1.f) * CASPI::Constants::PI<float> * 0.25f;
+        oscs.push_back (std::make_unique<Osc> (CASPI::Oscillators::WaveShape::Saw, kSR, kFreq * std::exp2 (25.f * offset / 1200.f)));
+        gainsLeft.push_back (std::cos (angle) / std::sqrt (static_cast<float> (voices)));
+        gainsRight.push_back (std::sin (angle) / std::sqrt (static_cast<float> (voices)));
+    }
+
+    std::vector<float> left (kBlock), right (kBlock), voice (kBlock);
+    for (auto _ : state)
+    {
+        std::fill (left.begin(), left.end(), 0.f);
+        std::fill (right.begin(), right.end(), 0.f);
+        for (std::size_t k = 0; k < voices; ++k)
+        {
+            oscs[k]->renderBlock (voice.data(), kBlock);
+            for (std::size_t i = 0; i < voice.size(); ++i)
+            {
+                left[i]  += voice[i] * gainsLeft[k];
+                right[i] += voice[i] * gainsRight[k];
+            }
+        }
+        benchmark::DoNotOptimize (left.data());
+        benchmark::DoNotOptimize (right.data());
+    }
+}
+BENCHMARK (BM_Unison_Scalar_renderBlock512)->Arg (1)->Arg (7)->Arg (16);
+
+/* Wavetable: SIMD renderBlock vs the scalar reference loop, 4-table morph */
+
+template <std::size_t TableSize>
+struct WavetableFixture
+{
+    using Bank = CASPI::Oscillators::WaveTableBank<float, TableSize, 4>;
+    using Osc  = CASPI::Oscillators::WavetableOscillator<float, TableSize, 4>;
+
+    explicit WavetableFixture (CASPI::Oscillators::InterpolationMode mode)
+        : bank (std::make_unique<Bank>())
+    {
+        (*bank)[0].fillSine();
+        (*bank)[1].fillSaw();
+        (*bank)[2].fillTriangle();
+        (*bank)[3].fillSine();
+        osc = std::make_unique<Osc> (*bank, kSR, kFreq);
+        osc->setMorphPosition (0.4f);
+        osc->setInterpolationMode (mode);
+    }
+
+    std::unique_ptr<Bank> bank;
+    std::unique_ptr<Osc>  osc;
+    std::vector<float>    buf = std::vector<float> (kBlock);
+};
+
+template <std::size_t TableSize, CASPI::Oscillators::InterpolationMode Mode>
+static void BM_Wavetable_renderBlockScalar512 (benchmark::State& state)
+{
+    WavetableFixture<TableSize> f (Mode);
+    for (auto _ : state)
+    {
+        f.osc->renderBlockScalar (f.buf.data(), kBlock);
+        benchmark::DoNotOptimize (f.buf.data());
+    }
+}
+
+template <std::size_t TableSize, CASPI::Oscillators::InterpolationMode Mode>
+static void BM_Wavetable_renderBlock512 (benchmark::State& state)
+{
+    WavetableFixture<TableSize> f (Mode);
+    for (auto _ : state)
+    {
+        f.osc->renderBlock (f.buf.data(), kBlock);
+        benchmark::DoNotOptimize (f.buf.data());
+    }
+}
+
+#define CASPI_WAVETABLE_BM(size)                                                                                 \
+    BENCHMARK_TEMPLATE (BM_Wavetable_renderBlockScalar512, size, CASPI::Oscillators::InterpolationMode::Linear);  \
+    BENCHMARK_TEMPLATE (BM_Wavetable_renderBlock512, size, CASPI::Oscillators::InterpolationMode::Linear);        \
+    BENCHMARK_TEMPLATE (BM_Wavetable_renderBlockScalar512, size, CASPI::Oscillators::InterpolationMode::Hermite); \
+    BENCHMARK_TEMPLATE (BM_Wavetable_renderBlock512, size, CASPI::Oscillators::InterpolationMode::Hermite)
+
+CASPI_WAVETABLE_BM (256);
+CASPI_WAVETABLE_BM (1024);
+CASPI_WAVETABLE_BM (2048);
+CASPI_WAVETABLE_BM (4096);
+
+/* LFO: renderSample() loop vs SIMD renderBlock(), Arg = LfoShape */
+
+static void BM_LFO_renderSampleLoop512 (benchmark::State& state)
+{
+    CASPI::Oscillators::LFO<float> lfo (kSR, 5.f, static_cast<CASPI::Oscillators::LfoShape> (state.range (0)));
+    std::vector<float> buf (kBlock);
+    for (auto _ : state)
+    {
+        for (int i = 0; i < kBlock; ++i)
+            buf[static_cast<std::size_t> (i)] = lfo.renderSample();
+        benchmark::DoNotOptimize (buf.data());
+    }
+}
+BENCHMARK (BM_LFO_renderSampleLoop512)->DenseRange (0, 4);
+
+static void BM_LFO_renderBlock512 (benchmark::State& state)
+{
+    CASPI::Oscillators::LFO<float> lfo (kSR, 5.f, static_cast<CASPI::Oscillators::LfoShape> (state.range (0)));
+    std::vector<float> buf (kBlock);
+    for (auto _ : state)
+    {
+        lfo.renderBlock (buf.data(), kBlock);
+        benchmark::DoNotOptimize (buf.data());
+    }
+}
+BENCHMARK (BM_LFO_renderBlock512)->DenseRange (0, 4);
+
+/* Noise: one serial xoshiro128+ stream vs the 8-lane engine, bytes/s = output throughput */
+
+static void BM_Noise_scalarXoshiro512 (benchmark::State& state)
+{
+    CASPI::Oscillators::detail::Xoshiro128Plus rng;
+    rng.seed (1);
+    std::vector<float> buf (kBlock);
+    for (auto _ : state)
+    {
+        for (int i = 0; i < kBlock; ++i)
+            buf[static_cast<std::size_t> (i)] = static_cast<float> (static_cast<int32_t> (rng.next())) * (1.f / 2147483648.f);
+        benchmark::DoNotOptimize (buf.data());
+    }
+    state.SetBytesProcessed (state.iterations() * kBlock * static_cast<int64_t> (sizeof (float)));
+}
+BENCHMARK (BM_Noise_scalarXoshiro512);
+
+template <CASPI::Oscillators::NoiseAlgorithm Algo>
+static void BM_Noise_renderBlock512 (benchmark::State& state)
+{
+    CASPI::Oscillators::NoiseOscillator<float, Algo> osc (kSR);
+    osc.seed (1);
+    std::vector<float> buf (kBlock);
+    for (auto _ : state)
+    {
+        osc.renderBlock (buf.data(), kBlock);
+        benchmark::DoNotOptimize (buf.data());
+    }
+    state.SetBytesProcessed (state.iterations() * kBlock * static_cast<int64_t> (sizeof (float)));
+}
+BENCHMARK_TEMPLATE (BM_Noise_renderBlock512, CASPI::Oscillators::NoiseAlgorithm::White);
+BENCHMARK_TEMPLATE (BM_Noise_renderBlock512, CASPI::Oscillators::NoiseAlgorithm::Pink);
+BENCHMARK_TEMPLATE (BM_Noise_renderBlock512, CASPI::Oscillators::NoiseAlgorithm::VossMcCartney);
+
+/* Additive: SIMD rotation bank vs one std::sin per partial per sample.
+ * items_per_second is partial-samples per second on one core. */
+
+static void BM_Additive_renderBlock512 (benchmark::State& state)
+{
+    const auto partials = static_cast<std::size_t> (state.range (0));
+
+    auto osc = std::make_unique<CASPI::Oscillators::AdditiveOscillator<float, 4096>> (kSR);
+    for (std::size_t k = 0; k < partials; ++k)
+        osc->setPartial (k, 5.f + 5.f * static_cast<float> (k), 1.f / static_cast<float> (k + 1));
+
+    std::vector<float> out (kBlock);
+    for (auto _ : state)
+    {
+        osc->renderBlock (out.data(), kBlock);
+        benchmark::DoNotOptimize (out.data());
+    }
+    state.SetItemsProcessed (static_cast<int64_t> (state.iterations()) * kBlock * static_cast<int64_t> (partials));
+}
+BENCHMARK (BM_Additive_renderBlock512)->Arg (64)->Arg (512)->Arg (4096);
+
+static void BM_Additive_sinLoop512 (benchmark::State& state)
+{
+    const auto partials = static_cast<std::size_t> (state.range (0));
+
+    std::vector<float> phases (partials, 0.f), increments (partials), amps (partials);
+    for (std::size_t k = 0; k < partials; ++k)
+    {
+        increments[k] = (5.f + 5.f * static_cast<float> (k)) / kSR;
+        amps[k]       = 1.f / static_cast<float> (k + 1);
+    }
+
+    std::vector<float> out (kBlock);
+    for (auto _ : state)
+    {
+        std::fill (out.begin(), out.end(), 0.f);
+        for (std::size_t k = 0; k < partials; ++k)
+        {
+            float p = phases[k];
+            for (int i = 0; i < kBlock; ++i)
+            {
+                out[static_cast<std::size_t> (i)] += amps[k] * std::sin (CASPI::Constants::TWO_PI<float> * p);
+                p += increments[k];
+                p -= std::floor (p);
+            }
+            phases[k] = p;
+        }
+        benchmark::DoNotOptimize (out.data());
+    }
+    state.SetItemsProcessed (static_cast<int64_t> (state.iterations()) * kBlock * static_cast<int64_t> (partials));
+}
+BENCHMARK (BM_Additive_sinLoop512)->Arg (64)->Arg (512);
@@ -0,0 +1,152 @@
+/*******************************************************************************
+ * StreamingSampler benchmarks
+ *
+ * 128 voices at pitch ratios spread around 1, rendered in 512-sample blocks
+ * while the background I/O thread streams from synthetic float32 files.
+ * Voices that reach the end of their sample are retriggered. The
+ * "underruns" counter reports starved voice-frames per iteration; it should
+ * stay 0 when the files are in the page cache. The resident variant gives
+ * every sample a head covering the whole file, so it measures the cubic
+ * gather alone.
+ *
+ * Granulator benchmarks spawn 1k-20k grains per second of 50 ms each, so
+ * 50-1000 grains overlap. The pitched variant spreads grains over ±12
+ * semitones (gathered, interpolated reads); the unity variant keeps every
+ * grain at rate 1 (contiguous loads). "grains/s" is grains spawned per
+ * second of CPU time, and "xRealtime" is seconds of audio per second.
+ ******************************************************************************/
+
+#include <benchmark/benchmark.h>
+#include "samplers/caspi_Granulator.h"
+#include "samplers/caspi_StreamingSampler.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr float       kSR       = 48000.f;
+    constexpr int         kBlock    = 512;
+    constexpr std::size_t kVoices   = 128;
+    constexpr std::size_t kFiles    = 16;
+    constexpr std::size_t kFrames   = 480000; // 10 s per file
+
+    using Sampler = CASPI::Samplers::StreamingSampler<float, kVoices>;
+    using Sample  = Sampler::Sample;
+
+    std::vector<Sample::Ptr> openSampleSet (std::size_t headFrames)
+    {
+        std::vector<Sample::Ptr> set;
+        std::vector<float>       data (kFrames);
+
+        for (std::size_t f = 0; f < kFiles; ++f)
+        {
+            const auto path = (std::filesystem::temp_directory_path() / ("caspi_sampler_bm_" + std::to_string (f) + ".f32")).string();
+
+            for (std::size_t i = 0; i < kFrames; ++i)
+                data[i] = 0.25f * std::sin (0.001f * static_cast<float> ((f + 1) * i));
+
+            std::FILE* file = std::fopen (path.c_str(), "wb");
+            std::fwrite (data.data(), sizeof (float), data.size(), file);
+            std::fclose (file);
+
+            set.push_back (Sample::open (path, kSR, headFrames).value());
+        }
+        return set;
+    }
+
+    void runSampler (benchmark::State& state, std::size_t headFrames)
+    {
+        auto sampler = std::make_unique<Sampler> (kSR);
+        for (auto& sample : openSampleSet (headFrames))
+            sampler->addSample (sample);
+
+        sampler->startStreaming (std::chrono::microseconds (200));
+
+        auto trigger = [&] (std::size_t v)
+        {
+            const float ratio = 0.9f + 0.2f * static_cast<float> (v) / static_cast<float> (kVoices);
+            sampler->noteOn (v % kFiles, ratio, 1.f / kVoices);
+        };
+        for (std::size_t v = 0; v < kVoices; ++v)
+            trigger (v);
+
+        std::vector<float> out (kBlock);
+        sampler->resetStatistics();
+
+        for (auto _ : state)
+        {
+            sampler->renderBlock (out.data(), kBlock);
+            benchmark::DoNotOptimize (out.data());
+
+            for (std::size_t v = sampler->getNumActiveVoices(); v < kVoices; ++v)
+                trigger (v);
+        }
+
+        sampler->stopStreaming();
+
+        state.SetItemsProcessed (state.iterations() * kBlock * static_cast<std::int64_t> (kVoices));
+        state.counters["underruns"] = benchmark::Counter (static_cast<double> (sampler->getUnderrunFrames()),
+                                                          benchmark::Counter::kAvgIterations);
+    }
+} // namespace
+
+static void BM_StreamingSampler_128Voices (benchmark::State& state)
+{
+    runSampler (state, 9600); // 200 ms heads
+}
+BENCHMARK (BM_StreamingSampler_128Voices)->UseRealTime();
+
+static void BM_StreamingSampler_128VoicesResident (benchmark::State& state)
+{
+    runSampler (state, kFrames);
+}
+BENCHMARK (BM_StreamingSampler_128VoicesResident)->UseRealTime();
+
+static void runGranulator (benchmark::State& state, float pitchSpread)
+{
+    const auto density = static_cast<float> (state.range (0));
+
+    std::vector<float> source (kFrames);
+    for (std::size_t i = 0; i < kFrames; ++i)
+        source[i] = 0.25f * std::sin (0.001f * static_cast<float> (i));
+
+    auto cloud = std::make_unique<CASPI::Samplers::Granulator<float, 1024>> (kSR);
+    cloud->setSource (source.data(), source.size(), kSR);
+    cloud->setDensity (density);
+    cloud->setGrainSize (50.f);
+    cloud->setPosition (0.5f);
+    cloud->setPositionSpread (0.4f);
+    cloud->setPitchSpread (pitchSpread);
+    cloud->setPanSpread (1.f);
+
+    std::vector<float> left (kBlock), right (kBlock);
+    for (auto _ : state)
+    {
+        cloud->renderBlock (left.data(), right.data(), kBlock);
+        benchmark::DoNotOptimize (left.data());
+        benchmark::DoNotOptimize (right.data());
+    }
+
+    const double seconds        = static_cast<double> (kBlock) / static_cast<double> (kSR);
+    state.counters["grains/s"]  = benchmark::Counter (density * seconds, benchmark::Counter::kIsIterationInvariantRate);
+    state.counters["xRealtime"] = benchmark::Counter (seconds, benchmark::Counter::kIsIterationInvariantRate);
+    state.counters["dropped"]   = static_cast<double> (cloud->getDroppedGrains());
+}
+
+static void BM_Granulator_pitched (benchmark::State& state)
+{
+    runGranulator (state, 12.f);
+}
+BENCHMARK (BM_Granulator_pitched)->Arg (1000)->Arg (5000)->Arg (20000);
+
+static void BM_Granulator_unity (benchmark::State& state)
+{
+    runGranulator (state, 0.f);
+}
+BENCHMARK (BM_Granulator_unity)->Arg (1000)->Arg (5000)->Arg (20000);
@@ -28,6 +28,7 @@ Y88b  d88P 888  888      X88 888 d88P 888
 *   - store: Auto-detects alignment
 *   - stream_store: Non-temporal (streaming) stores for large buffers
 *   - store_fence: Memory fence for ensuring NT stores complete
+*   - gather: Indexed table loads (AVX2 hardware gather, scalar otherwise)
 *
 *
 * USAGE EXAMPLES
@@ -78,6 +79,7 @@ Y88b  d88P 888  888      X88 888 d88P 888
 
 #include "caspi_Strategy.h"
 
+#include <cstdint>
 #include <cstring>
 
 namespace CASPI
@@ -443,6 +445,70 @@ namespace CASPI
         {
 #if defined(CASPI_HAS_SSE)
             _mm_sfence();
+#endif
+        }
+
+        /**
+         * @brief Gather float lanes from a table: r[i] = base[int(index[i]) & mask].
+         *
+         * Each lane of @p index is truncated to int32 and ANDed with @p mask,
+         * so a power-of-two table wraps for free, including index −1, which
+         * becomes N − 1. Pass mask = −1 to disable wrapping.
+         *
+         * Uses _mm_i32gather_ps under AVX2; otherwise the indices are
+         * extracted and each lane is loaded separately.
+         *
+         * @param base       Table base pointer
+         * @param index      Integral-valued lane indices (e.g. floor of a position)
+         * @param mask       Index mask, typically TableSize − 1
+         * @return           Gathered vector
+         *
+         * @code
+         * float32x4 i0 = floor(mul(phase, set1<float>(2048.f)));
+         * float32x4 y0 = gather(table, i0, 2047);
+         * float32x4 y1 = gather(table, add(i0, set1<float>(1.f)), 2047);
+         * @endcode
+         */
+        inline float32x4 gather (const float* base, float32x4 index, std::int32_t mask = -1) noexcept
+        {
+#if defined(CASPI_HAS_AVX2)
+            const __m128i i = _mm_and_si128 (_mm_cvttps_epi32 (index), _mm_set1_epi32 (mask));
+            return _mm_i32gather_ps (base, i, 4);
+#elif defined(CASPI_HAS_SSE2)
+            alignas (16) std::int32_t i[4];
+            _mm_store_si128 (reinterpret_cast<__m128i*> (i),
+                             _mm_and_si128 (_mm_cvttps_epi32 (index), _mm_set1_epi32 (mask)));
+            return _mm_setr_ps (base[i[0]], base[i[1]], base[i[2]], base[i[3]]);
+#else
+            alignas (16) float lanes[4];
+            store_aligned (lanes, index);
+            for (int k = 0; k < 4; ++k)
+                lanes[k] = base[static_cast<std::int32_t> (lanes[k]) & mask];
+            return load_aligned<float> (lanes);
+#endif
+        }
+
+        /**
+         * @brief Gather double lanes from a table: r[i] = base[int(index[i]) & mask].
+         *
+         * Double-precision counterpart of gather(const float*, float32x4, int32_t).
+         */
+        inline float64x2 gather (const double* base, float64x2 index, std::int32_t mask = -1) noexcept
+        {
+#if defined(CASPI_HAS_AVX2)
+            const __m128i i = _mm_and_si128 (_mm_cvttpd_epi32 (index), _mm_set1_epi32 (mask));
+            return _mm_i32gather_pd (base, i, 8);
+#elif defined(CASPI_HAS_SSE2)
+            alignas (16) std::int32_t i[4];
+            _mm_store_si128 (reinterpret_cast<__m128i*> (i),
+                             _mm_and_si128 (_mm_cvttpd_epi32 (index), _mm_set1_epi32 (mask)));
+            return _mm_setr_pd (base[i[0]], base[i[1]]);
+#else
+            alignas (16) double lanes[2];
+            store_aligned (lanes, index);
+            for (int k = 0; k < 2; ++k)
+                lanes[k] = base[static_cast<std::int32_t> (lanes[k]) & mask];
+            return load_aligned<double> (lanes);
 #endif
         }
     } // namespace SIMD
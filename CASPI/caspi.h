@@ -20,6 +20,7 @@
 #include "core/caspi_Expected.h"
 #include "core/caspi_Phase.h"
 #include "core/caspi_Parameter.h"
+#include "core/caspi_SnapshotPublisher.h"
 
 // External dependencies
 #include "external/caspi_External.h"
@@ -30,23 +31,40 @@
 
 // oscillators
 #include "oscillators/caspi_BlepOscillator.h"
+#include "oscillators/caspi_BlepOscillatorBank.h"
+#include "oscillators/caspi_AdditiveOscillator.h"
 #include "oscillators/caspi_Operator.h"
-#include "oscillators/caspi_WaveTableOscillator.h"
+#include "oscillators/caspi_WavetableOscillator.h"
+#include "oscillators/caspi_WavetableFile.h"
 #include "oscillators/caspi_LFO.h"
 #include "oscillators/caspi_Noise.h"
 
+// Samplers
+#include "samplers/caspi_StreamedSample.h"
+#include "samplers/caspi_StreamingSampler.h"
+#include "samplers/caspi_Granulator.h"
+
 // Filters
 #include "filters/caspi_OnePoleFilter.h"
 #include "filters/caspi_SvfFilter.h"
 
+// Physical modelling
+#include "physical/caspi_FractionalDelayLine.h"
+#include "physical/caspi_ModalResonatorBank.h"
+#include "physical/caspi_Waveguide.h"
+
 // Gain
 #include "gain/caspi_Gain.h"
 
 // Envelopes
 #include "controls/caspi_Envelope.h"
+#include "controls/caspi_EnvelopeBank.h"
+#include "controls/caspi_MSEG.h"
 #include "controls/caspi_ModMatrix.h"
+#include "controls/caspi_PolyModMatrix.h"
 
 // Synthesizers
 #include "synthesizers/caspi_FMGraph.h"
+#include "synthesizers/caspi_FMAlgorithm.h"
 
 #endif // CASPI_H
\ No newline at end of file
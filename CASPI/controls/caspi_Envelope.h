@@ -21,8 +21,10 @@ Y88b  d88P 888  888      X88 888 d88P 888
 #define CASPI_ENVELOPEGENERATOR_H
 
 #include "base/caspi_Assert.h"
+#include "base/caspi_SIMD.h"
 #include "core/caspi_AudioBuffer.h"
 #include "core/caspi_Producer.h"
+#include <algorithm>
 #include <cmath>
 #include <string>
 namespace CASPI
@@ -242,6 +244,33 @@ namespace CASPI
                     return level;
                 }
 
+                /**
+                 * @brief Render numSamples envelope samples; matches repeated render().
+                 *
+                 * Within one stage the recurrence level = c * level + o is a
+                 * geometric series, so the block is rendered stage by stage:
+                 * the number of samples left before the next transition is
+                 * solved in closed form, that run is filled with a SIMD kernel
+                 * (sample j of a group is c^j * level + o (1 + c + ... + c^(j-1))),
+                 * and the transition itself goes through the scalar render().
+                 * Results agree with render() to rounding.
+                 *
+                 * @param output      At least numSamples elements.
+                 * @param numSamples  Number of samples.
+                 */
+                void renderBlock (FloatType* CASPI_RESTRICT output, int numSamples) noexcept CASPI_NON_BLOCKING
+                {
+                    CASPI_ASSERT (output != nullptr || numSamples <= 0, "Output buffer must not be null");
+
+                    const auto n = static_cast<std::size_t> (std::max (numSamples, 0));
+                    for (std::size_t done = 0; done < n;)
+                    {
+                        done += renderRun (output + done, std::min (n - done, samplesBeforeTransition()));
+                        if (done < n)
+                            output[done++] = render();
+                    }
+                }
+
                 // *********************************************************************************************
                 // Observers
                 // *********************************************************************************************
@@ -345,6 +374,22 @@ namespace CASPI
                     return render();
                 }
 
+                /**
+                 * @brief Graph dispatch: renderBlock() into the mono output
+                 *        buffer; consumers broadcast it.
+                 */
+                void processImpl (Graph::AudioContext<FloatType>& ctx) noexcept CASPI_NON_BLOCKING
+                {
+                    (void) ctx;
+
+                    auto&             buffer = this->outputBuffer;
+                    const std::size_t frames = buffer.numFrames();
+                    if (buffer.numChannels() == 0 || frames == 0)
+                        return;
+
+                    renderBlock (buffer.channelData (0), static_cast<int> (frames));
+                }
+
             private:
                 // *********************************************************************************************
                 // State machine
@@ -403,6 +448,135 @@ namespace CASPI
                     }
                 }
 
+                // *********************************************************************************************
+                // Block rendering
+                // *********************************************************************************************
+
+                using simd_type = typename SIMD::Strategy::simd_type<FloatType, SIMD::Strategy::min_simd_width<FloatType>::value>::type;
+
+                static constexpr std::size_t kLanes = SIMD::Strategy::min_simd_width<FloatType>::value;
+
+                /** @brief True once `value` would end the current stage; mirrors advanceState(). */
+                bool crosses (FloatType value) const noexcept
+                {
+                    switch (state)
+                    {
+                        case State::attack:
+                            return value + target >= parameters.two;
+                        case State::decay:
+                            return value <= target;
+                        case State::release:
+                            return value <= parameters.zero;
+                        default:
+                            return false;
+                    }
+                }
+
+                /**
+                 * @brief Updates that leave the current stage unchanged.
+                 *
+                 * Level k samples on is L + c^k (level - L) with L = o / (1 - c);
+                 * the first k reaching the stage threshold T is
+                 * ceil(log((T - L) / (level - L)) / log c). Sustain and idle
+                 * never end on their own.
+                 */
+                std::size_t samplesBeforeTransition() const noexcept
+                {
+                    constexpr auto unbounded = static_cast<std::size_t> (-1);
+
+                    double threshold;
+                    switch (state)
+                    {
+                        case State::attack:
+                            threshold = static_cast<double> (parameters.two - target);
+                            break;
+                        case State::decay:
+                            threshold = static_cast<double> (target);
+                            break;
+                        case State::release:
+                            threshold = 0.0;
+                            break;
+                        default:
+                            return unbounded;
+                    }
+
+                    const double c = static_cast<double> (coefficient);
+                    if (! (c > 0.0 && c < 1.0))
+                        return 0;
+
+                    const double fixedPoint = static_cast<double> (offset) / (1.0 - c);
+                    const double ratio      = (threshold - fixedPoint) / (static_cast<double> (level) - fixedPoint);
+                    if (! (ratio > 0.0 && ratio < 1.0))
+                        return 0;
+
+                    const double updates = std::ceil (std::log (ratio) / std::log (c));
+                    return updates > 1.0 ? static_cast<std::size_t> (updates) - 1 : 0;
+                }
+
+                /**
+                 * @brief SIMD geometric-series fill of up to @p count samples
+                 *        within the current stage.
+                 *
+                 * Writes whole SIMD groups only, and stops early if rounding
+                 * brings the stage threshold forward; the caller finishes with
+                 * render(). The level carried between groups is computed in
+                 * scalar from the same powers, so it tracks the last lane to
+                 * rounding.
+                 *
+                 * @return Samples written.
+                 */
+                std::size_t renderRun (FloatType* CASPI_RESTRICT output, std::size_t count) noexcept
+                {
+                    if (count < kLanes)
+                        return 0;
+
+                    // Lane j holds c^(j+1) and o (1 + c + ... + c^j)
+                    alignas (16) FloatType powers[kLanes];
+                    alignas (16) FloatType sums[kLanes];
+                    powers[0] = coefficient;
+                    sums[0]   = offset;
+                    for (std::size_t j = 1; j < kLanes; ++j)
+                    {
+                        powers[j] = powers[j - 1] * coefficient;
+                        sums[j]   = sums[j - 1] * coefficient + offset;
+                    }
+
+                    const simd_type p     = SIMD::load_aligned<FloatType> (powers);
+                    const simd_type q     = SIMD::load_aligned<FloatType> (sums);
+                    const FloatType pLast = powers[kLanes - 1];
+                    const FloatType qLast = sums[kLanes - 1];
+                    const FloatType pTwo  = pLast * pLast;
+                    const FloatType qTwo  = qLast * pLast + qLast;
+
+                    FloatType   x = level;
+                    std::size_t t = 0;
+
+                    // Two groups per step from one carry: the carry chain is the bottleneck
+                    for (; t + 2 * kLanes <= count; t += 2 * kLanes)
+                    {
+                        const FloatType mid  = pLast * x + qLast;
+                        const FloatType next = pTwo * x + qTwo;
+                        if (crosses (next))
+                            break;
+
+                        SIMD::store_unaligned (output + t, SIMD::mul_add (p, SIMD::set1<FloatType> (x), q));
+                        SIMD::store_unaligned (output + t + kLanes, SIMD::mul_add (p, SIMD::set1<FloatType> (mid), q));
+                        x = next;
+                    }
+                    for (; t + kLanes <= count; t += kLanes)
+                    {
+                        const FloatType next = pLast * x + qLast;
+                        if (crosses (next))
+                            break;
+
+                        SIMD::store_unaligned (output + t, SIMD::mul_add (p, SIMD::set1<FloatType> (x), q));
+                        x = next;
+                    }
+
+                    level = x;
+                    return t;
+                }
+
                 // *********************************************************************************************
                 // Data
                 // *********************************************************************************************
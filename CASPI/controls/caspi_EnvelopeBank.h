@@ -0,0 +1,430 @@
+/************************************************************************
+ .d8888b.                             d8b
+d88P  Y88b                            Y8P
+888    888
+888         8888b.  .d8888b  88888b.  888
+888            "88b 88K      888 "88b 888
+888    888 .d888888 "Y8888b. 888  888 888
+Y88b  d88P 888  888      X88 888 d88P 888
+ "Y8888P"  "Y888888  88888P' 88888P"  888
+                             888
+                             888
+                             888
+
+ * @file   caspi_EnvelopeBank.h
+ * @author CS Islay
+ * @brief  Many ADSR envelopes in structure-of-arrays form, advanced a SIMD
+ *         group of voices at a time.
+ *
+ * @details
+ * EnvelopeBank<FloatType, NumVoices> holds the running state of NumVoices
+ * ADSR envelopes side by side: one array each for level, coefficient,
+ * offset and the two stage thresholds. Every stage is the same update,
+ * level = coefficient * level + offset, so one SIMD instruction advances
+ * a whole group of voices whatever stage each one is in. Stage changes
+ * are per voice and rare; they go through a scalar path that mirrors
+ * ADSR::advanceState(), so a voice of the bank follows the same curve as
+ * an ADSR with the same settings.
+ *
+ * ### Stage thresholds
+ * A voice leaves its stage once level + upper >= 2 or level <= lower:
+ * - attack:  upper = 1 (the ADSR target), lower = -max
+ * - decay:   upper = -max, lower = sustain
+ * - release: upper = -max, lower = 0
+ * - sustain and idle never cross.
+ *
+ * ### Block rendering
+ * renderBlock() walks the voices four groups at a time, interleaved so
+ * the update latency of one group hides behind the others, and runs
+ * chunks of samples entirely in registers. Within a stage the rounded
+ * update is monotone in the level, so once a threshold is crossed it
+ * stays crossed: the thresholds are tested once per chunk, and a chunk
+ * in which any lane crossed is rolled back and replayed in scalar for
+ * those groups only. Output is frame-major: sample
+ * t of voice v lands at output[t * kStride + v], the layout a SoA voice
+ * engine multiplies against directly.
+ *
+ * ### Voice bookkeeping
+ * getIdleMask() / getActiveMask() return one bit per voice, kept up to
+ * date by noteOn(), reset() and the end of each release, so finding a
+ * free voice or retiring finished ones is a bit scan. getLevel() and
+ * getQuietestVoice() serve quietest-voice stealing.
+ *
+ * ### Thread safety
+ * None. One audio thread owns the bank.
+ ************************************************************************/
+
+#ifndef CASPI_ENVELOPEBANK_H
+#define CASPI_ENVELOPEBANK_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "base/caspi_Assert.h"
+#include "base/caspi_Features.h"
+#include "base/caspi_SIMD.h"
+#include "controls/caspi_Envelope.h"
+
+namespace CASPI
+{
+    namespace Envelope
+    {
+
+        /*******************************************************************************
+         * EnvelopeBank
+         ******************************************************************************/
+
+        /**
+         * @brief NumVoices ADSR envelopes stored and advanced as structure-of-arrays.
+         *
+         * @tparam FloatType  float or double.
+         * @tparam NumVoices  Number of envelopes, 1 to 64 (one bit each in a Mask).
+         */
+        template <CASPI_FLOAT_TYPE FloatType, std::size_t NumVoices = 16>
+        class EnvelopeBank
+        {
+                static_assert (std::is_floating_point<FloatType>::value, "EnvelopeBank requires a floating-point type");
+                static_assert (NumVoices >= 1 && NumVoices <= 64, "EnvelopeBank holds between 1 and 64 voices");
+
+                using simd_type = typename SIMD::Strategy::simd_type<FloatType, SIMD::Strategy::min_simd_width<FloatType>::value>::type;
+
+                static constexpr std::size_t kLanes = SIMD::Strategy::min_simd_width<FloatType>::value;
+                static constexpr std::size_t kChunk      = 32;
+                static constexpr std::size_t kInterleave = 4; // groups in flight, to cover the update latency
+
+            public:
+                /** @brief One bit per voice, bit v for voice v. */
+                using Mask = std::uint64_t;
+
+                /** @brief Distance between consecutive frames in renderBlock() output. */
+                static constexpr std::size_t kStride = (NumVoices + kLanes - 1) / kLanes * kLanes;
+
+                /** @brief Every voice bit set. */
+                static constexpr Mask kAllVoices = NumVoices == 64 ? ~Mask (0) : (Mask (1) << NumVoices) - 1;
+
+                EnvelopeBank() noexcept
+                {
+                    reset();
+                }
+
+                /*************************************************************************
+                 * Parameters
+                 *************************************************************************/
+
+                /**
+                 * @brief Sample rate used by later setADSR() calls, for every voice.
+                 *
+                 * Like ADSR, coefficients are not recomputed: call setADSR() again
+                 * after changing the rate.
+                 */
+                void setSampleRate (FloatType rate) noexcept
+                {
+                    CASPI_ASSERT (rate > FloatType (0), "Sample rate must be positive.");
+                    for (auto& p : parameters)
+                        p.sampleRate = rate;
+                }
+
+                /** @brief Set attack, decay, sustain and release for every voice. */
+                void setADSR (FloatType attack, FloatType decay, FloatType sustain, FloatType release) noexcept
+                {
+                    for (std::size_t v = 0; v < NumVoices; ++v)
+                        setADSR (v, attack, decay, sustain, release);
+                }
+
+                /**
+                 * @brief Set one voice's attack, decay, sustain and release.
+                 *
+                 * Applies from the voice's next stage, as with ADSR.
+                 */
+                void setADSR (std::size_t voice, FloatType attack, FloatType decay, FloatType sustain, FloatType release) noexcept
+                {
+                    CASPI_ASSERT (voice < NumVoices, "Voice index out of range");
+                    auto& p = parameters[voice];
+                    p.setSustainLevel (sustain);
+                    p.setAttackTime (attack);
+                    p.setDecayTime (decay);
+                    p.setReleaseTime (release);
+                }
+
+                /*************************************************************************
+                 * Voice control
+                 *************************************************************************/
+
+                /** @brief Start @p voice's attack from zero. */
+                void noteOn (std::size_t voice) noexcept CASPI_NON_BLOCKING
+                {
+                    CASPI_ASSERT (voice < NumVoices, "Voice index out of range");
+                    const auto& p = parameters[voice];
+                    enterStage (voice, State::attack, FloatType (0), p.attackCoefficient, p.attackOffset, p.one, lowest());
+                    idleMask &= ~bit (voice);
+                }
+
+                /** @brief Start @p voice's release from its current level. Ignored while idle. */
+                void noteOff (std::size_t voice) noexcept CASPI_NON_BLOCKING
+                {
+                    CASPI_ASSERT (voice < NumVoices, "Voice index out of range");
+                    if (states[voice] == State::idle)
+                        return;
+
+                    const auto& p = parameters[voice];
+                    enterStage (voice, State::release, level[voice], p.releaseCoefficient, p.releaseOffset, lowest(), p.zero);
+                }
+
+                /** @brief Silence @p voice and mark it idle. */
+                void reset (std::size_t voice) noexcept CASPI_NON_BLOCKING
+                {
+                    CASPI_ASSERT (voice < kStride, "Voice index out of range");
+                    enterStage (voice, State::idle, FloatType (0), FloatType (0), FloatType (0), lowest(), lowest());
+                    idleMask |= bit (voice) & kAllVoices;
+                }
+
+                /** @brief Silence every voice. */
+                void reset() noexcept CASPI_NON_BLOCKING
+                {
+                    for (std::size_t v = 0; v < kStride; ++v)
+                        reset (v);
+                }
+
+                /*************************************************************************
+                 * Rendering
+                 *************************************************************************/
+
+                /**
+                 * @brief Advance every voice by @p numSamples, writing levels frame-major.
+                 *
+                 * Matches numSamples calls of ADSR::render() per voice to rounding.
+                 *
+                 * @param output      numSamples * kStride elements, or nullptr to
+                 *                    only advance. Padding lanes are written as 0.
+                 * @param numSamples  Number of samples.
+                 */
+                void renderBlock (FloatType* CASPI_RESTRICT output, int numSamples) noexcept CASPI_NON_BLOCKING
+                {
+                    const auto n = static_cast<std::size_t> (std::max (numSamples, 0));
+                    if (output != nullptr)
+                        renderAll<true> (output, n);
+                    else
+                        renderAll<false> (output, n);
+                }
+
+                /** @brief Advance every voice by @p numSamples without output. */
+                void advance (int numSamples) noexcept CASPI_NON_BLOCKING
+                {
+                    renderBlock (nullptr, numSamples);
+                }
+
+                /*************************************************************************
+                 * Observers
+                 *************************************************************************/
+
+                /** @brief Bits of the voices that are idle. */
+                CASPI_NO_DISCARD Mask getIdleMask() const noexcept
+                {
+                    return idleMask;
+                }
+
+                /** @brief Bits of the voices that are sounding, releases included. */
+                CASPI_NO_DISCARD Mask getActiveMask() const noexcept
+                {
+                    return ~idleMask & kAllVoices;
+                }
+
+                CASPI_NO_DISCARD bool isIdle (std::size_t voice) const noexcept
+                {
+                    return (idleMask & bit (voice)) != 0;
+                }
+
+                CASPI_NO_DISCARD FloatType getLevel (std::size_t voice) const noexcept
+                {
+                    CASPI_ASSERT (voice < NumVoices, "Voice index out of range");
+                    return level[voice];
+                }
+
+                CASPI_NO_DISCARD State getState (std::size_t voice) const noexcept
+                {
+                    CASPI_ASSERT (voice < NumVoices, "Voice index out of range");
+                    return states[voice];
+                }
+
+                /**
+                 * @brief The voice with the lowest level among @p candidates.
+                 *
+                 * Ties go to the lower index. Returns NumVoices when
+                 * @p candidates holds no voice.
+                 */
+                CASPI_NO_DISCARD std::size_t getQuietestVoice (Mask candidates) const noexcept
+                {
+                    candidates &= kAllVoices;
+
+                    std::size_t quietest = NumVoices;
+                    FloatType   lowestLv = std::numeric_limits<FloatType>::max();
+                    for (std::size_t v = 0; candidates != 0; ++v, candidates >>= 1)
+                    {
+                        if ((candidates & 1) != 0 && level[v] < lowestLv)
+                        {
+                            lowestLv = level[v];
+                            quietest = v;
+                        }
+                    }
+                    return quietest;
+                }
+
+            private:
+                static constexpr Mask bit (std::size_t voice) noexcept
+                {
+                    return voice < 64 ? Mask (1) << voice : Mask (0);
+                }
+
+                static constexpr FloatType lowest() noexcept
+                {
+                    return std::numeric_limits<FloatType>::lowest();
+                }
+
+                void enterStage (std::size_t voice, State s, FloatType lv, FloatType c, FloatType o, FloatType up, FloatType lo) noexcept
+                {
+                    states[voice]      = s;
+                    level[voice]       = lv;
+                    coefficient[voice] = c;
+                    offset[voice]      = o;
+                    upper[voice]       = up;
+                    lower[voice]       = lo;
+                }
+
+                /** @brief One scalar update of @p voice; mirrors ADSR::render(). */
+                FloatType step (std::size_t voice) noexcept
+                {
+                    const FloatType x = coefficient[voice] * level[voice] + offset[voice];
+                    level[voice]      = x;
+                    if (x + upper[voice] >= FloatType (2) || x <= lower[voice])
+                        advanceState (voice);
+                    return level[voice];
+                }
+
+                /** @brief Stage change of a voice whose level just crossed a threshold. */
+                void advanceState (std::size_t voice) noexcept
+                {
+                    const auto& p = parameters[voice];
+                    switch (states[voice])
+                    {
+                        case State::attack:
+                            enterStage (voice, State::decay, p.one, p.decayCoefficient, p.decayOffset, lowest(), p.sustainLevel);
+                            break;
+
+                        case State::decay:
+                            enterStage (voice, State::sustain, p.sustainLevel, p.one, p.zero, lowest(), lowest());
+                            break;
+
+                        case State::release:
+                            reset (voice);
+                            break;
+
+                        default:
+                            break;
+                    }
+                }
+
+                /** @brief All-ones lanes where @p x has crossed its stage threshold. */
+                static simd_type crossed (simd_type x, simd_type up, simd_type lo) noexcept
+                {
+                    const simd_type two = SIMD::set1<FloatType> (FloatType (2));
+                    return SIMD::or_vec (SIMD::cmp_ge (SIMD::add (x, up), two), SIMD::cmp_le (x, lo));
+                }
+
+                /**
+                 * @brief Advance the groups G of voices starting at @p base by @p n samples.
+                 *
+                 * The groups are interleaved so their update chains overlap, and
+                 * unrolled at compile time so their state stays in registers.
+                 * Chunks run in registers; a chunk whose last levels show any lane
+                 * past its threshold is replayed per voice through step().
+                 */
+                template <bool Write, std::size_t... G>
+                void renderGroups (std::size_t base, FloatType* CASPI_RESTRICT output, std::size_t n, std::index_sequence<G...>) noexcept
+                {
+                    constexpr std::size_t kGroups = sizeof...(G);
+
+                    // Idle voices hold zero: a pass with nothing sounding is a fill
+                    const Mask pass = (kGroups * kLanes >= 64 ? ~Mask (0) : (Mask (1) << (kGroups * kLanes)) - 1) << base;
+                    if ((getActiveMask() & pass) == 0)
+                    {
+                        if constexpr (Write)
+                            for (std::size_t t = 0; t < n; ++t)
+                                std::fill (output + t * kStride + base, output + t * kStride + base + kGroups * kLanes, FloatType (0));
+                        return;
+                    }
+
+                    simd_type x[kGroups], c[kGroups], o[kGroups], up[kGroups], lo[kGroups];
+
+                    for (std::size_t t = 0; t < n; t += kChunk)
+                    {
+                        const std::size_t len = std::min (kChunk, n - t);
+
+                        ((x[G] = SIMD::load_aligned<FloatType> (level + base + G * kLanes)), ...);
+                        ((c[G] = SIMD::load_aligned<FloatType> (coefficient + base + G * kLanes)), ...);
+                        ((o[G] = SIMD::load_aligned<FloatType> (offset + base + G * kLanes)), ...);
+
+                        for (std::size_t k = 0; k < len; ++k)
+                        {
+                            ((x[G] = SIMD::add (SIMD::mul (c[G], x[G]), o[G])), ...);
+                            if constexpr (Write)
+                                (SIMD::store_unaligned (output + (t + k) * kStride + base + G * kLanes, x[G]), ...);
+                        }
+
+                        // Each stage moves monotonically towards its threshold, so a
+                        // crossing anywhere in the chunk still shows at its end
+                        ((up[G] = SIMD::load_aligned<FloatType> (upper + base + G * kLanes)), ...);
+                        ((lo[G] = SIMD::load_aligned<FloatType> (lower + base + G * kLanes)), ...);
+
+                        simd_type hit = SIMD::set1<FloatType> (FloatType (0));
+                        ((hit = SIMD::or_vec (hit, crossed (x[G], up[G], lo[G]))), ...);
+
+                        if (SIMD::hmax (SIMD::and_vec (hit, SIMD::set1<FloatType> (FloatType (1)))) == FloatType (0))
+                        {
+                            (SIMD::store_aligned (level + base + G * kLanes, x[G]), ...);
+                            continue;
+                        }
+
+                        // A stage ended inside the chunk: replay it voice by voice
+                        for (std::size_t v = base; v < base + kGroups * kLanes; ++v)
+                        {
+                            for (std::size_t k = 0; k < len; ++k)
+                            {
+                                const FloatType y = step (v);
+                                if constexpr (Write)
+                                    output[(t + k) * kStride + v] = y;
+                            }
+                        }
+                    }
+                }
+
+                template <bool Write>
+                void renderAll (FloatType* CASPI_RESTRICT output, std::size_t n) noexcept
+                {
+                    std::size_t base = 0;
+                    for (; base + kInterleave * kLanes <= kStride; base += kInterleave * kLanes)
+                        renderGroups<Write> (base, output, n, std::make_index_sequence<kInterleave> {});
+                    for (; base < kStride; base += kLanes)
+                        renderGroups<Write> (base, output, n, std::make_index_sequence<1> {});
+                }
+
+                alignas (16) FloatType level[kStride];
+                alignas (16) FloatType coefficient[kStride];
+                alignas (16) FloatType offset[kStride];
+                alignas (16) FloatType upper[kStride];
+                alignas (16) FloatType lower[kStride];
+
+                State states[kStride];
+                Mask  idleMask { kAllVoices };
+
+                std::array<Parameters<FloatType>, NumVoices> parameters;
+        };
+
+    } // namespace Envelope
+} // namespace CASPI
+
+#endif // CASPI_ENVELOPEBANK_H
@@ -0,0 +1,707 @@
+/************************************************************************
+ .d8888b.                             d8b
+d88P  Y88b                            Y8P
+888    888
+888         8888b.  .d8888b  88888b.  888
+888            "88b 88K      888 "88b 888
+888    888 .d888888 "Y8888b. 888  888 888
+Y88b  d88P 888  888      X88 888 d88P 888
+ "Y8888P"  "Y888888  88888P' 88888P"  888
+                             888
+                             888
+                             888
+
+ * @file   caspi_MSEG.h
+ * @author CS Islay
+ * @brief  Multi-segment breakpoint envelopes: shareable immutable tables,
+ *         per-voice playheads and a graph control node.
+ *
+ * @details
+ * An MSEG is a list of breakpoints (time, value, curve) joined by curved
+ * segments, with an optional loop or sustain point. Three pieces:
+ *
+ * - MsegTable: the compiled, immutable breakpoint table. Built once off
+ *   the audio thread by create() and held through a shared_ptr, so any
+ *   number of voices can read one definition.
+ * - MsegPlayhead: the per-voice position (segment, time into it, gate).
+ *   A few words; MsegTable::render() advances one against a table.
+ * - MSEG: a ControlNode owning one playhead, fed either a fixed table or
+ *   the latest one from an MsegPublisher.
+ *
+ * ### Segment shape
+ * The segment arriving at a point with curve c in [-1, 1] runs
+ * @code
+ *   y(u) = y0 + (y1 - y0) (2^(k u) - 1) / (2^k - 1),  k = c * kMaxBend,  u in [0, 1)
+ * @endcode
+ * c = 0 is a straight line, c > 0 starts slowly and ends steeply, c < 0
+ * the reverse. Zero-length segments are steps.
+ *
+ * ### Block rendering
+ * render() walks the block a segment at a time. Each span is evaluated a
+ * SIMD group at a time: u is linear in the sample index, and 2^(k u) is
+ * split as 2^n 2^f with n = round(k u), f in [-0.5, 0.5]. 2^f comes from
+ * the SIMD::exp2_frac_poly() PolyKernel and 2^n from a gather into a
+ * small table of powers of two. Holds (sustain, finished) are fills.
+ *
+ * ### Loops and sustain
+ * With loopStart < loopEnd, reaching point loopEnd while the gate is held
+ * jumps back to point loopStart. With loopStart == loopEnd the playhead
+ * holds at that point until noteOff(). After noteOff() the envelope plays
+ * on to the last point and stays at its value.
+ *
+ * ### Editing while audio runs
+ * MsegPublisher hands new tables to running MSEG nodes read-copy-update
+ * style, as a Core::SnapshotPublisher: publish() swaps an atomic pointer,
+ * each node picks the new table up at its next block, and collect() frees
+ * tables no node holds, off the audio thread.
+ *
+ * ### Thread safety
+ * - MsegTable::create(), MsegPublisher::publish() / collect(),
+ *   MSEG::setTable() / setPublisher() — non-audio threads; they allocate.
+ * - MsegTable::render(), MSEG note and render calls — audio thread.
+ ************************************************************************/
+
+#ifndef CASPI_MSEG_H
+#define CASPI_MSEG_H
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "base/caspi_Assert.h"
+#include "base/caspi_Features.h"
+#include "base/caspi_SIMD.h"
+#include "core/caspi_Expected.h"
+#include "core/caspi_Node.h"
+#include "core/caspi_SnapshotPublisher.h"
+
+namespace CASPI
+{
+    namespace Envelope
+    {
+
+        /** @brief Why MsegTable::create() rejected a breakpoint list. */
+        enum class MsegError
+        {
+            TooFewPoints,      ///< Fewer than two points.
+            BadTimes,          ///< First time not 0, or times decreasing or not finite.
+            BadLoop,           ///< Loop indices out of range or reversed.
+            ZeroLengthLoop     ///< Loop spans no time, so it would never advance.
+        };
+
+        /** @brief One breakpoint of an MSEG. */
+        template <CASPI_FLOAT_TYPE FloatType>
+        struct MsegPoint
+        {
+            FloatType time  = FloatType (0); ///< Seconds from the start; the first point is at 0.
+            FloatType value = FloatType (0); ///< Level reached at this point.
+            FloatType curve = FloatType (0); ///< Bend of the segment arriving here, in [-1, 1].
+        };
+
+        namespace detail
+        {
+            /** @brief 2^i for i in [-MaxExponent, MaxExponent], built at compile time. */
+            template <typename FloatType, int MaxExponent>
+            constexpr std::array<FloatType, 2 * MaxExponent + 1> powersOfTwo() noexcept
+            {
+                std::array<FloatType, 2 * MaxExponent + 1> table {};
+                table[MaxExponent] = FloatType (1);
+                for (int i = 1; i <= MaxExponent; ++i)
+                {
+                    table[static_cast<std::size_t> (MaxExponent + i)] = table[static_cast<std::size_t> (MaxExponent + i - 1)] * FloatType (2);
+                    table[static_cast<std::size_t> (MaxExponent - i)] = table[static_cast<std::size_t> (MaxExponent - i + 1)] * FloatType (0.5);
+                }
+                return table;
+            }
+        } // namespace detail
+
+        /** @brief Per-voice position in an MsegTable. */
+        struct MsegPlayhead
+        {
+            std::size_t segment  = 0;     ///< Segment being played.
+            double      position = 0.0;   ///< Seconds into that segment.
+            bool        gate     = false; ///< Note held.
+            bool        started  = false; ///< noteOn() has been called since the last reset.
+            bool        running  = false; ///< False before noteOn() and after the last point.
+            bool        holding  = false; ///< Waiting at the sustain point.
+        };
+
+        /*******************************************************************************
+         * MsegTable
+         ******************************************************************************/
+
+        /**
+         * @brief Immutable compiled breakpoint envelope, shared between voices.
+         *
+         * @tparam FloatType  float or double.
+         */
+        template <CASPI_FLOAT_TYPE FloatType>
+        class MsegTable
+        {
+                static_assert (std::is_floating_point<FloatType>::value, "MsegTable requires a floating-point type");
+
+                using simd_type = typename SIMD::Strategy::simd_type<FloatType, SIMD::Strategy::min_simd_width<FloatType>::value>::type;
+
+                static constexpr std::size_t kLanes = SIMD::Strategy::min_simd_width<FloatType>::value;
+
+            public:
+                using Ptr    = std::shared_ptr<const MsegTable>;
+                using Result = expected<Ptr, MsegError>;
+
+                /** @brief Base-2 exponent of the steepest curve (|curve| = 1). */
+                static constexpr int kMaxBend = 16;
+
+                /** @brief Loop index meaning "no loop". */
+                static constexpr int kNoLoop = -1;
+
+                /** @brief One compiled segment, from point i to point i + 1. */
+                struct Segment
+                {
+                    double    duration;     ///< Seconds.
+                    FloatType start;        ///< Value at u = 0.
+                    FloatType delta;        ///< End value minus start value.
+                    FloatType bend;         ///< k; 0 for a straight line.
+                    FloatType scale;        ///< 1 / (2^k - 1), or 1 when straight.
+                };
+
+                /**
+                 * @brief Validate and compile a breakpoint list.
+                 *
+                 * @param points     Breakpoints, times ascending from 0. Curves are
+                 *                   clamped to [-1, 1].
+                 * @param loopStart  Point the loop returns to, or kNoLoop.
+                 * @param loopEnd    Point at which the loop jumps back, at least 1;
+                 *                   equal to loopStart for a sustain point.
+                 */
+                static Result create (const std::vector<MsegPoint<FloatType>>& points,
+                                      int                                      loopStart = kNoLoop,
+                                      int                                      loopEnd   = kNoLoop) CASPI_ALLOCATING
+                {
+                    if (points.size() < 2)
+                        return make_unexpected<Ptr, MsegError> (MsegError::TooFewPoints);
+
+                    if (points.front().time != FloatType (0))
+                        return make_unexpected<Ptr, MsegError> (MsegError::BadTimes);
+                    for (std::size_t i = 1; i < points.size(); ++i)
+                        if (! std::isfinite (points[i].time) || points[i].time < points[i - 1].time)
+                            return make_unexpected<Ptr, MsegError> (MsegError::BadTimes);
+
+                    const bool looped = loopStart != kNoLoop || loopEnd != kNoLoop;
+                    const auto last   = static_cast<int> (points.size()) - 1;
+                    if (looped && (loopStart < 0 || loopEnd < 1 || loopEnd > last || loopStart > loopEnd))
+                        return make_unexpected<Ptr, MsegError> (MsegError::BadLoop);
+                    if (looped && loopStart < loopEnd && ! (points[static_cast<std::size_t> (loopEnd)].time > points[static_cast<std::size_t> (loopStart)].time))
+                        return make_unexpected<Ptr, MsegError> (MsegError::ZeroLengthLoop);
+
+                    std::shared_ptr<MsegTable> table (new MsegTable());
+                    table->points    = points;
+                    table->loopStart = loopStart;
+                    table->loopEnd   = loopEnd;
+                    table->segments.reserve (points.size() - 1);
+                    for (std::size_t i = 1; i < points.size(); ++i)
+                        table->segments.push_back (compile (points[i - 1], points[i]));
+
+                    return make_expected<Ptr, MsegError> (Ptr (std::move (table)));
+                }
+
+                /*************************************************************************
+                 * Observers
+                 *************************************************************************/
+
+                CASPI_NO_DISCARD std::size_t numPoints() const noexcept { return points.size(); }
+                CASPI_NO_DISCARD std::size_t numSegments() const noexcept { return segments.size(); }
+                CASPI_NO_DISCARD const MsegPoint<FloatType>& getPoint (std::size_t i) const noexcept { return points[i]; }
+                CASPI_NO_DISCARD const Segment& getSegment (std::size_t i) const noexcept { return segments[i]; }
+                CASPI_NO_DISCARD int getLoopStart() const noexcept { return loopStart; }
+                CASPI_NO_DISCARD int getLoopEnd() const noexcept { return loopEnd; }
+
+                /** @brief Time of the last point, in seconds. */
+                CASPI_NO_DISCARD FloatType getLength() const noexcept
+                {
+                    return points.back().time;
+                }
+
+                /**
+                 * @brief Value @p seconds after noteOn, ignoring any loop.
+                 *
+                 * Scalar reference evaluation with std::exp2; render() agrees
+                 * with it to the accuracy of the exp2 polynomial.
+                 */
+                CASPI_NO_DISCARD FloatType valueAt (double seconds) const noexcept
+                {
+                    for (std::size_t s = 0; s < segments.size(); ++s)
+                    {
+                        const double start = static_cast<double> (points[s].time);
+                        if (seconds < start + segments[s].duration)
+                            return evaluate (segments[s], (seconds - start) / segments[s].duration);
+                    }
+                    return points.back().value;
+                }
+
+                /*************************************************************************
+                 * Playheads
+                 *************************************************************************/
+
+                /** @brief Start @p playhead from the first point. */
+                void noteOn (MsegPlayhead& playhead) const noexcept CASPI_NON_BLOCKING
+                {
+                    playhead.segment  = 0;
+                    playhead.position = 0.0;
+                    playhead.gate     = true;
+                    playhead.started  = true;
+                    playhead.running  = true;
+                    playhead.holding  = false;
+                }
+
+                /** @brief Release @p playhead: leave any loop or sustain and play to the end. */
+                void noteOff (MsegPlayhead& playhead) const noexcept CASPI_NON_BLOCKING
+                {
+                    playhead.gate = false;
+                    if (playhead.holding)
+                    {
+                        playhead.holding = false;
+                        advanceSegment (playhead);
+                    }
+                }
+
+                /**
+                 * @brief Clamp @p playhead into this table after a table change.
+                 *
+                 * Keeps the segment index and time where they still exist.
+                 */
+                void adopt (MsegPlayhead& playhead) const noexcept CASPI_NON_BLOCKING
+                {
+                    if (! playhead.running)
+                        return;
+
+                    if (playhead.segment >= segments.size())
+                    {
+                        playhead.running = false;
+                        playhead.holding = false;
+                        return;
+                    }
+                    if (playhead.holding && static_cast<int> (playhead.segment) + 1 != loopEnd)
+                    {
+                        playhead.holding = false;
+                        advanceSegment (playhead);
+                    }
+                }
+
+                /** @brief Level of @p playhead at its current position. */
+                CASPI_NO_DISCARD FloatType currentValue (const MsegPlayhead& playhead) const noexcept
+                {
+                    if (! playhead.running)
+                        return playhead.started ? points.back().value : points.front().value;
+                    if (playhead.holding)
+                        return points[playhead.segment + 1].value;
+                    const Segment& seg = segments[playhead.segment];
+                    return evaluate (seg, seg.duration > 0.0 ? playhead.position / seg.duration : 1.0);
+                }
+
+                /**
+                 * @brief Render @p numSamples of @p playhead and advance it.
+                 *
+                 * @param playhead    Voice position; advanced by numSamples.
+                 * @param output      At least numSamples elements.
+                 * @param numSamples  Number of samples.
+                 * @param sampleRate  Hz.
+                 */
+                void render (MsegPlayhead& playhead, FloatType* CASPI_RESTRICT output, int numSamples, double sampleRate) const noexcept CASPI_NON_BLOCKING
+                {
+                    CASPI_ASSERT (sampleRate > 0.0, "Sample rate must be positive");
+
+                    const auto   n  = static_cast<std::size_t> (std::max (numSamples, 0));
+                    const double dt = 1.0 / sampleRate;
+
+                    for (std::size_t done = 0; done < n;)
+                    {
+                        if (! playhead.running || playhead.holding)
+                        {
+                            std::fill (output + done, output + n, currentValue (playhead));
+                            return;
+                        }
+
+                        const Segment& seg  = segments[playhead.segment];
+                        const double   left = samplesLeft (playhead, sampleRate);
+                        if (left <= kBoundary)
+                        {
+                            playhead.position -= seg.duration;
+                            advanceSegment (playhead);
+                            continue;
+                        }
+
+                        const auto span = std::min (n - done, static_cast<std::size_t> (std::ceil (left - kBoundary)));
+                        renderSpan (seg, playhead.position / seg.duration, dt / seg.duration, output + done, span);
+
+                        done += span;
+                        playhead.position += static_cast<double> (span) * dt;
+                    }
+
+                    // A span that ends exactly on a boundary moves on now, so a
+                    // following sustain hold or end is visible straight away
+                    while (playhead.running && ! playhead.holding && samplesLeft (playhead, sampleRate) <= kBoundary)
+                    {
+                        playhead.position -= segments[playhead.segment].duration;
+                        advanceSegment (playhead);
+                    }
+                }
+
+            private:
+                /** @brief Samples of slack when matching a position to a segment end. */
+                static constexpr double kBoundary = 1e-6;
+
+                /** @brief 2^i for i in [-kMaxBend, kMaxBend], indexed by i + kMaxBend. */
+                static constexpr std::array<FloatType, 2 * kMaxBend + 1> kPowersOfTwo = detail::powersOfTwo<FloatType, kMaxBend>();
+
+                MsegTable() = default;
+
+                /** @brief Samples from @p playhead to the end of its segment. */
+                double samplesLeft (const MsegPlayhead& playhead, double sampleRate) const noexcept
+                {
+                    return (segments[playhead.segment].duration - playhead.position) * sampleRate;
+                }
+
+                static Segment compile (const MsegPoint<FloatType>& from, const MsegPoint<FloatType>& to) noexcept
+                {
+                    const FloatType curve = std::max (FloatType (-1), std::min (to.curve, FloatType (1)));
+                    const FloatType bend  = curve * FloatType (kMaxBend);
+
+                    Segment seg;
+                    seg.duration = static_cast<double> (to.time) - static_cast<double> (from.time);
+                    seg.start    = from.value;
+                    seg.delta    = to.value - from.value;
+                    seg.bend     = std::abs (bend) < FloatType (1e-3) ? FloatType (0) : bend;
+                    seg.scale    = seg.bend == FloatType (0) ? FloatType (1) : FloatType (1) / (std::exp2 (seg.bend) - FloatType (1));
+                    return seg;
+                }
+
+                static FloatType evaluate (const Segment& seg, double u) noexcept
+                {
+                    if (seg.bend == FloatType (0))
+                        return seg.start + seg.delta * static_cast<FloatType> (u);
+                    const auto e = static_cast<FloatType> (std::exp2 (static_cast<double> (seg.bend) * u));
+                    return seg.start + seg.delta * (e - FloatType (1)) * seg.scale;
+                }
+
+                /** @brief Move past the end of the current segment: loop, hold, next or finish. */
+                void advanceSegment (MsegPlayhead& playhead) const noexcept
+                {
+                    const auto endPoint = static_cast<int> (playhead.segment) + 1;
+                    if (playhead.gate && loopEnd != kNoLoop && endPoint == loopEnd)
+                    {
+                        if (loopStart == loopEnd)
+                        {
+                            playhead.holding  = true;
+                            playhead.position = 0.0;
+                            return;
+                        }
+                        playhead.segment = static_cast<std::size_t> (loopStart);
+                        return;
+                    }
+
+                    if (playhead.segment + 1 >= segments.size())
+                    {
+                        playhead.segment  = segments.size() - 1;
+                        playhead.position = 0.0;
+                        playhead.running  = false;
+                        return;
+                    }
+                    ++playhead.segment;
+                }
+
+                /** @brief Samples u0, u0 + du, ... of one segment into @p output. */
+                void renderSpan (const Segment& seg, double u0, double du, FloatType* CASPI_RESTRICT output, std::size_t count) const noexcept
+                {
+                    alignas (16) static constexpr FloatType laneIndex[] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+                    static_assert (kLanes <= 8, "laneIndex covers eight lanes");
+
+                    const simd_type start = SIMD::set1<FloatType> (seg.start);
+                    const simd_type delta = SIMD::set1<FloatType> (seg.delta);
+                    const simd_type lanes = SIMD::load_aligned<FloatType> (laneIndex);
+                    const simd_type step  = SIMD::set1<FloatType> (static_cast<FloatType> (du));
+                    const auto      first = static_cast<FloatType> (u0);
+
+                    alignas (16) FloatType tail[kLanes];
+                    if (seg.bend == FloatType (0))
+                    {
+                        for (std::size_t t = 0; t < count; t += kLanes)
+                        {
+                            const simd_type idx = SIMD::add (lanes, SIMD::set1<FloatType> (static_cast<FloatType> (t)));
+                            const simd_type u   = SIMD::mul_add (idx, step, SIMD::set1<FloatType> (first));
+                            const simd_type y   = SIMD::mul_add (delta, u, start);
+                            storeGroup (output + t, y, count - t, tail);
+                        }
+                        return;
+                    }
+
+                    const simd_type bend   = SIMD::set1<FloatType> (seg.bend);
+                    const simd_type scaled = SIMD::set1<FloatType> (seg.delta * seg.scale);
+                    const simd_type offset = SIMD::set1<FloatType> (FloatType (kMaxBend));
+                    const simd_type base   = SIMD::sub (start, scaled); // y = start + scaled (e - 1)
+                    const FloatType* pow2  = kPowersOfTwo.data();
+
+                    for (std::size_t t = 0; t < count; t += kLanes)
+                    {
+                        const simd_type idx   = SIMD::add (lanes, SIMD::set1<FloatType> (static_cast<FloatType> (t)));
+                        const simd_type u     = SIMD::mul_add (idx, step, SIMD::set1<FloatType> (first));
+                        const simd_type x     = SIMD::mul (bend, u);
+                        const simd_type whole = SIMD::round (x);
+                        const simd_type e     = SIMD::mul (exp2Frac (SIMD::sub (x, whole)), SIMD::gather (pow2, SIMD::add (whole, offset)));
+                        const simd_type y     = SIMD::mul_add (scaled, e, base);
+                        storeGroup (output + t, y, count - t, tail);
+                    }
+                }
+
+                static void storeGroup (FloatType* output, simd_type y, std::size_t left, FloatType* tail) noexcept
+                {
+                    if (left >= kLanes)
+                    {
+                        SIMD::store_unaligned (output, y);
+                        return;
+                    }
+                    SIMD::store_aligned (tail, y);
+                    std::copy (tail, tail + left, output);
+                }
+
+                std::vector<MsegPoint<FloatType>> points;
+                std::vector<Segment>              segments;
+                int                               loopStart = kNoLoop;
+                int                               loopEnd   = kNoLoop;
+
+                /** @brief 2^f for the fractional part; built with the table, off the audio thread. */
+                const decltype (SIMD::exp2_frac_poly<FloatType>()) exp2Frac = SIMD::exp2_frac_poly<FloatType>();
+        };
+
+        /*******************************************************************************
+         * MsegPublisher
+         ******************************************************************************/
+
+        /** @brief One published table. Immutable once published. */
+        template <CASPI_FLOAT_TYPE FloatType>
+        struct MsegSnapshot
+        {
+            typename MsegTable<FloatType>::Ptr table;
+        };
+
+        /**
+         * @brief Lock-free hand-over of edited MsegTables to running MSEG nodes.
+         *
+         * @details
+         * A Core::SnapshotPublisher of MsegSnapshot. Each attached node owns a
+         * Reader whose hazard slots keep the table it plays alive; collect()
+         * frees tables no node holds. Thread rules are those of
+         * Core::SnapshotPublisher.
+         *
+         * @tparam FloatType  float or double.
+         */
+        template <CASPI_FLOAT_TYPE FloatType>
+        class MsegPublisher : public Core::SnapshotPublisher<MsegSnapshot<FloatType>>
+        {
+            public:
+                /** @brief Make @p table the one every attached node plays from its next block. */
+                void publish (typename MsegTable<FloatType>::Ptr table) CASPI_ALLOCATING
+                {
+                    CASPI_ASSERT (table != nullptr, "Cannot publish a null table");
+                    Core::SnapshotPublisher<MsegSnapshot<FloatType>>::publish ({ std::move (table) });
+                }
+        };
+
+        /*******************************************************************************
+         * MSEG
+         ******************************************************************************/
+
+        /**
+         * @brief Graph control node playing one MsegTable with its own playhead.
+         *
+         * Like LFO, processImpl() renders each block into control port 0's
+         * per-sample block and publishes the last value as the port scalar.
+         * One node per voice, all set to the same table or publisher, shares
+         * one definition.
+         *
+         * @tparam FloatType  float or double.
+         */
+        template <CASPI_FLOAT_TYPE FloatType>
+        class MSEG : public Graph::ControlNode<MSEG<FloatType>, FloatType>
+        {
+                using Base = Graph::ControlNode<MSEG<FloatType>, FloatType>;
+
+            public:
+                MSEG() noexcept
+                    : Base (1)
+                {
+                }
+
+                ~MSEG() override
+                {
+                    setPublisher (nullptr);
+                }
+
+                MSEG (const MSEG&)            = delete;
+                MSEG& operator= (const MSEG&) = delete;
+
+                /*************************************************************************
+                 * Table source — setup thread
+                 *************************************************************************/
+
+                /** @brief Play @p newTable. Detaches from any publisher. */
+                void setTable (typename MsegTable<FloatType>::Ptr newTable) CASPI_ALLOCATING
+                {
+                    setPublisher (nullptr);
+                    ownedTable = std::move (newTable);
+                    table      = ownedTable.get();
+                    if (table != nullptr)
+                        table->adopt (playhead);
+                }
+
+                /**
+                 * @brief Follow @p newPublisher's latest table from the next block.
+                 *
+                 * Passing nullptr detaches and stops playing a published table.
+                 */
+                void setPublisher (MsegPublisher<FloatType>* newPublisher) CASPI_ALLOCATING
+                {
+                    if (publisher != nullptr)
+                    {
+                        publisher->removeReader (reader);
+                        publisher      = nullptr;
+                        reader         = nullptr;
+                        activeSnapshot = nullptr;
+                        table          = ownedTable.get();
+                    }
+
+                    if (newPublisher != nullptr)
+                    {
+                        ownedTable   = nullptr;
+                        table        = nullptr;
+                        publisher    = newPublisher;
+                        reader       = publisher->addReader();
+                        seenSequence = 0;
+                    }
+                }
+
+                /** @brief The table being played, or nullptr. */
+                CASPI_NO_DISCARD const MsegTable<FloatType>* getTable() const noexcept
+                {
+                    return table;
+                }
+
+                /*************************************************************************
+                 * Voice control — audio thread
+                 *************************************************************************/
+
+                void noteOn() noexcept CASPI_NON_BLOCKING
+                {
+                    pollPublisher();
+                    if (table != nullptr)
+                        table->noteOn (playhead);
+                }
+
+                void noteOff() noexcept CASPI_NON_BLOCKING
+                {
+                    if (table != nullptr)
+                        table->noteOff (playhead);
+                }
+
+                /** @brief Stop and return to the start of the table. */
+                void reset() noexcept CASPI_NON_BLOCKING
+                {
+                    playhead = MsegPlayhead {};
+                }
+
+                /** @brief True when not playing: before noteOn() or after the last point. */
+                CASPI_NO_DISCARD bool isIdle() const noexcept
+                {
+                    return ! playhead.running;
+                }
+
+                CASPI_NO_DISCARD const MsegPlayhead& getPlayhead() const noexcept
+                {
+                    return playhead;
+                }
+
+                /*************************************************************************
+                 * Rendering — audio thread
+                 *************************************************************************/
+
+                /**
+                 * @brief Render @p numSamples envelope values.
+                 *
+                 * Picks up a newly published table first. Writes zeros when no
+                 * table is set.
+                 */
+                void renderBlock (FloatType* CASPI_RESTRICT output, int numSamples) noexcept CASPI_NON_BLOCKING
+                {
+                    pollPublisher();
+                    if (table == nullptr)
+                    {
+                        std::fill (output, output + std::max (numSamples, 0), FloatType (0));
+                        return;
+                    }
+                    table->render (playhead, output, numSamples, static_cast<double> (this->getSampleRate()));
+                }
+
+                /*************************************************************************
+                 * Graph hooks
+                 *************************************************************************/
+
+                /** @brief Size the per-sample control block. */
+                void onPrepare (std::size_t /*numChannels*/, std::size_t numFrames, double) CASPI_ALLOCATING
+                {
+                    this->controlBlocks[0].assign (numFrames, FloatType (0));
+                }
+
+                /** @brief Graph dispatch: render one block into the port 0 control block. */
+                void processImpl (Graph::AudioContext<FloatType>& /*ctx*/) noexcept CASPI_NON_BLOCKING
+                {
+                    auto& block = this->controlBlocks[0];
+                    if (! block.empty())
+                    {
+                        renderBlock (block.data(), static_cast<int> (block.size()));
+                        this->controlOutputs[0] = block.back();
+                    }
+                }
+
+            private:
+                using Snapshot = typename MsegPublisher<FloatType>::Snapshot;
+
+                void pollPublisher() noexcept
+                {
+                    if (reader == nullptr)
+                        return;
+
+                    const std::uint64_t sequence = reader->sequence();
+                    if (sequence == seenSequence)
+                        return;
+                    seenSequence = sequence;
+
+                    const Snapshot* latest = reader->acquire();
+                    if (latest == nullptr || latest == activeSnapshot)
+                    {
+                        reader->release();
+                        return;
+                    }
+
+                    reader->commit (latest);
+                    activeSnapshot = latest;
+                    table          = latest->table.get();
+                    table->adopt (playhead);
+                }
+
+                MsegPlayhead                                 playhead;
+                const MsegTable<FloatType>*                  table { nullptr };
+                typename MsegTable<FloatType>::Ptr           ownedTable;
+                MsegPublisher<FloatType>*                    publisher { nullptr };
+                typename MsegPublisher<FloatType>::Reader*   reader { nullptr };   ///< Hazard slots, owned by publisher.
+                const Snapshot*                              activeSnapshot { nullptr };
+                std::uint64_t                                seenSequence { 0 };
+        };
+
+    } // namespace Envelope
+} // namespace CASPI
+
+#endif // CASPI_MSEG_H
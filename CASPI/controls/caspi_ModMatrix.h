@@ -6,11 +6,12 @@
  *
  * ARCHITECTURE
  *
- * Routing data is split into two fixed-capacity sorted lists at
+ * Routing data lives in a RoutingTable, shared with PolyModMatrix: a
+ * lock-free command queue and two fixed-capacity sorted lists, split at
  * command-apply time:
  *
  *   linearRoutings[]    - curve == Linear, processed via FMA-eligible loop
- *   nonLinearRoutings[] - all other curves, processed scalar
+ *   nonLinearRoutings[] - all other curves, processed via the curve plan
  *
  * Both lists are sorted by destinationId ascending so writes into the
  * flat modulationAccum[] array are sequential, improving spatial locality
@@ -19,7 +20,9 @@
  * Per-block flow (process()):
  *
  *   drainCommands()
- *     try_dequeue -> applyCommand() until queue empty
+ *     RoutingTable::drainCommands(): try_dequeue -> applyCommand()
+ *     until queue empty; marks the curve plan stale if a curved
+ *     routing changed
  *
  *   accumulateLinear()
  *     ops::fill(modulationAccum, 0)         SIMD zero (NT stores if large)
@@ -27,8 +30,11 @@
  *       accum[dst] += source[src] * depth   FMA-eligible
  *
  *   accumulateNonLinear()
- *     for each nonLinearRouting (enabled):
- *       accum[dst] += applyCurve(source[src]) * depth   scalar
+ *     rebuildCurvePlan() if nonLinearRoutings changed
+ *     for each curve group, one SIMD width of routings at a time:
+ *       x = gather(source, src[])                  lane-wise gather
+ *       c = detail::applyCurve<Curve>(x) * depth[] SIMD curve, no branches
+ *       accum[dst[k]] += c[k]                      scalar scatter
  *
  *   scatterToParameters()
  *     ops::clamp(modulationAccum, -1, 1)    SIMD clamp
@@ -40,6 +46,37 @@
  *   Zero pass    : ops::fill   (FillKernel, NT stores above L1 threshold)
  *   Clamp pass   : ops::clamp  (ClampKernel, min/max per lane)
  *   Linear accum : scalar loop, FMA auto-vectorised under /arch:AVX2 or -mavx2
+ *   Curved accum : gather + detail::applyCurve per curve group
+ *   Audio accum  : ops::accumulate_with_gain per routing over the block
+ *
+ * AUDIO-RATE ROUTINGS
+ *
+ * A routing with rate == ModulationRate::Audio lives in the same sorted
+ * lists but is skipped by the block passes. process(numFrames) gives each
+ * destination with at least one audio-rate routing a per-sample row:
+ *
+ *   accumulateAudio(numFrames)
+ *     row[dst] = block accum[dst]                  ops::fill (once per dst)
+ *     for each audio routing (enabled):
+ *       row[dst] += sourceBuffer[src] * depth      ops::accumulate_with_gain
+ *       (source without a buffer: += source[src] * depth, held for the block)
+ *
+ * Rows are clamped to [-1, 1] with the block accumulator and read through
+ * getModulationBuffer(). Parameters still receive the block-rate sum via
+ * addModulation(), so block-rate consumers are unchanged. Source buffers
+ * are set per block with setSourceBuffer() and forgotten after process().
+ * Row storage (numParameters x maxBlockSize) is allocated by
+ * setMaxBlockSize() during setup.
+ *
+ * CURVE PLAN
+ *
+ * The curve plan is a structure-of-arrays copy of the enabled block-rate
+ * curved routings, grouped by curve (Exponential, Logarithmic, SCurve)
+ * and kept in destination order within each group: source index (as a
+ * FloatType, ready for gather), depth and destination. Each group is
+ * padded to the SIMD width with zero-depth entries, so the pass has no
+ * tail loop. The plan is rebuilt on the audio thread, in O(n), only in
+ * blocks where a command changed nonLinearRoutings.
  *
  * No heap allocation on the audio thread. RoutingList uses a fixed std::array.
  * Total routing storage: 2 x 1024 x 24B = 48KB (float), fits in L2.
@@ -70,9 +107,12 @@
 /*------------------------------------------------------------------------------
  * Includes - System
  *----------------------------------------------------------------------------*/
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
 #include <cstring>
+#include <vector>
 
 /*------------------------------------------------------------------------------
  * Includes - Project
@@ -116,8 +156,9 @@ namespace CASPI
         /**
          * @brief Curve shaping applied to a source value before depth scaling.
          *
-         * Linear is the dominant case and takes the SIMD fast path internally.
-         * All other values are handled on the scalar non-linear pass.
+         * Linear is the dominant case and takes the FMA fast path internally.
+         * All other values are grouped by curve and evaluated a SIMD width
+         * of routings at a time on the non-linear pass.
          *
          * This enum is also used as a non-type template parameter on
          * ModMatrix::removeRouting and ModMatrix::setRoutingEnabled to select
@@ -126,9 +167,26 @@ namespace CASPI
         enum class ModulationCurve
         {
             Linear, /**< y = x,                   SIMD fast path  */
-            Exponential, /**< y = sign(x) * x^2,       scalar          */
-            Logarithmic, /**< y = sign(x) * sqrt(|x|), scalar          */
-            SCurve /**< smoothstep,               scalar          */
+            Exponential, /**< y = sign(x) * x^2,       SIMD curve pass */
+            Logarithmic, /**< y = sign(x) * sqrt(|x|), SIMD curve pass */
+            SCurve /**< smoothstep,               SIMD curve pass */
+        };
+
+        /*======================================================================
+         * ModulationRate
+         *====================================================================*/
+
+        /**
+         * @brief How often a routing is evaluated.
+         *
+         * Block routings add one value per block to the parameter. Audio
+         * routings add a per-sample source buffer to the destination's
+         * modulation buffer (see ModMatrix::getModulationBuffer).
+         */
+        enum class ModulationRate
+        {
+            Block, /**< Once per process() call, from setSourceValue(). */
+            Audio /**< Every sample, from setSourceBuffer().            */
         };
 
         /*======================================================================
@@ -147,6 +205,49 @@ namespace CASPI
             {
                     static constexpr bool value = (C == ModulationCurve::Linear);
             };
+
+            /**
+             * @brief SIMD counterpart of ModulationRouting::applyCurve for a fixed curve.
+             *
+             * Performs the scalar version's operations in the same order, lane
+             * by lane, so each lane matches applyCurve() for the same input.
+             * Sign selection uses a compare and blend instead of a branch.
+             *
+             * @tparam C          Curve to apply.
+             * @tparam FloatType  float or double.
+             * @param x           Source values.
+             * @return            Curve-shaped values.
+             */
+            template <ModulationCurve C, typename FloatType, typename V>
+            CASPI_NO_DISCARD inline V applyCurve (V x) noexcept CASPI_NON_BLOCKING
+            {
+                const V zero = SIMD::set1<FloatType> (FloatType (0));
+
+                if constexpr (C == ModulationCurve::Exponential)
+                {
+                    const V square = SIMD::mul (x, x);
+                    return SIMD::blend (SIMD::negate (square), square, SIMD::cmp_ge (x, zero));
+                }
+                else if constexpr (C == ModulationCurve::Logarithmic)
+                {
+                    const V root = SIMD::sqrt (SIMD::abs (x));
+                    return SIMD::blend (SIMD::negate (root), root, SIMD::cmp_ge (x, zero));
+                }
+                else if constexpr (C == ModulationCurve::SCurve)
+                {
+                    const V one = SIMD::set1<FloatType> (FloatType (1));
+                    const V two = SIMD::set1<FloatType> (FloatType (2));
+
+                    V t          = SIMD::mul (SIMD::add (x, one), SIMD::set1<FloatType> (FloatType (0.5)));
+                    t            = SIMD::min (SIMD::max (t, zero), one);
+                    const V s    = SIMD::mul (SIMD::mul (t, t), SIMD::sub (SIMD::set1<FloatType> (FloatType (3)), SIMD::mul (two, t)));
+                    return SIMD::sub (SIMD::mul (s, two), one);
+                }
+                else
+                {
+                    return x;
+                }
+            }
         } /* namespace detail */
 
         /*======================================================================
@@ -182,6 +283,9 @@ namespace CASPI
                 /** @brief When false the routing contributes zero modulation. */
                 bool enabled = true;
 
+                /** @brief Block-rate or audio-rate evaluation. */
+                ModulationRate rate = ModulationRate::Block;
+
                 /**
                  * @brief Default constructor. All fields zero / default initialised.
                  */
@@ -204,8 +308,9 @@ namespace CASPI
                 /**
                  * @brief Apply curve shaping to a normalised source value.
                  *
-                 * Only called from the non-linear accumulation pass.
-                 * Linear routings never invoke this function; they take the FMA path directly.
+                 * Scalar reference for detail::applyCurve, which the non-linear
+                 * pass uses. Linear routings never invoke this function; they
+                 * take the FMA path directly.
                  *
                  * @param value  Source value, typically in [-1, 1] or [0, 1].
                  * @return       Curve-shaped value in the same normalised range.
@@ -431,6 +536,269 @@ namespace CASPI
                 size_t count = 0;
         };
 
+        /*======================================================================
+         * ParamRegistrationError
+         *====================================================================*/
+
+        /**
+         * @brief Error codes returned by the matrices' parameter registration.
+         */
+        enum class ParamRegistrationError
+        {
+            NullParameter, /**< A supplied pointer was null.                 */
+            CapacityExceeded /**< MAX_MOD_PARAMS registrations already reached. */
+        };
+
+        /*======================================================================
+         * RoutingTable
+         *====================================================================*/
+
+        /**
+         * @brief The routing state shared by ModMatrix and PolyModMatrix.
+         *
+         * Holds the two sorted routing lists and the lock-free command queue
+         * that edits them. Producers on any thread enqueue commands; the
+         * owning matrix calls drainCommands() at the top of its process()
+         * on the audio thread, then reads linear() and nonLinear().
+         *
+         * @tparam FloatType  Floating-point scalar type (float or double).
+         */
+        template <CASPI_FLOAT_TYPE FloatType>
+        class RoutingTable
+        {
+            public:
+                using List = RoutingList<FloatType, MAX_MOD_ROUTINGS>;
+
+                /*==============================================================
+                 * Command queue types
+                 *============================================================*/
+
+                /**
+                 * @brief Discriminates the mutation carried by a Command.
+                 */
+                enum class CommandType
+                {
+                    AddRouting, /**< Insert a routing into the appropriate list.    */
+                    RemoveLinear, /**< Remove by index from linearRoutings.           */
+                    RemoveNonLinear, /**< Remove by index from nonLinearRoutings.        */
+                    ClearRoutings, /**< Clear both routing lists.                      */
+                    SetEnabledLinear, /**< Toggle enabled flag in linearRoutings.         */
+                    SetEnabledNonLinear /**< Toggle enabled flag in nonLinearRoutings.    */
+                };
+
+                /**
+                 * @brief Payload carried through the lock-free command queue.
+                 *
+                 * Only the fields relevant to the CommandType are used;
+                 * the rest are default-initialised.
+                 */
+                struct Command
+                {
+                        /** @brief Which mutation to perform when dequeued. */
+                        CommandType type = CommandType::ClearRoutings;
+
+                        /** @brief Routing data; used by AddRouting only. */
+                        ModulationRouting<FloatType> routing {};
+
+                        /** @brief Target index; used by Remove* and SetEnabled*. */
+                        size_t index = 0;
+
+                        /** @brief New enabled state; used by SetEnabled* only. */
+                        bool enabled = false;
+                };
+
+                /*==============================================================
+                 * Any-thread API - enqueues only, never mutates routing state
+                 *============================================================*/
+
+                /**
+                 * @brief Enqueue a routing for insertion on the next drainCommands().
+                 *
+                 * The routing is dispatched to the linear or non-linear list
+                 * according to routing.curve when the command is applied. Depth
+                 * is clamped to [-1, 1] here so the accumulation loops are
+                 * unconditional.
+                 *
+                 * @param routing  Routing to add.
+                 */
+                void addRouting (const ModulationRouting<FloatType>& routing) CASPI_NON_BLOCKING
+                {
+                    auto r  = routing;
+                    r.depth = Maths::clamp (r.depth, FloatType (-1), FloatType (1));
+                    pendingCommands.enqueue (producerToken, { CommandType::AddRouting, r, 0, false });
+                }
+
+                /**
+                 * @brief Enqueue removal of a routing by index from the list selected by Curve.
+                 *
+                 * @tparam Curve  Linear targets the linear list, anything else the non-linear one.
+                 * @param index   Zero-based position within the target list.
+                 */
+                template <ModulationCurve Curve = ModulationCurve::Linear>
+                void removeRouting (size_t index) CASPI_NON_BLOCKING
+                {
+                    constexpr CommandType t =
+                        detail::IsLinearCurve<Curve>::value ? CommandType::RemoveLinear : CommandType::RemoveNonLinear;
+                    pendingCommands.enqueue (producerToken, { t, {}, index, false });
+                }
+
+                /** @brief Enqueue a command to clear both lists. */
+                void clearRoutings() CASPI_NON_BLOCKING
+                {
+                    pendingCommands.enqueue (producerToken, { CommandType::ClearRoutings, {}, 0, false });
+                }
+
+                /**
+                 * @brief Enqueue a change to the enabled state of a routing in the list selected by Curve.
+                 *
+                 * @tparam Curve    Linear targets the linear list, anything else the non-linear one.
+                 * @param index     Zero-based position within the target list.
+                 * @param enabled   New enabled state for the routing at index.
+                 */
+                template <ModulationCurve Curve = ModulationCurve::Linear>
+                void setRoutingEnabled (size_t index, bool enabled) CASPI_NON_BLOCKING
+                {
+                    constexpr CommandType t = detail::IsLinearCurve<Curve>::value ? CommandType::SetEnabledLinear
+                                                                                  : CommandType::SetEnabledNonLinear;
+                    pendingCommands.enqueue (producerToken, { t, {}, index, enabled });
+                }
+
+                /*==============================================================
+                 * Audio thread
+                 *============================================================*/
+
+                /**
+                 * @brief Apply every pending command.
+                 *
+                 * try_dequeue is wait-free on the consumer side. Routings whose
+                 * source or destination is out of range are dropped.
+                 *
+                 * @param numDestinations  Destinations registered with the owning matrix.
+                 * @return                 True if the non-linear list changed.
+                 */
+                bool drainCommands (size_t numDestinations) noexcept CASPI_NON_BLOCKING
+                {
+                    Command cmd;
+                    bool    nonLinearChanged = false;
+
+                    while (pendingCommands.try_dequeue (cmd))
+                    {
+                        nonLinearChanged |= applyCommand (cmd, numDestinations);
+                    }
+
+                    return nonLinearChanged;
+                }
+
+                /** @brief Linear routings, sorted by destination. */
+                CASPI_NO_DISCARD const List& linear() const noexcept CASPI_NON_BLOCKING { return linearRoutings; }
+
+                /** @brief Curved routings, sorted by destination. */
+                CASPI_NO_DISCARD const List& nonLinear() const noexcept CASPI_NON_BLOCKING { return nonLinearRoutings; }
+
+                /** @brief Routings across both lists. */
+                CASPI_NO_DISCARD size_t size() const noexcept CASPI_NON_BLOCKING
+                {
+                    return linearRoutings.size() + nonLinearRoutings.size();
+                }
+
+            private:
+                /**
+                 * @brief Apply a single dequeued command.
+                 *
+                 * @return True if it changed the non-linear list.
+                 */
+                bool applyCommand (const Command& cmd, size_t numDestinations) noexcept CASPI_NON_BLOCKING
+                {
+                    switch (cmd.type)
+                    {
+                        case CommandType::AddRouting:
+                        {
+                            const auto& r = cmd.routing;
+
+                            if (r.sourceId >= MAX_MOD_SOURCES || r.destinationId >= numDestinations)
+                            {
+                                return false;
+                            }
+
+                            if (r.curve == ModulationCurve::Linear)
+                            {
+                                linearRoutings.insert (r);
+                                return false;
+                            }
+
+                            nonLinearRoutings.insert (r);
+                            return true;
+                        }
+
+                        case CommandType::RemoveLinear:
+                        {
+                            linearRoutings.removeAt (cmd.index);
+                            return false;
+                        }
+
+                        case CommandType::RemoveNonLinear:
+                        {
+                            nonLinearRoutings.removeAt (cmd.index);
+                            return true;
+                        }
+
+                        case CommandType::ClearRoutings:
+                        {
+                            linearRoutings.clear();
+                            nonLinearRoutings.clear();
+                            return true;
+                        }
+
+                        case CommandType::SetEnabledLinear:
+                        {
+                            if (cmd.index < linearRoutings.size())
+                            {
+                                linearRoutings[cmd.index].enabled = cmd.enabled;
+                            }
+
+                            return false;
+                        }
+
+                        case CommandType::SetEnabledNonLinear:
+                        {
+                            if (cmd.index < nonLinearRoutings.size())
+                            {
+                                nonLinearRoutings[cmd.index].enabled = cmd.enabled;
+                                return true;
+                            }
+
+                            return false;
+                        }
+                    }
+
+                    return false;
+                }
+
+                /**
+                 * @brief Lock-free command queue bridging any thread to the audio thread.
+                 *
+                 * Producers: any thread calling addRouting, removeRouting, etc.
+                 * Consumer:  audio thread inside drainCommands().
+                 */
+                CASPI::external::ConcurrentQueue<Command> pendingCommands { 2048 };
+
+                CASPI::external::ProducerToken producerToken { pendingCommands };
+
+                /**
+                 * @brief Fixed-capacity sorted list of linear (curve == Linear) routings.
+                 *
+                 * Footprint: MAX_MOD_ROUTINGS x sizeof(ModulationRouting<float>) = 24KB.
+                 */
+                List linearRoutings;
+
+                /**
+                 * @brief Fixed-capacity sorted list of non-linear (curved) routings.
+                 *
+                 * Footprint: MAX_MOD_ROUTINGS x sizeof(ModulationRouting<float>) = 24KB.
+                 */
+                List nonLinearRoutings;
+        };
+
         /*======================================================================
          * ModMatrix
          *====================================================================*/
@@ -460,6 +828,13 @@ namespace CASPI
         template <CASPI_FLOAT_TYPE FloatType>
         class ModMatrix : public Graph::AudioNode<ModMatrix<FloatType>, FloatType>
         {
+                using simd_type = typename SIMD::Strategy::simd_type<FloatType, SIMD::Strategy::min_simd_width<FloatType>::value>::type;
+
+                static constexpr std::size_t kLanes = SIMD::Strategy::min_simd_width<FloatType>::value;
+
+                /** @brief Curve plan capacity: every curved routing plus one SIMD width of padding per group. */
+                static constexpr std::size_t kCurvePlanCapacity = MAX_MOD_ROUTINGS + 3 * kLanes;
+
             public:
                 explicit ModMatrix (std::size_t numSources = 0)
                     : Graph::AudioNode<ModMatrix<FloatType>, FloatType> (numSources, 1)
@@ -471,73 +846,32 @@ namespace CASPI
                 // CRTP hooks — graph integration
                 // ====================================================================
 
-                void onPrepare (std::size_t, std::size_t, double)
+                void onPrepare (std::size_t, std::size_t numFrames, double)
                 {
+                    setMaxBlockSize (numFrames);
                     this->outputBuffer.clear();
                 }
 
                 void processImpl (Graph::AudioContext<FloatType>& ctx) noexcept
                 {
-                    for (std::size_t port = 0; port < numSources; ++port)
+                    for (std::size_t port = 0; port < numSources && port < MAX_MOD_SOURCES; ++port)
                     {
-                        const auto* buf    = ctx.getAudioInput (this->getId(), port);
-                        sourceValues[port] = (buf != nullptr) ? buf->sample (0, 0) : FloatType (0);
+                        const auto* buf     = ctx.getAudioInput (this->getId(), port);
+                        sourceValues[port]  = (buf != nullptr) ? buf->sample (0, 0) : FloatType (0);
+                        sourceBuffers[port] = (buf != nullptr) ? buf->channelData (0) : nullptr;
                     }
 
-                    process();
+                    process (ctx.getNumFrames());
 
                     this->outputBuffer.clear();
                 }
-                /*==============================================================
-                 * Command queue types
-                 *============================================================*/
-
-                /**
-                 * @brief Discriminates the mutation carried by a Command.
-                 */
-                enum class CommandType
-                {
-                    AddRouting, /**< Insert a routing into the appropriate list.    */
-                    RemoveLinear, /**< Remove by index from linearRoutings.           */
-                    RemoveNonLinear, /**< Remove by index from nonLinearRoutings.        */
-                    ClearRoutings, /**< Clear both routing lists.                      */
-                    SetEnabledLinear, /**< Toggle enabled flag in linearRoutings.         */
-                    SetEnabledNonLinear /**< Toggle enabled flag in nonLinearRoutings.    */
-                };
-
-                /**
-                 * @brief Payload carried through the lock-free command queue.
-                 *
-                 * Only the fields relevant to the CommandType are used;
-                 * the rest are default-initialised.
-                 */
-                struct Command
-                {
-                        /** @brief Which mutation to perform when dequeued. */
-                        CommandType type = CommandType::ClearRoutings;
-
-                        /** @brief Routing data; used by AddRouting only. */
-                        ModulationRouting<FloatType> routing {};
-
-                        /** @brief Target index; used by Remove* and SetEnabled*. */
-                        size_t index = 0;
-
-                        /** @brief New enabled state; used by SetEnabled* only. */
-                        bool enabled = false;
-                };
 
                 /*==============================================================
                  * Parameter registration (setup phase only - not thread-safe)
                  *============================================================*/
 
-                /**
-                 * @brief Error codes returned by registerParameter().
-                 */
-                enum class ParamRegistrationError
-                {
-                    NullParameter, /**< The supplied pointer was null.               */
-                    CapacityExceeded /**< MAX_MOD_PARAMS registrations already reached. */
-                };
+                /** @brief Error codes returned by registerParameter(). */
+                using ParamRegistrationError = Controls::ParamRegistrationError;
 
                 /**
                  * @brief Register a modulatable parameter with this matrix.
@@ -570,9 +904,27 @@ namespace CASPI
 
                     const size_t destId         = numParameters;
                     parameters[numParameters++] = parameter;
+                    audioModulation.resize (numParameters * audioStride);
                     return make_expected<size_t, ParamRegistrationError> (destId);
                 }
 
+                /**
+                 * @brief Size the per-sample modulation rows for audio-rate routings.
+                 *
+                 * Setup phase only, like registerParameter(). process(numFrames)
+                 * renders at most maxFrames frames of audio-rate modulation.
+                 *
+                 * @param maxFrames  Largest block passed to process(numFrames).
+                 */
+                void setMaxBlockSize (std::size_t maxFrames) CASPI_ALLOCATING
+                {
+                    constexpr std::size_t width = SIMD::Strategy::min_simd_width<FloatType>::value;
+
+                    maxBlockSize = maxFrames;
+                    audioStride  = (maxFrames + width - 1) / width * width;
+                    audioModulation.assign (numParameters * audioStride, FloatType (0));
+                }
+
                 /*==============================================================
                  * GUI / any-thread API - enqueues only, never mutates routing state
                  *============================================================*/
@@ -580,31 +932,20 @@ namespace CASPI
                 /**
                  * @brief Enqueue a routing for insertion on the next process() call.
                  *
-                 * May be called from any thread. The routing is dispatched to
-                 * linearRoutings or nonLinearRoutings according to routing.curve
-                 * when the command is dequeued by the audio thread.
-                 *
-                 * Depth is clamped to [-1, 1] here so the audio-thread accumulation
-                 * loop is unconditional.
+                 * May be called from any thread. See RoutingTable::addRouting().
                  *
                  * @param routing  Routing to add. depth is clamped to [-1, 1].
                  */
                 void addRouting (const ModulationRouting<FloatType>& routing) CASPI_NON_BLOCKING
                 {
-                    auto r  = routing;
-                    r.depth = Maths::clamp (r.depth, FloatType (-1), FloatType (1));
-                    pendingCommands.enqueue (producerToken, { CommandType::AddRouting, r, 0, false });
+                    routes.addRouting (routing);
                 }
 
                 /**
                  * @brief Enqueue removal of a routing by index, with the target list
                  *        selected at compile time via the Curve template parameter.
                  *
-                 * May be called from any thread. The list targeted is determined
-                 * entirely by the Curve template argument, not a runtime flag.
-                 *
-                 * When Curve == ModulationCurve::Linear (the default), the command
-                 * targets linearRoutings. Any other value targets nonLinearRoutings.
+                 * May be called from any thread.
                  *
                  * @code
                  *   matrix.removeRouting(0);                              // Linear (default)
@@ -617,9 +958,7 @@ namespace CASPI
                 template <ModulationCurve Curve = ModulationCurve::Linear>
                 void removeRouting (size_t index) CASPI_NON_BLOCKING
                 {
-                    constexpr CommandType t =
-                        detail::IsLinearCurve<Curve>::value ? CommandType::RemoveLinear : CommandType::RemoveNonLinear;
-                    pendingCommands.enqueue (producerToken, { t, {}, index, false });
+                    routes.template removeRouting<Curve> (index);
                 }
 
                 /**
@@ -630,7 +969,7 @@ namespace CASPI
                  */
                 void clearRoutings() CASPI_NON_BLOCKING
                 {
-                    pendingCommands.enqueue (producerToken, { CommandType::ClearRoutings, {}, 0, false });
+                    routes.clearRoutings();
                 }
 
                 /**
@@ -651,9 +990,7 @@ namespace CASPI
                 template <ModulationCurve Curve = ModulationCurve::Linear>
                 void setRoutingEnabled (size_t index, bool enabled) CASPI_NON_BLOCKING
                 {
-                    constexpr CommandType t = detail::IsLinearCurve<Curve>::value ? CommandType::SetEnabledLinear
-                                                                                  : CommandType::SetEnabledNonLinear;
-                    pendingCommands.enqueue (producerToken, { t, {}, index, enabled });
+                    routes.template setRoutingEnabled<Curve> (index, enabled);
                 }
 
                 /*==============================================================
@@ -677,6 +1014,26 @@ namespace CASPI
                     }
                 }
 
+                /**
+                 * @brief Supply a per-sample buffer for a source for the next process(numFrames).
+                 *
+                 * Must be called from the audio thread only. Audio-rate routings
+                 * from this source read numFrames samples from @p samples; the
+                 * pointer is forgotten once process() returns. Without a buffer,
+                 * audio-rate routings hold the source's setSourceValue() value.
+                 * Silently ignored if sourceId >= MAX_MOD_SOURCES.
+                 *
+                 * @param sourceId  Index into sourceBuffers[]. Range: [0, MAX_MOD_SOURCES).
+                 * @param samples   At least numFrames samples, or nullptr.
+                 */
+                void setSourceBuffer (size_t sourceId, const FloatType* samples) noexcept CASPI_NON_BLOCKING
+                {
+                    if (sourceId < MAX_MOD_SOURCES)
+                    {
+                        sourceBuffers[sourceId] = samples;
+                    }
+                }
+
                 /**
                  * @brief Read a modulation source value.
                  *
@@ -709,6 +1066,27 @@ namespace CASPI
                     return numParameters;
                 }
 
+                /**
+                 * @brief Return the per-sample modulation of a destination from the last process(numFrames).
+                 *
+                 * The buffer holds the block-rate sum plus every audio-rate
+                 * routing, clamped to [-1, 1], for numFrames samples. It is
+                 * nullptr when no enabled audio-rate routing targets the
+                 * destination; use the parameter's block value instead.
+                 *
+                 * @param destinationId  Destination ID from registerParameter().
+                 * @return               Pointer to numFrames samples, or nullptr.
+                 */
+                CASPI_NO_DISCARD const FloatType* getModulationBuffer (size_t destinationId) const noexcept CASPI_NON_BLOCKING
+                {
+                    if (destinationId >= numParameters || ! audioRowActive[destinationId])
+                    {
+                        return nullptr;
+                    }
+
+                    return audioModulation.data() + destinationId * audioStride;
+                }
+
                 /**
                  * @brief Return the total number of active routings across both lists.
                  *
@@ -716,7 +1094,7 @@ namespace CASPI
                  */
                 CASPI_NO_DISCARD size_t getNumRoutings() const noexcept CASPI_NON_BLOCKING
                 {
-                    return linearRoutings.size() + nonLinearRoutings.size();
+                    return routes.size();
                 }
 
                 /**
@@ -726,7 +1104,7 @@ namespace CASPI
                  */
                 CASPI_NO_DISCARD size_t getNumLinearRoutings() const noexcept CASPI_NON_BLOCKING
                 {
-                    return linearRoutings.size();
+                    return routes.linear().size();
                 }
 
                 /**
@@ -736,7 +1114,7 @@ namespace CASPI
                  */
                 CASPI_NO_DISCARD size_t getNumNonLinearRoutings() const noexcept CASPI_NON_BLOCKING
                 {
-                    return nonLinearRoutings.size();
+                    return routes.nonLinear().size();
                 }
 
                 /*==============================================================
@@ -751,15 +1129,36 @@ namespace CASPI
                  * Execution order:
                  *   1. drainCommands()       - apply pending GUI mutations
                  *   2. accumulateLinear()    - zero accum, FMA scatter-accumulate
-                 *   3. accumulateNonLinear() - scalar curved accumulation
-                 *   4. scatterToParameters() - SIMD clamp, push to parameter objects
+                 *   3. accumulateNonLinear() - SIMD curved accumulation, grouped by curve
+                 *   4. accumulateAudio()     - per-sample rows for audio-rate routings
+                 *   5. scatterToParameters() - SIMD clamp, push to parameter objects
+                 *
+                 * Audio-rate routings are only evaluated when numFrames > 0;
+                 * process() with no argument is block-rate only.
+                 *
+                 * A numFrames larger than setMaxBlockSize() fails a
+                 * CASPI_RT_ASSERT; once the handler returns, only the first
+                 * maxBlockSize frames of audio-rate modulation are rendered, so
+                 * getModulationBuffer() holds fewer than numFrames samples. If
+                 * setMaxBlockSize() was never called there are no per-sample
+                 * rows: audio-rate routings are dropped, getModulationBuffer()
+                 * returns nullptr and only block-rate routings reach the
+                 * parameters.
+                 *
+                 * @param numFrames  Frames of audio-rate modulation to render.
+                 *                   Must not exceed setMaxBlockSize().
                  */
-                void process() noexcept CASPI_NON_BLOCKING
+                void process (std::size_t numFrames = 0) noexcept CASPI_NON_BLOCKING
                 {
+                    CASPI_RT_ASSERT (numFrames <= maxBlockSize);
+
                     drainCommands();
                     accumulateLinear();
                     accumulateNonLinear();
+                    accumulateAudio (std::min (numFrames, maxBlockSize));
                     scatterToParameters();
+
+                    std::fill (sourceBuffers.begin(), sourceBuffers.end(), nullptr);
                 }
 
                 /**
@@ -775,6 +1174,9 @@ namespace CASPI
                 {
                     SIMD::ops::fill (sourceValues.data(), MAX_MOD_SOURCES, FloatType (0));
                     SIMD::ops::fill (modulationAccum.data(), numParameters, FloatType (0));
+                    std::fill (sourceBuffers.begin(), sourceBuffers.end(), nullptr);
+                    std::fill (audioRowActive.begin(), audioRowActive.end(), false);
+                    audioFrames = 0;
 
                     for (size_t i = 0; i < numParameters; ++i)
                     {
@@ -788,18 +1190,15 @@ namespace CASPI
                  *============================================================*/
 
                 /**
-                 * @brief Drain the pending command queue and apply each mutation.
+                 * @brief Apply pending routing commands; mark the curve plan stale if the curved list changed.
                  *
                  * Called at the top of process() before any accumulation.
-                 * try_dequeue is wait-free on the consumer side.
                  */
                 void drainCommands() noexcept CASPI_NON_BLOCKING
                 {
-                    Command cmd;
-
-                    while (pendingCommands.try_dequeue (cmd))
+                    if (routes.drainCommands (numParameters))
                     {
-                        applyCommand (cmd);
+                        curvePlanDirty = true;
                     }
                 }
 
@@ -827,12 +1226,12 @@ namespace CASPI
                     const FloatType* CASPI_RESTRICT sources = sourceValues.data();
                     FloatType* CASPI_RESTRICT accum         = modulationAccum.data();
 
-                    const auto* CASPI_RESTRICT routings = linearRoutings.begin();
-                    const auto* CASPI_RESTRICT end      = linearRoutings.end();
+                    const auto* CASPI_RESTRICT routings = routes.linear().begin();
+                    const auto* CASPI_RESTRICT end      = routes.linear().end();
 
                     for (; routings != end; ++routings)
                     {
-                        if (! routings->enabled)
+                        if (! routings->enabled || routings->rate != ModulationRate::Block)
                         {
                             continue;
                         }
@@ -848,128 +1247,246 @@ namespace CASPI
                 }
 
                 /**
-                 * @brief Scalar accumulation pass for non-linear (curve-shaped) routings.
+                 * @brief SIMD accumulation pass for non-linear (curve-shaped) routings.
                  *
                  * Adds curve-shaped, depth-scaled source values into the same
-                 * modulationAccum[] array written by accumulateLinear().
-                 * Non-linear routings are expected to be a minority in practice.
+                 * modulationAccum[] array written by accumulateLinear(), one
+                 * curve group of the plan at a time.
                  */
                 void accumulateNonLinear() noexcept CASPI_NON_BLOCKING
                 {
                     Core::ScopedFlushDenormals flush;
 
+                    if (curvePlanDirty)
+                    {
+                        rebuildCurvePlan();
+                    }
+
+                    accumulateCurveGroup<ModulationCurve::Exponential> (curveGroupBegin[0], curveGroupBegin[1]);
+                    accumulateCurveGroup<ModulationCurve::Logarithmic> (curveGroupBegin[1], curveGroupBegin[2]);
+                    accumulateCurveGroup<ModulationCurve::SCurve> (curveGroupBegin[2], curveGroupBegin[3]);
+                }
+
+                /**
+                 * @brief Accumulate plan entries [begin, end), all using curve C.
+                 *
+                 * Gathers kLanes source values, shapes and scales them in one
+                 * SIMD pass, then adds each lane to its destination. The scatter
+                 * stays scalar because lanes may share a destination.
+                 */
+                template <ModulationCurve C>
+                void accumulateCurveGroup (std::size_t begin, std::size_t end) noexcept CASPI_NON_BLOCKING
+                {
                     const FloatType* CASPI_RESTRICT sources = sourceValues.data();
                     FloatType* CASPI_RESTRICT accum         = modulationAccum.data();
 
-                    const auto* CASPI_RESTRICT routings = nonLinearRoutings.begin();
-                    const auto* CASPI_RESTRICT end      = nonLinearRoutings.end();
+                    alignas (SIMD::Strategy::simd_alignment<FloatType>()) FloatType contribution[kLanes];
 
-                    for (; routings != end; ++routings)
+                    for (std::size_t i = begin; i < end; i += kLanes)
                     {
-                        if (! routings->enabled)
+                        const simd_type x = SIMD::gather (sources, SIMD::load_aligned<FloatType> (curveSource.data() + i));
+                        const simd_type c = SIMD::mul (detail::applyCurve<C, FloatType> (x), SIMD::load_aligned<FloatType> (curveDepth.data() + i));
+                        SIMD::store_aligned (contribution, c);
+
+                        for (std::size_t k = 0; k < kLanes; ++k)
                         {
-                            continue;
+                            accum[curveDestination[i + k]] += contribution[k];
                         }
-
-                        const size_t src = routings->sourceId;
-                        const size_t dst = routings->destinationId;
-
-                        CASPI_RT_ASSERT (src < MAX_MOD_SOURCES);
-                        CASPI_RT_ASSERT (dst < numParameters);
-
-                        const FloatType curved  = routings->applyCurve (sources[src]);
-                        accum[dst]             += curved * routings->depth;
                     }
                 }
 
                 /**
-                 * @brief SIMD clamp the accumulator then scatter values to parameters.
+                 * @brief Rebuild the curve plan from nonLinearRoutings.
                  *
-                 * ops::clamp applies ClampKernel over the contiguous accumulator array,
-                 * processing 4 or 8 floats per cycle (SSE / AVX). The subsequent
-                 * parameter scatter performs one pointer dereference per parameter,
-                 * not per routing.
+                 * Enabled block-rate routings are copied group by group, in
+                 * list (destination) order; each group is padded to kLanes
+                 * with zero-depth entries on source 0 and destination 0.
                  */
-                void scatterToParameters() noexcept CASPI_NON_BLOCKING
+                void rebuildCurvePlan() noexcept CASPI_NON_BLOCKING
                 {
-                    SIMD::ops::clamp (modulationAccum.data(), FloatType (-1), FloatType (1), numParameters);
+                    constexpr ModulationCurve groups[] = { ModulationCurve::Exponential, ModulationCurve::Logarithmic, ModulationCurve::SCurve };
 
-                    for (size_t i = 0; i < numParameters; ++i)
+                    std::size_t n = 0;
+
+                    for (std::size_t g = 0; g < 3; ++g)
                     {
-                        parameters[i]->clearModulation();
-                        parameters[i]->addModulation (modulationAccum[i]);
+                        curveGroupBegin[g] = n;
+
+                        for (const auto& r : routes.nonLinear())
+                        {
+                            if (r.curve != groups[g] || ! r.enabled || r.rate != ModulationRate::Block)
+                            {
+                                continue;
+                            }
+
+                            CASPI_RT_ASSERT (r.sourceId < MAX_MOD_SOURCES);
+                            CASPI_RT_ASSERT (r.destinationId < numParameters);
+
+                            curveSource[n]      = static_cast<FloatType> (r.sourceId);
+                            curveDepth[n]       = r.depth;
+                            curveDestination[n] = static_cast<std::uint16_t> (r.destinationId);
+                            ++n;
+                        }
+
+                        for (; n % kLanes != 0; ++n)
+                        {
+                            curveSource[n]      = FloatType (0);
+                            curveDepth[n]       = FloatType (0);
+                            curveDestination[n] = 0;
+                        }
                     }
+
+                    curveGroupBegin[3] = n;
+                    curvePlanDirty     = false;
                 }
 
                 /**
-                 * @brief Apply a single command dequeued from pendingCommands.
+                 * @brief Build per-sample rows for destinations with audio-rate routings.
                  *
-                 * Called exclusively from drainCommands() on the audio thread.
+                 * Each touched row starts from the destination's block-rate sum,
+                 * then every audio-rate routing adds its source buffer with one
+                 * ops::accumulate_with_gain span. Curved routings go through
+                 * accumulateCurveSpan(). Rows are clamped later, with the
+                 * block accumulator, in scatterToParameters().
                  *
-                 * @param cmd  Command to execute.
+                 * @param numFrames  Frames per row; zero skips the pass.
                  */
-                void applyCommand (const Command& cmd) noexcept CASPI_NON_BLOCKING
+                void accumulateAudio (std::size_t numFrames) noexcept CASPI_NON_BLOCKING
                 {
-                    switch (cmd.type)
+                    std::fill (audioRowActive.begin(), audioRowActive.begin() + numParameters, false);
+                    audioFrames = numFrames;
+
+                    if (numFrames == 0)
                     {
-                        case CommandType::AddRouting:
-                        {
-                            const auto& r = cmd.routing;
+                        return;
+                    }
+
+                    Core::ScopedFlushDenormals flush;
 
-                            if (r.sourceId >= MAX_MOD_SOURCES || r.destinationId >= numParameters)
+                    for (const auto* list : { &routes.linear(), &routes.nonLinear() })
+                    {
+                        for (const auto& r : *list)
+                        {
+                            if (! r.enabled || r.rate != ModulationRate::Audio)
                             {
-                                break;
+                                continue;
                             }
 
-                            if (r.curve == ModulationCurve::Linear)
+                            CASPI_RT_ASSERT (r.sourceId < MAX_MOD_SOURCES);
+                            CASPI_RT_ASSERT (r.destinationId < numParameters);
+
+                            FloatType* CASPI_RESTRICT row = audioRow (r.destinationId);
+                            const FloatType* CASPI_RESTRICT src = sourceBuffers[r.sourceId];
+
+                            if (src == nullptr)
                             {
-                                linearRoutings.insert (r);
+                                // Block-rate source on an audio-rate routing: a constant offset
+                                const FloatType offset = r.applyCurve (sourceValues[r.sourceId]) * r.depth;
+                                for (std::size_t i = 0; i < numFrames; ++i)
+                                {
+                                    row[i] += offset;
+                                }
+                            }
+                            else if (r.curve == ModulationCurve::Linear)
+                            {
+                                SIMD::ops::accumulate_with_gain (row, src, numFrames, r.depth);
                             }
                             else
                             {
-                                nonLinearRoutings.insert (r);
+                                accumulateCurveSpan (r, row, src, numFrames);
                             }
-
-                            break;
                         }
+                    }
+                }
 
-                        case CommandType::RemoveLinear:
-                        {
-                            linearRoutings.removeAt (cmd.index);
+                /**
+                 * @brief row[i] += curve(src[i]) * depth for a curved audio-rate routing.
+                 *
+                 * Dispatches once on the routing's curve, then runs
+                 * detail::applyCurve over the span a SIMD width at a time.
+                 */
+                static void accumulateCurveSpan (const ModulationRouting<FloatType>& r,
+                                                 FloatType* CASPI_RESTRICT row,
+                                                 const FloatType* CASPI_RESTRICT src,
+                                                 std::size_t numFrames) noexcept CASPI_NON_BLOCKING
+                {
+                    switch (r.curve)
+                    {
+                        case ModulationCurve::Exponential:
+                            accumulateCurveSpan<ModulationCurve::Exponential> (r, row, src, numFrames);
                             break;
-                        }
-
-                        case CommandType::RemoveNonLinear:
-                        {
-                            nonLinearRoutings.removeAt (cmd.index);
+                        case ModulationCurve::Logarithmic:
+                            accumulateCurveSpan<ModulationCurve::Logarithmic> (r, row, src, numFrames);
                             break;
-                        }
-
-                        case CommandType::ClearRoutings:
-                        {
-                            linearRoutings.clear();
-                            nonLinearRoutings.clear();
+                        case ModulationCurve::SCurve:
+                            accumulateCurveSpan<ModulationCurve::SCurve> (r, row, src, numFrames);
                             break;
-                        }
+                        default:
+                            SIMD::ops::accumulate_with_gain (row, src, numFrames, r.depth);
+                            break;
+                    }
+                }
 
-                        case CommandType::SetEnabledLinear:
-                        {
-                            if (cmd.index < linearRoutings.size())
-                            {
-                                linearRoutings[cmd.index].enabled = cmd.enabled;
-                            }
+                template <ModulationCurve C>
+                static void accumulateCurveSpan (const ModulationRouting<FloatType>& r,
+                                                 FloatType* CASPI_RESTRICT row,
+                                                 const FloatType* CASPI_RESTRICT src,
+                                                 std::size_t numFrames) noexcept CASPI_NON_BLOCKING
+                {
+                    const simd_type depth = SIMD::set1<FloatType> (r.depth);
 
-                            break;
-                        }
+                    std::size_t i = 0;
+                    for (; i + kLanes <= numFrames; i += kLanes)
+                    {
+                        const simd_type curved = detail::applyCurve<C, FloatType> (SIMD::load_unaligned<FloatType> (src + i));
+                        SIMD::store_unaligned (row + i, SIMD::mul_add (curved, depth, SIMD::load_unaligned<FloatType> (row + i)));
+                    }
 
-                        case CommandType::SetEnabledNonLinear:
-                        {
-                            if (cmd.index < nonLinearRoutings.size())
-                            {
-                                nonLinearRoutings[cmd.index].enabled = cmd.enabled;
-                            }
+                    for (; i < numFrames; ++i)
+                    {
+                        row[i] += r.applyCurve (src[i]) * r.depth;
+                    }
+                }
 
-                            break;
+                /**
+                 * @brief Return a destination's row, seeding it with the block sum on first use.
+                 *
+                 * @param destinationId  Destination ID, < numParameters.
+                 * @return               Row of audioFrames samples.
+                 */
+                FloatType* audioRow (size_t destinationId) noexcept CASPI_NON_BLOCKING
+                {
+                    FloatType* row = audioModulation.data() + destinationId * audioStride;
+
+                    if (! audioRowActive[destinationId])
+                    {
+                        audioRowActive[destinationId] = true;
+                        std::fill_n (row, audioFrames, modulationAccum[destinationId]);
+                    }
+
+                    return row;
+                }
+
+                /**
+                 * @brief SIMD clamp the accumulator then scatter values to parameters.
+                 *
+                 * ops::clamp applies ClampKernel over the contiguous accumulator array,
+                 * processing 4 or 8 floats per cycle (SSE / AVX). The subsequent
+                 * parameter scatter performs one pointer dereference per parameter,
+                 * not per routing.
+                 */
+                void scatterToParameters() noexcept CASPI_NON_BLOCKING
+                {
+                    SIMD::ops::clamp (modulationAccum.data(), FloatType (-1), FloatType (1), numParameters);
+
+                    for (size_t i = 0; i < numParameters; ++i)
+                    {
+                        parameters[i]->clearModulation();
+                        parameters[i]->addModulation (modulationAccum[i]);
+
+                        if (audioRowActive[i])
+                        {
+                            SIMD::ops::clamp (audioModulation.data() + i * audioStride, FloatType (-1), FloatType (1), audioFrames);
                         }
                     }
                 }
@@ -978,15 +1495,9 @@ namespace CASPI
                  * Data members
                  *============================================================*/
                 std::size_t numSources = 0;
-                /**
-                 * @brief Lock-free command queue bridging any thread to the audio thread.
-                 *
-                 * Producers: any thread calling addRouting, removeRouting, etc.
-                 * Consumer:  audio thread inside drainCommands().
-                 */
-                CASPI::external::ConcurrentQueue<Command> pendingCommands { 2048 };
 
-                CASPI::external::ProducerToken producerToken { pendingCommands };
+                /** @brief Sorted routing lists and the command queue that edits them. */
+                RoutingTable<FloatType> routes;
 
                 /**
                  * @brief Source values written by the audio thread each block.
@@ -997,6 +1508,14 @@ namespace CASPI
                 alignas (
                     SIMD::Strategy::simd_alignment<FloatType>()) std::array<FloatType, MAX_MOD_SOURCES> sourceValues {};
 
+                /**
+                 * @brief Per-sample source buffers for the next process(numFrames).
+                 *
+                 * Set by setSourceBuffer() and cleared when process() returns.
+                 * nullptr means audio-rate routings hold sourceValues[].
+                 */
+                std::array<const FloatType*, MAX_MOD_SOURCES> sourceBuffers {};
+
                 /**
                  * @brief Flat per-parameter modulation accumulator.
                  *
@@ -1024,20 +1543,42 @@ namespace CASPI
                 size_t numParameters = 0;
 
                 /**
-                 * @brief Fixed-capacity sorted list of linear (curve == Linear) routings.
+                 * @brief Per-sample modulation rows, audioStride samples per parameter.
                  *
-                 * Processed in accumulateLinear() via the FMA-eligible scatter loop.
-                 * Stack footprint: MAX_MOD_ROUTINGS x sizeof(ModulationRouting<float>) = 24KB.
+                 * Sized by setMaxBlockSize() and registerParameter(), never on
+                 * the audio thread. Only rows flagged in audioRowActive[] hold
+                 * valid data after process(numFrames).
                  */
-                RoutingList<FloatType, MAX_MOD_ROUTINGS> linearRoutings;
+                std::vector<FloatType> audioModulation;
 
-                /**
-                 * @brief Fixed-capacity sorted list of non-linear (curved) routings.
-                 *
-                 * Processed in accumulateNonLinear() via the scalar path.
-                 * Stack footprint: MAX_MOD_ROUTINGS x sizeof(ModulationRouting<float>) = 24KB.
-                 */
-                RoutingList<FloatType, MAX_MOD_ROUTINGS> nonLinearRoutings;
+                /** @brief True for destinations with an audio-rate routing in the last block. */
+                std::array<bool, MAX_MOD_PARAMS> audioRowActive {};
+
+                /** @brief Largest numFrames accepted by process(). */
+                std::size_t maxBlockSize = 0;
+
+                /** @brief Row stride: maxBlockSize rounded up to the SIMD width. */
+                std::size_t audioStride = 0;
+
+                /** @brief Frames rendered into the active rows by the last process(). */
+                std::size_t audioFrames = 0;
+
+                /** @brief Curve plan: source index per entry, as FloatType for SIMD::gather. */
+                alignas (SIMD::Strategy::simd_alignment<FloatType>())
+                    std::array<FloatType, kCurvePlanCapacity> curveSource {};
+
+                /** @brief Curve plan: depth per entry; zero for padding. */
+                alignas (SIMD::Strategy::simd_alignment<FloatType>())
+                    std::array<FloatType, kCurvePlanCapacity> curveDepth {};
+
+                /** @brief Curve plan: destination per entry. */
+                std::array<std::uint16_t, kCurvePlanCapacity> curveDestination {};
+
+                /** @brief Start of the Exponential, Logarithmic and SCurve groups, then the end. */
+                std::array<std::size_t, 4> curveGroupBegin {};
+
+                /** @brief Set when a drained command touched the curved routing list. */
+                bool curvePlanDirty = false;
         };
 
     } /* namespace Controls */
@@ -0,0 +1,564 @@
+#ifndef CASPI_POLY_MODULATION_MATRIX_H
+#define CASPI_POLY_MODULATION_MATRIX_H
+
+/*************************************************************************
+ * @file caspi_PolyModMatrix.h
+ *
+ * ARCHITECTURE
+ *
+ * One routing table for every voice of a synth. A ModMatrix per voice
+ * duplicates the routing lists (2 x 1024 routings), the command queue
+ * and the queue draining NumVoices times; PolyModMatrix keeps one copy
+ * of each and stores only the values that differ per voice:
+ *
+ *   sourceValues[source][voice]      one SIMD-aligned row per source
+ *   modulationAccum[dest][voice]     one SIMD-aligned row per destination
+ *
+ * Rows are kStride = NumVoices rounded up to the SIMD width, so a
+ * routing is evaluated for every voice with kStride / width multiply-
+ * adds:
+ *
+ *   accum[dst][:] += source[src][:] * depth        SIMD across voices
+ *
+ * Routings live in a RoutingTable, the type ModMatrix also holds: the
+ * same sorted lists, lock-free command queue and compile-time list
+ * selection (removeRouting<Curve>, setRoutingEnabled<Curve>), applied
+ * by the same code.
+ *
+ * DESTINATIONS
+ *
+ *   registerVoiceParameter()   one ModulatableParameter per voice; the
+ *                              routing runs across all voice lanes and
+ *                              each active voice's parameter receives
+ *                              its own lane.
+ *   registerGlobalParameter()  one parameter shared by all voices (a
+ *                              master filter, an effect send). Routings
+ *                              into it run once per block, scalar, on
+ *                              the source's first lane: route only
+ *                              voice-independent sources (set with the
+ *                              broadcasting setSourceValue()) to it.
+ *
+ * Per-block flow (process()):
+ *
+ *   routes.drainCommands()
+ *   accumulateLinear()      ops::fill zero, then SIMD rows / scalar globals
+ *   accumulateNonLinear()   detail::applyCurve across lanes / scalar globals
+ *   scatterToParameters()   ops::clamp, then active voices and globals
+ *
+ * Every routing is evaluated at block rate; ModulationRouting::rate is
+ * ignored here.
+ *
+ * Thread safety model: as ModMatrix. Registration during setup only,
+ * routing mutations from any thread, everything else on the audio thread.
+ *
+ ************************************************************************/
+
+/*------------------------------------------------------------------------------
+ * Includes - System
+ *----------------------------------------------------------------------------*/
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/*------------------------------------------------------------------------------
+ * Includes - Project
+ *----------------------------------------------------------------------------*/
+#include "base/caspi_Assert.h"
+#include "base/caspi_SIMD.h"
+#include "base/SIMD/caspi_Blocks.h"
+#include "controls/caspi_ModMatrix.h"
+#include "core/caspi_Expected.h"
+#include "core/caspi_Parameter.h"
+
+namespace CASPI
+{
+    namespace Controls
+    {
+        /*======================================================================
+         * PolyModMatrix
+         *====================================================================*/
+
+        /**
+         * @brief Modulation matrix shared by NumVoices voices, evaluated with SIMD across voices.
+         *
+         * See file-level architecture comment for full design description.
+         *
+         * @tparam FloatType  Floating-point scalar type (float or double).
+         * @tparam NumVoices  Number of voice lanes, 1 to 64 (one bit each in a Mask).
+         */
+        template <CASPI_FLOAT_TYPE FloatType, std::size_t NumVoices = 16>
+        class PolyModMatrix
+        {
+                static_assert (NumVoices >= 1 && NumVoices <= 64, "PolyModMatrix holds between 1 and 64 voices");
+
+                using simd_type = typename SIMD::Strategy::simd_type<FloatType, SIMD::Strategy::min_simd_width<FloatType>::value>::type;
+
+                static constexpr std::size_t kLanes = SIMD::Strategy::min_simd_width<FloatType>::value;
+
+            public:
+                /** @brief One bit per voice, bit v for voice v. */
+                using Mask = std::uint64_t;
+
+                /** @brief Distance between the rows of sourceValues[] and modulationAccum[]. */
+                static constexpr std::size_t kStride = (NumVoices + kLanes - 1) / kLanes * kLanes;
+
+                /** @brief Every voice bit set. */
+                static constexpr Mask kAllVoices = NumVoices == 64 ? ~Mask (0) : (Mask (1) << NumVoices) - 1;
+
+                /** @brief One parameter pointer per voice, as passed to registerVoiceParameter(). */
+                using VoiceParameters = std::array<Core::ModulatableParameter<FloatType>*, NumVoices>;
+
+                /*==============================================================
+                 * Parameter registration (setup phase only - not thread-safe)
+                 *============================================================*/
+
+                /** @brief Error codes returned by registerVoiceParameter() and registerGlobalParameter(). */
+                using ParamRegistrationError = Controls::ParamRegistrationError;
+
+                /**
+                 * @brief Register a parameter that exists once per voice.
+                 *
+                 * Setup phase only. The caller retains ownership; every pointer
+                 * must remain valid for the lifetime of this matrix.
+                 *
+                 * @param perVoice  Voice v's parameter at index v; none may be null.
+                 * @return          Destination ID for use in addRouting(), or an error.
+                 */
+                expected<size_t, ParamRegistrationError> registerVoiceParameter (const VoiceParameters& perVoice) CASPI_ALLOCATING
+                {
+                    for (const auto* parameter : perVoice)
+                    {
+                        CASPI_EXPECT (parameter != nullptr, "Cannot register null parameter");
+
+                        if (parameter == nullptr)
+                        {
+                            return make_unexpected<size_t, ParamRegistrationError> (ParamRegistrationError::NullParameter);
+                        }
+                    }
+
+                    if (numParameters >= MAX_MOD_PARAMS)
+                    {
+                        return make_unexpected<size_t, ParamRegistrationError> (ParamRegistrationError::CapacityExceeded);
+                    }
+
+                    const size_t destId     = numParameters++;
+                    parameters[destId]      = perVoice;
+                    globalParameter[destId] = false;
+                    return make_expected<size_t, ParamRegistrationError> (destId);
+                }
+
+                /**
+                 * @brief Register a parameter shared by all voices.
+                 *
+                 * Setup phase only. Routings into it are evaluated once per
+                 * block from the first lane of their source.
+                 *
+                 * @param parameter  Non-null pointer to a ModulatableParameter.
+                 * @return           Destination ID for use in addRouting(), or an error.
+                 */
+                expected<size_t, ParamRegistrationError> registerGlobalParameter (
+                    Core::ModulatableParameter<FloatType>* parameter) CASPI_ALLOCATING
+                {
+                    CASPI_EXPECT (parameter != nullptr, "Cannot register null parameter");
+
+                    if (parameter == nullptr)
+                    {
+                        return make_unexpected<size_t, ParamRegistrationError> (ParamRegistrationError::NullParameter);
+                    }
+
+                    if (numParameters >= MAX_MOD_PARAMS)
+                    {
+                        return make_unexpected<size_t, ParamRegistrationError> (ParamRegistrationError::CapacityExceeded);
+                    }
+
+                    const size_t destId     = numParameters++;
+                    parameters[destId]      = {};
+                    parameters[destId][0]   = parameter;
+                    globalParameter[destId] = true;
+                    return make_expected<size_t, ParamRegistrationError> (destId);
+                }
+
+                /*==============================================================
+                 * GUI / any-thread API - enqueues only, never mutates routing state
+                 *============================================================*/
+
+                /**
+                 * @brief Enqueue a routing for insertion on the next process() call.
+                 *
+                 * @param routing  Routing to add. depth is clamped to [-1, 1].
+                 */
+                void addRouting (const ModulationRouting<FloatType>& routing) CASPI_NON_BLOCKING
+                {
+                    routes.addRouting (routing);
+                }
+
+                /**
+                 * @brief Enqueue removal of a routing by index within the list selected by Curve.
+                 *
+                 * @tparam Curve  Compile-time curve selector. Defaults to Linear.
+                 * @param index   Zero-based position within the target list.
+                 */
+                template <ModulationCurve Curve = ModulationCurve::Linear>
+                void removeRouting (size_t index) CASPI_NON_BLOCKING
+                {
+                    routes.template removeRouting<Curve> (index);
+                }
+
+                /**
+                 * @brief Enqueue a command to clear all routings from both lists.
+                 */
+                void clearRoutings() CASPI_NON_BLOCKING
+                {
+                    routes.clearRoutings();
+                }
+
+                /**
+                 * @brief Enqueue a change to the enabled state of a routing in the list selected by Curve.
+                 *
+                 * @tparam Curve    Compile-time curve selector. Defaults to Linear.
+                 * @param index     Zero-based position within the target list.
+                 * @param enabled   New enabled state for the routing at index.
+                 */
+                template <ModulationCurve Curve = ModulationCurve::Linear>
+                void setRoutingEnabled (size_t index, bool enabled) CASPI_NON_BLOCKING
+                {
+                    routes.template setRoutingEnabled<Curve> (index, enabled);
+                }
+
+                /*==============================================================
+                 * Source values and voices - audio thread only
+                 *============================================================*/
+
+                /**
+                 * @brief Write a source value for every voice (a global LFO, a macro).
+                 *
+                 * Silently ignored if sourceId >= MAX_MOD_SOURCES.
+                 *
+                 * @param sourceId  Range: [0, MAX_MOD_SOURCES).
+                 * @param value     Source value, typically in [-1, 1] or [0, 1].
+                 */
+                void setSourceValue (size_t sourceId, FloatType value) noexcept CASPI_NON_BLOCKING
+                {
+                    if (sourceId < MAX_MOD_SOURCES)
+                    {
+                        std::fill_n (sourceValues.data() + sourceId * kStride, kStride, value);
+                    }
+                }
+
+                /**
+                 * @brief Write one voice's source value (its envelope, its velocity).
+                 *
+                 * Silently ignored if sourceId >= MAX_MOD_SOURCES or voice >= NumVoices.
+                 *
+                 * @param sourceId  Range: [0, MAX_MOD_SOURCES).
+                 * @param voice     Range: [0, NumVoices).
+                 * @param value     Source value, typically in [-1, 1] or [0, 1].
+                 */
+                void setSourceValue (size_t sourceId, size_t voice, FloatType value) noexcept CASPI_NON_BLOCKING
+                {
+                    if (sourceId < MAX_MOD_SOURCES && voice < NumVoices)
+                    {
+                        sourceValues[sourceId * kStride + voice] = value;
+                    }
+                }
+
+                /**
+                 * @brief Read one voice's source value.
+                 *
+                 * @return Stored value, or FloatType(0) if either index is out of range.
+                 */
+                CASPI_NO_DISCARD FloatType getSourceValue (size_t sourceId, size_t voice) const noexcept CASPI_NON_BLOCKING
+                {
+                    if (sourceId < MAX_MOD_SOURCES && voice < NumVoices)
+                    {
+                        return sourceValues[sourceId * kStride + voice];
+                    }
+
+                    return FloatType (0);
+                }
+
+                /**
+                 * @brief Choose which voices' parameters process() writes.
+                 *
+                 * Every lane is still evaluated (it costs the same SIMD work);
+                 * inactive voices' parameters are left untouched. All voices
+                 * are active by default. EnvelopeBank::getActiveMask() fits here
+                 * directly.
+                 *
+                 * @param mask  Bit v set for each active voice.
+                 */
+                void setActiveVoices (Mask mask) noexcept CASPI_NON_BLOCKING
+                {
+                    activeVoices = mask & kAllVoices;
+                }
+
+                /** @brief Voices whose parameters process() writes. */
+                CASPI_NO_DISCARD Mask getActiveVoices() const noexcept CASPI_NON_BLOCKING
+                {
+                    return activeVoices;
+                }
+
+                /*==============================================================
+                 * Observers - audio thread only, reflect state after last process()
+                 *============================================================*/
+
+                /**
+                 * @brief Clamped modulation of a destination for one voice after the last process().
+                 *
+                 * Global destinations return the same value for every voice.
+                 *
+                 * @return Modulation in [-1, 1], or FloatType(0) if either index is out of range.
+                 */
+                CASPI_NO_DISCARD FloatType getModulation (size_t destinationId, size_t voice) const noexcept CASPI_NON_BLOCKING
+                {
+                    if (destinationId >= numParameters || voice >= NumVoices)
+                    {
+                        return FloatType (0);
+                    }
+
+                    return modulationAccum[destinationId * kStride + (globalParameter[destinationId] ? 0 : voice)];
+                }
+
+                /** @brief True if the destination was registered with registerGlobalParameter(). */
+                CASPI_NO_DISCARD bool isGlobalParameter (size_t destinationId) const noexcept CASPI_NON_BLOCKING
+                {
+                    return destinationId < numParameters && globalParameter[destinationId];
+                }
+
+                /** @brief Number of registered destinations, voice and global. */
+                CASPI_NO_DISCARD size_t getNumParameters() const noexcept CASPI_NON_BLOCKING
+                {
+                    return numParameters;
+                }
+
+                /** @brief Total number of routings across both lists. */
+                CASPI_NO_DISCARD size_t getNumRoutings() const noexcept CASPI_NON_BLOCKING
+                {
+                    return routes.size();
+                }
+
+                /** @brief Number of linear routings. */
+                CASPI_NO_DISCARD size_t getNumLinearRoutings() const noexcept CASPI_NON_BLOCKING
+                {
+                    return routes.linear().size();
+                }
+
+                /** @brief Number of non-linear routings. */
+                CASPI_NO_DISCARD size_t getNumNonLinearRoutings() const noexcept CASPI_NON_BLOCKING
+                {
+                    return routes.nonLinear().size();
+                }
+
+                /*==============================================================
+                 * Audio thread - main process
+                 *============================================================*/
+
+                /**
+                 * @brief Process all routings for every voice for one block.
+                 *
+                 * Execution order:
+                 *   1. routes.drainCommands() - apply pending GUI mutations, once for all voices
+                 *   2. accumulateLinear()     - zero accum, SIMD rows across voices
+                 *   3. accumulateNonLinear()  - SIMD curved accumulation across voices
+                 *   4. scatterToParameters()  - SIMD clamp, push to active voices and globals
+                 */
+                void process() noexcept CASPI_NON_BLOCKING
+                {
+                    routes.drainCommands (numParameters);
+                    accumulateLinear();
+                    accumulateNonLinear();
+                    scatterToParameters();
+                }
+
+                /**
+                 * @brief Zero all source values and clear modulation on every parameter.
+                 *
+                 * Routings and the active voice mask are preserved.
+                 */
+                void reset() noexcept CASPI_NON_BLOCKING
+                {
+                    SIMD::ops::fill (sourceValues.data(), sourceValues.size(), FloatType (0));
+                    SIMD::ops::fill (modulationAccum.data(), numParameters * kStride, FloatType (0));
+
+                    for (size_t i = 0; i < numParameters; ++i)
+                    {
+                        for (auto* parameter : parameters[i])
+                        {
+                            if (parameter != nullptr)
+                            {
+                                parameter->clearModulation();
+                            }
+                        }
+                    }
+                }
+
+            private:
+                /*==============================================================
+                 * Process steps (audio thread only)
+                 *============================================================*/
+
+                /**
+                 * @brief Zero the accumulator rows then accumulate linear routings.
+                 *
+                 * Voice destinations: one SIMD multiply-add per kLanes voices.
+                 * Global destinations: one scalar multiply-add on lane 0.
+                 */
+                void accumulateLinear() noexcept CASPI_NON_BLOCKING
+                {
+                    Core::ScopedFlushDenormals flush;
+
+                    SIMD::ops::fill (modulationAccum.data(), numParameters * kStride, FloatType (0));
+
+                    const FloatType* CASPI_RESTRICT sources = sourceValues.data();
+                    FloatType* CASPI_RESTRICT accum         = modulationAccum.data();
+
+                    for (const auto& r : routes.linear())
+                    {
+                        if (! r.enabled)
+                        {
+                            continue;
+                        }
+
+                        CASPI_RT_ASSERT (r.sourceId < MAX_MOD_SOURCES);
+                        CASPI_RT_ASSERT (r.destinationId < numParameters);
+
+                        const FloatType* CASPI_RESTRICT src = sources + r.sourceId * kStride;
+                        FloatType* CASPI_RESTRICT dst       = accum + r.destinationId * kStride;
+
+                        if (globalParameter[r.destinationId])
+                        {
+                            dst[0] += src[0] * r.depth;
+                            continue;
+                        }
+
+                        const simd_type depth = SIMD::set1<FloatType> (r.depth);
+                        for (std::size_t i = 0; i < kStride; i += kLanes)
+                        {
+                            SIMD::store_aligned (dst + i,
+                                                 SIMD::mul_add (SIMD::load_aligned<FloatType> (src + i),
+                                                                depth,
+                                                                SIMD::load_aligned<FloatType> (dst + i)));
+                        }
+                    }
+                }
+
+                /**
+                 * @brief Curved accumulation: detail::applyCurve across voice lanes, scalar lane 0 for globals.
+                 */
+                void accumulateNonLinear() noexcept CASPI_NON_BLOCKING
+                {
+                    Core::ScopedFlushDenormals flush;
+
+                    const FloatType* CASPI_RESTRICT sources = sourceValues.data();
+                    FloatType* CASPI_RESTRICT accum         = modulationAccum.data();
+
+                    for (const auto& r : routes.nonLinear())
+                    {
+                        if (! r.enabled)
+                        {
+                            continue;
+                        }
+
+                        CASPI_RT_ASSERT (r.sourceId < MAX_MOD_SOURCES);
+                        CASPI_RT_ASSERT (r.destinationId < numParameters);
+
+                        const FloatType* CASPI_RESTRICT src = sources + r.sourceId * kStride;
+                        FloatType* CASPI_RESTRICT dst       = accum + r.destinationId * kStride;
+
+                        if (globalParameter[r.destinationId])
+                        {
+                            dst[0] += r.applyCurve (src[0]) * r.depth;
+                            continue;
+                        }
+
+                        switch (r.curve)
+                        {
+                            case ModulationCurve::Exponential:
+                                accumulateCurveRow<ModulationCurve::Exponential> (src, dst, r.depth);
+                                break;
+                            case ModulationCurve::Logarithmic:
+                                accumulateCurveRow<ModulationCurve::Logarithmic> (src, dst, r.depth);
+                                break;
+                            case ModulationCurve::SCurve:
+                                accumulateCurveRow<ModulationCurve::SCurve> (src, dst, r.depth);
+                                break;
+                            default:
+                                accumulateCurveRow<ModulationCurve::Linear> (src, dst, r.depth);
+                                break;
+                        }
+                    }
+                }
+
+                /** @brief dst[:] += curve(src[:]) * depth over one row of voice lanes. */
+                template <ModulationCurve C>
+                static void accumulateCurveRow (const FloatType* CASPI_RESTRICT src, FloatType* CASPI_RESTRICT dst, FloatType depth) noexcept CASPI_NON_BLOCKING
+                {
+                    const simd_type g = SIMD::set1<FloatType> (depth);
+                    for (std::size_t i = 0; i < kStride; i += kLanes)
+                    {
+                        const simd_type curved = detail::applyCurve<C, FloatType> (SIMD::load_aligned<FloatType> (src + i));
+                        SIMD::store_aligned (dst + i, SIMD::mul_add (curved, g, SIMD::load_aligned<FloatType> (dst + i)));
+                    }
+                }
+
+                /**
+                 * @brief SIMD clamp every row, then write active voices' parameters and globals.
+                 */
+                void scatterToParameters() noexcept CASPI_NON_BLOCKING
+                {
+                    SIMD::ops::clamp (modulationAccum.data(), FloatType (-1), FloatType (1), numParameters * kStride);
+
+                    for (size_t i = 0; i < numParameters; ++i)
+                    {
+                        const FloatType* row = modulationAccum.data() + i * kStride;
+
+                        if (globalParameter[i])
+                        {
+                            parameters[i][0]->clearModulation();
+                            parameters[i][0]->addModulation (row[0]);
+                            continue;
+                        }
+
+                        for (std::size_t v = 0; v < NumVoices; ++v)
+                        {
+                            if ((activeVoices >> v & 1u) == 0)
+                            {
+                                continue;
+                            }
+
+                            parameters[i][v]->clearModulation();
+                            parameters[i][v]->addModulation (row[v]);
+                        }
+                    }
+                }
+
+                /*==============================================================
+                 * Data members
+                 *============================================================*/
+
+                /** @brief Routing lists and command queue, shared by every voice. */
+                RoutingTable<FloatType> routes;
+
+                /** @brief Source values, row sourceId, lane voice: [sourceId * kStride + voice]. */
+                alignas (SIMD::Strategy::simd_alignment<FloatType>())
+                    std::array<FloatType, MAX_MOD_SOURCES * kStride> sourceValues {};
+
+                /** @brief Per-destination, per-voice accumulator: [destinationId * kStride + voice]. */
+                alignas (SIMD::Strategy::simd_alignment<FloatType>())
+                    std::array<FloatType, MAX_MOD_PARAMS * kStride> modulationAccum {};
+
+                /** @brief Registered parameters; a global destination uses index 0 only. */
+                std::array<VoiceParameters, MAX_MOD_PARAMS> parameters {};
+
+                /** @brief True for destinations registered with registerGlobalParameter(). */
+                std::array<bool, MAX_MOD_PARAMS> globalParameter {};
+
+                size_t numParameters = 0;
+
+                Mask activeVoices = kAllVoices;
+        };
+
+    } /* namespace Controls */
+} /* namespace CASPI */
+
+#endif // CASPI_POLY_MODULATION_MATRIX_H
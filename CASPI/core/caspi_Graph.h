@@ -44,6 +44,11 @@
  *     at prepare() time. Destination reads via AudioContext::getControlInput().
  *     O(1) dereference, no virtual call, no scan.
  *
+ *     A source that publishes a per-sample block for the port (see
+ *     ControlNode::controlBlocks) is also readable at audio rate via
+ *     AudioContext::getControlInputBlock(). The destination chooses: the
+ *     scalar for per-block modulation, the block for per-sample modulation.
+ *
  * PORT TYPE
  *
  * Port{nodeId, portIndex} is a lightweight value type used by the ergonomic
@@ -89,8 +94,8 @@
  *
  * process() is noexcept and performs no heap allocation. All pointer resolution
  * is done at prepare() time and cached in:
- *   cachedAudioLinks   flat array of (dstNode, dstPort, BufferType*)
- *   cachedControlLinks flat array of (dstNode, dstPort, const FloatType*)
+ *   cachedAudioLinks   flat array of (dstNode, dstPort, BufferType*, broadcast scratch)
+ *   cachedControlLinks flat array of (dstNode, dstPort, const FloatType*, block ptr)
  *   sortedNodePtrs     flat array of raw NodeBase* in execution order
  *
  * AudioContext is constructed each process() call with reserved capacity for
@@ -295,6 +300,8 @@ namespace Graph
      * getControlInput(dstNode, dstPort). Returns FloatType(0) if no control
      * connection exists for that port (unconnected control ports are silent).
      * Linear scan: O(numControlConnections), then a single pointer dereference.
+     * getControlInputBlock(dstNode, dstPort) returns the source's per-sample
+     * block for the same connection, or nullptr if it publishes only a scalar.
      *
      * @tparam FloatType  Floating-point sample type matching the owning AudioGraph.
      */
@@ -317,6 +324,12 @@ namespace Graph
              * Returns nullptr if no Audio connection targets this (node, port) pair.
              * For feedback connections the buffer contains the previous block's output.
              *
+             * When the source has fewer channels than the querying node (a Mono
+             * oscillator feeding a Multichannel node), the returned buffer is a
+             * graph-owned copy with every missing channel broadcast from channel
+             * 0. The copy is made on the first query of the block, so a mono
+             * input nobody reads is never widened.
+             *
              * Linear scan: O(numAudioConnections). Real-time safe.
              *
              * @param destinationNode  NodeId of the querying node.
@@ -332,7 +345,16 @@ namespace Graph
                     if (entry.destinationNode == destinationNode
                         && entry.destinationPort == destinationPort)
                     {
-                        return entry.buffer;
+                        if (entry.broadcast == nullptr)
+                        {
+                            return entry.buffer;
+                        }
+                        if (! entry.expanded)
+                        {
+                            copyBroadcast (*entry.buffer, *entry.broadcast);
+                            entry.expanded = true;
+                        }
+                        return entry.broadcast;
                     }
                 }
                 return nullptr;
@@ -370,6 +392,38 @@ namespace Graph
                 return FloatType (0);
             }
 
+            /**
+             * @brief Return the per-sample control block connected to (destinationNode, destinationPort).
+             *
+             * The block holds getNumFrames() values for the current block, written
+             * by the source's processImpl() earlier in this process() call. For
+             * feedback connections it holds the previous block.
+             *
+             * Returns nullptr if no Control connection targets this (node, port)
+             * pair, or if the source publishes only a per-block scalar; fall back
+             * to getControlInput() in that case.
+             *
+             * Linear scan: O(numControlConnections). Real-time safe.
+             *
+             * @param destinationNode  NodeId of the querying node.
+             * @param destinationPort  Zero-based input port index.
+             * @return                 Pointer to getNumFrames() values, or nullptr.
+             */
+            CASPI_NO_DISCARD const FloatType* getControlInputBlock (NodeId destinationNode,
+                                                                    std::size_t destinationPort) const noexcept
+                CASPI_NON_BLOCKING
+            {
+                for (const auto& entry : resolvedControlInputs)
+                {
+                    if (entry.destinationNode == destinationNode
+                        && entry.destinationPort == destinationPort)
+                    {
+                        return entry.blockPtr;
+                    }
+                }
+                return nullptr;
+            }
+
             /*------------------------------------------------------------------
              * Block geometry accessors
              *-----------------------------------------------------------------*/
@@ -394,6 +448,8 @@ namespace Graph
                 NodeId destinationNode;
                 std::size_t destinationPort;
                 const BufferType* buffer;
+                BufferType* broadcast;      ///< Widened copy of buffer, or nullptr.
+                mutable bool expanded;      ///< broadcast holds this block's data.
             };
 
             /** @brief Resolved control input: maps (dstNode, dstPort) to a const FloatType*. */
@@ -402,6 +458,7 @@ namespace Graph
                 NodeId destinationNode;
                 std::size_t destinationPort;
                 const FloatType* valuePtr;
+                const FloatType* blockPtr; ///< Per-sample block, or nullptr.
             };
 
             void reserveCapacity (std::size_t numAudioLinks, std::size_t numControlLinks) CASPI_ALLOCATING
@@ -438,14 +495,14 @@ namespace Graph
                 resolvedControlInputs.reserve (numControlLinks);
             }
 
-            void addAudioInput (NodeId dst, std::size_t dstPort, const BufferType* buf)
+            void addAudioInput (NodeId dst, std::size_t dstPort, const BufferType* buf, BufferType* broadcast)
             {
-                resolvedAudioInputs.push_back ({ dst, dstPort, buf });
+                resolvedAudioInputs.push_back ({ dst, dstPort, buf, broadcast, false });
             }
 
-            void addControlInput (NodeId dst, std::size_t dstPort, const FloatType* valuePtr)
+            void addControlInput (NodeId dst, std::size_t dstPort, const FloatType* valuePtr, const FloatType* blockPtr)
             {
-                resolvedControlInputs.push_back ({ dst, dstPort, valuePtr });
+                resolvedControlInputs.push_back ({ dst, dstPort, valuePtr, blockPtr });
             }
 
             std::vector<ResolvedAudioInput>   resolvedAudioInputs;
@@ -745,14 +802,16 @@ namespace Graph
              *
              * Must be called after any topology change and before process().
              * Performs Kahn's BFS on non-feedback edges: O(V + E).
-             * Calls prepareToRender() on each node in topological order.
+             * Calls prepareToRender() on each node in topological order, with
+             * the channel count its ChannelMode resolves to (see caspi_Node.h).
              * Resolves Audio and Control connections into flat pointer caches.
              * Builds sortedNodePtrs for O(1) dispatch during process().
              *
              * On success isPrepared() returns true. On failure the caches and
              * sortedNodePtrs are cleared and isPrepared() returns false.
              *
-             * @param numChannels  Number of audio channels.
+             * @param numChannels  Number of audio channels. Multichannel nodes get
+             *                     this many; Mono and FollowInput nodes may get fewer.
              * @param numFrames    Block size in frames.
              * @param sampleRate   Sample rate in Hz.
              * @return             void on success.
@@ -776,18 +835,24 @@ namespace Graph
                 sortedNodePtrs.clear();
                 sortedNodePtrs.reserve (sortedOrder.size());
 
+                std::map<NodeId, std::size_t> resolvedChannels;
+
                 for (NodeId id : sortedOrder)
                 {
                     auto nodeIt = nodes.find (id);
                     if (nodeIt != nodes.end())
                     {
-                        nodeIt->second->prepareToRender (numChannels, numFrames, sampleRate);
+                        const std::size_t channels = resolveChannelCount (id, *nodeIt->second, numChannels, resolvedChannels);
+                        resolvedChannels[id]       = channels;
+
+                        nodeIt->second->prepareToRender (channels, numFrames, sampleRate);
                         sortedNodePtrs.push_back (nodeIt->second.get());
                     }
                 }
 
                 cachedAudioLinks.clear();
                 cachedControlLinks.clear();
+                broadcastBuffers.clear();
 
                 for (const auto& conn : connections)
                 {
@@ -806,6 +871,7 @@ namespace Graph
                             link.destinationNode = conn.destinationNode;
                             link.destinationPort = conn.destinationPort;
                             link.buffer          = buf;
+                            link.broadcast       = makeBroadcastBuffer (*buf, resolvedChannels[conn.destinationNode]);
                             cachedAudioLinks.push_back (link);
                         }
                     }
@@ -818,6 +884,7 @@ namespace Graph
                             link.destinationNode = conn.destinationNode;
                             link.destinationPort = conn.destinationPort;
                             link.valuePtr        = ptr;
+                            link.blockPtr        = srcIt->second->getControlBlockPtr (conn.sourcePort);
                             cachedControlLinks.push_back (link);
                         }
                     }
@@ -851,10 +918,10 @@ namespace Graph
                 context.beginBlock (blockChannels, blockFrames, blockSampleRate);
 
                 for (const auto& link : cachedAudioLinks)
-                    context.addAudioInput (link.destinationNode, link.destinationPort, link.buffer);
+                    context.addAudioInput (link.destinationNode, link.destinationPort, link.buffer, link.broadcast);
 
                 for (const auto& link : cachedControlLinks)
-                    context.addControlInput (link.destinationNode, link.destinationPort, link.valuePtr);
+                    context.addControlInput (link.destinationNode, link.destinationPort, link.valuePtr, link.blockPtr);
 
                 for (NodeType_t* node : sortedNodePtrs)
                     node->process (context);
@@ -876,6 +943,18 @@ namespace Graph
                 return connections.size();
             }
 
+            /**
+             * @brief Channel count passed to the last prepare().
+             *
+             * Node output buffers can be narrower: a Mono node holds one
+             * channel whatever this is. Hosts reading a sink should
+             * broadcast it to this width with copyBroadcast().
+             */
+            CASPI_NO_DISCARD std::size_t getNumChannels() const noexcept
+            {
+                return blockChannels;
+            }
+
             /**
              * @brief True if prepare() has been called since the last topology change.
              *
@@ -995,6 +1074,76 @@ namespace Graph
                 return {};
             }
 
+            /*==================================================================
+             * Mono broadcast
+             *
+             * An audio link whose source has fewer channels than its
+             * destination gets a scratch buffer of the destination's width,
+             * filled by AudioContext::getAudioInput() on first use each block.
+             * Links between equal widths, or into a narrower node, read the
+             * source buffer directly. Setup path only.
+             *================================================================*/
+
+            BufferType* makeBroadcastBuffer (const BufferType& source, std::size_t destinationChannels) CASPI_ALLOCATING
+            {
+                if (source.numChannels() == 0 || source.numChannels() >= destinationChannels)
+                {
+                    return nullptr;
+                }
+
+                auto buffer = CASPI::make_unique<BufferType>();
+                auto result = buffer->resize (destinationChannels, source.numFrames());
+                CASPI_ASSERT (result.has_value(), "AudioGraph: broadcast buffer resize failed (out of memory)");
+                buffer->clear();
+
+                broadcastBuffers.push_back (std::move (buffer));
+                return broadcastBuffers.back().get();
+            }
+
+            /*==================================================================
+             * Channel count resolution
+             *
+             * Maps a node's ChannelMode to the channel count its buffer is
+             * prepared with. FollowInput takes the widest non-feedback audio
+             * input already resolved in this prepare() pass; with none, it
+             * falls back to the graph width. Setup path only.
+             *================================================================*/
+
+            std::size_t resolveChannelCount (NodeId id,
+                                             const NodeBase<FloatType>& node,
+                                             std::size_t graphChannels,
+                                             const std::map<NodeId, std::size_t>& resolved) const CASPI_ALLOCATING
+            {
+                switch (node.getOutputChannelMode (0))
+                {
+                    case ChannelMode::Mono:
+                        return (graphChannels > 0) ? 1 : 0;
+
+                    case ChannelMode::FollowInput:
+                    {
+                        std::size_t widest = 0;
+                        for (const auto& conn : connections)
+                        {
+                            if (conn.destinationNode != id || conn.isFeedback || conn.connectionType != ConnectionType::Audio)
+                            {
+                                continue;
+                            }
+
+                            auto it = resolved.find (conn.sourceNode);
+                            if (it != resolved.end() && it->second > widest)
+                            {
+                                widest = it->second;
+                            }
+                        }
+                        return (widest > 0 && widest < graphChannels) ? widest : graphChannels;
+                    }
+
+                    case ChannelMode::Multichannel:
+                    default:
+                        return graphChannels;
+                }
+            }
+
             /*==================================================================
              * Topological sort — Kahn's algorithm, non-feedback edges only
              *
@@ -1153,16 +1302,21 @@ namespace Graph
                 NodeId destinationNode;
                 std::size_t destinationPort;
                 const BufferType* buffer;
+                BufferType* broadcast; ///< Scratch for a widened mono source, or nullptr.
             };
 
             std::vector<CachedAudioLink> cachedAudioLinks;
 
+            /** @brief Scratch buffers owned for cachedAudioLinks' broadcast pointers. */
+            std::vector<std::unique_ptr<BufferType>> broadcastBuffers;
+
             /** @brief Cached control link: maps (dstNode, dstPort) to a const FloatType*. */
             struct CachedControlLink
             {
                 NodeId destinationNode;
                 std::size_t destinationPort;
                 const FloatType* valuePtr;
+                const FloatType* blockPtr; ///< Per-sample block, or nullptr.
             };
 
             std::vector<CachedControlLink> cachedControlLinks;
@@ -31,7 +31,8 @@
  *
  *   ControlNode<Derived, FloatType> : NodeBase<FloatType>
  *     CRTP base for control-rate nodes (envelopes, LFOs, mod matrices).
- *     Owns a flat vector of scalar output values.
+ *     Owns a flat vector of scalar output values, plus an optional
+ *     per-sample block per port for audio-rate modulation.
  *     Hot path: process() [virtual, final] -> Derived::processImpl() [CRTP].
  *
  * ### CRTP contract for AudioNode<Derived, FloatType>
@@ -54,6 +55,26 @@
  * This allows feedback connections to read a previous block's output
  * (the pointer remains valid, content is from the last block).
  *
+ * ### Output channel count
+ *
+ * Each node declares a ChannelMode for its output. AudioGraph::prepare()
+ * resolves it into the channel count passed to prepareToRender():
+ *
+ *   Multichannel  one channel per graph channel (default)
+ *   Mono          a single channel, e.g. oscillators whose channels would
+ *                 all be identical
+ *   FollowInput   as many channels as the widest non-feedback audio input
+ *                 (processors: a filter after a mono oscillator runs mono)
+ *
+ * A mono buffer is never expanded up front. When a node reads an input
+ * with fewer channels than its own output, AudioContext::getAudioInput()
+ * returns a graph-owned copy with channel 0 broadcast to the missing
+ * channels, made on the first read of the block. Nodes can keep indexing
+ * in->sample (ch, fr) for every ch of their output, and a stereo patch
+ * only pays for stereo from the first genuinely multichannel node onwards.
+ * copyBroadcast() / addBroadcast() do the same expansion for buffers read
+ * outside a graph.
+ *
  * ### Multi-output nodes
  *
  * Override getOutputBuffer(port) in Derived to expose additional output
@@ -69,6 +90,7 @@
 #include "base/caspi_Assert.h"
 #include "base/caspi_Constants.h"
 #include "base/caspi_Features.h"
+#include "base/caspi_SIMD.h"
 #include "caspi_AudioBuffer.h"
 
 #include <cstddef>
@@ -92,6 +114,21 @@ namespace CASPI
             Control ///< Produces control-rate scalar signals (ControlNode).
         };
 
+        /** @brief How many channels a node's audio output carries. */
+        enum class ChannelMode
+        {
+            Multichannel, ///< One channel per graph channel.
+            Mono, ///< A single channel, broadcast by consumers on demand.
+            FollowInput ///< Matches the widest non-feedback audio input.
+        };
+
+        /** @brief How a consumer applies a control input that publishes a per-sample block. */
+        enum class ControlRate
+        {
+            PerBlock, ///< One value per block: AudioContext::getControlInput().
+            PerSample ///< Every frame: AudioContext::getControlInputBlock(), scalar fallback.
+        };
+
         template <typename FloatType>
         class AudioContext;
 
@@ -184,6 +221,21 @@ namespace CASPI
                     return nullptr;
                 }
 
+                /**
+                 * @brief Return the channel mode declared for the given output port.
+                 *
+                 * AudioGraph::prepare() resolves port 0's mode into the channel
+                 * count passed to prepareToRender(). Nodes with additional output
+                 * buffers size those themselves and may override this to report them.
+                 *
+                 * @param port  Zero-based output port index.
+                 */
+                CASPI_NO_DISCARD virtual ChannelMode getOutputChannelMode (std::size_t port) const noexcept
+                {
+                    (void) port;
+                    return ChannelMode::Multichannel;
+                }
+
                 /**
                  * @brief Return a scalar control output for the given port.
                  *
@@ -211,6 +263,18 @@ namespace CASPI
                     return nullptr;
                 }
 
+                /**
+                 * @brief Return a stable pointer to the per-sample control block for the given port.
+                 * ControlNode overrides to return controlBlocks[port].data() once Derived has
+                 * sized it. nullptr for ports that publish only a per-block scalar.
+                 * @param port  Zero-based output port index.
+                 */
+                virtual const FloatType* getControlBlockPtr (std::size_t port) const noexcept
+                {
+                    (void) port;
+                    return nullptr;
+                }
+
                 /** @brief NodeId assigned by AudioGraph::addNode(). */
                 CASPI_NO_DISCARD NodeId getId() const noexcept
                 {
@@ -321,10 +385,16 @@ namespace CASPI
                  * @brief Resize outputBuffer and call Derived::onPrepare().
                  *
                  * Called once per AudioGraph::prepare(). The buffer is cleared to silence
-                 * so feedback connections read zeros on the first block.
+                 * so feedback connections read zeros on the first block. A Mono node
+                 * always gets a single channel, whatever numChannels is.
                  */
                 void prepareToRender (std::size_t numChannels, std::size_t numFrames, double newSampleRate) override
                 {
+                    if (outputChannelMode == ChannelMode::Mono && numChannels > 1)
+                    {
+                        numChannels = 1;
+                    }
+
                     auto result = outputBuffer.resize (numChannels, numFrames);
                     CASPI_ASSERT (result.has_value(), "AudioNode: outputBuffer resize failed (out of memory)");
                     outputBuffer.clear();
@@ -358,6 +428,23 @@ namespace CASPI
                     return nullptr;
                 }
 
+                /** @brief Channel mode of outputBuffer (port 0). */
+                CASPI_NO_DISCARD ChannelMode getOutputChannelMode (std::size_t port) const noexcept override
+                {
+                    (void) port;
+                    return outputChannelMode;
+                }
+
+                /**
+                 * @brief Declare how many channels outputBuffer carries.
+                 *
+                 * Takes effect at the next prepareToRender(). Setup thread only.
+                 */
+                void setOutputChannelMode (ChannelMode mode) noexcept
+                {
+                    outputChannelMode = mode;
+                }
+
                 /*------------------------------------------------------------------
                  * Default CRTP hooks - derived classes shadow these
                  *-----------------------------------------------------------------*/
@@ -403,6 +490,9 @@ namespace CASPI
 
                 /** @brief Output buffer written by processImpl(). Accessible to downstream nodes. */
                 BufferType outputBuffer;
+
+            private:
+                ChannelMode outputChannelMode = ChannelMode::Multichannel;
         };
 
         /*======================================================================
@@ -455,6 +545,15 @@ namespace CASPI
                     return (port < controlOutputs.size()) ? controlOutputs[port] : FloatType(0);
                 }
 
+                /**
+                 * @brief Return the per-sample block at the given port.
+                 * @return controlBlocks[port].data(), or nullptr if the port has no block.
+                 */
+                const FloatType* getControlBlockPtr (std::size_t port) const noexcept override
+                {
+                    return (port < controlBlocks.size() && ! controlBlocks[port].empty()) ? controlBlocks[port].data() : nullptr;
+                }
+
                 /*------------------------------------------------------------------
                  * Default CRTP hooks
                  *-----------------------------------------------------------------*/
@@ -475,6 +574,7 @@ namespace CASPI
                     : NodeBase<FloatType> (NodeType::Control, 0, numControlOutputs)
                 {
                     controlOutputs.resize (numControlOutputs, FloatType (0));
+                    controlBlocks.resize (numControlOutputs);
                 }
 
                 Derived& getDerived() noexcept
@@ -488,8 +588,65 @@ namespace CASPI
 
                 /** @brief Scalar outputs written by processImpl(). Indexed by port. */
                 std::vector<FloatType> controlOutputs;
+
+                /**
+                 * @brief Optional audio-rate outputs, one numFrames block per port.
+                 * Derived sizes a port's block in onPrepare() to publish it; ports left
+                 * empty publish only their controlOutputs[] scalar.
+                 */
+                std::vector<std::vector<FloatType>> controlBlocks;
         };
 
+        /*======================================================================
+         * Channel broadcast helpers
+         *
+         * Consumers call these instead of indexing src channel-by-channel, so
+         * a Mono source is expanded only where a wider buffer needs it. Each
+         * destination channel reads the source channel of the same index, or
+         * channel 0 when the source has fewer channels. Frames beyond the
+         * shorter of the two buffers are left untouched.
+         *====================================================================*/
+
+        /** @brief dst[ch] = src[ch], broadcasting a mono src across every channel of dst. */
+        template <typename FloatType>
+        void copyBroadcast (const AudioBuffer<FloatType, ChannelMajorLayout>& src,
+                            AudioBuffer<FloatType, ChannelMajorLayout>& dst) noexcept CASPI_NON_BLOCKING
+        {
+            const std::size_t srcChannels = src.numChannels();
+            const std::size_t frames      = (src.numFrames() < dst.numFrames()) ? src.numFrames() : dst.numFrames();
+
+            if (srcChannels == 0 || frames == 0)
+            {
+                return;
+            }
+
+            for (std::size_t ch = 0; ch < dst.numChannels(); ++ch)
+            {
+                const std::size_t from = (ch < srcChannels) ? ch : 0;
+                SIMD::ops::copy (dst.channelData (ch), src.channelData (from), frames);
+            }
+        }
+
+        /** @brief dst[ch] += src[ch], broadcasting a mono src across every channel of dst. */
+        template <typename FloatType>
+        void addBroadcast (const AudioBuffer<FloatType, ChannelMajorLayout>& src,
+                           AudioBuffer<FloatType, ChannelMajorLayout>& dst) noexcept CASPI_NON_BLOCKING
+        {
+            const std::size_t srcChannels = src.numChannels();
+            const std::size_t frames      = (src.numFrames() < dst.numFrames()) ? src.numFrames() : dst.numFrames();
+
+            if (srcChannels == 0 || frames == 0)
+            {
+                return;
+            }
+
+            for (std::size_t ch = 0; ch < dst.numChannels(); ++ch)
+            {
+                const std::size_t from = (ch < srcChannels) ? ch : 0;
+                SIMD::ops::add (dst.channelData (ch), src.channelData (from), frames);
+            }
+        }
+
     } // namespace Graph
 } // namespace CASPI
 
@@ -227,6 +227,19 @@ namespace CASPI
                         smoothedBase = target;
                 }
 
+                /**
+                 * @brief True while the next process() would still move the
+                 * smoothed value (audio thread only)
+                 *
+                 * Once false, process() is a no-op until the target changes,
+                 * so a block renderer can hold value() for the rest of the block.
+                 */
+                CASPI_NO_DISCARD bool isSmoothing() const noexcept CASPI_NON_BLOCKING
+                {
+                    const FloatType target = baseNormalised.load (std::memory_order_relaxed);
+                    return smoothedBase + (target - smoothedBase) * smoothingCoeff != smoothedBase;
+                }
+
                 /**
                  * @brief Get smoothed Normalised value [0, 1]
                  * @return Smoothed Normalised value (audio thread only)
@@ -208,6 +208,8 @@ class Processor : public Graph::AudioNode<Derived, FloatType>
      *
      * Reads the audio buffer from AudioContext input port 0, copies it
      * into this->outputBuffer, then calls process(outputBuffer) in-place.
+     * Processors follow their input's channel count, so a mono input is
+     * only broadcast if the node has been declared Multichannel.
      *
      * If port 0 is not connected, outputBuffer retains its previous content
      * (cleared to silence at prepare() time, so the first block is silent).
@@ -225,16 +227,7 @@ class Processor : public Graph::AudioNode<Derived, FloatType>
 
         if (inBuf != nullptr)
         {
-            const std::size_t C  = this->outputBuffer.numChannels();
-            const std::size_t Fm = this->outputBuffer.numFrames();
-
-            for (std::size_t ch = 0; ch < C; ++ch)
-            {
-                for (std::size_t fr = 0; fr < Fm; ++fr)
-                {
-                    this->outputBuffer.sample (ch, fr) = inBuf->sample (ch, fr);
-                }
-            }
+            Graph::copyBroadcast (*inBuf, this->outputBuffer);
         }
 
         this->process (this->outputBuffer);
@@ -278,6 +271,7 @@ class Processor : public Graph::AudioNode<Derived, FloatType>
                         std::size_t numOutputPorts = 1)
         : Graph::AudioNode<Derived, FloatType> (numInputPorts, numOutputPorts)
     {
+        this->setOutputChannelMode (Graph::ChannelMode::FollowInput);
     }
 };
 
@@ -239,6 +239,9 @@ class Producer : public Graph::AudioNode<Derived, FloatType>
 
 protected:
     /**
+     * PerFrame producers write the same sample to every channel, so they
+     * declare a Mono output and leave any broadcast to their consumers.
+     *
      * @param numInputPorts   Audio inputs accepted. Default 0 (source has no audio input).
      * @param numOutputPorts  Audio outputs produced. Default 1.
      */
@@ -246,6 +249,10 @@ class Producer : public Graph::AudioNode<Derived, FloatType>
                        std::size_t numOutputPorts = 1)
         : Graph::AudioNode<Derived, FloatType> (numInputPorts, numOutputPorts)
     {
+        if (std::is_same<Policy, Traversal::PerFrame>::value)
+        {
+            this->setOutputChannelMode (Graph::ChannelMode::Mono);
+        }
     }
 
 private:
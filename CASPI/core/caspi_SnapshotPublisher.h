@@ -0,0 +1,238 @@
+/************************************************************************
+ .d8888b.                             d8b
+d88P  Y88b                            Y8P
+888    888
+888         8888b.  .d8888b  88888b.  888
+888            "88b 88K      888 "88b 888
+888    888 .d888888 "Y8888b. 888  888 888
+Y88b  d88P 888  888      X88 888 d88P 888
+ "Y8888P"  "Y888888  88888P' 88888P"  888
+                             888
+                             888
+                             888
+
+ * @file   caspi_SnapshotPublisher.h
+ * @author CS Islay
+ * @brief  Lock-free read-copy-update hand-over of immutable snapshots to
+ *         audio-thread readers, with hazard-slot reclamation.
+ *
+ * @details
+ * A producer thread builds an immutable Snapshot and publish() swaps one
+ * atomic pointer to it. Each audio-thread consumer owns a Reader and
+ * picks the latest snapshot up at a point of its choosing; the audio
+ * thread never locks, allocates or frees.
+ *
+ * Reclamation uses per-reader hazard slots. A Reader has two atomic
+ * slots: the snapshot in use (`active`) and the one being picked up
+ * (`incoming`). A snapshot replaced by publish() goes on a retired list,
+ * and collect() — called from a non-audio thread — frees every retired
+ * snapshot no slot refers to. publish() collects too, so a producer that
+ * publishes regularly needs no extra housekeeping.
+ *
+ * Used by WaveTableBankPublisher and MsegPublisher, which add typed
+ * publish() overloads for their payloads.
+ *
+ * ### Thread safety
+ * - publish(), collect(), numRetired(), addReader(), removeReader() —
+ *   any non-audio thread; serialised by an internal mutex.
+ * - Reader::acquire(), commit(), release(), sequence() — the audio thread
+ *   that owns the Reader. Lock-free: acquire() only retries when a
+ *   publish() lands between its two loads.
+ * - Every Reader must be removed before the publisher is destroyed.
+ ************************************************************************/
+
+#ifndef CASPI_SNAPSHOTPUBLISHER_H
+#define CASPI_SNAPSHOTPUBLISHER_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "base/caspi_Assert.h"
+#include "base/caspi_Compatibility.h"
+#include "base/caspi_Features.h"
+
+namespace CASPI
+{
+    namespace Core
+    {
+        /**
+         * @brief Publishes immutable snapshots to lock-free readers.
+         *
+         * @tparam SnapshotType  Payload handed to readers. Never modified
+         *                       once published.
+         */
+        template <typename SnapshotType>
+        class SnapshotPublisher
+        {
+            public:
+                using Snapshot = SnapshotType;
+
+                /**
+                 * @brief One consumer's hazard slots.
+                 *
+                 * @details
+                 * Created by addReader(); owned by the publisher so collect()
+                 * can scan it.
+                 */
+                class Reader
+                {
+                    public:
+                        /** @brief Publication count; changes on every publish(). */
+                        CASPI_NO_DISCARD std::uint64_t sequence() const noexcept CASPI_NON_BLOCKING
+                        {
+                            return source.published.load (std::memory_order_acquire);
+                        }
+
+                        /**
+                         * @brief Protect and return the latest snapshot (may be null).
+                         *
+                         * @details
+                         * Stores the pointer in the incoming slot, then re-reads the
+                         * source: if it is unchanged, collect() is guaranteed to see
+                         * the slot before it could free the snapshot.
+                         */
+                        CASPI_NO_DISCARD const Snapshot* acquire() noexcept CASPI_NON_BLOCKING
+                        {
+                            const Snapshot* latest = source.latest.load (std::memory_order_seq_cst);
+                            for (;;)
+                            {
+                                incoming.store (latest, std::memory_order_seq_cst);
+                                const Snapshot* again = source.latest.load (std::memory_order_seq_cst);
+                                if (again == latest)
+                                    return latest;
+                                latest = again;
+                            }
+                        }
+
+                        /** @brief Make @p snapshot the active one and clear the incoming slot. */
+                        void commit (const Snapshot* snapshot) noexcept CASPI_NON_BLOCKING
+                        {
+                            active.store (snapshot, std::memory_order_seq_cst);
+                            incoming.store (nullptr, std::memory_order_release);
+                        }
+
+                        /** @brief Drop the incoming slot without adopting it. */
+                        void release() noexcept CASPI_NON_BLOCKING
+                        {
+                            incoming.store (nullptr, std::memory_order_release);
+                        }
+
+                    private:
+                        friend class SnapshotPublisher;
+
+                        explicit Reader (const SnapshotPublisher& sourceIn) noexcept
+                            : source (sourceIn)
+                        {
+                        }
+
+                        const SnapshotPublisher&     source;
+                        std::atomic<const Snapshot*> active { nullptr };
+                        std::atomic<const Snapshot*> incoming { nullptr };
+                };
+
+                SnapshotPublisher() = default;
+
+                SnapshotPublisher (const SnapshotPublisher&)            = delete;
+                SnapshotPublisher& operator= (const SnapshotPublisher&) = delete;
+
+                ~SnapshotPublisher()
+                {
+                    CASPI_ASSERT (readers.empty(), "Remove every reader before destroying the publisher");
+                    delete latest.load (std::memory_order_acquire);
+                }
+
+                /** @brief Make @p snapshot the one every reader picks up next. */
+                void publish (Snapshot snapshot) CASPI_ALLOCATING
+                {
+                    auto next = CASPI::make_unique<const Snapshot> (std::move (snapshot));
+
+                    std::lock_guard<std::mutex> lock (mutex);
+                    const Snapshot* previous = latest.exchange (next.release(), std::memory_order_seq_cst);
+                    published.fetch_add (1, std::memory_order_release);
+
+                    if (previous != nullptr)
+                        retired.emplace_back (previous);
+
+                    collectLocked();
+                }
+
+                /**
+                 * @brief Free retired snapshots that no reader refers to any more.
+                 *
+                 * @details
+                 * Non-audio thread. Destroying a snapshot runs its destructor
+                 * here, so any resources it owns are released on this thread.
+                 *
+                 * @return Number of snapshots freed.
+                 */
+                std::size_t collect() CASPI_BLOCKING
+                {
+                    std::lock_guard<std::mutex> lock (mutex);
+                    return collectLocked();
+                }
+
+                /** @brief Snapshots replaced by publish() but not yet freed. */
+                CASPI_NO_DISCARD std::size_t numRetired() const CASPI_BLOCKING
+                {
+                    std::lock_guard<std::mutex> lock (mutex);
+                    return retired.size();
+                }
+
+                /** @brief Register hazard slots for one consumer. Setup thread. */
+                CASPI_NO_DISCARD Reader* addReader() CASPI_ALLOCATING
+                {
+                    std::lock_guard<std::mutex> lock (mutex);
+                    readers.push_back (std::unique_ptr<Reader> (new Reader (*this)));
+                    return readers.back().get();
+                }
+
+                /** @brief Unregister @p reader. Its snapshots become collectable. */
+                void removeReader (Reader* reader) CASPI_BLOCKING
+                {
+                    std::lock_guard<std::mutex> lock (mutex);
+                    readers.erase (std::remove_if (readers.begin(),
+                                                   readers.end(),
+                                                   [reader] (const std::unique_ptr<Reader>& r) { return r.get() == reader; }),
+                                   readers.end());
+                    collectLocked();
+                }
+
+            private:
+                std::size_t collectLocked()
+                {
+                    const std::size_t before = retired.size();
+
+                    retired.erase (std::remove_if (retired.begin(),
+                                                   retired.end(),
+                                                   [this] (const std::unique_ptr<const Snapshot>& s) { return ! isHeld (s.get()); }),
+                                   retired.end());
+
+                    return before - retired.size();
+                }
+
+                bool isHeld (const Snapshot* snapshot) const noexcept
+                {
+                    for (const auto& reader : readers)
+                    {
+                        if (reader->active.load (std::memory_order_seq_cst) == snapshot
+                            || reader->incoming.load (std::memory_order_seq_cst) == snapshot)
+                            return true;
+                    }
+                    return false;
+                }
+
+                std::atomic<const Snapshot*>                 latest { nullptr };
+                std::atomic<std::uint64_t>                   published { 0 };
+                mutable std::mutex                           mutex;
+                std::vector<std::unique_ptr<Reader>>         readers;
+                std::vector<std::unique_ptr<const Snapshot>> retired;
+        };
+    } // namespace Core
+} // namespace CASPI
+
+#endif // CASPI_SNAPSHOTPUBLISHER_H
@@ -0,0 +1,618 @@
+/************************************************************************
+ .d8888b.                             d8b
+d88P  Y88b                            Y8P
+888    888
+888         8888b.  .d8888b  88888b.  888
+888            "88b 88K      888 "88b 888
+888    888 .d888888 "Y8888b. 888  888 888
+Y88b  d88P 888  888      X88 888 d88P 888
+ "Y8888P"  "Y888888  88888P' 88888P"  888
+                             888
+                             888
+                             888
+
+ * @file   caspi_AdditiveOscillator.h
+ * @author CS Islay
+ * @brief  Additive synthesis: a bank of up to several thousand sine
+ *         partials, SIMD across partials, no sin() per sample.
+ *
+ * @details
+ * AdditiveOscillator<FloatType, MaxPartials> sums MaxPartials sine partials,
+ * each with its own frequency and amplitude. Partial data arrives as
+ * block-rate breakpoints: set a frame (setPartials(), setHarmonics(),
+ * setPartial()) before each renderBlock() and the oscillator moves to it
+ * over that block.
+ *
+ * ### Recursive rotation
+ * Each partial is a unit phasor z = e^(i phi) turned by a fixed rotor
+ * w = e^(i 2 pi f / fs) once per sample:
+ * @code
+ *   out += a * Im(z)
+ *   z    = z * w          // 4 mul + 2 add, no transcendental
+ * @endcode
+ * The rotor costs one cos() / sin() pair when a partial's frequency
+ * changes, not one sin() per sample. Rounding makes |z| drift; every
+ * kChunk samples z is pulled back to the unit circle with one Newton step,
+ * z *= (3 - |z|^2) / 2, which is exact to rounding for |z| near 1.
+ *
+ * ### Breakpoints
+ * Amplitudes ramp linearly from their current value to the new target
+ * over the next renderBlock() call; frequencies step at the block start
+ * with phase kept continuous. Call renderBlock() with the analysis hop
+ * size to play a frame sequence back at its own rate.
+ *
+ * ### Culling
+ * At each block start a partial is silent if its frequency is outside
+ * (0, fs / 2) or both its current and target amplitude are below the
+ * amplitude floor. Silent partials are cut to zero; a SIMD vector whose
+ * lanes are all silent is skipped entirely, so the cost follows the
+ * number of audible partials, not MaxPartials. Harmonic spectra cull from
+ * the top, which leaves whole vectors empty.
+ *
+ * ### SIMD layout
+ * Phasors, rotors and amplitudes live in MaxPartials-long aligned arrays,
+ * kLanes partials per vector (4 floats / 2 doubles). The render loop is
+ * partial-outer, sample-inner: two vectors of partials stay in registers
+ * for a whole chunk while their contributions accumulate per sample into
+ * a kChunk x kLanes scratch, which is reduced across lanes once at the end.
+ *
+ * ### Modulatable parameters
+ * | Parameter | Range  | Scale  | Notes                        |
+ * |-----------|--------|--------|------------------------------|
+ * | amplitude | [0, 1] | Linear | Output gain, stepped per block |
+ *
+ * ### Thread safety
+ * Partial setters and rendering on the audio thread, or before streaming
+ * starts. To stream frames from an analysis thread, hand them over through
+ * a lock-free queue and call setPartials() from the audio thread.
+ *
+ * ### Typical usage
+ * @code
+ *   auto additive = std::make_unique<CASPI::Oscillators::AdditiveOscillator<float, 2048>> (48000.f);
+ *
+ *   // 1/n sawtooth, 200 harmonics, slightly stretched
+ *   float amps[200];
+ *   for (int n = 0; n < 200; ++n) amps[n] = 1.f / float (n + 1);
+ *   additive->setHarmonics (110.f, amps, 200, 1e-4f);
+ *
+ *   float out[256];
+ *   additive->renderBlock (out, 256);
+ * @endcode
+ ************************************************************************/
+
+#ifndef CASPI_ADDITIVEOSCILLATOR_H
+#define CASPI_ADDITIVEOSCILLATOR_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+#include "base/caspi_Assert.h"
+#include "base/caspi_Constants.h"
+#include "base/caspi_SIMD.h"
+#include "core/caspi_Parameter.h"
+#include "core/caspi_Producer.h"
+
+namespace CASPI
+{
+    namespace Oscillators
+    {
+
+        /*******************************************************************************
+         * AdditiveOscillator
+         ******************************************************************************/
+
+        /**
+         * @brief Bank of MaxPartials sine partials driven by block-rate breakpoints.
+         *
+         * @details
+         * The object holds all partial state inline (about 7 x MaxPartials
+         * values); allocate large banks on the heap.
+         *
+         * @tparam FloatType    float or double.
+         * @tparam MaxPartials  Partial capacity. Must be a multiple of the SIMD width.
+         */
+        template <CASPI_FLOAT_TYPE FloatType, std::size_t MaxPartials = 1024>
+        class AdditiveOscillator final
+            : public Core::Producer<AdditiveOscillator<FloatType, MaxPartials>, FloatType, Core::Traversal::PerFrame>
+        {
+                static_assert (std::is_floating_point<FloatType>::value,
+                               "AdditiveOscillator requires a floating-point type");
+
+                using simd_type = typename SIMD::Strategy::simd_type<FloatType, SIMD::Strategy::min_simd_width<FloatType>::value>::type;
+
+                static constexpr std::size_t kLanes   = SIMD::Strategy::min_simd_width<FloatType>::value;
+                static constexpr std::size_t kVectors = MaxPartials / kLanes;
+
+                static_assert (MaxPartials >= 1 && MaxPartials % kLanes == 0,
+                               "MaxPartials must be a positive multiple of the SIMD width");
+
+            public:
+                /// Samples rendered between phasor renormalisations.
+                static constexpr std::size_t kChunk = 256;
+
+                /*************************************************************************
+                 * Construction
+                 *************************************************************************/
+
+                /**
+                 * @brief Default constructor: every partial silent.
+                 *
+                 * @details
+                 * Call setSampleRate() before setting partials.
+                 */
+                AdditiveOscillator() CASPI_ALLOCATING
+                {
+                    initParameters();
+                }
+
+                /**
+                 * @brief Construct with a sample rate.
+                 *
+                 * @param sr  Sample rate in Hz. Must be > 0.
+                 */
+                explicit AdditiveOscillator (FloatType sr)
+                {
+                    initParameters();
+                    this->setSampleRate (sr);
+                }
+
+                /** @brief AudioNode hook: rotors are rebuilt on the next block. */
+                void onPrepare (std::size_t /*numChannels*/, std::size_t /*numFrames*/, double /*sampleRate*/) noexcept
+                {
+                    rotorsDirty = true;
+                }
+
+                /**
+                 * @brief Graph dispatch: renders channel 0 and copies it to the others.
+                 */
+                void processImpl (Graph::AudioContext<FloatType>& ctx) noexcept
+                {
+                    (void) ctx;
+
+                    auto&             buffer   = this->outputBuffer;
+                    const std::size_t channels = buffer.numChannels();
+                    const int         frames   = static_cast<int> (buffer.numFrames());
+
+                    if (channels == 0 || frames == 0)
+                        return;
+
+                    renderBlock (buffer.channelData (0), frames);
+
+                    for (std::size_t ch = 1; ch < channels; ++ch)
+                    {
+                        const FloatType* src = buffer.channelData (0);
+                        FloatType*       dst = buffer.channelData (ch);
+                        for (int i = 0; i < frames; ++i)
+                            dst[i] = src[i];
+                    }
+                }
+
+                /*************************************************************************
+                 * Breakpoints
+                 *************************************************************************/
+
+                /**
+                 * @brief Set the target of one partial for the next block.
+                 *
+                 * @param index  Partial index in [0, MaxPartials).
+                 * @param hz     Frequency in Hz. Partials at or above fs / 2 are culled.
+                 * @param amp    Linear amplitude; reached at the end of the next block.
+                 */
+                void setPartial (std::size_t index, FloatType hz, FloatType amp) noexcept CASPI_NON_BLOCKING
+                {
+                    CASPI_ASSERT (index < MaxPartials, "Partial index out of range");
+                    if (index >= MaxPartials)
+                        return;
+
+                    frequencies[index]      = hz;
+                    targetAmplitudes[index] = amp;
+                    partialCount            = std::max (partialCount, index + 1);
+                }
+
+                /**
+                 * @brief Set a whole breakpoint frame: partials [0, count) take the
+                 *        given targets, partials from @p count up fade to silence.
+                 *
+                 * @details
+                 * Matches the per-frame output of a sinusoidal analysis (one
+                 * frequency and amplitude array per hop).
+                 *
+                 * @param hz     @p count frequencies in Hz.
+                 * @param amps   @p count linear amplitudes.
+                 * @param count  Partials in the frame; clamped to MaxPartials.
+                 */
+                void setPartials (const FloatType* hz, const FloatType* amps, std::size_t count) noexcept CASPI_NON_BLOCKING
+                {
+                    CASPI_ASSERT (count == 0 || (hz != nullptr && amps != nullptr), "Frame arrays must not be null");
+
+                    count = std::min (count, MaxPartials);
+                    for (std::size_t k = 0; k < count; ++k)
+                    {
+                        frequencies[k]      = hz[k];
+                        targetAmplitudes[k] = amps[k];
+                    }
+                    for (std::size_t k = count; k < partialCount; ++k)
+                        targetAmplitudes[k] = FloatType (0);
+
+                    partialCount = std::max (partialCount, count);
+                }
+
+                /**
+                 * @brief Set a harmonic (or stretched) series as the next frame.
+                 *
+                 * @details
+                 * Partial n - 1 sits at n * f0 * sqrt(1 + B n^2), the stiff-string
+                 * model; B = 0 gives exact harmonics.
+                 *
+                 * @param f0             Fundamental in Hz.
+                 * @param amps           @p count amplitudes, fundamental first.
+                 * @param count          Number of harmonics; clamped to MaxPartials.
+                 * @param inharmonicity  B >= 0.
+                 */
+                void setHarmonics (FloatType f0, const FloatType* amps, std::size_t count, FloatType inharmonicity = FloatType (0)) noexcept
+                    CASPI_NON_BLOCKING
+                {
+                    CASPI_ASSERT (inharmonicity >= FloatType (0), "Inharmonicity must be non-negative");
+
+                    count = std::min (count, MaxPartials);
+                    for (std::size_t k = 0; k < count; ++k)
+                    {
+                        const FloatType n   = static_cast<FloatType> (k + 1);
+                        frequencies[k]      = n * f0 * std::sqrt (FloatType (1) + inharmonicity * n * n);
+                        targetAmplitudes[k] = amps[k];
+                    }
+                    for (std::size_t k = count; k < partialCount; ++k)
+                        targetAmplitudes[k] = FloatType (0);
+
+                    partialCount = std::max (partialCount, count);
+                }
+
+                /**
+                 * @brief Amplitude below which a partial is culled.
+                 *
+                 * @param floor  Linear amplitude >= 0. Default 1e-5 (-100 dB).
+                 */
+                void setAmplitudeFloor (FloatType floor) noexcept CASPI_NON_BLOCKING
+                {
+                    amplitudeFloor = std::max (FloatType (0), floor);
+                }
+
+                /**
+                 * @brief Silence every partial and restart all phases at 0.
+                 *
+                 * @details
+                 * Frequencies and targets are kept, so the next block fades the
+                 * current frame back in from silence.
+                 */
+                void resetPhases() noexcept CASPI_NON_BLOCKING
+                {
+                    for (std::size_t k = 0; k < MaxPartials; ++k)
+                    {
+                        phasorRe[k]   = FloatType (1);
+                        phasorIm[k]   = FloatType (0);
+                        amplitudes[k] = FloatType (0);
+                    }
+                }
+
+                /** @brief Partials rendered in the last block (after culling). */
+                CASPI_NO_DISCARD std::size_t getNumActivePartials() const noexcept CASPI_NON_BLOCKING
+                {
+                    return activePartials;
+                }
+
+                /** @brief Current phase of partial @p k in [-pi, pi]. */
+                CASPI_NO_DISCARD FloatType getPartialPhase (std::size_t k) const noexcept CASPI_NON_BLOCKING
+                {
+                    CASPI_ASSERT (k < MaxPartials, "Partial index out of range");
+                    return std::atan2 (phasorIm[k], phasorRe[k]);
+                }
+
+                /**
+                 * @brief Override from SampleRateAware. Rotors are rebuilt on the
+                 *        next block.
+                 */
+                void setSampleRate (FloatType newRate) override
+                {
+                    Graph::NodeBase<FloatType>::setSampleRate (newRate);
+                    rotorsDirty = true;
+                }
+
+                /*************************************************************************
+                 * Rendering
+                 *************************************************************************/
+
+                /**
+                 * @brief Render one sample. Counts as a one-sample block, so
+                 *        amplitude targets are reached immediately.
+                 */
+                FloatType renderSample() noexcept CASPI_NON_BLOCKING override
+                {
+                    FloatType out = FloatType (0);
+                    renderBlock (&out, 1);
+                    return out;
+                }
+
+                /**
+                 * @brief Render the sum of all audible partials.
+                 *
+                 * @param output      Buffer of at least @p numSamples elements.
+                 * @param numSamples  Number of samples. Must be > 0. Amplitudes
+                 *                    reach their targets on the last sample.
+                 */
+                void renderBlock (FloatType* CASPI_RESTRICT output, int numSamples) noexcept CASPI_NON_BLOCKING
+                {
+                    CASPI_ASSERT (output != nullptr, "Output buffer must not be null");
+                    CASPI_ASSERT (numSamples > 0, "numSamples must be positive");
+
+                    beginBlock (numSamples);
+
+                    const FloatType gain = amplitude.value();
+                    std::size_t     done = 0;
+                    const auto      n    = static_cast<std::size_t> (numSamples);
+
+                    while (done < n)
+                    {
+                        const std::size_t chunk = std::min (kChunk, n - done);
+                        renderChunk (output + done, chunk, gain);
+                        done += chunk;
+                    }
+
+                    endBlock();
+                }
+
+                /*************************************************************************
+                 * Public modulatable parameters
+                 *************************************************************************/
+
+                Core::ModulatableParameter<FloatType> amplitude; ///< Output gain in [0, 1].
+
+            private:
+                /*************************************************************************
+                 * Per-block setup
+                 *************************************************************************/
+
+                /**
+                 * @brief Step the gain smoother, rebuild changed rotors, cull, and
+                 *        set up the amplitude ramps for @p numSamples samples.
+                 */
+                void beginBlock (int numSamples) noexcept CASPI_NON_BLOCKING
+                {
+                    amplitude.process();
+
+                    const FloatType fs       = this->getSampleRate();
+                    const FloatType nyquist  = FloatType (0.5) * fs;
+                    const FloatType radPerHz = Constants::TWO_PI<FloatType> / fs;
+                    const FloatType invN     = FloatType (1) / static_cast<FloatType> (numSamples);
+                    const std::size_t used   = (partialCount + kLanes - 1) / kLanes;
+
+                    numActiveVectors = 0;
+                    activePartials   = 0;
+
+                    for (std::size_t v = 0; v < used; ++v)
+                    {
+                        bool audible = false;
+
+                        for (std::size_t k = v * kLanes; k < (v + 1) * kLanes; ++k)
+                        {
+                            const FloatType hz = frequencies[k];
+
+                            if (rotorsDirty || hz != rotorHz[k])
+                            {
+                                rotorRe[k] = std::cos (radPerHz * hz);
+                                rotorIm[k] = std::sin (radPerHz * hz);
+                                rotorHz[k] = hz;
+                            }
+
+                            const bool inBand = hz > FloatType (0) && hz < nyquist;
+                            const bool loud   = std::max (amplitudes[k], targetAmplitudes[k]) >= amplitudeFloor;
+
+                            if (inBand && loud)
+                            {
+                                ramps[k] = (targetAmplitudes[k] - amplitudes[k]) * invN;
+                                audible  = true;
+                                ++activePartials;
+                            }
+                            else
+                            {
+                                amplitudes[k] = FloatType (0);
+                                ramps[k]      = FloatType (0);
+                            }
+                        }
+
+                        if (audible)
+                            activeVectors[numActiveVectors++] = v;
+                    }
+
+                    rotorsDirty = false;
+                }
+
+                /**
+                 * @brief Snap amplitudes to their targets, removing ramp rounding.
+                 */
+                void endBlock() noexcept CASPI_NON_BLOCKING
+                {
+                    for (std::size_t a = 0; a < numActiveVectors; ++a)
+                    {
+                        const std::size_t k = activeVectors[a] * kLanes;
+                        for (std::size_t l = 0; l < kLanes; ++l)
+                        {
+                            if (ramps[k + l] != FloatType (0) || amplitudes[k + l] != FloatType (0))
+                                amplitudes[k + l] = targetAmplitudes[k + l];
+                        }
+                    }
+                }
+
+                /*************************************************************************
+                 * Partial rendering
+                 *************************************************************************/
+
+                /**
+                 * @brief Render @p n <= kChunk samples, then renormalise the phasors.
+                 */
+                void renderChunk (FloatType* CASPI_RESTRICT output, std::size_t n, FloatType gain) noexcept CASPI_NON_BLOCKING
+                {
+                    const simd_type zero = SIMD::set1<FloatType> (FloatType (0));
+
+                    for (std::size_t i = 0; i < n; ++i)
+                        SIMD::store_aligned (scratch + i * kLanes, zero);
+
+                    std::size_t a = 0;
+                    for (; a + 2 <= numActiveVectors; a += 2)
+                        renderPair (activeVectors[a] * kLanes, activeVectors[a + 1] * kLanes, n);
+
+                    if (a < numActiveVectors)
+                        renderSingle (activeVectors[a] * kLanes, n);
+
+                    for (std::size_t i = 0; i < n; ++i)
+                        output[i] = SIMD::hsum (SIMD::load_aligned<FloatType> (scratch + i * kLanes)) * gain;
+
+                    renormalise();
+                }
+
+                /**
+                 * @brief Two vectors at once: four independent rotation chains hide
+                 *        the multiply latency of the complex product.
+                 */
+                CASPI_ALWAYS_INLINE void renderPair (std::size_t k0, std::size_t k1, std::size_t n) noexcept CASPI_NON_BLOCKING
+                {
+                    simd_type       re0 = SIMD::load_aligned<FloatType> (phasorRe + k0);
+                    simd_type       im0 = SIMD::load_aligned<FloatType> (phasorIm + k0);
+                    simd_type       a0  = SIMD::load_aligned<FloatType> (amplitudes + k0);
+                    const simd_type wr0 = SIMD::load_aligned<FloatType> (rotorRe + k0);
+                    const simd_type wi0 = SIMD::load_aligned<FloatType> (rotorIm + k0);
+                    const simd_type da0 = SIMD::load_aligned<FloatType> (ramps + k0);
+
+                    simd_type       re1 = SIMD::load_aligned<FloatType> (phasorRe + k1);
+                    simd_type       im1 = SIMD::load_aligned<FloatType> (phasorIm + k1);
+                    simd_type       a1  = SIMD::load_aligned<FloatType> (amplitudes + k1);
+                    const simd_type wr1 = SIMD::load_aligned<FloatType> (rotorRe + k1);
+                    const simd_type wi1 = SIMD::load_aligned<FloatType> (rotorIm + k1);
+                    const simd_type da1 = SIMD::load_aligned<FloatType> (ramps + k1);
+
+                    for (std::size_t i = 0; i < n; ++i)
+                    {
+                        // Amplitude ramps start one step in, so the last sample sits on the target
+                        a0 = SIMD::add (a0, da0);
+                        a1 = SIMD::add (a1, da1);
+
+                        simd_type acc = SIMD::load_aligned<FloatType> (scratch + i * kLanes);
+                        acc           = SIMD::mul_add (im0, a0, acc);
+                        acc           = SIMD::mul_add (im1, a1, acc);
+                        SIMD::store_aligned (scratch + i * kLanes, acc);
+
+                        const simd_type nr0 = SIMD::sub (SIMD::mul (re0, wr0), SIMD::mul (im0, wi0));
+                        const simd_type ni0 = SIMD::add (SIMD::mul (re0, wi0), SIMD::mul (im0, wr0));
+                        const simd_type nr1 = SIMD::sub (SIMD::mul (re1, wr1), SIMD::mul (im1, wi1));
+                        const simd_type ni1 = SIMD::add (SIMD::mul (re1, wi1), SIMD::mul (im1, wr1));
+                        re0                 = nr0;
+                        im0                 = ni0;
+                        re1                 = nr1;
+                        im1                 = ni1;
+                    }
+
+                    SIMD::store_aligned (phasorRe + k0, re0);
+                    SIMD::store_aligned (phasorIm + k0, im0);
+                    SIMD::store_aligned (amplitudes + k0, a0);
+                    SIMD::store_aligned (phasorRe + k1, re1);
+                    SIMD::store_aligned (phasorIm + k1, im1);
+                    SIMD::store_aligned (amplitudes + k1, a1);
+                }
+
+                /** @brief One vector: the odd one out after renderPair(). */
+                CASPI_ALWAYS_INLINE void renderSingle (std::size_t k, std::size_t n) noexcept CASPI_NON_BLOCKING
+                {
+                    simd_type       re = SIMD::load_aligned<FloatType> (phasorRe + k);
+                    simd_type       im = SIMD::load_aligned<FloatType> (phasorIm + k);
+                    simd_type       a  = SIMD::load_aligned<FloatType> (amplitudes + k);
+                    const simd_type wr = SIMD::load_aligned<FloatType> (rotorRe + k);
+                    const simd_type wi = SIMD::load_aligned<FloatType> (rotorIm + k);
+                    const simd_type da = SIMD::load_aligned<FloatType> (ramps + k);
+
+                    for (std::size_t i = 0; i < n; ++i)
+                    {
+                        a = SIMD::add (a, da);
+
+                        const simd_type acc = SIMD::load_aligned<FloatType> (scratch + i * kLanes);
+                        SIMD::store_aligned (scratch + i * kLanes, SIMD::mul_add (im, a, acc));
+
+                        const simd_type nr = SIMD::sub (SIMD::mul (re, wr), SIMD::mul (im, wi));
+                        im                 = SIMD::add (SIMD::mul (re, wi), SIMD::mul (im, wr));
+                        re                 = nr;
+                    }
+
+                    SIMD::store_aligned (phasorRe + k, re);
+                    SIMD::store_aligned (phasorIm + k, im);
+                    SIMD::store_aligned (amplitudes + k, a);
+                }
+
+                /**
+                 * @brief One Newton step towards |z| = 1 for every active phasor.
+                 */
+                void renormalise() noexcept CASPI_NON_BLOCKING
+                {
+                    const simd_type half  = SIMD::set1<FloatType> (FloatType (0.5));
+                    const simd_type three = SIMD::set1<FloatType> (FloatType (3));
+
+                    for (std::size_t a = 0; a < numActiveVectors; ++a)
+                    {
+                        const std::size_t k  = activeVectors[a] * kLanes;
+                        const simd_type   re = SIMD::load_aligned<FloatType> (phasorRe + k);
+                        const simd_type   im = SIMD::load_aligned<FloatType> (phasorIm + k);
+
+                        const simd_type mag2 = SIMD::add (SIMD::mul (re, re), SIMD::mul (im, im));
+                        const simd_type g    = SIMD::mul (SIMD::sub (three, mag2), half);
+
+                        SIMD::store_aligned (phasorRe + k, SIMD::mul (re, g));
+                        SIMD::store_aligned (phasorIm + k, SIMD::mul (im, g));
+                    }
+                }
+
+                /*************************************************************************
+                 * Parameter initialisation
+                 *************************************************************************/
+
+                void initParameters() CASPI_ALLOCATING
+                {
+                    amplitude.setRange (FloatType (0), FloatType (1));
+                    amplitude.setBaseNormalised (FloatType (1));
+                    amplitude.skip (1000);
+
+                    for (std::size_t k = 0; k < MaxPartials; ++k)
+                    {
+                        rotorRe[k] = FloatType (1);
+                        rotorIm[k] = FloatType (0);
+                    }
+
+                    resetPhases();
+                }
+
+                /*************************************************************************
+                 * State
+                 *************************************************************************/
+
+                alignas (16) FloatType phasorRe[MaxPartials] {};         ///< cos(phase) per partial.
+                alignas (16) FloatType phasorIm[MaxPartials] {};         ///< sin(phase) per partial; the output.
+                alignas (16) FloatType rotorRe[MaxPartials] {};          ///< cos(2 pi f / fs).
+                alignas (16) FloatType rotorIm[MaxPartials] {};          ///< sin(2 pi f / fs).
+                alignas (16) FloatType amplitudes[MaxPartials] {};       ///< Current amplitude.
+                alignas (16) FloatType ramps[MaxPartials] {};            ///< Amplitude step per sample this block.
+                alignas (16) FloatType scratch[kChunk * kLanes] {};      ///< Per-sample lane sums of one chunk.
+
+                FloatType frequencies[MaxPartials] {};      ///< Target frequency in Hz.
+                FloatType targetAmplitudes[MaxPartials] {}; ///< Amplitude at the end of the next block.
+                FloatType rotorHz[MaxPartials] {};          ///< Frequency the rotor was built for.
+
+                std::size_t activeVectors[kVectors] {}; ///< Vectors with an audible lane, this block.
+                std::size_t numActiveVectors { 0 };
+                std::size_t activePartials { 0 };
+                std::size_t partialCount { 0 };         ///< One past the highest partial ever set.
+                FloatType   amplitudeFloor { FloatType (1e-5) };
+                bool        rotorsDirty { true };
+        };
+
+    } // namespace Oscillators
+} // namespace CASPI
+
+#endif // CASPI_ADDITIVEOSCILLATOR_H
@@ -0,0 +1,695 @@
+/************************************************************************
+ .d8888b.                             d8b
+d88P  Y88b                            Y8P
+888    888
+888         8888b.  .d8888b  88888b.  888
+888            "88b 88K      888 "88b 888
+888    888 .d888888 "Y8888b. 888  888 888
+Y88b  d88P 888  888      X88 888 d88P 888
+ "Y8888P"  "Y888888  88888P' 88888P"  888
+                             888
+                             888
+                             888
+
+ * @file   caspi_BlepOscillatorBank.h
+ * @author CS Islay
+ * @brief  Unison / supersaw bank of PolyBLEP oscillators, one voice per
+ *         SIMD lane.
+ *
+ * @details
+ * BlepOscillatorBank<FloatType, MaxVoices> renders up to MaxVoices detuned
+ * copies of one BlepOscillator waveform and mixes them to stereo. Where a
+ * stack of separate BlepOscillators steps N sets of smoothers and runs N
+ * scalar computeSample() switches, the bank keeps one set of parameters
+ * and evaluates all voices of a sample together, kLanes voices per SIMD
+ * vector (4 floats / 2 doubles).
+ *
+ * ### Voice layout
+ * Voice k of N sits at offset o(k) = 2k / (N - 1) - 1 in [-1, 1] (0 when
+ * N == 1). Per block:
+ * @code
+ *   increment(k) = hz * 2^(detuneCents * o(k) / 1200) / sampleRate
+ *   pan(k)       = stereoSpread * o(k)                         // -1 left, +1 right
+ *   left(k)      = cos((pan(k) + 1) * pi / 4) / sqrt(N)        // equal power
+ *   right(k)     = sin((pan(k) + 1) * pi / 4) / sqrt(N)
+ * @endcode
+ * The 1/sqrt(N) keeps the level of uncorrelated voices roughly constant
+ * as N changes. The mono path (renderBlock(out, n), renderSample()) mixes
+ * every voice at 1/sqrt(N) without panning, so one voice renders exactly
+ * like a BlepOscillator.
+ *
+ * resetPhase() starts voice k at frac(phaseOffset + k / golden ratio), so
+ * voices do not start in phase and sum to one loud spike. Voice 0 starts
+ * at phaseOffset, like BlepOscillator.
+ *
+ * ### SIMD and masked lanes
+ * Phases, increments, reciprocal increments and pan gains live in
+ * MaxVoices-long aligned arrays; voices >= N are padded lanes with zero
+ * gain and a finite dummy increment. The PolyBLEP residual is computed
+ * for every lane, then selected with compare masks and SIMD::blend:
+ * @code
+ *   rise = (2 - p/dt) * p/dt - 1                    where p < dt
+ *   fall = ((p-1)/dt + 2) * (p-1)/dt + 1            where p > 1 - dt
+ *   blep = blend(blend(0, fall, p > 1-dt), rise, p < dt)
+ * @endcode
+ * Every shape is vectorised. Sine uses SIMD::kernels::SinKernel (~2e-7
+ * from std::sin); Triangle keeps one leaky integrator per lane, so its
+ * feedback runs across time, not across lanes.
+ *
+ * ### Modulatable parameters
+ * | Parameter    | Range          | Scale       | Notes                        |
+ * |--------------|----------------|-------------|------------------------------|
+ * | amplitude    | [0, 1]         | Linear      | Output gain                  |
+ * | frequency    | [20, 20000] Hz | Logarithmic | Centre frequency             |
+ * | pulseWidth   | [0.01, 0.99]   | Linear      | Square / Pulse shapes only   |
+ * | detune       | [0, 100] cents | Linear      | Outer voices at ± detune     |
+ * | stereoSpread | [0, 1]         | Linear      | 0 centred, 1 outer voices hard-panned |
+ *
+ * All are stepped once per renderBlock() call.
+ *
+ * ### Typical usage
+ * @code
+ *   CASPI::Oscillators::BlepOscillatorBank<float> supersaw (WaveShape::Saw, 48000.f, 110.f, 7);
+ *   supersaw.setDetune (25.f);
+ *   supersaw.setStereoSpread (0.8f);
+ *
+ *   float left[512], right[512];
+ *   supersaw.renderBlock (left, right, 512);
+ * @endcode
+ ************************************************************************/
+
+#ifndef CASPI_BLEPOSCILLATORBANK_H
+#define CASPI_BLEPOSCILLATORBANK_H
+
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+#include "base/caspi_Assert.h"
+#include "base/caspi_Constants.h"
+#include "base/caspi_SIMD.h"
+#include "core/caspi_Parameter.h"
+#include "core/caspi_Producer.h"
+#include "oscillators/caspi_BlepOscillator.h"
+
+namespace CASPI
+{
+    namespace Oscillators
+    {
+
+        /*******************************************************************************
+         * BlepOscillatorBank
+         ******************************************************************************/
+
+        /**
+         * @brief N detuned PolyBLEP voices of one waveform, mixed to stereo.
+         *
+         * @details
+         * Behaves like MaxVoices BlepOscillators sharing shape, frequency,
+         * amplitude and pulse width, spread in pitch by detune and across the
+         * stereo field by stereoSpread. Per-voice hard sync is not supported.
+         *
+         * As a graph node the bank writes left / right into output channels 0
+         * and 1 (further channels are cleared); with a mono output buffer it
+         * writes the mono mix.
+         *
+         * ### Thread safety
+         * Same rules as BlepOscillator: setters from the audio thread or before
+         * streaming, parameter base values from any thread, rendering on the
+         * audio thread only.
+         *
+         * @tparam FloatType  float or double.
+         * @tparam MaxVoices  Voice capacity. Must be a multiple of the SIMD width.
+         */
+        template <CASPI_FLOAT_TYPE FloatType, std::size_t MaxVoices = 16>
+        class BlepOscillatorBank final
+            : public Core::Producer<BlepOscillatorBank<FloatType, MaxVoices>, FloatType, Core::Traversal::PerFrame>
+        {
+                static_assert (std::is_floating_point<FloatType>::value,
+                               "BlepOscillatorBank requires a floating-point type");
+
+                using simd_type = typename SIMD::Strategy::simd_type<FloatType, SIMD::Strategy::min_simd_width<FloatType>::value>::type;
+
+                static constexpr std::size_t kLanes = SIMD::Strategy::min_simd_width<FloatType>::value;
+
+                static_assert (MaxVoices >= 1 && MaxVoices % kLanes == 0,
+                               "MaxVoices must be a positive multiple of the SIMD width");
+
+                static constexpr FloatType kMaxDetuneCents = FloatType (100);
+
+            public:
+                /*************************************************************************
+                 * Construction
+                 *************************************************************************/
+
+                /**
+                 * @brief Default constructor: one Sine voice at ~440 Hz.
+                 *
+                 * @details
+                 * Call setSampleRate() and setFrequency() before rendering.
+                 */
+                BlepOscillatorBank() CASPI_ALLOCATING
+                {
+                    initParameters();
+                }
+
+                /**
+                 * @brief Construct with shape, sample rate, frequency and voice count.
+                 *
+                 * @param initialShape  Initial waveform shape.
+                 * @param sr         Sample rate in Hz. Must be > 0.
+                 * @param hz         Centre frequency in Hz. Must be in (0, sr/2).
+                 * @param voices  Voices in [1, MaxVoices].
+                 */
+                BlepOscillatorBank (WaveShape initialShape, FloatType sr, FloatType hz, std::size_t voices = 1)
+                {
+                    initParameters();
+                    this->setSampleRate (sr);
+                    setShape (initialShape);
+                    setNumVoices (voices);
+                    setFrequency (hz);
+                }
+
+                /** @brief AudioNode hook: refresh per-voice increments for the new rate. */
+                void onPrepare (std::size_t /*numChannels*/, std::size_t /*numFrames*/, double /*sampleRate*/) noexcept
+                {
+                    layoutDirty = true;
+                }
+
+                /**
+                 * @brief Graph dispatch: stereo into channels 0 / 1, or mono into
+                 *        channel 0 for a single-channel output buffer.
+                 */
+                void processImpl (Graph::AudioContext<FloatType>& ctx) noexcept
+                {
+                    (void) ctx;
+
+                    auto&             buffer   = this->outputBuffer;
+                    const std::size_t channels = buffer.numChannels();
+                    const int         frames   = static_cast<int> (buffer.numFrames());
+
+                    if (channels == 0 || frames == 0)
+                        return;
+
+                    if (channels == 1)
+                    {
+                        renderBlock (buffer.channelData (0), frames);
+                        return;
+                    }
+
+                    renderBlock (buffer.channelData (0), buffer.channelData (1), frames);
+
+                    for (std::size_t ch = 2; ch < channels; ++ch)
+                    {
+                        FloatType* data = buffer.channelData (ch);
+                        for (int i = 0; i < frames; ++i)
+                            data[i] = FloatType (0);
+                    }
+                }
+
+                /*************************************************************************
+                 * Configuration
+                 *************************************************************************/
+
+                /**
+                 * @brief Select the waveform of every voice.
+                 *
+                 * @details
+                 * Switching to Triangle resets the per-voice integrators, as
+                 * BlepOscillator::setShape() does.
+                 */
+                void setShape (WaveShape newShape) noexcept CASPI_NON_BLOCKING
+                {
+                    if (newShape == WaveShape::Triangle && shape != WaveShape::Triangle)
+                    {
+                        for (auto& integrator : triangleIntegrators)
+                            integrator = FloatType (1);
+                    }
+
+                    shape = newShape;
+                }
+
+                /** @brief Current waveform shape. */
+                CASPI_NO_DISCARD WaveShape getShape() const noexcept CASPI_NON_BLOCKING
+                {
+                    return shape;
+                }
+
+                /**
+                 * @brief Number of sounding voices.
+                 *
+                 * @details
+                 * Voices keep their phase when the count changes, so growing the
+                 * stack does not restart the existing voices.
+                 *
+                 * @param n  Voices in [1, MaxVoices]. Clamped.
+                 */
+                void setNumVoices (std::size_t n) noexcept CASPI_NON_BLOCKING
+                {
+                    CASPI_ASSERT (n >= 1 && n <= MaxVoices, "Voice count out of range");
+                    numVoices   = std::max<std::size_t> (1, std::min (n, MaxVoices));
+                    layoutDirty = true;
+                }
+
+                /** @brief Number of sounding voices. */
+                CASPI_NO_DISCARD std::size_t getNumVoices() const noexcept CASPI_NON_BLOCKING
+                {
+                    return numVoices;
+                }
+
+                /**
+                 * @brief Set the centre frequency in Hz, bypassing smoothing.
+                 *
+                 * @param hz  Frequency in Hz. Must be > 0 and < sampleRate / 2.
+                 */
+                void setFrequency (FloatType hz) noexcept CASPI_NON_BLOCKING
+                {
+                    CASPI_ASSERT (hz > FloatType (0), "Frequency must be positive");
+
+                    const FloatType norm = (std::log (hz) - std::log (FloatType (20)))
+                                           / (std::log (FloatType (20000)) - std::log (FloatType (20)));
+
+                    frequency.setBaseNormalised (std::max (FloatType (0), std::min (norm, FloatType (1))));
+                    frequency.skip (1000);
+                    layoutDirty = true;
+                }
+
+                /**
+                 * @brief Set the detune of the outermost voices, bypassing smoothing.
+                 *
+                 * @param cents  Detune in [0, 100] cents. Clamped.
+                 */
+                void setDetune (FloatType cents) noexcept CASPI_NON_BLOCKING
+                {
+                    detune.setBaseNormalised (std::max (FloatType (0), std::min (cents / kMaxDetuneCents, FloatType (1))));
+                    detune.skip (1000);
+                }
+
+                /**
+                 * @brief Set the stereo spread, bypassing smoothing.
+                 *
+                 * @param amount  0 keeps every voice centred, 1 pans the outermost
+                 *                voices hard left and right. Clamped to [0, 1].
+                 */
+                void setStereoSpread (FloatType amount) noexcept CASPI_NON_BLOCKING
+                {
+                    stereoSpread.setBaseNormalised (std::max (FloatType (0), std::min (amount, FloatType (1))));
+                    stereoSpread.skip (1000);
+                }
+
+                /**
+                 * @brief Set the phase offset applied on resetPhase().
+                 *
+                 * @param offset  Offset of voice 0; wrapped via fmod(abs(offset), 1).
+                 */
+                void setPhaseOffset (FloatType offset) noexcept CASPI_NON_BLOCKING
+                {
+                    phaseOffset = std::fmod (std::abs (offset), FloatType (1));
+                }
+
+                /**
+                 * @brief Restart every voice: voice k at frac(phaseOffset + k / golden ratio).
+                 *
+                 * @details
+                 * Does not reset the Triangle integrators; see BlepOscillator::resetPhase().
+                 */
+                void resetPhase() noexcept CASPI_NON_BLOCKING
+                {
+                    constexpr FloatType kInvGolden = FloatType (0.6180339887498949);
+
+                    for (std::size_t k = 0; k < MaxVoices; ++k)
+                    {
+                        const FloatType p = phaseOffset + static_cast<FloatType> (k) * kInvGolden;
+                        phases[k]         = p - std::floor (p);
+                    }
+                }
+
+                /** @brief Phase of voice @p k in [0, 1). */
+                CASPI_NO_DISCARD FloatType getVoicePhase (std::size_t k) const noexcept CASPI_NON_BLOCKING
+                {
+                    CASPI_ASSERT (k < MaxVoices, "Voice index out of range");
+                    return phases[k];
+                }
+
+                /**
+                 * @brief Override from SampleRateAware. Per-voice increments are
+                 *        recomputed on the next block.
+                 */
+                void setSampleRate (FloatType newRate) override
+                {
+                    Graph::NodeBase<FloatType>::setSampleRate (newRate);
+                    layoutDirty = true;
+                }
+
+                /*************************************************************************
+                 * Rendering
+                 *************************************************************************/
+
+                /**
+                 * @brief Render one mono sample. Steps the smoothers once.
+                 *
+                 * @details
+                 * Called per frame by Producer::render(AudioBuffer&). Prefer
+                 * renderBlock() on the audio thread.
+                 */
+                FloatType renderSample() noexcept CASPI_NON_BLOCKING override
+                {
+                    FloatType out = FloatType (0);
+                    renderBlock (&out, 1);
+                    return out;
+                }
+
+                /**
+                 * @brief Render the mono mix of all voices.
+                 *
+                 * @param output      Buffer of at least @p numSamples elements.
+                 * @param numSamples  Number of samples. Must be > 0.
+                 */
+                void renderBlock (FloatType* CASPI_RESTRICT output, int numSamples) noexcept CASPI_NON_BLOCKING
+                {
+                    CASPI_ASSERT (output != nullptr, "Output buffer must not be null");
+                    CASPI_ASSERT (numSamples > 0, "numSamples must be positive");
+
+                    beginBlock();
+                    dispatch<false> (output, nullptr, numSamples);
+                }
+
+                /**
+                 * @brief Render the stereo-spread mix of all voices.
+                 *
+                 * @param left        Left channel, at least @p numSamples elements.
+                 * @param right       Right channel, at least @p numSamples elements.
+                 *                    Must not alias @p left.
+                 * @param numSamples  Number of samples. Must be > 0.
+                 */
+                void renderBlock (FloatType* CASPI_RESTRICT left,
+                                  FloatType* CASPI_RESTRICT right,
+                                  int                       numSamples) noexcept CASPI_NON_BLOCKING
+                {
+                    CASPI_ASSERT (left != nullptr && right != nullptr, "Output buffers must not be null");
+                    CASPI_ASSERT (numSamples > 0, "numSamples must be positive");
+
+                    beginBlock();
+                    dispatch<true> (left, right, numSamples);
+                }
+
+                /*************************************************************************
+                 * Public modulatable parameters
+                 *************************************************************************/
+
+                Core::ModulatableParameter<FloatType> amplitude;    ///< Output gain in [0, 1].
+                Core::ModulatableParameter<FloatType> frequency;    ///< Centre frequency in Hz, log scale [20, 20000].
+                Core::ModulatableParameter<FloatType> pulseWidth;   ///< [0.01, 0.99]; Square / Pulse only.
+                Core::ModulatableParameter<FloatType> detune;       ///< Outer voice detune in cents, [0, 100].
+                Core::ModulatableParameter<FloatType> stereoSpread; ///< Pan width in [0, 1].
+
+            private:
+                /*************************************************************************
+                 * Per-block layout
+                 *************************************************************************/
+
+                /**
+                 * @brief Step the smoothers and, if anything moved, recompute the
+                 *        per-voice increments and pan gains.
+                 */
+                void beginBlock() noexcept CASPI_NON_BLOCKING
+                {
+                    amplitude.process();
+                    frequency.process();
+                    pulseWidth.process();
+                    detune.process();
+                    stereoSpread.process();
+
+                    const FloatType hz     = frequency.value();
+                    const FloatType cents  = detune.value();
+                    const FloatType spread = stereoSpread.value();
+
+                    if (layoutDirty || hz != layoutHz || cents != layoutCents || spread != layoutSpread)
+                        updateLayout (hz, cents, spread);
+                }
+
+                void updateLayout (FloatType hz, FloatType cents, FloatType spread) noexcept CASPI_NON_BLOCKING
+                {
+                    const FloatType fs   = this->getSampleRate();
+                    const FloatType norm = FloatType (1) / std::sqrt (static_cast<FloatType> (numVoices));
+                    const FloatType quarterPi = Constants::PI<FloatType> * FloatType (0.25);
+
+                    for (std::size_t k = 0; k < MaxVoices; ++k)
+                    {
+                        if (k >= numVoices)
+                        {
+                            // Padded lane: finite arithmetic, silent output
+                            increments[k]        = FloatType (0.25);
+                            inverseIncrements[k] = FloatType (4);
+                            gainsLeft[k]         = FloatType (0);
+                            gainsRight[k]        = FloatType (0);
+                            gainsMono[k]         = FloatType (0);
+                            triangleLeaks[k]     = FloatType (0.9);
+                            continue;
+                        }
+
+                        const FloatType offset = (numVoices > 1)
+                                                     ? FloatType (2) * static_cast<FloatType> (k) / static_cast<FloatType> (numVoices - 1) - FloatType (1)
+                                                     : FloatType (0);
+
+                        const FloatType voiceHz = hz * std::exp2 (cents * offset / FloatType (1200));
+                        const FloatType angle   = (spread * offset + FloatType (1)) * quarterPi;
+
+                        increments[k]        = voiceHz / fs;
+                        inverseIncrements[k] = fs / voiceHz;
+                        gainsLeft[k]         = norm * std::cos (angle);
+                        gainsRight[k]        = norm * std::sin (angle);
+                        gainsMono[k]         = norm;
+                        triangleLeaks[k]     = detail::leakCoeff (voiceHz, fs);
+                    }
+
+                    layoutHz     = hz;
+                    layoutCents  = cents;
+                    layoutSpread = spread;
+                    layoutDirty  = false;
+                }
+
+                /*************************************************************************
+                 * Voice rendering
+                 *************************************************************************/
+
+                template <bool Stereo>
+                void dispatch (FloatType* CASPI_RESTRICT left, FloatType* CASPI_RESTRICT right, int numSamples) noexcept
+                    CASPI_NON_BLOCKING
+                {
+                    switch (shape)
+                    {
+                        case WaveShape::Sine:
+                            renderVoices<WaveShape::Sine, Stereo> (left, right, numSamples);
+                            break;
+                        case WaveShape::Saw:
+                            renderVoices<WaveShape::Saw, Stereo> (left, right, numSamples);
+                            break;
+                        case WaveShape::Square:
+                        case WaveShape::Pulse:
+                            renderVoices<WaveShape::Square, Stereo> (left, right, numSamples);
+                            break;
+                        case WaveShape::Triangle:
+                            renderVoices<WaveShape::Triangle, Stereo> (left, right, numSamples);
+                            break;
+                    }
+                }
+
+                /**
+                 * @brief Sample-outer, voice-vector-inner render loop.
+                 *
+                 * @details
+                 * Only the vectors holding sounding voices are visited; padding
+                 * inside the last vector is silenced by its zero gain.
+                 */
+                template <WaveShape Shape, bool Stereo>
+                void renderVoices (FloatType* CASPI_RESTRICT left, FloatType* CASPI_RESTRICT right, int numSamples) noexcept
+                    CASPI_NON_BLOCKING
+                {
+                    const std::size_t numVectors = (numVoices + kLanes - 1) / kLanes;
+                    const FloatType   amp        = amplitude.value();
+
+                    const simd_type one  = SIMD::set1<FloatType> (FloatType (1));
+                    const simd_type pw   = SIMD::set1<FloatType> (pulseWidth.value());
+                    const simd_type zero = SIMD::set1<FloatType> (FloatType (0));
+
+                    for (int i = 0; i < numSamples; ++i)
+                    {
+                        simd_type accLeft  = zero;
+                        simd_type accRight = zero;
+
+                        for (std::size_t v = 0; v < numVectors; ++v)
+                        {
+                            const std::size_t k  = v * kLanes;
+                            const simd_type   p  = SIMD::load_aligned<FloatType> (phases + k);
+                            const simd_type   dt = SIMD::load_aligned<FloatType> (increments + k);
+
+                            const simd_type out = voiceSample<Shape> (p, dt, k, pw, one);
+
+                            if (Stereo)
+                            {
+                                accLeft  = SIMD::mul_add (out, SIMD::load_aligned<FloatType> (gainsLeft + k), accLeft);
+                                accRight = SIMD::mul_add (out, SIMD::load_aligned<FloatType> (gainsRight + k), accRight);
+                            }
+                            else
+                            {
+                                accLeft = SIMD::mul_add (out, SIMD::load_aligned<FloatType> (gainsMono + k), accLeft);
+                            }
+
+                            // Same wrap as Phase::advanceAndWrap(1) for increments < 1
+                            simd_type next = SIMD::add (p, dt);
+                            next           = SIMD::sub (next, SIMD::and_vec (SIMD::cmp_ge (next, one), one));
+                            SIMD::store_aligned (phases + k, next);
+                        }
+
+                        left[i] = SIMD::hsum (accLeft) * amp;
+                        if (Stereo)
+                            right[i] = SIMD::hsum (accRight) * amp;
+                    }
+                }
+
+                /**
+                 * @brief Waveform of kLanes voices starting at voice @p k.
+                 *
+                 * @param p    Phases before advancing.
+                 * @param dt   Phase increments.
+                 * @param k    First voice of the vector.
+                 * @param pw   Pulse width, broadcast.
+                 * @param one  1, broadcast.
+                 */
+                template <WaveShape Shape>
+                CASPI_ALWAYS_INLINE simd_type voiceSample (simd_type   p,
+                                                           simd_type   dt,
+                                                           std::size_t k,
+                                                           simd_type   pw,
+                                                           simd_type   one) noexcept CASPI_NON_BLOCKING
+                {
+                    CASPI_CPP17_IF_CONSTEXPR (Shape == WaveShape::Sine)
+                    {
+                        (void) dt;
+                        (void) k;
+                        (void) pw;
+                        (void) one;
+
+                        return sine (SIMD::mul (p, SIMD::set1<FloatType> (Constants::TWO_PI<FloatType>)));
+                    }
+                    else CASPI_CPP17_IF_CONSTEXPR (Shape == WaveShape::Saw)
+                    {
+                        (void) pw;
+
+                        const simd_type invDt = SIMD::load_aligned<FloatType> (inverseIncrements + k);
+                        const simd_type naive = SIMD::sub (SIMD::add (p, p), one);
+                        return SIMD::sub (naive, blep (p, dt, invDt, one));
+                    }
+                    else
+                    {
+                        const simd_type invDt = SIMD::load_aligned<FloatType> (inverseIncrements + k);
+                        const simd_type width = (Shape == WaveShape::Triangle) ? SIMD::set1<FloatType> (FloatType (0.5)) : pw;
+
+                        // -1 below the pulse width, +1 above
+                        const simd_type high  = SIMD::cmp_ge (p, width);
+                        const simd_type naive = SIMD::blend (SIMD::set1<FloatType> (FloatType (-1)), one, high);
+
+                        simd_type p2 = SIMD::add (p, SIMD::sub (one, width));
+                        p2           = SIMD::sub (p2, SIMD::and_vec (SIMD::cmp_ge (p2, one), one));
+
+                        const simd_type square = SIMD::add (SIMD::sub (naive, blep (p, dt, invDt, one)),
+                                                            blep (p2, dt, invDt, one));
+
+                        CASPI_CPP17_IF_CONSTEXPR (Shape == WaveShape::Triangle)
+                        {
+                            // integrator = integrator * leak + 4 * dt * square, per lane
+                            const simd_type leak  = SIMD::load_aligned<FloatType> (triangleLeaks + k);
+                            const simd_type state = SIMD::load_aligned<FloatType> (triangleIntegrators + k);
+                            const simd_type step  = SIMD::mul (SIMD::mul (SIMD::set1<FloatType> (FloatType (4)), dt), square);
+                            const simd_type next  = SIMD::mul_add (state, leak, step);
+                            SIMD::store_aligned (triangleIntegrators + k, next);
+                            return next;
+                        }
+
+                        return square;
+                    }
+                }
+
+                /**
+                 * @brief detail::polyBlep() for one vector of lanes, selected by masks.
+                 */
+                CASPI_ALWAYS_INLINE static simd_type blep (simd_type p, simd_type dt, simd_type invDt, simd_type one) noexcept
+                    CASPI_NON_BLOCKING
+                {
+                    const simd_type two = SIMD::add (one, one);
+
+                    const simd_type tRise    = SIMD::mul (p, invDt);
+                    const simd_type blepRise = SIMD::mul_sub (SIMD::sub (two, tRise), tRise, one);
+
+                    const simd_type tFall    = SIMD::mul (SIMD::sub (p, one), invDt);
+                    const simd_type blepFall = SIMD::mul_add (SIMD::add (tFall, two), tFall, one);
+
+                    const simd_type fall = SIMD::and_vec (SIMD::cmp_gt (p, SIMD::sub (one, dt)), blepFall);
+                    return SIMD::blend (fall, blepRise, SIMD::cmp_lt (p, dt));
+                }
+
+                /*************************************************************************
+                 * Parameter initialisation
+                 *************************************************************************/
+
+                void initParameters() CASPI_ALLOCATING
+                {
+                    amplitude.setRange (FloatType (0), FloatType (1));
+                    amplitude.setBaseNormalised (FloatType (1));
+
+                    frequency.setRange (FloatType (20), FloatType (20000), Core::ParameterScale::Logarithmic);
+                    frequency.setBaseNormalised (FloatType (0.023)); // ≈ 440 Hz
+
+                    pulseWidth.setRange (FloatType (0.01), FloatType (0.99));
+                    pulseWidth.setBaseNormalised (FloatType (0.5));
+
+                    detune.setRange (FloatType (0), kMaxDetuneCents);
+                    detune.setBaseNormalised (FloatType (0));
+
+                    stereoSpread.setRange (FloatType (0), FloatType (1));
+                    stereoSpread.setBaseNormalised (FloatType (0));
+
+                    amplitude.skip (1000);
+                    frequency.skip (1000);
+                    pulseWidth.skip (1000);
+                    detune.skip (1000);
+                    stereoSpread.skip (1000);
+
+                    for (auto& integrator : triangleIntegrators)
+                        integrator = FloatType (1);
+
+                    resetPhase();
+
+                    // The graph's PerFrame default is mono; the bank is stereo
+                    this->setOutputChannelMode (Graph::ChannelMode::Multichannel);
+                }
+
+                /*************************************************************************
+                 * State
+                 *************************************************************************/
+
+                alignas (16) FloatType phases[MaxVoices] {};              ///< Per-voice phase in [0, 1).
+                alignas (16) FloatType increments[MaxVoices] {};          ///< Per-voice cycles / sample.
+                alignas (16) FloatType inverseIncrements[MaxVoices] {};   ///< 1 / increments, for the BLEP.
+                alignas (16) FloatType gainsLeft[MaxVoices] {};           ///< Equal-power pan gain × 1/sqrt(N).
+                alignas (16) FloatType gainsRight[MaxVoices] {};
+                alignas (16) FloatType gainsMono[MaxVoices] {};           ///< 1/sqrt(N), 0 for padded lanes.
+                alignas (16) FloatType triangleIntegrators[MaxVoices] {}; ///< Leaky integrator per voice.
+                alignas (16) FloatType triangleLeaks[MaxVoices] {};
+
+                SIMD::kernels::SinKernel<FloatType> sine {};
+
+                WaveShape   shape { WaveShape::Sine };
+                std::size_t numVoices { 1 };
+                FloatType   phaseOffset { FloatType (0) };
+                FloatType   layoutHz { FloatType (0) };     ///< Parameters the layout was built for.
+                FloatType   layoutCents { FloatType (0) };
+                FloatType   layoutSpread { FloatType (0) };
+                bool        layoutDirty { true };
+        };
+
+    } // namespace Oscillators
+} // namespace CASPI
+
+#endif // CASPI_BLEPOSCILLATORBANK_H
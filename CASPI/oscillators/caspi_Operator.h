@@ -25,6 +25,7 @@
 
 #include "base/caspi_Assert.h"
 #include "base/caspi_Constants.h"
+#include "base/caspi_SIMD.h"
 #include "controls/caspi_Envelope.h"
 #include "core/caspi_Graph.h"
 #include "core/caspi_Phase.h"
@@ -40,6 +41,13 @@ namespace CASPI
         Frequency ///< Frequency modulation (FM) - modulation affects instantaneous frequency
     };
 
+    /// How the operator evaluates its sine
+    enum class SineEvaluation
+    {
+        Exact, ///< std::sin
+        Polynomial ///< SIMD::kernels::SinKernel - range-reduced polynomial, ~1e-7 absolute error
+    };
+
     /**
      * @class Operator
      * @brief A sine wave oscillator with FM/PM synthesis capabilities.
@@ -143,6 +151,7 @@ namespace CASPI
             Operator()
             {
                 envelope.setSampleRate (Constants::DEFAULT_SAMPLE_RATE<FloatType>);
+                this->setOutputChannelMode (Graph::ChannelMode::Mono);
             }
 
             Operator (FloatType SampleRate,
@@ -160,6 +169,7 @@ namespace CASPI
                 this->setSampleRate (SampleRate);
                 envelope.setSampleRate (SampleRate);
                 updatePhaseIncrement();
+                this->setOutputChannelMode (Graph::ChannelMode::Mono);
             }
 
             // ====================================================================
@@ -211,6 +221,26 @@ namespace CASPI
                 modulationMode = mode;
             }
 
+            /**
+             * @brief Select std::sin or the polynomial sine kernel
+             *
+             * Polynomial trades ~1e-7 absolute error (THD well below -120 dB)
+             * for roughly 3x the throughput of std::sin. Its latency is longer,
+             * so an operator with feedback, whose sine sits on a loop-carried
+             * chain, gains little or nothing from it.
+             *
+             * REAL-TIME SAFE: No allocations
+             */
+            void setSineEvaluation (SineEvaluation evaluation) CASPI_NON_BLOCKING
+            {
+                sineEvaluation = evaluation;
+            }
+
+            SineEvaluation getSineEvaluation() const CASPI_NON_BLOCKING
+            {
+                return sineEvaluation;
+            }
+
             void setModulation (FloatType index, FloatType depth, FloatType feedback = FloatType (0.0))
                 CASPI_NON_BLOCKING
             {
@@ -360,6 +390,7 @@ namespace CASPI
                 modulationDepth    = FloatType (1.0);
                 modulationFeedback = FloatType (0.0);
                 modulationMode     = ModulationMode::Phase;
+                sineEvaluation     = SineEvaluation::Exact;
                 previousOutput     = FloatType (0.0);
                 currentModulation  = FloatType (0.0);
                 envelopeEnabled    = false;
@@ -402,6 +433,68 @@ namespace CASPI
                 return renderSampleWithModulation (modulationInput);
             }
 
+            /**
+             * @brief Render a block of samples with an explicit modulation input per sample
+             * @param output      Destination buffer of at least @p numSamples elements
+             * @param modulation  Per-sample modulation input, or nullptr for none
+             * @param numSamples  Number of samples to render
+             *
+             * Equivalent to calling renderSample(modulation[i]) for each sample, but
+             * sets the denormal guard once for the whole block instead of once per sample.
+             *
+             * REAL-TIME SAFE: No allocations, bounded execution
+             */
+            void renderBlock (FloatType* CASPI_RESTRICT output,
+                              const FloatType* CASPI_RESTRICT modulation,
+                              std::size_t numSamples) CASPI_NON_BLOCKING
+            {
+                Core::ScopedFlushDenormals flush {};
+                renderBlockUnguarded (output, modulation, numSamples);
+            }
+
+            /**
+             * @brief renderBlock() without the denormal guard
+             *
+             * For callers that already hold a Core::ScopedFlushDenormals for the
+             * enclosing block (e.g. FMGraphDSP rendering many operators per block).
+             *
+             * REAL-TIME SAFE: No allocations, bounded execution
+             */
+            void renderBlockUnguarded (FloatType* CASPI_RESTRICT output,
+                                       const FloatType* CASPI_RESTRICT modulation,
+                                       std::size_t numSamples) CASPI_NON_BLOCKING
+            {
+                CASPI_ASSERT (output != nullptr, "Output buffer must not be null");
+
+                if (modulation != nullptr)
+                {
+                    for (std::size_t i = 0; i < numSamples; ++i)
+                    {
+                        output[i] = computeSample (modulation[i]);
+                    }
+                }
+                else
+                {
+                    for (std::size_t i = 0; i < numSamples; ++i)
+                    {
+                        output[i] = computeSample (FloatType (0));
+                    }
+                }
+            }
+
+            /**
+             * @brief renderSample(modulationInput) without the denormal guard
+             *
+             * For sample-major callers that already hold a Core::ScopedFlushDenormals
+             * (e.g. FMAlgorithmDSP's unrolled renderer).
+             *
+             * REAL-TIME SAFE: No allocations, bounded execution
+             */
+            CASPI_NO_DISCARD CASPI_ALWAYS_INLINE FloatType renderSampleUnguarded (FloatType modulationInput) CASPI_NON_BLOCKING
+            {
+                return computeSample (modulationInput);
+            }
+
             /**
              * @brief Render sample for multi-channel rendering
              */
@@ -433,6 +526,8 @@ namespace CASPI
             FloatType modulationDepth     = FloatType (1.0);
             FloatType modulationFeedback  = FloatType (0.0);
             ModulationMode modulationMode = ModulationMode::Phase;
+            SineEvaluation sineEvaluation = SineEvaluation::Exact;
+            SIMD::kernels::SinKernel<FloatType> polynomialSine;
             FloatType previousOutput      = FloatType (0.0);
             FloatType currentModulation   = FloatType (0.0); // NEW: Single-value modulation
 
@@ -510,11 +605,30 @@ namespace CASPI
             CASPI_NO_DISCARD FloatType renderSampleWithModulation (FloatType modulationSignal) CASPI_NON_BLOCKING
             {
                 Core::ScopedFlushDenormals flush {};
+                return computeSample (modulationSignal);
+            }
+
+            /** @brief Sine of @p x (radians) using the selected SineEvaluation mode */
+            CASPI_NO_DISCARD CASPI_ALWAYS_INLINE FloatType evaluateSine (FloatType x) const CASPI_NON_BLOCKING
+            {
+                return (sineEvaluation == SineEvaluation::Polynomial) ? polynomialSine (x) : std::sin (x);
+            }
+
+            /**
+             * @brief Per-sample operator kernel, without the denormal guard
+             * @param modulationSignal Modulation input for this sample
+             * @return Generated audio sample
+             *
+             * REAL-TIME SAFE: No allocations, bounded execution
+             */
+            CASPI_NO_DISCARD CASPI_ALWAYS_INLINE FloatType computeSample (FloatType modulationSignal) CASPI_NON_BLOCKING
+            {
                 // Get envelope amount
                 FloatType envAmount = envelopeEnabled ? envelope.render() : FloatType (1.0);
 
-                // Apply feedback (self-modulation)
-                FloatType selfMod = modulationFeedback * previousOutput;
+                // Apply feedback (self-modulation). Skipping the product when feedback is
+                // off keeps the previous output off the loop-carried dependency chain.
+                FloatType selfMod = (modulationFeedback != FloatType (0)) ? modulationFeedback * previousOutput : FloatType (0);
 
                 FloatType output;
 
@@ -526,7 +640,7 @@ namespace CASPI
                     FloatType instantPhaseInc = Constants::TWO_PI<FloatType> * instantFreq / this->getSampleRate();
 
                     // Generate sample
-                    output = envAmount * modulationDepth * std::sin (phase.phase + selfMod);
+                    output = envAmount * modulationDepth * evaluateSine (phase.phase + selfMod);
 
                     // Advance phase by modulated increment
                     phase.phase += instantPhaseInc;
@@ -537,7 +651,7 @@ namespace CASPI
                     FloatType phaseDeviation = modulationSignal * modulationIndex;
 
                     // Generate sample with modulated phase
-                    output = envAmount * modulationDepth * std::sin (phase.phase + phaseDeviation + selfMod);
+                    output = envAmount * modulationDepth * evaluateSine (phase.phase + phaseDeviation + selfMod);
 
                     // Advance phase normally
                     phase.phase += phase.increment;
@@ -0,0 +1,464 @@
+/*****************************************************************************
+ .d8888b.                             d8b
+d88P  Y88b                            Y8P
+888    888
+888         8888b.  .d8888b  88888b.  888
+888            "88b 88K      888 "88b 888
+888    888 .d888888 "Y8888b. 888  888 888
+Y88b  d88P 888  888      X88 888 d88P 888
+ "Y8888P"  "Y888888  88888P' 88888P"  888
+                             888
+                             888
+                             888
+
+ * @file   caspi_WavetableFile.h
+ * @author CS Islay
+ * @brief  On-disk wavetable bank format, memory-mapped read-only and
+ *         shared across the process.
+ *
+ * @details
+ * Compiled WaveTableBanks are sized at compile time and filled at startup,
+ * so shipping many banks costs binary size or load time. A bank file holds
+ * the same samples (optionally with precomputed mip levels) and is mapped
+ * read-only: nothing is read until a page is touched, the OS page cache
+ * shares the pages between every mapping of the file, and
+ * MappedWaveTableBank::acquire() hands out a single mapping per path to
+ * every caller in the process.
+ *
+ * ### File layout
+ * | Offset     | Size       | Content                                      |
+ * |------------|------------|----------------------------------------------|
+ * | 0          | 64         | WaveTableFileHeader                          |
+ * | dataOffset | dataBytes  | tableSize · numTables · numMipLevels samples |
+ *
+ * Samples are native floats (sampleBytes 4) or doubles (8) in the
+ * WaveTableBankView layout, table-major with the mip levels of each table
+ * adjacent. dataOffset is a multiple of kWaveTableFileAlignment. The header
+ * carries a byte-order tag; files are not portable between endiannesses.
+ *
+ * ### Loading
+ * @code
+ *   // Offline: write a compiled bank once
+ *   writeWaveTableFile ("pads.cwtb", bank.view());
+ *
+ *   // Setup thread: map (or reuse) the file and point voices at it
+ *   auto file = MappedWaveTableBank<float>::acquire ("pads.cwtb");
+ *   if (! file.has_value())
+ *       return;                                 // file.error() says why
+ *   for (auto& voice : voices)
+ *       voice.osc.setBank (file.value()->view());
+ *   osc.prepare();                              // faults pages in now
+ * @endcode
+ *
+ * Keep the shared_ptr for as long as any oscillator reads the view.
+ *
+ * ### Thread safety
+ * - open(), acquire(), prefetch(), writeWaveTableFile() — setup thread only.
+ *   They block on file I/O; acquire() also takes a mutex.
+ * - view() and reading the mapped samples — any thread, the data is
+ *   immutable.
+ *****************************************************************************/
+
+#ifndef CASPI_WAVETABLEFILE_H
+#define CASPI_WAVETABLEFILE_H
+
+#include "base/caspi_Assert.h"
+#include "base/caspi_Features.h"
+#include "base/caspi_Platform.h"
+#include "core/caspi_Expected.h"
+#include "oscillators/caspi_WavetableOscillator.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#if defined(CASPI_PLATFORM_WINDOWS)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace CASPI
+{
+namespace Oscillators
+{
+
+/*******************************************************************************
+ * File format
+ ******************************************************************************/
+
+/// Current bank file version written by writeWaveTableFile().
+constexpr std::uint32_t kWaveTableFileVersion = 1;
+
+/// Alignment of the sample data within the file (a cache line).
+constexpr std::uint64_t kWaveTableFileAlignment = 64;
+
+/// Written as-is; reads back differently on a machine of the other byte order.
+constexpr std::uint32_t kWaveTableFileByteOrder = 0x01020304u;
+
+/**
+ * @brief Fixed 64-byte header at the start of a bank file.
+ */
+struct WaveTableFileHeader
+{
+    char          magic[4];       ///< "CWTB"
+    std::uint32_t version;        ///< kWaveTableFileVersion
+    std::uint32_t byteOrder;      ///< kWaveTableFileByteOrder
+    std::uint32_t sampleBytes;    ///< sizeof (float) or sizeof (double)
+    std::uint32_t tableSize;      ///< Samples per table; power of two
+    std::uint32_t numTables;      ///< Morph tables
+    std::uint32_t numMipLevels;   ///< Levels per morph table, >= 1
+    std::uint32_t reserved0;
+    std::uint64_t dataOffset;     ///< Byte offset of the first sample
+    std::uint64_t dataBytes;      ///< Byte length of the sample data
+    std::uint8_t  reserved1[16];
+};
+
+CASPI_STATIC_ASSERT (sizeof (WaveTableFileHeader) == 64, "WaveTableFileHeader must be 64 bytes");
+
+/**
+ * @brief Why a bank file could not be written or mapped.
+ */
+enum class WaveTableFileError
+{
+    OpenFailed,          ///< File could not be opened or created
+    MapFailed,           ///< File could not be memory-mapped
+    WriteFailed,         ///< Short write
+    BadHeader,           ///< Wrong magic, byte order or dimensions
+    UnsupportedVersion,  ///< Written by a newer format version
+    SampleTypeMismatch,  ///< File holds doubles but floats were requested, or vice versa
+    Truncated,           ///< File is shorter than its header says
+    EmptyBank            ///< Nothing to write
+};
+
+namespace detail
+{
+
+inline bool isValidWaveTableDimensions (std::uint64_t tableSize,
+                                        std::uint64_t numTables,
+                                        std::uint64_t numMipLevels) noexcept
+{
+    const bool powerOfTwo = tableSize >= 2 && (tableSize & (tableSize - 1)) == 0;
+    std::uint64_t maxLevels = 0;
+    for (std::uint64_t n = tableSize; n > 1; n >>= 1)
+        ++maxLevels;
+
+    return powerOfTwo && numTables >= 1 && numMipLevels >= 1 && numMipLevels <= maxLevels;
+}
+
+/** @brief @p a * @p b into @p product; false if it does not fit in 64 bits. */
+inline bool multiplyChecked (std::uint64_t a, std::uint64_t b, std::uint64_t& product) noexcept
+{
+    if (a != 0 && b > std::numeric_limits<std::uint64_t>::max() / a)
+        return false;
+    product = a * b;
+    return true;
+}
+
+} // namespace detail
+
+/*******************************************************************************
+ * Writing
+ ******************************************************************************/
+
+/**
+ * @brief Write a bank to @p path in the bank file format.
+ *
+ * @details
+ * Any view works: a compiled bank's view(), or another mapped file's. Mip
+ * levels are stored as they are in the view, so build them first with
+ * WaveTableBank::buildMipLevels() (fillAll() / fillTable() already do).
+ *
+ * @param path  Destination; overwritten if it exists.
+ * @param view  Bank data to store.
+ * @return      Nothing on success, otherwise the failure.
+ */
+template <typename FloatType>
+expected<void, WaveTableFileError> writeWaveTableFile (const std::string&                  path,
+                                                       const WaveTableBankView<FloatType>& view) CASPI_BLOCKING
+{
+    using Error = WaveTableFileError;
+
+    if (view.empty() || ! detail::isValidWaveTableDimensions (view.tableSize(), view.numTables(), view.numMipLevels()))
+        return make_unexpected<Error, NonRealTimeSafe> (Error::EmptyBank);
+
+    WaveTableFileHeader header {};
+    std::memcpy (header.magic, "CWTB", 4);
+    header.version      = kWaveTableFileVersion;
+    header.byteOrder    = kWaveTableFileByteOrder;
+    header.sampleBytes  = static_cast<std::uint32_t> (sizeof (FloatType));
+    header.tableSize    = static_cast<std::uint32_t> (view.tableSize());
+    header.numTables    = static_cast<std::uint32_t> (view.numTables());
+    header.numMipLevels = static_cast<std::uint32_t> (view.numMipLevels());
+    header.dataOffset   = kWaveTableFileAlignment;
+    header.dataBytes    = static_cast<std::uint64_t> (view.numSamples() * sizeof (FloatType));
+
+    std::FILE* file = std::fopen (path.c_str(), "wb");
+    if (file == nullptr)
+        return make_unexpected<Error, NonRealTimeSafe> (Error::OpenFailed);
+
+    // The header is exactly one alignment unit, so the data follows directly
+    CASPI_STATIC_ASSERT (sizeof (WaveTableFileHeader) == kWaveTableFileAlignment,
+                         "Header must fill the first alignment unit");
+
+    bool ok = std::fwrite (&header, sizeof (header), 1, file) == 1;
+    ok      = ok && std::fwrite (view.data(), sizeof (FloatType), view.numSamples(), file) == view.numSamples();
+    ok      = (std::fclose (file) == 0) && ok;
+
+    if (! ok)
+        return make_unexpected<Error, NonRealTimeSafe> (Error::WriteFailed);
+    return {};
+}
+
+/*******************************************************************************
+ * MappedWaveTableBank
+ ******************************************************************************/
+
+/**
+ * @brief Read-only memory mapping of a bank file.
+ *
+ * @details
+ * open() validates the header and maps the whole file; no sample data is
+ * read until it is touched. The mapping is released when the last
+ * shared_ptr goes away, so hold one for as long as any oscillator reads
+ * view(). acquire() caches mappings by path, so every voice and plugin
+ * instance in the process that asks for the same file shares one mapping
+ * (and, through the page cache, one copy of the data in RAM). Separately
+ * loaded modules that each instantiate the cache still share pages
+ * through the OS.
+ *
+ * Pages can be evicted again under memory pressure; prepare the
+ * oscillators (or call prefetch()) after loading and after long idle
+ * periods.
+ *
+ * @tparam FloatType  float or double; must match the file's sample type.
+ */
+template <typename FloatType>
+class MappedWaveTableBank
+{
+public:
+    using Ptr    = std::shared_ptr<const MappedWaveTableBank>;
+    using Result = expected<Ptr, WaveTableFileError>;
+
+    MappedWaveTableBank (const MappedWaveTableBank&)            = delete;
+    MappedWaveTableBank& operator= (const MappedWaveTableBank&) = delete;
+
+    ~MappedWaveTableBank()
+    {
+        unmap();
+    }
+
+    /**
+     * @brief Map @p path, always creating a new mapping.
+     *
+     * @param path  Bank file written by writeWaveTableFile().
+     * @return      The mapping, or why it failed.
+     */
+    static Result open (const std::string& path) CASPI_BLOCKING
+    {
+        using Error = WaveTableFileError;
+
+        std::shared_ptr<MappedWaveTableBank> bank (new MappedWaveTableBank (path));
+
+        const auto mapped = bank->map();
+        if (! mapped.has_value())
+            return make_unexpected<Ptr, Error> (mapped.error());
+
+        if (bank->length < sizeof (WaveTableFileHeader))
+            return make_unexpected<Ptr, Error> (Error::Truncated);
+
+        WaveTableFileHeader header;
+        std::memcpy (&header, bank->base, sizeof (header));
+
+        if (std::memcmp (header.magic, "CWTB", 4) != 0 || header.byteOrder != kWaveTableFileByteOrder)
+            return make_unexpected<Ptr, Error> (Error::BadHeader);
+        if (header.version > kWaveTableFileVersion)
+            return make_unexpected<Ptr, Error> (Error::UnsupportedVersion);
+        if (header.sampleBytes != sizeof (FloatType))
+            return make_unexpected<Ptr, Error> (Error::SampleTypeMismatch);
+        if (! detail::isValidWaveTableDimensions (header.tableSize, header.numTables, header.numMipLevels)
+            || header.dataOffset % kWaveTableFileAlignment != 0
+            || header.dataOffset < sizeof (WaveTableFileHeader))
+            return make_unexpected<Ptr, Error> (Error::BadHeader);
+
+        // The header is untrusted: a wrapped product or offset would point
+        // the view outside the mapping.
+        std::uint64_t samples = 0;
+        std::uint64_t bytes   = 0;
+        if (! detail::multiplyChecked (header.tableSize, header.numTables, samples)
+            || ! detail::multiplyChecked (samples, header.numMipLevels, samples)
+            || ! detail::multiplyChecked (samples, sizeof (FloatType), bytes)
+            || header.dataBytes != bytes)
+            return make_unexpected<Ptr, Error> (Error::BadHeader);
+        if (header.dataOffset > bank->length || header.dataBytes > bank->length - header.dataOffset)
+            return make_unexpected<Ptr, Error> (Error::Truncated);
+
+        const auto* data = reinterpret_cast<const FloatType*> (static_cast<const char*> (bank->base) + header.dataOffset);
+        bank->bankView   = WaveTableBankView<FloatType> (data, header.tableSize, header.numTables, header.numMipLevels);
+
+        return make_expected<Ptr, Error> (Ptr (std::move (bank)));
+    }
+
+    /**
+     * @brief Map @p path, or return the mapping another caller already holds.
+     *
+     * @details
+     * Mappings are keyed by the path string as given and cached weakly:
+     * once every holder has released a mapping, the next acquire() maps
+     * the file again (picking up any changes on disk).
+     *
+     * @param path  Bank file written by writeWaveTableFile().
+     * @return      The shared mapping, or why it failed.
+     */
+    static Result acquire (const std::string& path) CASPI_BLOCKING
+    {
+        auto& cache = registry();
+        std::lock_guard<std::mutex> lock (cache.mutex);
+
+        auto it = cache.banks.find (path);
+        if (it != cache.banks.end())
+        {
+            if (Ptr existing = it->second.lock())
+                return make_expected<Ptr, WaveTableFileError> (std::move (existing));
+        }
+
+        Result opened = open (path);
+        if (opened.has_value())
+            cache.banks[path] = opened.value();
+        return opened;
+    }
+
+    /** @brief The mapped bank, for WavetableOscillator::setBank(). */
+    CASPI_NO_DISCARD const WaveTableBankView<FloatType>& view() const noexcept
+    {
+        return bankView;
+    }
+
+    /** @brief Path the mapping was opened from. */
+    CASPI_NO_DISCARD const std::string& path() const noexcept
+    {
+        return filePath;
+    }
+
+    /**
+     * @brief Ask the OS to read the sample data ahead, then fault in every page.
+     *
+     * @details
+     * Setup thread only. WavetableOscillator::prepare() does the second
+     * half for the bank it points at; calling this once per file is
+     * enough when many oscillators share it.
+     */
+    void prefetch() const noexcept CASPI_BLOCKING
+    {
+#if ! defined(CASPI_PLATFORM_WINDOWS)
+        ::posix_madvise (base, length, POSIX_MADV_WILLNEED);
+#endif
+        bankView.prefetch();
+    }
+
+private:
+    explicit MappedWaveTableBank (std::string pathIn)
+        : filePath (std::move (pathIn))
+    {
+    }
+
+    struct Registry
+    {
+        std::mutex                             mutex;
+        std::map<std::string, std::weak_ptr<const MappedWaveTableBank>> banks;
+    };
+
+    static Registry& registry()
+    {
+        static Registry instance;
+        return instance;
+    }
+
+    /** @brief Map the whole file read-only. */
+    expected<void, WaveTableFileError> map() noexcept
+    {
+        using Error = WaveTableFileError;
+
+#if defined(CASPI_PLATFORM_WINDOWS)
+        fileHandle = ::CreateFileA (filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE)
+            return make_unexpected<Error, NonRealTimeSafe> (Error::OpenFailed);
+
+        LARGE_INTEGER size;
+        if (! ::GetFileSizeEx (fileHandle, &size) || size.QuadPart == 0)
+            return make_unexpected<Error, NonRealTimeSafe> (Error::Truncated);
+        length = static_cast<std::size_t> (size.QuadPart);
+
+        mappingHandle = ::CreateFileMappingA (fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mappingHandle == nullptr)
+            return make_unexpected<Error, NonRealTimeSafe> (Error::MapFailed);
+
+        base = ::MapViewOfFile (mappingHandle, FILE_MAP_READ, 0, 0, 0);
+        if (base == nullptr)
+            return make_unexpected<Error, NonRealTimeSafe> (Error::MapFailed);
+#else
+        const int fd = ::open (filePath.c_str(), O_RDONLY);
+        if (fd < 0)
+            return make_unexpected<Error, NonRealTimeSafe> (Error::OpenFailed);
+
+        struct stat info;
+        if (::fstat (fd, &info) != 0 || info.st_size <= 0)
+        {
+            ::close (fd);
+            return make_unexpected<Error, NonRealTimeSafe> (Error::Truncated);
+        }
+        length = static_cast<std::size_t> (info.st_size);
+
+        void* mapped = ::mmap (nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+        ::close (fd); // the mapping keeps the file referenced
+
+        if (mapped == MAP_FAILED)
+            return make_unexpected<Error, NonRealTimeSafe> (Error::MapFailed);
+        base = mapped;
+#endif
+        return {};
+    }
+
+    void unmap() noexcept
+    {
+#if defined(CASPI_PLATFORM_WINDOWS)
+        if (base != nullptr)
+            ::UnmapViewOfFile (base);
+        if (mappingHandle != nullptr)
+            ::CloseHandle (mappingHandle);
+        if (fileHandle != INVALID_HANDLE_VALUE)
+            ::CloseHandle (fileHandle);
+#else
+        if (base != nullptr)
+            ::munmap (base, length);
+#endif
+        base = nullptr;
+    }
+
+    std::string                  filePath;
+    WaveTableBankView<FloatType> bankView {};
+    void*                        base   { nullptr };
+    std::size_t                  length { 0 };
+#if defined(CASPI_PLATFORM_WINDOWS)
+    HANDLE fileHandle    { INVALID_HANDLE_VALUE };
+    HANDLE mappingHandle { nullptr };
+#endif
+};
+
+} // namespace Oscillators
+} // namespace CASPI
+
+#endif // CASPI_WAVETABLEFILE_H
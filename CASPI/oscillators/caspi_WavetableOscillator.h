@@ -17,7 +17,7 @@ Y88b  d88P 888  888      X88 888 d88P 888
  *         and multi-table morphing.
  *
  * @details
- * Three cooperating types form the public API:
+ * Five cooperating types form the public API:
  *
  * ### WaveTable\<FloatType, TableSize\>
  * A single normalised single-cycle waveform stored as a fixed-size array.
@@ -31,11 +31,23 @@ Y88b  d88P 888  888      X88 888 d88P 888
  * Ordered array of WaveTables owned by value (no heap allocation).
  * The oscillator crossfades between adjacent tables based on morphPosition.
  * With NumTables == 1 the morph path is eliminated at compile time via
- * `if constexpr`.
+ * `if constexpr`. An optional MipLevels parameter adds per-octave copies of
+ * each table, band-limited via FFT, so high notes do not alias.
+ *
+ * ### WaveTableBankView\<FloatType\>
+ * Runtime-sized, non-owning view of contiguous bank data: bank.view(), or
+ * MappedWaveTableBank::view() for a bank file mapped from disk (see
+ * caspi_WavetableFile.h). This is what the oscillator actually reads.
+ *
+ * ### WaveTableBankPublisher\<FloatType\>
+ * RCU-style hand-over of new banks to running oscillators: an atomic
+ * pointer to an immutable snapshot, a crossfade on the audio side and
+ * hazard-slot reclamation of old banks on a non-audio thread.
  *
  * ### WavetableOscillator\<FloatType, TableSize, NumTables\>
- * The oscillator. Holds a non-owning pointer to a WaveTableBank; the bank
- * must outlive the oscillator. The API matches BlepOscillator exactly:
+ * The oscillator. Reads a non-owning WaveTableBankView of a WaveTableBank,
+ * a memory-mapped bank file or a publisher's latest bank; the bank must
+ * outlive the oscillator's use of it. The API matches BlepOscillator exactly:
  * - Inherits Core::Producer<FloatType, Traversal::PerFrame>
  * - Inherits Core::SampleRateAware<FloatType>
  * - Public ModulatableParameter members: amplitude, frequency, morphPosition
@@ -67,6 +79,19 @@ Y88b  d88P 888  888      X88 888 d88P 888
  * @endcode
  * With NumTables == 1 the lerp is eliminated at compile time.
  *
+ * ### Mipmapping
+ * A single full-bandwidth table aliases as soon as its upper harmonics
+ * pass Nyquist, whatever the interpolation kernel. With MipLevels > 1 the
+ * bank stores log-spaced band-limited levels and the oscillator reads the
+ * one whose top harmonic fits below Nyquist for the current increment,
+ * so plain linear interpolation at 1x rate is alias-free:
+ * @code
+ *   using Bank = WaveTableBank<float, 2048, 1, MaxMipLevels<2048>::value>;
+ *   static Bank bank;
+ *   bank.fillTable (0, [](float t) { return 2.f * t - 1.f; });   // builds levels
+ *   WavetableOscillator<float, 2048, 1, Bank::numMipLevels> osc (bank, 48000.f, 3000.f);
+ * @endcode
+ *
  * ### Hard sync
  * No discontinuity correction is applied on forceSync() because the
  * wavetable content is band-limited by construction. Any residual click
@@ -78,17 +103,20 @@ Y88b  d88P 888  888      X88 888 d88P 888
  * @endcode
  *
  * ### Block rendering and SIMD
- * renderBlock() steps parameters once per block and runs a scalar loop.
- * The loop body has no loop-carried data dependency (unlike BlepOscillator
- * Triangle), making it a strong auto-vectorisation candidate. The intended
- * SIMD upgrade path is a renderBlockSIMD() override:
- * - Accumulate phase into float32x4/x8.
- * - floor(phase * TableSize) via CASPI::SIMD::floor.
- * - Gather table[i0] / table[i1] via CASPI::SIMD::gather or scalar + blend.
- * - frac lerp via CASPI::SIMD::fmadd.
- * - Morph lerp at a second level.
- * The scalar loop is written so that replacing its body requires no
- * structural change to the surrounding code.
+ * renderBlock() steps parameters once per block and renders whole SIMD
+ * vectors (4 floats / 2 doubles), with a scalar loop for the remainder:
+ * - Lane phases are stepped in scalar code, exactly as renderSample() steps
+ *   them (one add and compare per lane). This is deliberate: bit-parity
+ *   with renderSample() requires the serial phase accumulation, and a
+ *   vector step (base + lane · increment) drifts ~1e-5 cycles from it over
+ *   a few thousand samples. Only the table lookups are vectorised.
+ * - i0 = floor(phase * TableSize) and frac via CASPI::SIMD::floor.
+ * - table[i0] / table[i1] via CASPI::SIMD::gather, which masks the index
+ *   (wrap for free) and uses the AVX2 hardware gather when built with it.
+ * - Linear or Catmull-Rom kernel via SIMD::mul_add, then the morph lerp
+ *   and the mip crossfade at a second level.
+ * renderBlockScalar() keeps the original per-sample loop as a reference
+ * and for benchmarking. The two differ only by kernel rounding.
  *
  * ### Typical usage
  * @code
@@ -123,15 +151,24 @@ Y88b  d88P 888  888      X88 888 d88P 888
 
 #include "base/caspi_Assert.h"
 #include "base/caspi_Constants.h"
+#include "base/caspi_SIMD.h"
 #include "core/caspi_Producer.h"
 #include "core/caspi_Graph.h"
 #include "core/caspi_Parameter.h"
 #include "core/caspi_Phase.h"
+#include "core/caspi_SnapshotPublisher.h"
+#include "maths/caspi_FFT.h"
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <type_traits>
+#include <vector>
 
 namespace CASPI
 {
@@ -156,6 +193,23 @@ struct IsPowerOfTwo
     static constexpr bool value = (N > 0) && ((N & (N - 1)) == 0);
 };
 
+/**
+ * @brief Compile-time floor(log2(N)) for N >= 1.
+ *
+ * @tparam N  Value to take the logarithm of.
+ */
+template <std::size_t N>
+struct Log2
+{
+    static constexpr std::size_t value = 1 + Log2<N / 2>::value;
+};
+
+template <>
+struct Log2<1>
+{
+    static constexpr std::size_t value = 0;
+};
+
 /**
  * @brief Convert Hz to a normalised [0, 1] value on a log scale.
  *
@@ -180,6 +234,60 @@ FloatType hzToNormLog (FloatType hz,
          / (std::log (maxHz) - std::log (minHz));
 }
 
+/**
+ * @brief Linear table read on raw samples. See WaveTable::readLinear().
+ *
+ * @tparam TableSize  Power-of-two table length.
+ * @param  samples    TableSize samples of one cycle.
+ * @param  phase      Normalised phase in [0, 1).
+ */
+template <std::size_t TableSize, typename FloatType>
+CASPI_ALWAYS_INLINE FloatType readLinear (const FloatType* samples, FloatType phase) noexcept
+{
+    constexpr std::size_t mask = TableSize - 1;
+
+    const FloatType   idx  = phase * static_cast<FloatType> (TableSize);
+    const std::size_t i0   = static_cast<std::size_t> (idx);
+    const std::size_t i1   = (i0 + 1) & mask;
+    const FloatType   frac = idx - static_cast<FloatType> (i0);
+
+    return samples[i0] + frac * (samples[i1] - samples[i0]);
+}
+
+/**
+ * @brief Catmull-Rom table read on raw samples. See WaveTable::readHermite().
+ *
+ * @tparam TableSize  Power-of-two table length.
+ * @param  samples    TableSize samples of one cycle.
+ * @param  phase      Normalised phase in [0, 1).
+ */
+template <std::size_t TableSize, typename FloatType>
+CASPI_ALWAYS_INLINE FloatType readHermite (const FloatType* samples, FloatType phase) noexcept
+{
+    constexpr std::size_t mask = TableSize - 1;
+
+    const FloatType   idx  = phase * static_cast<FloatType> (TableSize);
+    const std::size_t i1   = static_cast<std::size_t> (idx) & mask;
+    const std::size_t i0   = (i1 - 1) & mask;
+    const std::size_t i2   = (i1 + 1) & mask;
+    const std::size_t i3   = (i1 + 2) & mask;
+    const FloatType   frac = idx - std::floor (idx);
+
+    const FloatType y0 = samples[i0];
+    const FloatType y1 = samples[i1];
+    const FloatType y2 = samples[i2];
+    const FloatType y3 = samples[i3];
+
+    const FloatType c3 = FloatType (-0.5) * y0 + FloatType ( 1.5) * y1
+                       + FloatType (-1.5) * y2 + FloatType ( 0.5) * y3;
+    const FloatType c2 = y0 + FloatType (-2.5) * y1
+                       + FloatType ( 2.0) * y2 + FloatType (-0.5) * y3;
+    const FloatType c1 = FloatType (-0.5) * y0 + FloatType (0.5) * y2;
+    const FloatType c0 = y1;
+
+    return ((c3 * frac + c2) * frac + c1) * frac + c0;
+}
+
 } // namespace detail
 
 
@@ -205,6 +313,25 @@ enum class InterpolationMode
     Hermite
 };
 
+/**
+ * @brief Number of mip levels needed to reach a single harmonic.
+ *
+ * @details
+ * Level 0 holds TableSize/2 harmonics and each level halves that, so a
+ * TableSize-point bank bottoms out at a pure sine after log2(TableSize)
+ * levels. Use as the MipLevels argument of WaveTableBank for a full chain:
+ * @code
+ *   using Bank = WaveTableBank<float, 2048, 1, MaxMipLevels<2048>::value>;  // 11 levels
+ * @endcode
+ *
+ * @tparam TableSize  Power-of-two table length.
+ */
+template <std::size_t TableSize>
+struct MaxMipLevels
+{
+    static constexpr std::size_t value = detail::Log2<TableSize>::value;
+};
+
 
 /*******************************************************************************
  * WaveTable
@@ -387,14 +514,7 @@ class WaveTable
     CASPI_NO_DISCARD CASPI_ALWAYS_INLINE
     FloatType readLinear (FloatType phase) const noexcept CASPI_NON_BLOCKING
     {
-        constexpr std::size_t mask = TableSize - 1;
-
-        const FloatType   idx  = phase * static_cast<FloatType> (TableSize);
-        const std::size_t i0   = static_cast<std::size_t> (idx);
-        const std::size_t i1   = (i0 + 1) & mask;
-        const FloatType   frac = idx - static_cast<FloatType> (i0);
-
-        return samples[i0] + frac * (samples[i1] - samples[i0]);
+        return detail::readLinear<TableSize> (samples.data(), phase);
     }
 
     /**
@@ -422,41 +542,240 @@ class WaveTable
     CASPI_NO_DISCARD CASPI_ALWAYS_INLINE
     FloatType readHermite (FloatType phase) const noexcept CASPI_NON_BLOCKING
     {
-        constexpr std::size_t mask = TableSize - 1;
+        return detail::readHermite<TableSize> (samples.data(), phase);
+    }
+
+private:
+    std::array<FloatType, TableSize> samples {};
+};
+
+
+/*******************************************************************************
+ * WaveTableBankView
+ ******************************************************************************/
+
+/**
+ * @brief Non-owning, runtime-sized view of contiguous wavetable bank data.
+ *
+ * @details
+ * Describes numTables × numMipLevels tables of tableSize samples laid out
+ * back to back, table-major:
+ * @code
+ *   table(i, level) = data + (i * numMipLevels + level) * tableSize
+ * @endcode
+ * This is the layout of WaveTableBank and of the on-disk format in
+ * caspi_WavetableFile.h, so a compiled bank and a memory-mapped file can
+ * both be handed to WavetableOscillator::setBank(). The view is a plain
+ * value (pointer + three sizes) and is cheap to copy; whoever owns the
+ * data must keep it alive while any oscillator points at it.
+ *
+ * @tparam FloatType  float or double.
+ *
+ * @code
+ *   WaveTableBank<float, 2048, 4> bank;
+ *   WaveTableBankView<float> view = bank.view();
+ *   const float* saw = view.table (1, 0);
+ * @endcode
+ */
+template <typename FloatType>
+class WaveTableBankView
+{
+public:
+    /** @brief Empty view. */
+    WaveTableBankView() noexcept = default;
+
+    /**
+     * @param dataIn          First sample of table 0, level 0.
+     * @param tableSizeIn     Samples per table. Power of two.
+     * @param numTablesIn     Morph tables.
+     * @param numMipLevelsIn  Mip levels per morph table.
+     */
+    WaveTableBankView (const FloatType* dataIn,
+                       std::size_t      tableSizeIn,
+                       std::size_t      numTablesIn,
+                       std::size_t      numMipLevelsIn) noexcept
+        : samples (dataIn)
+        , tableLength (tableSizeIn)
+        , tables (numTablesIn)
+        , mipLevels (numMipLevelsIn)
+    {
+    }
 
-        const FloatType   idx  = phase * static_cast<FloatType> (TableSize);
-        const std::size_t i1   = static_cast<std::size_t> (idx) & mask;
-        const std::size_t i0   = (i1 - 1) & mask;
-        const std::size_t i2   = (i1 + 1) & mask;
-        const std::size_t i3   = (i1 + 2) & mask;
-        const FloatType   frac = idx - std::floor (idx);
+    /** @brief Samples of morph table @p i at mip level @p level. */
+    CASPI_NO_DISCARD const FloatType* table (std::size_t i, std::size_t level) const noexcept
+    {
+        CASPI_ASSERT (i < tables, "Table index out of range");
+        CASPI_ASSERT (level < mipLevels, "Mip level out of range");
+        return samples + (i * mipLevels + level) * tableLength;
+    }
 
-        const FloatType y0 = samples[i0];
-        const FloatType y1 = samples[i1];
-        const FloatType y2 = samples[i2];
-        const FloatType y3 = samples[i3];
+    CASPI_NO_DISCARD const FloatType* data() const noexcept { return samples; }
+    CASPI_NO_DISCARD std::size_t tableSize() const noexcept { return tableLength; }
+    CASPI_NO_DISCARD std::size_t numTables() const noexcept { return tables; }
+    CASPI_NO_DISCARD std::size_t numMipLevels() const noexcept { return mipLevels; }
+    CASPI_NO_DISCARD bool empty() const noexcept { return samples == nullptr; }
 
-        const FloatType c3 = FloatType (-0.5) * y0 + FloatType ( 1.5) * y1
-                           + FloatType (-1.5) * y2 + FloatType ( 0.5) * y3;
-        const FloatType c2 = y0 + FloatType (-2.5) * y1
-                           + FloatType ( 2.0) * y2 + FloatType (-0.5) * y3;
-        const FloatType c1 = FloatType (-0.5) * y0 + FloatType (0.5) * y2;
-        const FloatType c0 = y1;
+    /** @brief Total samples covered by the view. */
+    CASPI_NO_DISCARD std::size_t numSamples() const noexcept
+    {
+        return tableLength * tables * mipLevels;
+    }
+
+    /** @brief True if the view is non-empty and has exactly these dimensions. */
+    CASPI_NO_DISCARD bool matches (std::size_t tableSizeIn,
+                                   std::size_t numTablesIn,
+                                   std::size_t numMipLevelsIn) const noexcept
+    {
+        return samples != nullptr
+            && tableLength == tableSizeIn
+            && tables == numTablesIn
+            && mipLevels == numMipLevelsIn;
+    }
+
+    /**
+     * @brief Read one sample from every page the view covers.
+     *
+     * @details
+     * Faults in pages that are not resident yet (e.g. a freshly mapped
+     * file) so the audio thread does not take the page faults. Setup
+     * thread only.
+     */
+    void prefetch() const noexcept CASPI_BLOCKING
+    {
+        constexpr std::size_t kStride = 4096 / sizeof (FloatType);
 
-        return ((c3 * frac + c2) * frac + c1) * frac + c0;
+        const std::size_t n = numSamples();
+        FloatType acc       = FloatType (0);
+        for (std::size_t i = 0; i < n; i += kStride)
+            acc += samples[i];
+        if (n > 0)
+            acc += samples[n - 1];
+
+        volatile FloatType sink = acc;
+        (void) sink;
     }
 
 private:
-    std::array<FloatType, TableSize> samples {};
+    const FloatType* samples     { nullptr };
+    std::size_t      tableLength { 0 };
+    std::size_t      tables      { 0 };
+    std::size_t      mipLevels   { 0 };
 };
 
 
+/*******************************************************************************
+ * WaveTableBankPublisher
+ ******************************************************************************/
+
+/** @brief One published bank. Immutable once published. */
+template <typename FloatType>
+struct WaveTableBankSnapshot
+{
+    WaveTableBankView<FloatType> view;
+    std::shared_ptr<const void>  owner;   ///< Keeps the view's data alive.
+};
+
+namespace detail
+{
+
+/** @brief Owners with their own prefetch() (MappedWaveTableBank) also advise the OS. */
+template <typename Owner>
+auto prefetchBankOwner (const Owner& owner, int) -> decltype (owner.prefetch(), void())
+{
+    owner.prefetch();
+}
+
+template <typename Owner>
+void prefetchBankOwner (const Owner& owner, long)
+{
+    owner.view().prefetch();
+}
+
+} // namespace detail
+
+/**
+ * @brief Lock-free hand-over of new wavetable banks to running oscillators.
+ *
+ * @details
+ * A Core::SnapshotPublisher of WaveTableBankSnapshot: a loader thread builds
+ * or maps a bank and publishes it; oscillators attached with
+ * WavetableOscillator::setBankPublisher() pick the new snapshot up on their
+ * next block (or sample) and crossfade to it. Each oscillator's Reader
+ * protects the snapshot it is playing and the one it is fading to, and
+ * collect() releases the owners of banks no oscillator still reads.
+ *
+ * @code
+ *   WaveTableBankPublisher<float> banks;
+ *   banks.publish (std::make_shared<const Bank> (...));    // loader thread
+ *   osc.setBankPublisher (&banks);                          // setup thread
+ *
+ *   // later, while audio runs
+ *   banks.publish (MappedWaveTableBank<float>::acquire ("pad.cwtb").value());
+ *   ...
+ *   banks.collect();                                        // timer / loader thread
+ * @endcode
+ *
+ * publish() faults every page of the bank in before the swap, on the
+ * calling (loader) thread, so a freshly mapped bank never page-faults on
+ * the audio thread during the crossfade. For a MappedWaveTableBank it first
+ * asks the OS to read the file ahead (MappedWaveTableBank::prefetch()).
+ *
+ * Thread rules are those of Core::SnapshotPublisher. Every oscillator must
+ * be detached (setBankPublisher (nullptr) or destroying it) before the
+ * publisher is destroyed.
+ *
+ * @tparam FloatType  float or double.
+ */
+template <typename FloatType>
+class WaveTableBankPublisher : public Core::SnapshotPublisher<WaveTableBankSnapshot<FloatType>>
+{
+public:
+    /**
+     * @brief Publish a bank owned by @p owner.
+     *
+     * @details
+     * Owner is anything with a view() returning WaveTableBankView<FloatType>
+     * — WaveTableBank or MappedWaveTableBank. The publisher holds a
+     * reference until every oscillator has moved past the bank. The bank
+     * is prefetched through the owner's prefetch() when it has one.
+     */
+    template <typename Owner>
+    void publish (std::shared_ptr<Owner> owner) CASPI_ALLOCATING
+    {
+        CASPI_ASSERT (owner != nullptr, "Cannot publish a null bank");
+        detail::prefetchBankOwner (*owner, 0);
+        const WaveTableBankView<FloatType> view = owner->view();
+        swapIn (view, std::move (owner));
+    }
+
+    /**
+     * @brief Publish @p view, kept alive by @p owner.
+     *
+     * @param view   Bank data, prefetched before the swap. Dimensions are
+     *               checked by each oscillator; a mismatching bank is
+     *               ignored by it.
+     * @param owner  Owner of the data, released once no reader holds it.
+     */
+    void publish (const WaveTableBankView<FloatType>& view,
+                  std::shared_ptr<const void>         owner) CASPI_ALLOCATING
+    {
+        view.prefetch();
+        swapIn (view, std::move (owner));
+    }
+
+private:
+    void swapIn (const WaveTableBankView<FloatType>& view, std::shared_ptr<const void> owner) CASPI_ALLOCATING
+    {
+        Core::SnapshotPublisher<WaveTableBankSnapshot<FloatType>>::publish ({ view, std::move (owner) });
+    }
+};
+
 /*******************************************************************************
  * WaveTableBank
  ******************************************************************************/
 
 /**
- * @brief Ordered collection of WaveTables for morphing.
+ * @brief Ordered collection of WaveTables for morphing, optionally mipmapped.
  *
  * @details
  * Tables are owned by value — no heap allocation. The oscillator reads
@@ -471,21 +790,52 @@ class WaveTable
  *   // morph at 0.5 → equal mix of sine and saw
  * @endcode
  *
+ * ### Mip levels
+ * With MipLevels > 1 every morph table carries a chain of band-limited
+ * copies. Level 0 is the table as filled; level k keeps harmonics
+ * 1..harmonicLimit(k) = (TableSize/2) >> k and is produced from level 0 by
+ * zeroing the FFT bins above that limit. A note whose phase increment is
+ * `inc` cycles/sample is alias-free on any level with
+ * harmonicLimit(k) * inc <= 0.5, which the oscillator selects per block.
+ *
+ * fillAll() and fillTable() rebuild the levels of the tables they touch.
+ * After writing level 0 directly through operator[], call buildMipLevels().
+ *
+ * Every level keeps the full TableSize, so upper levels are heavily
+ * oversampled and linear interpolation images stay far below the signal.
+ * Footprint is footprintBytes() = TableSize · NumTables · MipLevels ·
+ * sizeof(FloatType):
+ *
+ * | TableSize | Levels | float / morph table | double / morph table |
+ * |-----------|--------|---------------------|----------------------|
+ * | 2048      | 1      | 8 KiB               | 16 KiB               |
+ * | 2048      | 11     | 88 KiB              | 176 KiB              |
+ * | 1024      | 10     | 40 KiB              | 80 KiB               |
+ * | 4096      | 12     | 192 KiB             | 384 KiB              |
+ *
+ * Large banks should live in static storage or on the heap, not the stack.
+ *
  * @tparam FloatType   float or double.
  * @tparam TableSize   Power-of-two table length. Must match the oscillator.
  * @tparam NumTables   Number of morph tables. Must be >= 1.
+ * @tparam MipLevels   Band-limited levels per table, in [1, MaxMipLevels<TableSize>].
+ *                     1 (default) disables mipmapping.
  */
 template <typename FloatType,
           std::size_t TableSize  = 2048,
-          std::size_t NumTables  = 1>
+          std::size_t NumTables  = 1,
+          std::size_t MipLevels  = 1>
 class WaveTableBank
 {
     CASPI_STATIC_ASSERT (NumTables >= 1,
                    "WaveTableBank requires at least one table");
+    CASPI_STATIC_ASSERT (MipLevels >= 1 && MipLevels <= MaxMipLevels<TableSize>::value,
+                   "WaveTableBank MipLevels must be in [1, log2(TableSize)]");
 
 public:
-    static constexpr std::size_t numTables = NumTables;
-    static constexpr std::size_t tableSize = TableSize;
+    static constexpr std::size_t numTables    = NumTables;
+    static constexpr std::size_t tableSize    = TableSize;
+    static constexpr std::size_t numMipLevels = MipLevels;
 
     using Table = WaveTable<FloatType, TableSize>;
 
@@ -494,7 +844,7 @@ class WaveTableBank
      *************************************************************************/
 
     /**
-     * @brief Mutable access to table at index @p i.
+     * @brief Mutable access to table at index @p i (mip level 0).
      *
      * @param i  Table index in [0, NumTables). Asserts in debug builds.
      * @return   Reference to the WaveTable.
@@ -502,11 +852,11 @@ class WaveTableBank
     Table& operator[] (std::size_t i) noexcept
     {
         CASPI_ASSERT (i < NumTables, "Table index out of range");
-        return tables[i];
+        return tables[i][0];
     }
 
     /**
-     * @brief Const access to table at index @p i.
+     * @brief Const access to table at index @p i (mip level 0).
      *
      * @param i  Table index in [0, NumTables). Asserts in debug builds.
      * @return   Const reference to the WaveTable.
@@ -514,7 +864,51 @@ class WaveTableBank
     const Table& operator[] (std::size_t i) const noexcept
     {
         CASPI_ASSERT (i < NumTables, "Table index out of range");
-        return tables[i];
+        return tables[i][0];
+    }
+
+    /**
+     * @brief Const access to mip level @p level of table @p i.
+     *
+     * @param i      Table index in [0, NumTables).
+     * @param level  Mip level in [0, MipLevels).
+     * @return       Const reference to the band-limited WaveTable.
+     */
+    const Table& mipLevel (std::size_t i, std::size_t level) const noexcept
+    {
+        CASPI_ASSERT (i < NumTables, "Table index out of range");
+        CASPI_ASSERT (level < MipLevels, "Mip level out of range");
+        return tables[i][level];
+    }
+
+    /**
+     * @brief Highest harmonic kept by mip level @p level.
+     *
+     * @param level  Mip level in [0, MipLevels).
+     * @return       (TableSize / 2) >> level.
+     */
+    static constexpr std::size_t harmonicLimit (std::size_t level) noexcept
+    {
+        return (TableSize / 2) >> level;
+    }
+
+    /** @brief Bytes of sample storage held by the bank. */
+    static constexpr std::size_t footprintBytes() noexcept
+    {
+        return TableSize * NumTables * MipLevels * sizeof (FloatType);
+    }
+
+    /**
+     * @brief Runtime-sized view of the bank's samples.
+     *
+     * @details
+     * The view points into this bank, which must outlive it.
+     */
+    CASPI_NO_DISCARD WaveTableBankView<FloatType> view() const noexcept
+    {
+        CASPI_STATIC_ASSERT (sizeof (Table) == TableSize * sizeof (FloatType),
+                             "WaveTable must be exactly its samples for the bank to be contiguous");
+        return WaveTableBankView<FloatType> (tables[0][0].data(), TableSize, NumTables, MipLevels);
     }
 
     /*************************************************************************
@@ -524,28 +918,95 @@ class WaveTableBank
     /**
      * @brief Fill all tables with the same callable.
      *
+     * @details
+     * Rebuilds every mip level when MipLevels > 1, which allocates.
+     *
      * @param fn  Callable matching `FloatType(FloatType normalised_phase)`.
      * @return    Reference to this bank for chaining.
      */
-    WaveTableBank& fillAll (std::function<FloatType (FloatType)> fn) noexcept CASPI_NON_BLOCKING
+    WaveTableBank& fillAll (std::function<FloatType (FloatType)> fn) CASPI_ALLOCATING
     {
         for (auto& t : tables)
-            t.fillWith (fn);
+            t[0].fillWith (fn);
+        buildMipLevels();
         return *this;
     }
 
     /**
      * @brief Fill table @p i with @p fn.
      *
+     * @details
+     * Rebuilds table @p i's mip levels when MipLevels > 1, which allocates.
+     *
      * @param i   Table index in [0, NumTables).
      * @param fn  Callable matching `FloatType(FloatType normalised_phase)`.
      * @return    Reference to this bank for chaining.
      */
     WaveTableBank& fillTable (std::size_t                        i,
-                               std::function<FloatType (FloatType)> fn) noexcept CASPI_NON_BLOCKING
+                               std::function<FloatType (FloatType)> fn) CASPI_ALLOCATING
+    {
+        CASPI_ASSERT (i < NumTables, "Table index out of range");
+        tables[i][0].fillWith (fn);
+        buildMipLevels (i);
+        return *this;
+    }
+
+    /*************************************************************************
+     * Mip level generation
+     *************************************************************************/
+
+    /**
+     * @brief Regenerate the band-limited levels of every table from level 0.
+     *
+     * @return Reference to this bank for chaining.
+     */
+    WaveTableBank& buildMipLevels() CASPI_ALLOCATING
+    {
+        for (std::size_t i = 0; i < NumTables; ++i)
+            buildMipLevels (i);
+        return *this;
+    }
+
+    /**
+     * @brief Regenerate the band-limited levels of table @p i from level 0.
+     *
+     * @details
+     * One forward FFT of level 0, then one inverse FFT per level with the
+     * bins above harmonicLimit(level) (and their negative-frequency
+     * mirrors) zeroed. No-op when MipLevels == 1. Setup thread only.
+     *
+     * @param i  Table index in [0, NumTables).
+     * @return   Reference to this bank for chaining.
+     */
+    WaveTableBank& buildMipLevels (std::size_t i) CASPI_ALLOCATING
     {
         CASPI_ASSERT (i < NumTables, "Table index out of range");
-        tables[i].fillWith (fn);
+
+        CASPI_CPP17_IF_CONSTEXPR (MipLevels > 1)
+        {
+            CASPI::FFT engine (FFTConfig { TableSize, 1.0 });
+
+            CArray spectrum (TableSize);
+            for (std::size_t n = 0; n < TableSize; ++n)
+                spectrum[n] = Complex (static_cast<double> (tables[i][0][n]), 0.0);
+            engine.perform (spectrum);
+
+            CArray band (TableSize);
+            for (std::size_t level = 1; level < MipLevels; ++level)
+            {
+                const std::size_t limit = harmonicLimit (level);
+
+                for (std::size_t b = 0; b < TableSize; ++b)
+                {
+                    const bool kept = (b <= limit) || (b >= TableSize - limit);
+                    band[b]         = kept ? spectrum[b] : Complex (0.0, 0.0);
+                }
+                engine.performInverse (band);
+
+                for (std::size_t n = 0; n < TableSize; ++n)
+                    tables[i][level][n] = static_cast<FloatType> (band[n].real());
+            }
+        }
         return *this;
     }
 
@@ -563,14 +1024,15 @@ class WaveTableBank
      *
      * @param phase     Normalised oscillator phase in [0, 1).
      * @param morphPos  Pre-scaled morph position in [0, NumTables-1].
+     * @param level     Mip level in [0, MipLevels). Default 0.
      * @return          Crossfaded sample value.
      */
     CASPI_NO_DISCARD
-    FloatType readLinear (FloatType phase, FloatType morphPos) const noexcept CASPI_NON_BLOCKING
+    FloatType readLinear (FloatType phase, FloatType morphPos, std::size_t level = 0) const noexcept CASPI_NON_BLOCKING
     {
         CASPI_CPP17_IF_CONSTEXPR (NumTables == 1)
         {
-            return tables[0].readLinear (phase);
+            return tables[0][level].readLinear (phase);
         }
         else
         {
@@ -581,8 +1043,8 @@ class WaveTableBank
             const std::size_t iB   = std::min (iA + 1, NumTables - 1);
             const FloatType   frac = clamped - static_cast<FloatType> (iA);
 
-            return tables[iA].readLinear (phase)
-                 + frac * (tables[iB].readLinear (phase) - tables[iA].readLinear (phase));
+            return tables[iA][level].readLinear (phase)
+                 + frac * (tables[iB][level].readLinear (phase) - tables[iA][level].readLinear (phase));
         }
     }
 
@@ -599,14 +1061,15 @@ class WaveTableBank
      *
      * @param phase     Normalised oscillator phase in [0, 1).
      * @param morphPos  Pre-scaled morph position in [0, NumTables-1].
+     * @param level     Mip level in [0, MipLevels). Default 0.
      * @return          Crossfaded sample value.
      */
     CASPI_NO_DISCARD
-    FloatType readHermite (FloatType phase, FloatType morphPos) const noexcept CASPI_NON_BLOCKING
+    FloatType readHermite (FloatType phase, FloatType morphPos, std::size_t level = 0) const noexcept CASPI_NON_BLOCKING
     {
         CASPI_CPP17_IF_CONSTEXPR (NumTables == 1)
         {
-            return tables[0].readHermite (phase);
+            return tables[0][level].readHermite (phase);
         }
         else
         {
@@ -617,13 +1080,13 @@ class WaveTableBank
             const std::size_t iB   = std::min (iA + 1, NumTables - 1);
             const FloatType   frac = clamped - static_cast<FloatType> (iA);
 
-            return tables[iA].readHermite (phase)
-                 + frac * (tables[iB].readHermite (phase) - tables[iA].readHermite (phase));
+            return tables[iA][level].readHermite (phase)
+                 + frac * (tables[iB][level].readHermite (phase) - tables[iA][level].readHermite (phase));
         }
     }
 
 private:
-    std::array<Table, NumTables> tables {};
+    std::array<std::array<Table, MipLevels>, NumTables> tables {};
 };
 
 
@@ -636,23 +1099,46 @@ class WaveTableBank
  *        modulation.
  *
  * @details
- * Holds a non-owning pointer to a WaveTableBank. The bank must outlive the
- * oscillator. The bank can be swapped at runtime via setBank(); thread-safety
- * of the swap is the caller's responsibility.
+ * Reads through a non-owning WaveTableBankView, taken from a WaveTableBank
+ * or from a memory-mapped bank file (caspi_WavetableFile.h). The bank must
+ * outlive the oscillator. The bank can be swapped at runtime via setBank();
+ * thread-safety of the swap is the caller's responsibility. To load banks
+ * while audio runs, attach a WaveTableBankPublisher with setBankPublisher():
+ * new banks are crossfaded in at block boundaries and the old ones freed
+ * off the audio thread.
  *
  * ### Thread safety
  * - setFrequency(), setAmplitude(), setMorphPosition(), setPhaseOffset(),
- *   setPhaseModDepth(), setInterpolationMode(), setSampleRate(), setBank() —
- *   call from the audio thread or before streaming starts. Not thread-safe
- *   with concurrent renderSample() / renderBlock() calls.
+ *   setPhaseModDepth(), setInterpolationMode(), setSampleRate(), setBank(),
+ *   setBankCrossfade() — call from the audio thread or before streaming
+ *   starts. Not thread-safe with concurrent renderSample() / renderBlock()
+ *   calls.
+ * - setBankPublisher() — setup thread, not while rendering. Publishing to
+ *   an attached publisher is safe from any thread at any time.
  * - amplitude / frequency / morphPosition parameter writes
  *   (setBaseNormalised, addModulation) — the underlying atomic base value
  *   is thread-safe; smoother state is not.
  * - renderSample() / renderBlock() — audio thread only.
  *
+ * ### Mip level selection
+ * With MipLevels > 1 the oscillator reads the band-limited level chosen
+ * from the phase increment each time it changes: the lowest level whose
+ * top harmonic stays at or below Nyquist, i.e.
+ * @code
+ *   octaves = log2(TableSize * increment)
+ *   level   = clamp(ceil(octaves), 0, MipLevels - 1)            // default
+ *   pos     = clamp(octaves + 1,   0, MipLevels - 1)            // crossfade
+ *   out     = lerp(level[floor(pos)], level[floor(pos) + 1], frac(pos))
+ * @endcode
+ * The default switches level at octave boundaries, keeping the most
+ * harmonics. setMipCrossfade(true) blends the two levels that are both
+ * alias-free, so sweeps change timbre smoothly at the cost of up to one
+ * octave of top-end bandwidth and a second table read.
+ *
  * @tparam FloatType   float or double.
  * @tparam TableSize   Power-of-two table length. Must match the bank.
  * @tparam NumTables   Number of morph tables. Must match the bank.
+ * @tparam MipLevels   Mip levels per table. Must match the bank.
  *
  * @code
  *   CASPI::Oscillators::WaveTableBank<float, 2048, 1> bank;
@@ -665,9 +1151,10 @@ class WaveTableBank
  */
 template <CASPI_FLOAT_TYPE FloatType,
           std::size_t TableSize = 2048,
-          std::size_t NumTables = 1>
+          std::size_t NumTables = 1,
+          std::size_t MipLevels = 1>
 class WavetableOscillator
-    : public Core::Producer<WavetableOscillator<FloatType, TableSize, NumTables>,
+    : public Core::Producer<WavetableOscillator<FloatType, TableSize, NumTables, MipLevels>,
                             FloatType,
                             Core::Traversal::PerFrame>
 {
@@ -678,11 +1165,18 @@ class WavetableOscillator
     CASPI_STATIC_ASSERT (NumTables >= 1,
                    "NumTables must be >= 1");
 
+    using Base = Core::Producer<WavetableOscillator<FloatType, TableSize, NumTables, MipLevels>,
+                                FloatType,
+                                Core::Traversal::PerFrame>;
+
     static constexpr FloatType kFreqMin = FloatType (20);
     static constexpr FloatType kFreqMax = FloatType (20000);
 
+    /// Control inputs read by processImpl(): 0 = frequency, 1 = morph position.
+    static constexpr std::size_t kNumControlInputs = 2;
+
 public:
-    using Bank = WaveTableBank<FloatType, TableSize, NumTables>;
+    using Bank = WaveTableBank<FloatType, TableSize, NumTables, MipLevels>;
 
     /*************************************************************************
      * Construction
@@ -697,6 +1191,7 @@ class WavetableOscillator
      * assert in debug builds.
      */
     WavetableOscillator() noexcept CASPI_NON_ALLOCATING
+        : Base (kNumControlInputs)
     {
         initParameters();
     }
@@ -711,7 +1206,8 @@ class WavetableOscillator
      * @param bankIn  Reference to the WaveTableBank. Must outlive this object.
      */
     explicit WavetableOscillator (Bank& bankIn) noexcept CASPI_NON_ALLOCATING
-        : bank (&bankIn)
+        : Base (kNumControlInputs)
+        , bankView (bankIn.view())
     {
         initParameters();
     }
@@ -733,7 +1229,8 @@ class WavetableOscillator
      * @endcode
      */
     WavetableOscillator (Bank& bankIn, FloatType sampleRate, FloatType hz) noexcept CASPI_NON_ALLOCATING
-        : bank (&bankIn)
+        : Base (kNumControlInputs)
+        , bankView (bankIn.view())
     {
         initParameters();
         this->setSampleRate (sampleRate);
@@ -776,6 +1273,7 @@ class WavetableOscillator
         frequency.setBaseNormalised (detail::hzToNormLog (hz, kFreqMin, kFreqMax));
         frequency.skip (1000);
         phase.increment = hz / this->getSampleRate();
+        selectMipLevel();
     }
 
     /**
@@ -864,6 +1362,22 @@ class WavetableOscillator
         phaseModDepth = depth;
     }
 
+    /**
+     * @brief Choose how processImpl() applies its control inputs. Default: PerBlock.
+     *
+     * @details
+     * PerSample reads each connected source's per-sample block (e.g. an LFO)
+     * and steps the modulation every frame, removing block-stepped zipper
+     * noise at the cost of a renderSample() per frame. Inputs whose source
+     * publishes no block fall back to the per-block scalar.
+     *
+     * @param rate  Graph::ControlRate::PerBlock or Graph::ControlRate::PerSample.
+     */
+    void setModulationRate (Graph::ControlRate rate) noexcept CASPI_NON_BLOCKING
+    {
+        modulationRate = rate;
+    }
+
     /**
      * @brief Select the table interpolation kernel. Default: Linear.
      *
@@ -879,6 +1393,31 @@ class WavetableOscillator
         interpMode = mode;
     }
 
+    /**
+     * @brief Crossfade between adjacent mip levels instead of switching.
+     *
+     * @details
+     * Default: off. See "Mip level selection" above for the trade-off.
+     * No effect when MipLevels == 1.
+     *
+     * @param enabled  true to crossfade, false to switch at octave boundaries.
+     */
+    void setMipCrossfade (bool enabled) noexcept CASPI_NON_BLOCKING
+    {
+        mipCrossfade = enabled;
+        selectMipLevel();
+    }
+
+    /**
+     * @brief Current mip read position: level index plus crossfade fraction.
+     *
+     * @return Value in [0, MipLevels - 1]. Always 0 when MipLevels == 1.
+     */
+    CASPI_NO_DISCARD FloatType getMipPosition() const noexcept CASPI_NON_BLOCKING
+    {
+        return static_cast<FloatType> (mipLevel) + mipBlend;
+    }
+
     /**
      * @brief Swap the wavetable bank at runtime.
      *
@@ -895,7 +1434,106 @@ class WavetableOscillator
      */
     void setBank (Bank& newBank) noexcept CASPI_NON_BLOCKING
     {
-        bank = &newBank;
+        bankView = newBank.view();
+    }
+
+    /**
+     * @brief Point the oscillator at a runtime-sized bank view.
+     *
+     * @details
+     * Use with MappedWaveTableBank (caspi_WavetableFile.h) or any other
+     * contiguous table data. The view's dimensions must equal this
+     * oscillator's TableSize, NumTables and MipLevels; otherwise the
+     * current bank is kept and false is returned. The data must outlive
+     * the oscillator's use of it. Same threading rules as setBank(Bank&).
+     *
+     * @param view  Bank data to read from.
+     * @return      True if the view was accepted.
+     *
+     * @code
+     *   auto file = MappedWaveTableBank<float>::acquire ("basic.cwtb");
+     *   if (file && osc.setBank (file.value()->view()))
+     *       osc.prepare();
+     * @endcode
+     */
+    CASPI_NO_DISCARD bool setBank (const WaveTableBankView<FloatType>& view) noexcept CASPI_NON_BLOCKING
+    {
+        if (! view.matches (TableSize, NumTables, MipLevels))
+            return false;
+
+        bankView = view;
+        return true;
+    }
+
+    /** @brief The bank data the oscillator currently reads. */
+    CASPI_NO_DISCARD const WaveTableBankView<FloatType>& getBankView() const noexcept
+    {
+        return bankView;
+    }
+
+    /**
+     * @brief Follow the banks published by @p newPublisher. Setup thread.
+     *
+     * @details
+     * Registers hazard slots with the publisher. From then on every
+     * renderBlock() (and renderSample()) checks for a new publication; a
+     * matching bank is faded in over setBankCrossfade() samples, starting
+     * at that block boundary. The first bank is adopted without a fade if
+     * the oscillator has none yet. Banks whose dimensions do not match the
+     * oscillator are ignored.
+     *
+     * Passing nullptr detaches. If the current bank came from the publisher
+     * it may be freed after detaching, so the view is cleared; call
+     * setBank() before rendering again. Not thread-safe with rendering.
+     *
+     * @param newPublisher  Publisher to follow, or nullptr. Must outlive the
+     *                      attachment.
+     */
+    void setBankPublisher (WaveTableBankPublisher<FloatType>* newPublisher) CASPI_ALLOCATING
+    {
+        if (publisher != nullptr)
+        {
+            if (activeSnapshot != nullptr || pendingSnapshot != nullptr)
+                bankView = {};
+
+            publisher->removeReader (reader);
+            publisher       = nullptr;
+            reader          = nullptr;
+            activeSnapshot  = nullptr;
+            pendingSnapshot = nullptr;
+            fadeFromView    = {};
+            fadeRemaining   = 0;
+        }
+
+        if (newPublisher != nullptr)
+        {
+            publisher    = newPublisher;
+            reader       = publisher->addReader();
+            seenSequence = 0;
+        }
+    }
+
+    /**
+     * @brief Length of the fade to a newly published bank. Default 256.
+     *
+     * @param numSamples  Fade length in samples; 0 switches instantly.
+     */
+    void setBankCrossfade (int numSamples) noexcept CASPI_NON_BLOCKING
+    {
+        CASPI_ASSERT (numSamples >= 0, "Crossfade length must not be negative");
+        bankFadeLength = numSamples;
+    }
+
+    /** @brief True while fading from the previous bank to a published one. */
+    CASPI_NO_DISCARD bool isBankCrossfading() const noexcept CASPI_NON_BLOCKING
+    {
+        return fadeRemaining > 0;
+    }
+
+    /** @brief Detaches from the bank publisher, if any. */
+    ~WavetableOscillator() CASPI_BLOCKING
+    {
+        setBankPublisher (nullptr);
     }
 
     /*************************************************************************
@@ -920,10 +1558,28 @@ class WavetableOscillator
     {
         const FloatType hz = frequency.value();
         phase.increment    = (newRate > FloatType (0)) ? hz / newRate : FloatType (0);
+        selectMipLevel();
     }
 
-    /** @brief AudioNode hook — no additional setup needed beyond onSampleRateChanged. */
-    void onPrepare (std::size_t, std::size_t, double) noexcept {}
+    /**
+     * @brief Fault in every page of the current bank. Setup thread only.
+     *
+     * @details
+     * A memory-mapped bank is loaded lazily by the OS, so the first read
+     * of each page would otherwise block the audio thread on disk I/O.
+     * Call after setBank() and before rendering; AudioGraph::prepare()
+     * calls it through onPrepare(). Cheap for banks already in memory.
+     */
+    void prepare() const noexcept CASPI_BLOCKING
+    {
+        bankView.prefetch();
+    }
+
+    /** @brief AudioNode hook — prefetches the bank; sample rate is handled by onSampleRateChanged. */
+    void onPrepare (std::size_t, std::size_t, double) noexcept
+    {
+        prepare();
+    }
 
     /*************************************************************************
      * Phase control
@@ -1034,6 +1690,8 @@ class WavetableOscillator
     CASPI_NO_DISCARD
     FloatType renderSample() noexcept CASPI_NON_BLOCKING override
     {
+        pollPublisher();
+
         amplitude.process();
         frequency.process();
         morphPosition.process();
@@ -1041,11 +1699,16 @@ class WavetableOscillator
         const FloatType hz = frequency.value();
         const FloatType fs = this->getSampleRate();
         phase.increment    = hz / fs;
+        if (phase.increment != mipIncrement)
+            selectMipLevel();
 
         const FloatType pBefore = phase.phase;
         phase.advanceAndWrap (FloatType (1));
         wrapped = (phase.phase < pBefore);
 
+        if (fadeRemaining > 0)
+            return readFading (pBefore) * amplitude.value();
+
         return readTable (pBefore) * amplitude.value();
     }
 
@@ -1055,12 +1718,27 @@ class WavetableOscillator
      *
      * Control input port 0 (optional): frequency modulation in [-1, 1] normalised.
      * Control input port 1 (optional): morph position modulation in [-1, 1] normalised.
+     *
+     * Modulation is applied once per block unless setModulationRate() selected
+     * PerSample and a source publishes a per-sample block.
      */
     void processImpl (Graph::AudioContext<FloatType>& ctx) noexcept
     {
         const FloatType freqMod  = ctx.getControlInput (this->getId(), 0);
         const FloatType morphMod = ctx.getControlInput (this->getId(), 1);
 
+        if (modulationRate == Graph::ControlRate::PerSample)
+        {
+            const FloatType* freqBlock  = ctx.getControlInputBlock (this->getId(), 0);
+            const FloatType* morphBlock = ctx.getControlInputBlock (this->getId(), 1);
+
+            if (freqBlock != nullptr || morphBlock != nullptr)
+            {
+                renderModulated (freqBlock, freqMod, morphBlock, morphMod);
+                return;
+            }
+        }
+
         if (freqMod != FloatType (0))
         {
             frequency.addModulation (freqMod);
@@ -1122,16 +1800,26 @@ class WavetableOscillator
         CASPI_ASSERT (output     != nullptr, "Output buffer must not be null");
         CASPI_ASSERT (numSamples >  0,       "numSamples must be positive");
 
-        amplitude.process();
-        frequency.process();
-        morphPosition.process();
+        const FloatType amp = beginBlock();
+
+        // A bank fade in progress is rendered per sample, then SIMD resumes
+        const int faded = std::min (numSamples, fadeRemaining);
+        for (int i = 0; i < faded; ++i)
+        {
+            const FloatType pBefore = phase.phase;
+            phase.advanceAndWrap (FloatType (1));
+            output[i] = readFading (pBefore) * amp;
+        }
 
-        const FloatType hz  = frequency.value();
-        const FloatType fs  = this->getSampleRate();
-        const FloatType amp = amplitude.value();
-        phase.increment     = hz / fs;
+        const int remaining = numSamples - faded;
+        const int vectored  = faded + remaining - remaining % static_cast<int> (kLanes);
 
-        for (int i = 0; i < numSamples; ++i)
+        if (interpMode == InterpolationMode::Hermite)
+            renderVectors<InterpolationMode::Hermite> (output + faded, vectored - faded, amp);
+        else
+            renderVectors<InterpolationMode::Linear> (output + faded, vectored - faded, amp);
+
+        for (int i = vectored; i < numSamples; ++i)
         {
             const FloatType pBefore = phase.phase;
             phase.advanceAndWrap (FloatType (1));
@@ -1142,6 +1830,35 @@ class WavetableOscillator
         wrapped = (numSamples > 0) && (phase.phase < phase.increment);
     }
 
+    /**
+     * @brief Render @p numSamples with the per-sample scalar loop.
+     *
+     * @details
+     * Same contract as renderBlock(); reads one sample at a time through
+     * readTable(). Kept as the reference the SIMD path is tested and
+     * benchmarked against.
+     *
+     * @param output      Pointer to a buffer of at least @p numSamples elements.
+     * @param numSamples  Number of samples to generate. Must be > 0.
+     */
+    void renderBlockScalar (FloatType* CASPI_RESTRICT output,
+                            int                       numSamples) noexcept CASPI_NON_BLOCKING
+    {
+        CASPI_ASSERT (output     != nullptr, "Output buffer must not be null");
+        CASPI_ASSERT (numSamples >  0,       "numSamples must be positive");
+
+        const FloatType amp = beginBlock();
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const FloatType pBefore = phase.phase;
+            phase.advanceAndWrap (FloatType (1));
+            output[i] = (fadeRemaining > 0 ? readFading (pBefore) : readTable (pBefore)) * amp;
+        }
+
+        wrapped = (numSamples > 0) && (phase.phase < phase.increment);
+    }
+
     /*************************************************************************
      * Public modulatable parameters
      *************************************************************************/
@@ -1240,6 +1957,13 @@ class WavetableOscillator
      */
     CASPI_ALWAYS_INLINE
     FloatType readTable (FloatType pBefore) const noexcept CASPI_NON_BLOCKING
+    {
+        return readTable (pBefore, bankView);
+    }
+
+    /** @brief readTable() from an explicit bank; used while crossfading banks. */
+    CASPI_ALWAYS_INLINE
+    FloatType readTable (FloatType pBefore, const WaveTableBankView<FloatType>& view) const noexcept CASPI_NON_BLOCKING
     {
         FloatType p = pBefore + phaseModDepth;
         if (p >= FloatType (1)) p -= FloatType (1);
@@ -1249,22 +1973,402 @@ class WavetableOscillator
             static_cast<FloatType> (NumTables > 1 ? NumTables - 1 : 1);
         const FloatType morphScaled = morphPosition.value() * kMorphScale;
 
+        const FloatType out = readBank (view, p, morphScaled, mipLevel);
+
+        CASPI_CPP17_IF_CONSTEXPR (MipLevels > 1)
+        {
+            if (mipBlend > FloatType (0))
+                return out + mipBlend * (readBank (view, p, morphScaled, mipLevel + 1) - out);
+        }
+
+        return out;
+    }
+
+    /**
+     * @brief Morph-crossfaded read of one mip level.
+     *
+     * @details
+     * Same arithmetic as WaveTableBank::readLinear() / readHermite(), but
+     * through a bank view so compiled and memory-mapped banks share one path.
+     */
+    CASPI_ALWAYS_INLINE
+    FloatType readBank (const WaveTableBankView<FloatType>& view,
+                        FloatType                           p,
+                        FloatType                           morphScaled,
+                        std::size_t                         level) const noexcept CASPI_NON_BLOCKING
+    {
+        CASPI_CPP17_IF_CONSTEXPR (NumTables == 1)
+        {
+            (void) morphScaled;
+            return readKernel (view.table (0, level), p);
+        }
+        else
+        {
+            const FloatType   clamped = std::max (FloatType (0),
+                                                   std::min (morphScaled,
+                                                             static_cast<FloatType> (NumTables - 1)));
+            const std::size_t iA   = static_cast<std::size_t> (clamped);
+            const std::size_t iB   = std::min (iA + 1, NumTables - 1);
+            const FloatType   frac = clamped - static_cast<FloatType> (iA);
+
+            const FloatType a = readKernel (view.table (iA, level), p);
+            return a + frac * (readKernel (view.table (iB, level), p) - a);
+        }
+    }
+
+    /** @brief Interpolation-mode dispatch for one table. */
+    CASPI_ALWAYS_INLINE
+    FloatType readKernel (const FloatType* table, FloatType p) const noexcept CASPI_NON_BLOCKING
+    {
         if (interpMode == InterpolationMode::Hermite)
-            return bank->readHermite (p, morphScaled);
+            return detail::readHermite<TableSize> (table, p);
+
+        return detail::readLinear<TableSize> (table, p);
+    }
+
+    /*************************************************************************
+     * Block rendering internals
+     *************************************************************************/
+
+    using simd_type = typename SIMD::Strategy::simd_type<FloatType, SIMD::Strategy::min_simd_width<FloatType>::value>::type;
 
-        return bank->readLinear (p, morphScaled);
+    static constexpr std::size_t  kLanes = SIMD::Strategy::min_simd_width<FloatType>::value;
+    static constexpr std::int32_t kMask  = static_cast<std::int32_t> (TableSize - 1);
+
+    /**
+     * @brief Per-sample modulated render into outputBuffer.
+     *
+     * @details
+     * A null block applies its per-block scalar on every frame instead.
+     */
+    void renderModulated (const FloatType* freqBlock,
+                          FloatType        freqMod,
+                          const FloatType* morphBlock,
+                          FloatType        morphMod) noexcept CASPI_NON_BLOCKING
+    {
+        auto&             out      = this->outputBuffer;
+        const std::size_t channels = out.numChannels();
+
+        for (std::size_t f = 0; f < out.numFrames(); ++f)
+        {
+            frequency.addModulation ((freqBlock != nullptr) ? freqBlock[f] : freqMod);
+            morphPosition.addModulation ((morphBlock != nullptr) ? morphBlock[f] : morphMod);
+
+            const FloatType s = renderSample();
+
+            frequency.clearModulation();
+            morphPosition.clearModulation();
+
+            for (std::size_t ch = 0; ch < channels; ++ch)
+            {
+                out.sample (ch, f) = s;
+            }
+        }
+    }
+
+    /**
+     * @brief Step the smoothers once and refresh the increment and mip level.
+     *
+     * @return The amplitude to apply for the whole block.
+     */
+    FloatType beginBlock() noexcept CASPI_NON_BLOCKING
+    {
+        pollPublisher();
+
+        amplitude.process();
+        frequency.process();
+        morphPosition.process();
+
+        const FloatType hz = frequency.value();
+        const FloatType fs = this->getSampleRate();
+        phase.increment    = hz / fs;
+        if (phase.increment != mipIncrement)
+            selectMipLevel();
+
+        return amplitude.value();
+    }
+
+    /**
+     * @brief SIMD body of renderBlock(); @p numSamples must be a multiple of kLanes.
+     *
+     * @details
+     * Morph tables, morph fraction and mip level are fixed for the block,
+     * so they are resolved to table pointers once. Lane phases are stepped
+     * serially with the same rounding as Phase::advanceAndWrap(), for
+     * bit-parity with renderSample() (see the file header).
+     */
+    template <InterpolationMode Mode>
+    void renderVectors (FloatType* CASPI_RESTRICT output,
+                        int                       numSamples,
+                        FloatType                 amp) noexcept CASPI_NON_BLOCKING
+    {
+        if (numSamples <= 0)
+            return;
+
+        const FloatType inc = phase.increment;
+        FloatType       ph  = phase.phase;
+
+        alignas (16) FloatType lanes[kLanes];
+
+        const simd_type pm    = SIMD::set1<FloatType> (phaseModDepth);
+        const simd_type size  = SIMD::set1<FloatType> (static_cast<FloatType> (TableSize));
+        const simd_type gain  = SIMD::set1<FloatType> (amp);
+
+        // Morph pair, resolved as in WaveTableBank::readLinear()
+        std::size_t iA        = 0;
+        std::size_t iB        = 0;
+        FloatType   morphFrac = FloatType (0);
+
+        CASPI_CPP17_IF_CONSTEXPR (NumTables > 1)
+        {
+            constexpr FloatType kTop = static_cast<FloatType> (NumTables - 1);
+            const FloatType clamped  = std::max (FloatType (0), std::min (morphPosition.value() * kTop, kTop));
+
+            iA        = static_cast<std::size_t> (clamped);
+            iB        = std::min (iA + 1, NumTables - 1);
+            morphFrac = clamped - static_cast<FloatType> (iA);
+        }
+
+        const simd_type morph = SIMD::set1<FloatType> (morphFrac);
+        const simd_type blend = SIMD::set1<FloatType> (mipBlend);
+
+        const FloatType* a0 = bankView.table (iA, mipLevel);
+        const FloatType* b0 = bankView.table (iB, mipLevel);
+        const FloatType* a1 = a0;
+        const FloatType* b1 = b0;
+        bool crossfadeMips  = false;
+
+        CASPI_CPP17_IF_CONSTEXPR (MipLevels > 1)
+        {
+            crossfadeMips = mipBlend > FloatType (0);
+            if (crossfadeMips)
+            {
+                a1 = bankView.table (iA, mipLevel + 1);
+                b1 = bankView.table (iB, mipLevel + 1);
+            }
+        }
+
+        for (int i = 0; i < numSamples; i += static_cast<int> (kLanes))
+        {
+            for (std::size_t k = 0; k < kLanes; ++k)
+            {
+                lanes[k] = ph;
+                ph += inc;
+                if (ph >= FloatType (1))
+                    ph -= std::floor (ph);
+            }
+
+            simd_type q = SIMD::add (SIMD::load_aligned<FloatType> (lanes), pm);
+            q           = SIMD::sub (q, SIMD::floor (q));
+
+            const simd_type idx  = SIMD::mul (q, size);
+            const simd_type i0   = SIMD::floor (idx);
+            const simd_type frac = SIMD::sub (idx, i0);
+
+            simd_type out = readMorph<Mode> (a0, b0, morph, i0, frac);
+
+            if (crossfadeMips)
+            {
+                const simd_type upper = readMorph<Mode> (a1, b1, morph, i0, frac);
+                out                   = SIMD::mul_add (blend, SIMD::sub (upper, out), out);
+            }
+
+            SIMD::store_unaligned (output + i, SIMD::mul (out, gain));
+        }
+
+        phase.phase = ph;
+    }
+
+    /** @brief Interpolated read of tables @p a and @p b, crossfaded by @p morph. */
+    template <InterpolationMode Mode>
+    CASPI_ALWAYS_INLINE
+    static simd_type readMorph (const FloatType* a,
+                                const FloatType* b,
+                                simd_type        morph,
+                                simd_type        i0,
+                                simd_type        frac) noexcept CASPI_NON_BLOCKING
+    {
+        const simd_type outA = readVector<Mode> (a, i0, frac);
+
+        CASPI_CPP17_IF_CONSTEXPR (NumTables > 1)
+        {
+            const simd_type outB = readVector<Mode> (b, i0, frac);
+            return SIMD::mul_add (morph, SIMD::sub (outB, outA), outA);
+        }
+
+        (void) b;
+        (void) morph;
+        return outA;
+    }
+
+    /**
+     * @brief Vector counterpart of WaveTable::readLinear() / readHermite().
+     *
+     * @param table  Table samples.
+     * @param i0     floor(phase · TableSize) per lane.
+     * @param frac   Fractional index per lane.
+     */
+    template <InterpolationMode Mode>
+    CASPI_ALWAYS_INLINE
+    static simd_type readVector (const FloatType* table, simd_type i0, simd_type frac) noexcept CASPI_NON_BLOCKING
+    {
+        const simd_type one = SIMD::set1<FloatType> (FloatType (1));
+        const simd_type y1  = SIMD::gather (table, i0, kMask);
+        const simd_type y2  = SIMD::gather (table, SIMD::add (i0, one), kMask);
+
+        CASPI_CPP17_IF_CONSTEXPR (Mode == InterpolationMode::Hermite)
+        {
+            const simd_type y0 = SIMD::gather (table, SIMD::sub (i0, one), kMask);
+            const simd_type y3 = SIMD::gather (table, SIMD::add (i0, SIMD::set1<FloatType> (FloatType (2))), kMask);
+
+            const simd_type half = SIMD::set1<FloatType> (FloatType (0.5));
+
+            // Catmull-Rom, same coefficients as WaveTable::readHermite()
+            const simd_type c3 = SIMD::mul_add (SIMD::set1<FloatType> (FloatType (1.5)), SIMD::sub (y1, y2),
+                                                SIMD::mul (half, SIMD::sub (y3, y0)));
+            const simd_type c2 = SIMD::sub (SIMD::add (y0, SIMD::mul (SIMD::set1<FloatType> (FloatType (2)), y2)),
+                                            SIMD::mul_add (SIMD::set1<FloatType> (FloatType (2.5)), y1,
+                                                           SIMD::mul (half, y3)));
+            const simd_type c1 = SIMD::mul (half, SIMD::sub (y2, y0));
+
+            simd_type out = SIMD::mul_add (c3, frac, c2);
+            out           = SIMD::mul_add (out, frac, c1);
+            return SIMD::mul_add (out, frac, y1);
+        }
+        else
+        {
+            return SIMD::mul_add (frac, SIMD::sub (y2, y1), y1);
+        }
+    }
+
+    /*************************************************************************
+     * Bank publication
+     *************************************************************************/
+
+    using Snapshot = typename WaveTableBankPublisher<FloatType>::Snapshot;
+
+    /**
+     * @brief Start the fade to a newly published bank, if there is one.
+     *
+     * @details
+     * One acquire load when nothing changed. A publication during a fade
+     * waits until the fade ends, so at most two snapshots are held.
+     */
+    void pollPublisher() noexcept CASPI_NON_BLOCKING
+    {
+        if (reader == nullptr || fadeRemaining > 0)
+            return;
+
+        const std::uint64_t sequence = reader->sequence();
+        if (sequence == seenSequence)
+            return;
+        seenSequence = sequence;
+
+        const Snapshot* latest = reader->acquire();
+        if (latest == nullptr || latest == activeSnapshot
+            || ! latest->view.matches (TableSize, NumTables, MipLevels))
+        {
+            reader->release();
+            return;
+        }
+
+        pendingSnapshot = latest;
+
+        if (bankView.empty() || bankFadeLength == 0)
+        {
+            bankView = latest->view;
+            finishBankFade();
+            return;
+        }
+
+        fadeFromView  = bankView;
+        bankView      = latest->view;
+        fadeRemaining = bankFadeLength;
+    }
+
+    /** @brief One sample of the bank fade; the gain reaches 1 on the last sample. */
+    FloatType readFading (FloatType pBefore) noexcept CASPI_NON_BLOCKING
+    {
+        const FloatType gain = static_cast<FloatType> (bankFadeLength - fadeRemaining + 1)
+                             / static_cast<FloatType> (bankFadeLength);
+        const FloatType from = readTable (pBefore, fadeFromView);
+        const FloatType to   = readTable (pBefore, bankView);
+
+        if (--fadeRemaining == 0)
+            finishBankFade();
+
+        return from + gain * (to - from);
+    }
+
+    /** @brief Hand the old bank back for reclamation. */
+    void finishBankFade() noexcept CASPI_NON_BLOCKING
+    {
+        reader->commit (pendingSnapshot);
+        activeSnapshot  = pendingSnapshot;
+        pendingSnapshot = nullptr;
+        fadeFromView    = {};
+    }
+
+    /*************************************************************************
+     * Mip level selection
+     *************************************************************************/
+
+    /**
+     * @brief Choose the mip level (and crossfade fraction) for phase.increment.
+     *
+     * @details
+     * Called whenever the increment changes, so steady notes pay for the
+     * log2 once. Compiles to nothing when MipLevels == 1.
+     */
+    void selectMipLevel() noexcept CASPI_NON_BLOCKING
+    {
+        CASPI_CPP17_IF_CONSTEXPR (MipLevels > 1)
+        {
+            constexpr FloatType kTop = static_cast<FloatType> (MipLevels - 1);
+
+            mipIncrement          = phase.increment;
+            const FloatType span  = static_cast<FloatType> (TableSize) * std::abs (phase.increment);
+            const FloatType octaves = (span > FloatType (0)) ? std::log2 (span) : FloatType (-1);
+
+            if (mipCrossfade)
+            {
+                const FloatType pos = std::max (FloatType (0), std::min (octaves + FloatType (1), kTop));
+                mipLevel            = static_cast<std::size_t> (pos);
+                mipBlend            = pos - static_cast<FloatType> (mipLevel);
+            }
+            else
+            {
+                const FloatType pos = std::max (FloatType (0), std::min (std::ceil (octaves), kTop));
+                mipLevel            = static_cast<std::size_t> (pos);
+                mipBlend            = FloatType (0);
+            }
+        }
     }
 
     /*************************************************************************
      * State
      *************************************************************************/
 
-    Bank*             bank         { nullptr };             ///< Non-owning pointer. Must not be null when rendering.
+    WaveTableBankView<FloatType> bankView {};                ///< Non-owning. Must not be empty when rendering.
     Phase<FloatType>  phase         {};                      ///< Phase accumulator and increment.
     FloatType         phaseOffset   { FloatType (0) };       ///< Applied on resetPhase() / forceSync().
     FloatType         phaseModDepth { FloatType (0) };       ///< Added to phase before each table lookup.
     InterpolationMode interpMode    { InterpolationMode::Linear };
+    Graph::ControlRate modulationRate { Graph::ControlRate::PerBlock }; ///< How processImpl() applies control inputs.
     bool              wrapped       { false };               ///< Updated by renderSample(); approximated by renderBlock().
+    bool              mipCrossfade  { false };               ///< Blend adjacent mip levels instead of switching.
+    std::size_t       mipLevel      { 0 };                   ///< Lower mip level read by readTable().
+    FloatType         mipBlend      { FloatType (0) };       ///< Weight of mipLevel + 1 in [0, 1).
+    FloatType         mipIncrement  { FloatType (-1) };      ///< phase.increment the level was selected for.
+
+    WaveTableBankPublisher<FloatType>*                  publisher       { nullptr };
+    typename WaveTableBankPublisher<FloatType>::Reader* reader          { nullptr };  ///< Hazard slots, owned by publisher.
+    const Snapshot*                                     activeSnapshot  { nullptr };  ///< Published bank being played.
+    const Snapshot*                                     pendingSnapshot { nullptr };  ///< Published bank being faded to.
+    std::uint64_t                                       seenSequence    { 0 };        ///< Last publication checked.
+    WaveTableBankView<FloatType>                        fadeFromView    {};           ///< Bank being faded from.
+    int                                                 bankFadeLength  { 256 };
+    int                                                 fadeRemaining   { 0 };
 };
 
 } // namespace Oscillators
@@ -0,0 +1,305 @@
+/************************************************************************
+ .d8888b.                             d8b
+d88P  Y88b                            Y8P
+888    888
+888         8888b.  .d8888b  88888b.  888
+888            "88b 88K      888 "88b 888
+888    888 .d888888 "Y8888b. 888  888 888
+Y88b  d88P 888  888      X88 888 d88P 888
+ "Y8888P"  "Y888888  88888P' 88888P"  888
+                             888
+                             888
+                             888
+
+ * @file   caspi_FractionalDelayLine.h
+ * @author CS Islay
+ * @brief  Allocation-free power-of-two delay line with Lagrange or allpass
+ *         fractional reads, built for waveguide feedback loops.
+ *
+ * @details
+ * FractionalDelayLine<FloatType, Capacity, MaxBlock> stores the last
+ * Capacity samples in a fixed array indexed with a bit mask. Delays are
+ * measured from the next sample to be written, so a feedback loop reads
+ * and then writes:
+ * @code
+ *   y = line.read (d);
+ *   line.write (x + g * y);      // y[n] = x[n] + g y[n - d]
+ * @endcode
+ *
+ * ### Interpolation
+ * - Lagrange: third-order FIR over four neighbouring samples, with the
+ *   fractional offset kept in [1, 2) where the error is lowest. Exact
+ *   for cubic signals; rolls off a little near Nyquist.
+ * - Allpass: first-order Thiran allpass, eta = (1 - D) / (1 + D) for a
+ *   fractional part D in [0.5, 1.5). Flat magnitude, so a loop keeps its
+ *   high partials, but the filter has state: read exactly once per
+ *   written sample, and expect a short transient when the delay jumps.
+ *
+ * ### Block reads
+ * readBlock() returns n consecutive outputs before any of the matching
+ * writes. That is valid while the newest tap stays in the past, which
+ * holds for n <= maxBlockFor(delay) (about one delay length). Inside a
+ * block each output depends only on stored samples, so the Lagrange
+ * read is a plain SIMD loop over time with contiguous loads.
+ *
+ * A guard region mirrors the first MaxBlock + 4 samples after the end of
+ * the array, so a block read never wraps mid-vector.
+ *
+ * ### Thread safety
+ * None. One audio thread owns the line.
+ ************************************************************************/
+
+#ifndef CASPI_FRACTIONALDELAYLINE_H
+#define CASPI_FRACTIONALDELAYLINE_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+#include "base/caspi_Assert.h"
+#include "base/caspi_Features.h"
+#include "base/caspi_SIMD.h"
+
+namespace CASPI
+{
+    namespace Physical
+    {
+
+        /** @brief Fractional read method of a FractionalDelayLine. */
+        enum class DelayInterpolation
+        {
+            Lagrange, ///< Third-order Lagrange FIR.
+            Allpass   ///< First-order Thiran allpass.
+        };
+
+        /*******************************************************************************
+         * FractionalDelayLine
+         ******************************************************************************/
+
+        /**
+         * @brief Single-channel delay line with fractional, block-wise reads.
+         *
+         * @tparam FloatType  float or double.
+         * @tparam Capacity   Stored samples; a power of two.
+         * @tparam MaxBlock   Largest block accepted by readBlock() / writeBlock().
+         */
+        template <CASPI_FLOAT_TYPE FloatType, std::size_t Capacity = 4096, std::size_t MaxBlock = 256>
+        class FractionalDelayLine
+        {
+                static_assert (std::is_floating_point<FloatType>::value,
+                               "FractionalDelayLine requires a floating-point type");
+                static_assert (Capacity >= 16 && (Capacity & (Capacity - 1)) == 0,
+                               "Capacity must be a power of two of at least 16");
+                static_assert (MaxBlock >= 1 && MaxBlock + 4 <= Capacity, "MaxBlock must fit in the line");
+
+                using simd_type = typename SIMD::Strategy::simd_type<FloatType, SIMD::Strategy::min_simd_width<FloatType>::value>::type;
+
+                static constexpr std::size_t kLanes = SIMD::Strategy::min_simd_width<FloatType>::value;
+                static constexpr std::size_t kMask  = Capacity - 1;
+                static constexpr std::size_t kGuard = MaxBlock + 4;
+
+            public:
+                /** @brief Shortest supported delay in samples. */
+                static constexpr FloatType minDelay() noexcept
+                {
+                    return FloatType (2);
+                }
+
+                /** @brief Longest supported delay in samples. */
+                static constexpr FloatType maxDelay() noexcept
+                {
+                    return static_cast<FloatType> (Capacity - 4);
+                }
+
+                FractionalDelayLine() noexcept
+                {
+                    clear();
+                }
+
+                /** @brief Select the read method. Clears the allpass state. */
+                void setInterpolation (DelayInterpolation method) noexcept CASPI_NON_BLOCKING
+                {
+                    interpolation = method;
+                    allpassIn     = FloatType (0);
+                    allpassOut    = FloatType (0);
+                }
+
+                CASPI_NO_DISCARD DelayInterpolation getInterpolation() const noexcept
+                {
+                    return interpolation;
+                }
+
+                /** @brief Zero the stored samples and the allpass state. */
+                void clear() noexcept CASPI_NON_BLOCKING
+                {
+                    std::fill (std::begin (buffer), std::end (buffer), FloatType (0));
+                    writeIndex = 0;
+                    allpassIn  = FloatType (0);
+                    allpassOut = FloatType (0);
+                }
+
+                /**
+                 * @brief Largest readBlock() length for @p delay with the current
+                 *        interpolation; at least 1.
+                 */
+                CASPI_NO_DISCARD std::size_t maxBlockFor (FloatType delay) const noexcept
+                {
+                    const FloatType d    = clampDelay (delay);
+                    const auto      taps = interpolation == DelayInterpolation::Lagrange
+                                               ? static_cast<std::size_t> (d) - 1
+                                               : static_cast<std::size_t> (d - FloatType (0.5));
+                    return std::min (MaxBlock, taps);
+                }
+
+                /*************************************************************************
+                 * Per sample
+                 *************************************************************************/
+
+                /** @brief Append one sample. */
+                void write (FloatType x) noexcept CASPI_NON_BLOCKING
+                {
+                    const std::size_t i = writeIndex & kMask;
+                    buffer[i]           = x;
+                    if (i < kGuard)
+                        buffer[i + Capacity] = x;
+                    ++writeIndex;
+                }
+
+                /**
+                 * @brief The signal @p delay samples before the next write.
+                 *
+                 * @param delay  In [minDelay(), maxDelay()]; clamped.
+                 */
+                CASPI_NO_DISCARD FloatType read (FloatType delay) noexcept CASPI_NON_BLOCKING
+                {
+                    FloatType out;
+                    readBlock (delay, &out, 1);
+                    return out;
+                }
+
+                /*************************************************************************
+                 * Blocks
+                 *************************************************************************/
+
+                /**
+                 * @brief Append @p n samples.
+                 *
+                 * @param input  Samples to store.
+                 * @param n      At most MaxBlock.
+                 */
+                void writeBlock (const FloatType* input, std::size_t n) noexcept CASPI_NON_BLOCKING
+                {
+                    CASPI_ASSERT (n <= MaxBlock, "Block longer than MaxBlock");
+
+                    const std::size_t pos   = writeIndex & kMask;
+                    const std::size_t first = std::min (n, Capacity - pos);
+
+                    std::copy (input, input + first, buffer + pos);
+                    std::copy (input + first, input + n, buffer);
+                    mirror (pos, pos + first);
+                    mirror (0, n - first);
+
+                    writeIndex += n;
+                }
+
+                /**
+                 * @brief Read @p n consecutive outputs at a fixed @p delay, ahead of
+                 *        their writes.
+                 *
+                 * Output t is the signal at (next write + t - delay).
+                 *
+                 * @param delay   In [minDelay(), maxDelay()]; clamped.
+                 * @param output  At least @p n elements.
+                 * @param n       At most maxBlockFor (delay).
+                 */
+                void readBlock (FloatType delay, FloatType* output, std::size_t n) noexcept CASPI_NON_BLOCKING
+                {
+                    CASPI_ASSERT (n <= maxBlockFor (delay), "Block reads past the write head");
+
+                    const FloatType d = clampDelay (delay);
+                    if (interpolation == DelayInterpolation::Lagrange)
+                        readLagrange (d, output, n);
+                    else
+                        readAllpass (d, output, n);
+                }
+
+            private:
+                static FloatType clampDelay (FloatType delay) noexcept
+                {
+                    return std::max (minDelay(), std::min (delay, maxDelay()));
+                }
+
+                /** @brief Copy the part of [lo, hi) inside the guard span past the end. */
+                void mirror (std::size_t lo, std::size_t hi) noexcept
+                {
+                    hi = std::min (hi, kGuard);
+                    if (lo < hi)
+                        std::copy (buffer + lo, buffer + hi, buffer + Capacity + lo);
+                }
+
+                void readLagrange (FloatType d, FloatType* output, std::size_t n) const noexcept
+                {
+                    // Newest tap N samples back, fractional offset mu in [1, 2)
+                    const auto      whole = static_cast<std::size_t> (d) - 1;
+                    const FloatType mu    = d - static_cast<FloatType> (whole);
+
+                    const FloatType h0 = -(mu - 1) * (mu - 2) * (mu - 3) / FloatType (6);
+                    const FloatType h1 = mu * (mu - 2) * (mu - 3) / FloatType (2);
+                    const FloatType h2 = -mu * (mu - 1) * (mu - 3) / FloatType (2);
+                    const FloatType h3 = mu * (mu - 1) * (mu - 2) / FloatType (6);
+
+                    // p[t] is the oldest tap of output t; the guard keeps p[n + 2] in range
+                    const FloatType* p = buffer + ((writeIndex - whole - 3) & kMask);
+
+                    const simd_type c0 = SIMD::set1<FloatType> (h0);
+                    const simd_type c1 = SIMD::set1<FloatType> (h1);
+                    const simd_type c2 = SIMD::set1<FloatType> (h2);
+                    const simd_type c3 = SIMD::set1<FloatType> (h3);
+
+                    std::size_t t = 0;
+                    for (; t + kLanes <= n; t += kLanes)
+                    {
+                        simd_type y = SIMD::mul (c3, SIMD::load_unaligned<FloatType> (p + t));
+                        y           = SIMD::mul_add (c2, SIMD::load_unaligned<FloatType> (p + t + 1), y);
+                        y           = SIMD::mul_add (c1, SIMD::load_unaligned<FloatType> (p + t + 2), y);
+                        y           = SIMD::mul_add (c0, SIMD::load_unaligned<FloatType> (p + t + 3), y);
+                        SIMD::store_unaligned (output + t, y);
+                    }
+                    for (; t < n; ++t)
+                        output[t] = h0 * p[t + 3] + (h1 * p[t + 2] + (h2 * p[t + 1] + h3 * p[t]));
+                }
+
+                void readAllpass (FloatType d, FloatType* output, std::size_t n) noexcept
+                {
+                    // Integer part M, allpass delay D in [0.5, 1.5)
+                    const auto      whole = static_cast<std::size_t> (d - FloatType (0.5));
+                    const FloatType frac  = d - static_cast<FloatType> (whole);
+                    const FloatType eta   = (FloatType (1) - frac) / (FloatType (1) + frac);
+
+                    const FloatType* p = buffer + ((writeIndex - whole) & kMask);
+
+                    FloatType in  = allpassIn;
+                    FloatType out = allpassOut;
+                    for (std::size_t t = 0; t < n; ++t)
+                    {
+                        const FloatType x = p[t];
+                        out               = eta * (x - out) + in;
+                        in                = x;
+                        output[t]         = out;
+                    }
+                    allpassIn  = in;
+                    allpassOut = out;
+                }
+
+                alignas (16) FloatType buffer[Capacity + kGuard];
+                std::size_t        writeIndex { 0 };
+                FloatType          allpassIn { 0 };
+                FloatType          allpassOut { 0 };
+                DelayInterpolation interpolation { DelayInterpolation::Lagrange };
+        };
+
+    } // namespace Physical
+} // namespace CASPI
+
+#endif // CASPI_FRACTIONALDELAYLINE_H
@@ -0,0 +1,497 @@
+/************************************************************************
+ .d8888b.                             d8b
+d88P  Y88b                            Y8P
+888    888
+888         8888b.  .d8888b  88888b.  888
+888            "88b 88K      888 "88b 888
+888    888 .d888888 "Y8888b. 888  888 888
+Y88b  d88P 888  888      X88 888 d88P 888
+ "Y8888P"  "Y888888  88888P' 88888P"  888
+                             888
+                             888
+                             888
+
+ * @file   caspi_ModalResonatorBank.h
+ * @author CS Islay
+ * @brief  Bank of two-pole resonators for modal percussion synthesis,
+ *         one mode per SIMD lane.
+ *
+ * @details
+ * ModalResonatorBank<FloatType, MaxModes> models a struck object as a sum
+ * of exponentially decaying sinusoids, one per vibration mode. Each mode
+ * is a two-pole resonator driven by the same excitation: an impulse from
+ * strike(), the Processor input (noise, a mallet sample, another voice),
+ * or both.
+ *
+ * ### Mode response
+ * For a mode of frequency f, decay time T60 and gain g, at sample rate fs:
+ * @code
+ *   theta = 2 pi f / fs
+ *   r     = 10^(-3 / (T60 fs))                 // -60 dB after T60 seconds
+ *   y[n]  = 2 r cos(theta) y[n-1] - r^2 y[n-2] + g sin(theta) x[n]
+ * @endcode
+ * A unit impulse makes the mode ring as g r^n sin((n + 1) theta). Modes at
+ * or above Nyquist, or with a non-positive frequency, are silent.
+ *
+ * ### SIMD layout
+ * Coefficients and states live in structure-of-arrays form, kLanes modes
+ * per vector (4 float / 2 double). Rendering is mode-major: four mode
+ * vectors keep their state in registers while stepping through a chunk
+ * of up to 256 samples, and add their outputs into a per-sample vector
+ * accumulator. One horizontal sum per sample then gives the output. The
+ * four independent recurrences hide the latency of the feedback path,
+ * and the only memory traffic in the inner loop is the accumulator.
+ *
+ * ### Coefficient updates
+ * setMode() and setModes() run on the setup thread: they recompute the
+ * coefficient set and publish it through a Filters::AtomicCoefficients
+ * double buffer. The audio thread adopts the newest set at the start of
+ * each processBlock(), so a change lands on a block boundary and never
+ * tears. Resonator states carry over, so retuning a ringing mode glides
+ * rather than clicks.
+ *
+ * ### Thread safety
+ * - setMode(), setModes(), setSampleRate() — one setup thread.
+ * - strike(), processBlock(), reset() — audio thread.
+ *
+ * ### Typical usage
+ * @code
+ *   using Bank = CASPI::Physical::ModalResonatorBank<float>;
+ *   auto tom = std::make_unique<Bank> (48000.f);
+ *
+ *   Bank::Mode modes[4] = { { 110.f, 0.8f, 1.f },  { 176.f, 0.6f, 0.5f },
+ *                           { 235.f, 0.4f, 0.3f }, { 268.f, 0.3f, 0.2f } };
+ *   tom->setModes (modes, 4);
+ *
+ *   tom->strike (0.9f);
+ *   tom->processBlock (nullptr, out, 512);   // no input: just the strike
+ * @endcode
+ ************************************************************************/
+
+#ifndef CASPI_MODALRESONATORBANK_H
+#define CASPI_MODALRESONATORBANK_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "base/caspi_Assert.h"
+#include "base/caspi_Constants.h"
+#include "base/caspi_Denormals.h"
+#include "base/caspi_SIMD.h"
+#include "core/caspi_Processor.h"
+#include "filters/caspi_Filter.h"
+
+namespace CASPI
+{
+    namespace Physical
+    {
+
+        /*******************************************************************************
+         * ModalResonatorBank
+         ******************************************************************************/
+
+        /**
+         * @brief Up to MaxModes parallel two-pole resonators summed to mono.
+         *
+         * @details
+         * As a graph node the bank reads its excitation from input port 0
+         * (silence if unconnected, so strike() alone still works), renders
+         * into output channel 0 and copies it to any further channels. Only
+         * channel 0 of the input excites the bank.
+         *
+         * @tparam FloatType  float or double.
+         * @tparam MaxModes   Mode capacity.
+         */
+        template <CASPI_FLOAT_TYPE FloatType, std::size_t MaxModes = 256>
+        class ModalResonatorBank final
+            : public Core::Processor<ModalResonatorBank<FloatType, MaxModes>, FloatType, Core::Traversal::PerChannel>
+        {
+                static_assert (std::is_floating_point<FloatType>::value,
+                               "ModalResonatorBank requires a floating-point type");
+                static_assert (MaxModes >= 1, "MaxModes must be positive");
+
+                using simd_type = typename SIMD::Strategy::simd_type<FloatType, SIMD::Strategy::min_simd_width<FloatType>::value>::type;
+
+                static constexpr std::size_t kLanes   = SIMD::Strategy::min_simd_width<FloatType>::value;
+                static constexpr std::size_t kVectors = (MaxModes + kLanes - 1) / kLanes;
+                static constexpr std::size_t kPadded  = kVectors * kLanes;
+                static constexpr std::size_t kChunk   = 256;
+
+                /// Published set: a1[kPadded] | a2[kPadded] | b[kPadded] | mode count.
+                static constexpr std::size_t kNumCoeffs = 3 * kPadded + 1;
+
+            public:
+                /** @brief One vibration mode. */
+                struct Mode
+                {
+                    FloatType frequency; ///< Hz.
+                    FloatType decay;     ///< T60 in seconds. Must be > 0.
+                    FloatType gain;      ///< Peak amplitude for a unit impulse.
+                };
+
+                /*************************************************************************
+                 * Construction
+                 *************************************************************************/
+
+                /**
+                 * @brief Default constructor. No modes; call setSampleRate() first.
+                 */
+                ModalResonatorBank()
+                    : Core::Processor<ModalResonatorBank, FloatType, Core::Traversal::PerChannel> (1, 1)
+                {
+                    reset();
+                }
+
+                /**
+                 * @brief Construct with the sample rate.
+                 *
+                 * @param sr  Sample rate in Hz. Must be > 0.
+                 */
+                explicit ModalResonatorBank (FloatType sr)
+                    : ModalResonatorBank()
+                {
+                    this->setSampleRate (sr);
+                }
+
+                /**
+                 * @brief Graph dispatch: excite from input port 0, write channel 0,
+                 *        copy to the other output channels.
+                 */
+                void processImpl (Graph::AudioContext<FloatType>& ctx) noexcept
+                {
+                    const auto* inBuf = ctx.getAudioInput (this->getId(), 0);
+                    auto&       out   = this->outputBuffer;
+
+                    const std::size_t channels = out.numChannels();
+                    const std::size_t frames   = out.numFrames();
+                    if (channels == 0 || frames == 0)
+                        return;
+
+                    const FloatType* excitation = nullptr;
+                    if (inBuf != nullptr && inBuf->numChannels() > 0 && inBuf->numFrames() >= frames)
+                        excitation = inBuf->channelData (0);
+
+                    processBlock (excitation, out.channelData (0), static_cast<int> (frames));
+
+                    for (std::size_t ch = 1; ch < channels; ++ch)
+                    {
+                        const FloatType* src = out.channelData (0);
+                        FloatType*       dst = out.channelData (ch);
+                        for (std::size_t i = 0; i < frames; ++i)
+                            dst[i] = src[i];
+                    }
+                }
+
+                /**
+                 * @brief Recompute every mode for the new rate and publish them.
+                 */
+                void setSampleRate (FloatType newRate) override
+                {
+                    Graph::NodeBase<FloatType>::setSampleRate (newRate);
+                    publish();
+                }
+
+                /*************************************************************************
+                 * Modes (setup thread)
+                 *************************************************************************/
+
+                /**
+                 * @brief Replace all modes. Modes past @p count are removed.
+                 *
+                 * @param modes  Mode array; may be nullptr when @p count is 0.
+                 * @param count  Number of modes, clamped to MaxModes.
+                 */
+                void setModes (const Mode* modes, std::size_t count) noexcept
+                {
+                    numModes = std::min (count, MaxModes);
+                    for (std::size_t k = 0; k < numModes; ++k)
+                        specs[k] = modes[k];
+                    publish();
+                }
+
+                /**
+                 * @brief Set one mode, growing the mode count to include it.
+                 *
+                 * @param index      Mode index < MaxModes.
+                 * @param frequency  Hz.
+                 * @param decay      T60 in seconds. Must be > 0.
+                 * @param gain       Peak amplitude for a unit impulse.
+                 */
+                void setMode (std::size_t index, FloatType frequency, FloatType decay, FloatType gain) noexcept
+                {
+                    CASPI_ASSERT (index < MaxModes, "Mode index out of range");
+                    if (index >= MaxModes)
+                        return;
+
+                    for (std::size_t k = numModes; k < index; ++k)
+                        specs[k] = Mode { FloatType (0), FloatType (1), FloatType (0) };
+
+                    specs[index] = Mode { frequency, decay, gain };
+                    numModes     = std::max (numModes, index + 1);
+                    publish();
+                }
+
+                /** @brief Modes set on the setup thread. */
+                CASPI_NO_DISCARD std::size_t getNumModes() const noexcept
+                {
+                    return numModes;
+                }
+
+                /** @brief Mode @p index as last set. */
+                CASPI_NO_DISCARD Mode getMode (std::size_t index) const noexcept
+                {
+                    CASPI_ASSERT (index < MaxModes, "Mode index out of range");
+                    return specs[index];
+                }
+
+                /*************************************************************************
+                 * Excitation and rendering (audio thread)
+                 *************************************************************************/
+
+                /**
+                 * @brief Add an impulse of height @p velocity to the next sample's input.
+                 */
+                void strike (FloatType velocity = FloatType (1)) noexcept CASPI_NON_BLOCKING
+                {
+                    pendingStrike += velocity;
+                }
+
+                /** @brief Silence every mode. */
+                void reset() noexcept CASPI_NON_BLOCKING
+                {
+                    std::fill (std::begin (y1), std::end (y1), FloatType (0));
+                    std::fill (std::begin (y2), std::end (y2), FloatType (0));
+                    pendingStrike = FloatType (0);
+                }
+
+                /**
+                 * @brief Process one sample; prefer processBlock().
+                 */
+                CASPI_NO_DISCARD FloatType processSample (FloatType in) noexcept CASPI_NON_BLOCKING override
+                {
+                    FloatType out = FloatType (0);
+                    processBlock (&in, &out, 1);
+                    return out;
+                }
+
+                /**
+                 * @brief Excite the bank with @p input and write the summed modes.
+                 *
+                 * @param input       Excitation, or nullptr for silence (strikes only).
+                 *                    May alias @p output.
+                 * @param output      At least @p numSamples elements.
+                 * @param numSamples  Number of samples. Must be > 0.
+                 */
+                void processBlock (const FloatType* input, FloatType* output, int numSamples) noexcept CASPI_NON_BLOCKING
+                {
+                    CASPI_ASSERT (output != nullptr, "Output buffer must not be null");
+                    CASPI_ASSERT (numSamples > 0, "numSamples must be positive");
+
+                    Core::ScopedFlushDenormals flush {};
+
+                    adoptCoefficients();
+
+                    const auto n = static_cast<std::size_t> (numSamples);
+                    for (std::size_t done = 0; done < n;)
+                    {
+                        const std::size_t count = std::min (kChunk, n - done);
+                        renderChunk (input != nullptr ? input + done : nullptr, output + done, count);
+                        done += count;
+                    }
+                }
+
+            private:
+                /*************************************************************************
+                 * Coefficients
+                 *************************************************************************/
+
+                /**
+                 * @brief Setup thread: compute every mode's coefficients and swap
+                 *        them in.
+                 */
+                void publish() noexcept
+                {
+                    typename Filters::AtomicCoefficients<FloatType, kNumCoeffs>::CoeffArray set {};
+
+                    const double fs = static_cast<double> (this->getSampleRate());
+                    for (std::size_t k = 0; k < numModes; ++k)
+                    {
+                        const Mode&  mode  = specs[k];
+                        const double theta = 2.0 * Constants::PI<double> * static_cast<double> (mode.frequency) / fs;
+
+                        if (! (theta > 0.0 && theta < Constants::PI<double>) || ! (mode.decay > FloatType (0)))
+                            continue;
+
+                        const double r = std::pow (10.0, -3.0 / (static_cast<double> (mode.decay) * fs));
+
+                        set[k]               = static_cast<FloatType> (2.0 * r * std::cos (theta));
+                        set[kPadded + k]     = static_cast<FloatType> (-r * r);
+                        set[2 * kPadded + k] = static_cast<FloatType> (static_cast<double> (mode.gain) * std::sin (theta));
+                    }
+                    set[3 * kPadded] = static_cast<FloatType> (numModes);
+
+                    published.swap (set);
+                    version.fetch_add (1, std::memory_order_release);
+                }
+
+                /** @brief Audio thread: copy the newest published set into the SoA arrays. */
+                void adoptCoefficients() noexcept CASPI_NON_BLOCKING
+                {
+                    const std::uint32_t latest = version.load (std::memory_order_acquire);
+                    if (latest == seenVersion)
+                        return;
+                    seenVersion = latest;
+
+                    const auto& set = published.get();
+                    std::copy (set.begin(), set.begin() + kPadded, std::begin (a1));
+                    std::copy (set.begin() + kPadded, set.begin() + 2 * kPadded, std::begin (a2));
+                    std::copy (set.begin() + 2 * kPadded, set.begin() + 3 * kPadded, std::begin (b));
+
+                    const auto modes = static_cast<std::size_t> (set[3 * kPadded]);
+                    activeVectors    = (modes + kLanes - 1) / kLanes;
+                }
+
+                /*************************************************************************
+                 * Rendering
+                 *************************************************************************/
+
+                void renderChunk (const FloatType* input, FloatType* output, std::size_t count) noexcept CASPI_NON_BLOCKING
+                {
+                    // Copy the excitation first: output may alias input
+                    for (std::size_t t = 0; t < count; ++t)
+                        excitation[t] = input != nullptr ? input[t] : FloatType (0);
+                    excitation[0] += pendingStrike;
+                    pendingStrike  = FloatType (0);
+
+                    const simd_type zero = SIMD::set1<FloatType> (FloatType (0));
+                    for (std::size_t t = 0; t < count; ++t)
+                        SIMD::store_aligned (accumulator + t * kLanes, zero);
+
+                    std::size_t v = 0;
+                    for (; v + 4 <= activeVectors; v += 4)
+                        renderFour (v, count);
+                    for (; v < activeVectors; ++v)
+                        renderOne (v, count);
+
+                    for (std::size_t t = 0; t < count; ++t)
+                        output[t] = SIMD::hsum (SIMD::load_aligned<FloatType> (accumulator + t * kLanes));
+                }
+
+                /** @brief Four mode vectors, states in registers, across the chunk. */
+                void renderFour (std::size_t v, std::size_t count) noexcept CASPI_NON_BLOCKING
+                {
+                    const std::size_t o = v * kLanes;
+
+                    const simd_type a1_0 = SIMD::load_aligned<FloatType> (a1 + o);
+                    const simd_type a1_1 = SIMD::load_aligned<FloatType> (a1 + o + kLanes);
+                    const simd_type a1_2 = SIMD::load_aligned<FloatType> (a1 + o + 2 * kLanes);
+                    const simd_type a1_3 = SIMD::load_aligned<FloatType> (a1 + o + 3 * kLanes);
+                    const simd_type a2_0 = SIMD::load_aligned<FloatType> (a2 + o);
+                    const simd_type a2_1 = SIMD::load_aligned<FloatType> (a2 + o + kLanes);
+                    const simd_type a2_2 = SIMD::load_aligned<FloatType> (a2 + o + 2 * kLanes);
+                    const simd_type a2_3 = SIMD::load_aligned<FloatType> (a2 + o + 3 * kLanes);
+                    const simd_type b_0  = SIMD::load_aligned<FloatType> (b + o);
+                    const simd_type b_1  = SIMD::load_aligned<FloatType> (b + o + kLanes);
+                    const simd_type b_2  = SIMD::load_aligned<FloatType> (b + o + 2 * kLanes);
+                    const simd_type b_3  = SIMD::load_aligned<FloatType> (b + o + 3 * kLanes);
+
+                    simd_type p0 = SIMD::load_aligned<FloatType> (y1 + o);
+                    simd_type p1 = SIMD::load_aligned<FloatType> (y1 + o + kLanes);
+                    simd_type p2 = SIMD::load_aligned<FloatType> (y1 + o + 2 * kLanes);
+                    simd_type p3 = SIMD::load_aligned<FloatType> (y1 + o + 3 * kLanes);
+                    simd_type q0 = SIMD::load_aligned<FloatType> (y2 + o);
+                    simd_type q1 = SIMD::load_aligned<FloatType> (y2 + o + kLanes);
+                    simd_type q2 = SIMD::load_aligned<FloatType> (y2 + o + 2 * kLanes);
+                    simd_type q3 = SIMD::load_aligned<FloatType> (y2 + o + 3 * kLanes);
+
+                    for (std::size_t t = 0; t < count; ++t)
+                    {
+                        const simd_type x = SIMD::set1<FloatType> (excitation[t]);
+
+                        const simd_type n0 = SIMD::mul_add (a1_0, p0, SIMD::mul_add (a2_0, q0, SIMD::mul (b_0, x)));
+                        const simd_type n1 = SIMD::mul_add (a1_1, p1, SIMD::mul_add (a2_1, q1, SIMD::mul (b_1, x)));
+                        const simd_type n2 = SIMD::mul_add (a1_2, p2, SIMD::mul_add (a2_2, q2, SIMD::mul (b_2, x)));
+                        const simd_type n3 = SIMD::mul_add (a1_3, p3, SIMD::mul_add (a2_3, q3, SIMD::mul (b_3, x)));
+
+                        q0 = p0;
+                        q1 = p1;
+                        q2 = p2;
+                        q3 = p3;
+                        p0 = n0;
+                        p1 = n1;
+                        p2 = n2;
+                        p3 = n3;
+
+                        FloatType*      acc = accumulator + t * kLanes;
+                        const simd_type sum = SIMD::add (SIMD::add (n0, n1), SIMD::add (n2, n3));
+                        SIMD::store_aligned (acc, SIMD::add (SIMD::load_aligned<FloatType> (acc), sum));
+                    }
+
+                    SIMD::store_aligned (y1 + o, p0);
+                    SIMD::store_aligned (y1 + o + kLanes, p1);
+                    SIMD::store_aligned (y1 + o + 2 * kLanes, p2);
+                    SIMD::store_aligned (y1 + o + 3 * kLanes, p3);
+                    SIMD::store_aligned (y2 + o, q0);
+                    SIMD::store_aligned (y2 + o + kLanes, q1);
+                    SIMD::store_aligned (y2 + o + 2 * kLanes, q2);
+                    SIMD::store_aligned (y2 + o + 3 * kLanes, q3);
+                }
+
+                /** @brief A single mode vector across the chunk, for the remainder. */
+                void renderOne (std::size_t v, std::size_t count) noexcept CASPI_NON_BLOCKING
+                {
+                    const std::size_t o = v * kLanes;
+
+                    const simd_type c1 = SIMD::load_aligned<FloatType> (a1 + o);
+                    const simd_type c2 = SIMD::load_aligned<FloatType> (a2 + o);
+                    const simd_type g  = SIMD::load_aligned<FloatType> (b + o);
+                    simd_type       p  = SIMD::load_aligned<FloatType> (y1 + o);
+                    simd_type       q  = SIMD::load_aligned<FloatType> (y2 + o);
+
+                    for (std::size_t t = 0; t < count; ++t)
+                    {
+                        const simd_type next = SIMD::mul_add (c1, p, SIMD::mul_add (c2, q, SIMD::mul (g, SIMD::set1<FloatType> (excitation[t]))));
+                        q                    = p;
+                        p                    = next;
+
+                        FloatType* acc = accumulator + t * kLanes;
+                        SIMD::store_aligned (acc, SIMD::add (SIMD::load_aligned<FloatType> (acc), next));
+                    }
+
+                    SIMD::store_aligned (y1 + o, p);
+                    SIMD::store_aligned (y2 + o, q);
+                }
+
+                /*************************************************************************
+                 * State
+                 *************************************************************************/
+
+                // Setup thread
+                std::array<Mode, MaxModes>                         specs {};
+                std::size_t                                        numModes { 0 };
+                Filters::AtomicCoefficients<FloatType, kNumCoeffs> published;
+                std::atomic<std::uint32_t>                         version { 0 };
+
+                // Audio thread
+                std::uint32_t seenVersion { 0 };
+                std::size_t   activeVectors { 0 };
+                FloatType     pendingStrike { 0 };
+
+                alignas (16) FloatType a1[kPadded] {};
+                alignas (16) FloatType a2[kPadded] {};
+                alignas (16) FloatType b[kPadded] {};
+                alignas (16) FloatType y1[kPadded] {};
+                alignas (16) FloatType y2[kPadded] {};
+                alignas (16) FloatType accumulator[kChunk * kLanes] {};
+                FloatType excitation[kChunk] {};
+        };
+
+    } // namespace Physical
+} // namespace CASPI
+
+#endif // CASPI_MODALRESONATORBANK_H
@@ -0,0 +1,641 @@
+/************************************************************************
+ .d8888b.                             d8b
+d88P  Y88b                            Y8P
+888    888
+888         8888b.  .d8888b  88888b.  888
+888            "88b 88K      888 "88b 888
+888    888 .d888888 "Y8888b. 888  888 888
+Y88b  d88P 888  888      X88 888 d88P 888
+ "Y8888P"  "Y888888  88888P' 88888P"  888
+                             888
+                             888
+                             888
+
+ * @file   caspi_Waveguide.h
+ * @author CS Islay
+ * @brief  Polyphonic digital waveguide voices: Karplus-Strong plucked
+ *         strings and closed-open tubes.
+ *
+ * @details
+ * Each voice is a single-delay-line waveguide loop:
+ * @code
+ *   y[n] = g * (b y[n-d] + (1 - 2b) y[n-d-1] + b y[n-d-2]) + e[n]
+ * @endcode
+ * The delay line (FractionalDelayLine) holds the travelling wave, the
+ * three-tap LoopFilter models frequency-dependent losses, g sets the
+ * decay time, and e is the excitation. The loop filter is symmetric, so
+ * its delay is exactly one sample at every frequency and the loop period
+ * is d + 1 whatever the brightness: tuning is just d = P - 1.
+ *
+ * ### Models
+ * - PluckedString: period P = fs / f. noteOn() injects one period of
+ *   low-passed noise; softer velocities give a darker pluck.
+ * - Tube: a bore closed at one end and open at the other. The open end
+ *   reflects with inverted sign, so g < 0, the loop is P = fs / (2 f)
+ *   and only odd harmonics ring. A breath-noise excitation runs while
+ *   the note is held.
+ *
+ * ### Block processing
+ * A voice renders in sub-blocks no longer than its delay line allows
+ * (FractionalDelayLine::maxBlockFor(), about one period). Within a
+ * sub-block the loop reads only samples written in earlier sub-blocks, so
+ * the fractional read, the loop filter and the mix are straight SIMD
+ * loops over time. Writing the sub-block back closes the loop.
+ *
+ * ### Parameters and thread safety
+ * - setBrightness() runs on the setup thread: it sets the loop filter
+ *   cutoff, and the coefficients reach the audio thread through the
+ *   filter's AtomicCoefficients double buffer.
+ * - noteOn(), noteOff(), renderBlock(), reset() and the other setters —
+ *   audio thread.
+ *
+ * ### Typical usage
+ * @code
+ *   auto strings = std::make_unique<CASPI::Physical::WaveguideBank<float>> (48000.f);
+ *   strings->setDecay (3.f);
+ *   strings->setBrightness (6000.f);
+ *
+ *   const int v = strings->noteOn (220.f, 0.8f);
+ *   strings->renderBlock (out, 512);
+ *   strings->noteOff (v);
+ * @endcode
+ ************************************************************************/
+
+#ifndef CASPI_WAVEGUIDE_H
+#define CASPI_WAVEGUIDE_H
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "base/caspi_Assert.h"
+#include "base/caspi_Constants.h"
+#include "base/caspi_Denormals.h"
+#include "base/caspi_SIMD.h"
+#include "core/caspi_Parameter.h"
+#include "core/caspi_Producer.h"
+#include "filters/caspi_Filter.h"
+#include "oscillators/caspi_Noise.h"
+#include "physical/caspi_FractionalDelayLine.h"
+
+namespace CASPI
+{
+    namespace Physical
+    {
+
+        /*******************************************************************************
+         * LoopFilter
+         ******************************************************************************/
+
+        /**
+         * @brief Linear-phase three-tap low-pass for waveguide loops.
+         *
+         * @details
+         * H(z) = b + (1 - 2b) z^-1 + b z^-2, so |H| = 1 - 4b sin^2(w / 2): unity
+         * at DC, a delay of exactly one sample at every frequency. setCutoff()
+         * picks b so one pass loses 1 dB at the cutoff; a string loses that
+         * on every period, so this is already a strong damping. Three taps
+         * reach from b = 0.027 (1 dB at Nyquist) to the Karplus-Strong
+         * average b = 0.25 (1 dB at 0.108 fs, 5.2 kHz at 48 kHz); cutoffs
+         * outside that range are clamped. Q, gain and mode are ignored.
+         *
+         * Coefficients are published as { b, 1 - 2b }.
+         *
+         * @tparam FloatType  float or double.
+         */
+        template <CASPI_FLOAT_TYPE FloatType>
+        class LoopFilter : public Filters::FilterBase<LoopFilter<FloatType>, FloatType, /*NumStates=*/2u, /*NumCoeffs=*/2u>
+        {
+            public:
+                using Base = Filters::FilterBase<LoopFilter<FloatType>, FloatType, 2u, 2u>;
+
+                LoopFilter()
+                {
+                    Graph::NodeBase<FloatType>::setSampleRate (Constants::DEFAULT_SAMPLE_RATE<FloatType>);
+                    this->cutoff = Constants::DEFAULT_SAMPLE_RATE<FloatType> / FloatType (2);
+                    updateCoefficients();
+                }
+
+                /**
+                 * @param sampleRateHz  Sample rate in Hz. Must be > 0.
+                 * @param cutoffHz      -1 dB per pass frequency in Hz. Must be > 0.
+                 */
+                LoopFilter (FloatType sampleRateHz, FloatType cutoffHz)
+                {
+                    CASPI_ASSERT (sampleRateHz > FloatType (0), "Sample rate must be positive");
+                    CASPI_ASSERT (cutoffHz > FloatType (0), "Cutoff must be positive");
+
+                    Graph::NodeBase<FloatType>::setSampleRate (sampleRateHz);
+                    this->cutoff = cutoffHz;
+                    updateCoefficients();
+                }
+
+                /** @brief Set sample rate and recompute coefficients. */
+                void setSampleRate (FloatType fs) noexcept
+                {
+                    CASPI_ASSERT (fs > FloatType (0), "Sample rate must be positive");
+                    Graph::NodeBase<FloatType>::setSampleRate (fs);
+                    updateCoefficients();
+                }
+
+                /** @brief CRTP hook — recompute and publish { b, 1 - 2b }. */
+                void updateCoefficients() noexcept
+                {
+                    const FloatType fs = this->getSampleRate();
+                    if (fs <= FloatType (0) || this->cutoff <= FloatType (0))
+                        return;
+
+                    const FloatType w    = Constants::PI<FloatType> * std::min (this->cutoff / fs, FloatType (0.5));
+                    const FloatType s    = std::sin (w);
+                    const FloatType loss = FloatType (1) - FloatType (0.8912509381337456); // 1 dB
+                    const FloatType b    = std::max (loss / FloatType (4), std::min (loss / (FloatType (4) * s * s), FloatType (0.25)));
+
+                    typename Base::AtomicCoefficientsType::CoeffArray arr;
+                    arr[0] = b;
+                    arr[1] = FloatType (1) - FloatType (2) * b;
+                    this->coeffs.swap (arr);
+                }
+
+                /** @brief Consistent { b, 1 - 2b } pair for block-wise users. Audio thread safe. */
+                CASPI_NO_DISCARD const typename Base::AtomicCoefficientsType::CoeffArray& getCoefficients() const noexcept CASPI_NON_BLOCKING
+                {
+                    return this->coeffs.get();
+                }
+
+                /** @brief Filter one sample. */
+                CASPI_NO_DISCARD FloatType processSample (FloatType x) noexcept CASPI_NON_BLOCKING override
+                {
+                    const auto& c = this->coeffs.get();
+
+                    const FloatType y = c[0] * (x + this->states[1]) + c[1] * this->states[0];
+                    this->states[1]   = this->states[0];
+                    this->states[0]   = x;
+                    return y;
+                }
+
+                /** @brief |H(f)|; the phase is always one sample of delay. */
+                CASPI_NO_DISCARD FloatType getFrequencyResponse (FloatType freq) const noexcept
+                {
+                    const auto&     c = this->coeffs.get();
+                    const FloatType w = FloatType (2) * Constants::PI<FloatType> * freq / this->getSampleRate();
+                    return std::abs (c[1] + FloatType (2) * c[0] * std::cos (w));
+                }
+        };
+
+        /*******************************************************************************
+         * WaveguideBank
+         ******************************************************************************/
+
+        /** @brief Instrument model for notes started by WaveguideBank::noteOn(). */
+        enum class WaveguideModel
+        {
+            PluckedString, ///< Karplus-Strong string, noise pluck.
+            Tube           ///< Closed-open bore, breath noise, odd harmonics.
+        };
+
+        /**
+         * @brief Up to MaxVoices waveguide voices summed to mono.
+         *
+         * @details
+         * Voices start with noteOn() and end when they decay below -100 dB
+         * with no excitation left. A full bank steals its oldest voice.
+         * After noteOff() a voice decays with the shorter of the decay and
+         * release times. As a graph node the bank writes a mono buffer that
+         * consumers broadcast.
+         *
+         * @tparam FloatType  float or double.
+         * @tparam MaxVoices  Voice capacity.
+         * @tparam Capacity   Delay line length per voice, a power of two. The
+         *                    lowest note is about fs / Capacity Hz for strings
+         *                    and half that for tubes.
+         */
+        template <CASPI_FLOAT_TYPE FloatType, std::size_t MaxVoices = 64, std::size_t Capacity = 4096>
+        class WaveguideBank final
+            : public Core::Producer<WaveguideBank<FloatType, MaxVoices, Capacity>, FloatType, Core::Traversal::PerFrame>
+        {
+                static_assert (std::is_floating_point<FloatType>::value,
+                               "WaveguideBank requires a floating-point type");
+                static_assert (MaxVoices >= 1, "MaxVoices must be positive");
+
+                using simd_type = typename SIMD::Strategy::simd_type<FloatType, SIMD::Strategy::min_simd_width<FloatType>::value>::type;
+
+                static constexpr std::size_t kLanes = SIMD::Strategy::min_simd_width<FloatType>::value;
+                static constexpr std::size_t kChunk = 256;
+
+                using Line = FractionalDelayLine<FloatType, Capacity, kChunk>;
+
+            public:
+                /*************************************************************************
+                 * Construction
+                 *************************************************************************/
+
+                /** @brief Default constructor; call setSampleRate() before rendering. */
+                WaveguideBank() CASPI_ALLOCATING
+                {
+                    initParameters();
+                    reset();
+                }
+
+                /**
+                 * @brief Construct with the sample rate.
+                 *
+                 * @param sr  Sample rate in Hz. Must be > 0.
+                 */
+                explicit WaveguideBank (FloatType sr) CASPI_ALLOCATING
+                    : WaveguideBank()
+                {
+                    this->setSampleRate (sr);
+                }
+
+                /** @brief AudioNode hook; nothing to cache. */
+                void onPrepare (std::size_t /*numChannels*/, std::size_t /*numFrames*/, double /*sampleRate*/) noexcept {}
+
+                /** @brief Graph dispatch: render into the mono output buffer; consumers broadcast it. */
+                void processImpl (Graph::AudioContext<FloatType>& ctx) noexcept
+                {
+                    (void) ctx;
+
+                    auto&             buffer = this->outputBuffer;
+                    const std::size_t frames = buffer.numFrames();
+                    if (buffer.numChannels() == 0 || frames == 0)
+                        return;
+
+                    renderBlock (buffer.channelData (0), static_cast<int> (frames));
+                }
+
+                /**
+                 * @brief Set the rate for new notes and the loop filter. Sounding
+                 *        voices keep their delay in samples.
+                 */
+                void setSampleRate (FloatType newRate) override
+                {
+                    Graph::NodeBase<FloatType>::setSampleRate (newRate);
+                    loopFilter.setSampleRate (newRate);
+                }
+
+                /*************************************************************************
+                 * Configuration
+                 *************************************************************************/
+
+                /** @brief Model for notes started from now on. */
+                void setModel (WaveguideModel m) noexcept CASPI_NON_BLOCKING
+                {
+                    model = m;
+                }
+
+                CASPI_NO_DISCARD WaveguideModel getModel() const noexcept
+                {
+                    return model;
+                }
+
+                /** @brief Fractional delay method for notes started from now on. */
+                void setInterpolation (DelayInterpolation method) noexcept CASPI_NON_BLOCKING
+                {
+                    interpolation = method;
+                }
+
+                CASPI_NO_DISCARD DelayInterpolation getInterpolation() const noexcept
+                {
+                    return interpolation;
+                }
+
+                /**
+                 * @brief Set the loop filter cutoff: one pass loses 1 dB here. Setup thread.
+                 *
+                 * @param hz  Cutoff in Hz. Must be > 0. Default 24 kHz, the brightest
+                 *            setting at 48 kHz.
+                 */
+                void setBrightness (FloatType hz) noexcept
+                {
+                    loopFilter.setCutoff (hz);
+                }
+
+                CASPI_NO_DISCARD FloatType getBrightness() const noexcept
+                {
+                    return loopFilter.getCutoff();
+                }
+
+                /** @brief Set the held-note T60 in seconds, bypassing smoothing. */
+                void setDecay (FloatType seconds) noexcept CASPI_NON_BLOCKING
+                {
+                    CASPI_ASSERT (seconds > FloatType (0), "Decay must be positive");
+                    const FloatType lo   = std::log (decay.getMinValue());
+                    const FloatType hi   = std::log (decay.getMaxValue());
+                    const FloatType norm = (std::log (seconds) - lo) / (hi - lo);
+                    decay.setBaseNormalised (std::max (FloatType (0), std::min (norm, FloatType (1))));
+                    decay.skip (1000);
+                }
+
+                /**
+                 * @brief T60 after noteOff(), when shorter than the decay.
+                 *
+                 * @param seconds  > 0. Default 0.1.
+                 */
+                void setReleaseTime (FloatType seconds) noexcept CASPI_NON_BLOCKING
+                {
+                    CASPI_ASSERT (seconds > FloatType (0), "Release time must be positive");
+                    releaseSeconds = seconds;
+                }
+
+                /** @brief Seed the excitation noise. Takes effect at reset(). */
+                void setSeed (std::uint64_t newSeed) noexcept CASPI_NON_BLOCKING
+                {
+                    seed = newSeed;
+                }
+
+                /*************************************************************************
+                 * Notes
+                 *************************************************************************/
+
+                /**
+                 * @brief Start a note with the current model.
+                 *
+                 * @param frequency  Fundamental in Hz. Clamped to what the delay
+                 *                   line can hold.
+                 * @param velocity   Excitation level in [0, 1].
+                 * @return           Voice index for noteOff().
+                 */
+                int noteOn (FloatType frequency, FloatType velocity = FloatType (1)) noexcept CASPI_NON_BLOCKING
+                {
+                    CASPI_ASSERT (frequency > FloatType (0), "Frequency must be positive");
+
+                    std::size_t chosen = 0;
+                    for (std::size_t k = 0; k < MaxVoices; ++k)
+                    {
+                        if (! voices[k].active)
+                        {
+                            chosen = k;
+                            break;
+                        }
+                        if (voices[k].started < voices[chosen].started)
+                            chosen = k;
+                    }
+
+                    Voice& v = voices[chosen];
+                    v.line.clear();
+                    v.line.setInterpolation (interpolation);
+
+                    const FloatType fs      = this->getSampleRate();
+                    const FloatType cycles  = model == WaveguideModel::Tube ? FloatType (2) : FloatType (1);
+                    const FloatType period  = std::max (Line::minDelay() + 1, std::min (fs / (cycles * frequency), Line::maxDelay() + 1));
+
+                    v.model      = model;
+                    v.period     = period;
+                    v.delay      = period - FloatType (1);
+                    v.maxBlock   = v.line.maxBlockFor (v.delay);
+                    v.history[0] = FloatType (0);
+                    v.history[1] = FloatType (0);
+                    v.velocity   = std::max (FloatType (0), std::min (velocity, FloatType (1)));
+                    v.tone       = FloatType (0.2) + FloatType (0.8) * v.velocity;
+                    v.toneState  = FloatType (0);
+                    v.burst      = model == WaveguideModel::PluckedString ? static_cast<std::size_t> (std::lround (period)) : 0;
+                    v.breath     = FloatType (0);
+                    v.held       = true;
+                    v.rng.seed (static_cast<std::uint64_t> (rng.next()) << 32 | rng.next());
+                    v.started    = ++noteCounter;
+                    v.active     = true;
+
+                    return static_cast<int> (chosen);
+                }
+
+                /**
+                 * @brief Release a voice: it decays with the release time, and a
+                 *        tube stops breathing.
+                 *
+                 * @param voice  Index returned by noteOn(). Ignored if out of range.
+                 */
+                void noteOff (int voice) noexcept CASPI_NON_BLOCKING
+                {
+                    if (voice < 0 || static_cast<std::size_t> (voice) >= MaxVoices)
+                        return;
+                    voices[static_cast<std::size_t> (voice)].held = false;
+                }
+
+                /** @brief Release every sounding voice. */
+                void allNotesOff() noexcept CASPI_NON_BLOCKING
+                {
+                    for (auto& v : voices)
+                        v.held = false;
+                }
+
+                /** @brief Silence every voice and reseed the noise streams of later notes. */
+                void reset() noexcept CASPI_NON_BLOCKING
+                {
+                    for (auto& v : voices)
+                        v.active = false;
+                    rng.seed (seed);
+                }
+
+                /** @brief Voices currently sounding. */
+                CASPI_NO_DISCARD std::size_t getNumActiveVoices() const noexcept CASPI_NON_BLOCKING
+                {
+                    std::size_t n = 0;
+                    for (const auto& v : voices)
+                        n += v.active ? 1 : 0;
+                    return n;
+                }
+
+                /*************************************************************************
+                 * Rendering
+                 *************************************************************************/
+
+                /** @brief Render one sample; prefer renderBlock(). */
+                FloatType renderSample() noexcept CASPI_NON_BLOCKING override
+                {
+                    FloatType out = FloatType (0);
+                    renderBlock (&out, 1);
+                    return out;
+                }
+
+                /**
+                 * @brief Render the mono mix of every voice.
+                 *
+                 * @param output      At least @p numSamples elements.
+                 * @param numSamples  Number of samples. Must be > 0.
+                 */
+                void renderBlock (FloatType* CASPI_RESTRICT output, int numSamples) noexcept CASPI_NON_BLOCKING
+                {
+                    CASPI_ASSERT (output != nullptr, "Output buffer must not be null");
+                    CASPI_ASSERT (numSamples > 0, "numSamples must be positive");
+
+                    Core::ScopedFlushDenormals flush {};
+
+                    const auto n = static_cast<std::size_t> (numSamples);
+                    std::fill (output, output + n, FloatType (0));
+
+                    const auto& c   = loopFilter.getCoefficients();
+                    const auto  t60 = decay.value();
+                    for (auto& v : voices)
+                    {
+                        if (v.active)
+                            renderVoice (v, output, n, c[0], c[1], t60);
+                    }
+
+                    const FloatType gain = amplitude.value();
+                    for (std::size_t i = 0; i < n; ++i)
+                        output[i] *= gain;
+                }
+
+                /*************************************************************************
+                 * Public modulatable parameters
+                 *************************************************************************/
+
+                Core::ModulatableParameter<FloatType> amplitude; ///< Output gain in [0, 1].
+                Core::ModulatableParameter<FloatType> decay;     ///< Held-note T60 in seconds, log scale [0.01, 60].
+
+            private:
+                /*************************************************************************
+                 * Types
+                 *************************************************************************/
+
+                struct Voice
+                {
+                    Line                                line;
+                    FloatType                           period { 3 };   ///< Loop length in samples.
+                    FloatType                           delay { 2 };    ///< period - 1: the loop filter adds one.
+                    std::size_t                         maxBlock { 1 }; ///< Longest sub-block for this delay.
+                    FloatType                           history[2] {};  ///< Last two delay-line outputs.
+                    WaveguideModel                      model { WaveguideModel::PluckedString };
+                    FloatType                           velocity { 0 };
+                    FloatType                           tone { 1 };     ///< Excitation low-pass coefficient.
+                    FloatType                           toneState { 0 };
+                    std::size_t                         burst { 0 };    ///< Pluck samples left to inject.
+                    FloatType                           breath { 0 };   ///< Tube breath level.
+                    Oscillators::detail::Xoshiro128Plus rng {};         ///< Per voice, so output is independent of block size.
+                    std::uint64_t                       started { 0 };
+                    bool                                held { false };
+                    bool                                active { false };
+                };
+
+                /*************************************************************************
+                 * Voice
+                 *************************************************************************/
+
+                void renderVoice (Voice& v, FloatType* CASPI_RESTRICT output, std::size_t n, FloatType outer, FloatType centre, FloatType heldT60) noexcept
+                {
+                    const FloatType fs   = this->getSampleRate();
+                    const FloatType t60  = v.held ? heldT60 : std::min (heldT60, releaseSeconds);
+                    const FloatType sign = v.model == WaveguideModel::Tube ? FloatType (-1) : FloatType (1);
+                    const FloatType g    = sign * std::pow (FloatType (10), FloatType (-3) * v.period / (t60 * fs));
+
+                    const simd_type go = SIMD::set1<FloatType> (g * outer);
+                    const simd_type gc = SIMD::set1<FloatType> (g * centre);
+
+                    simd_type peak = SIMD::set1<FloatType> (FloatType (0));
+                    FloatType tail = FloatType (0);
+
+                    for (std::size_t done = 0; done < n;)
+                    {
+                        const std::size_t count = std::min (n - done, v.maxBlock);
+
+                        // taps[t + 2] is the line output for sample t; taps[0..1] are history
+                        taps[0] = v.history[0];
+                        taps[1] = v.history[1];
+                        v.line.readBlock (v.delay, taps + 2, count);
+                        v.history[0] = taps[count];
+                        v.history[1] = taps[count + 1];
+
+                        std::size_t t = 0;
+                        for (; t + kLanes <= count; t += kLanes)
+                        {
+                            const simd_type ends = SIMD::add (SIMD::load_unaligned<FloatType> (taps + t), SIMD::load_unaligned<FloatType> (taps + t + 2));
+                            SIMD::store_aligned (loop + t, SIMD::mul_add (gc, SIMD::load_unaligned<FloatType> (taps + t + 1), SIMD::mul (go, ends)));
+                        }
+                        for (; t < count; ++t)
+                            loop[t] = g * centre * taps[t + 1] + g * outer * (taps[t] + taps[t + 2]);
+
+                        excite (v, count);
+                        v.line.writeBlock (loop, count);
+
+                        FloatType* out = output + done;
+                        t              = 0;
+                        for (; t + kLanes <= count; t += kLanes)
+                        {
+                            const simd_type y = SIMD::load_aligned<FloatType> (loop + t);
+                            SIMD::store_unaligned (out + t, SIMD::add (SIMD::load_unaligned<FloatType> (out + t), y));
+                            peak = SIMD::max (peak, SIMD::abs (y));
+                        }
+                        for (; t < count; ++t)
+                        {
+                            out[t] += loop[t];
+                            tail = std::max (tail, std::abs (loop[t]));
+                        }
+
+                        done += count;
+                    }
+
+                    const bool exciting = v.burst > 0 || v.breath > FloatType (0) || (v.model == WaveguideModel::Tube && v.held);
+                    if (! exciting && std::max (SIMD::hmax (peak), tail) < FloatType (1e-5))
+                        v.active = false;
+                }
+
+                /** @brief Add the pluck burst or the breath noise into loop[0, count). */
+                void excite (Voice& v, std::size_t count) noexcept
+                {
+                    if (v.model == WaveguideModel::PluckedString)
+                    {
+                        const std::size_t m = std::min (count, v.burst);
+                        for (std::size_t t = 0; t < m; ++t)
+                        {
+                            v.toneState += v.tone * (noise (v) - v.toneState);
+                            loop[t]     += v.velocity * v.toneState;
+                        }
+                        v.burst -= m;
+                        return;
+                    }
+
+                    const FloatType target = v.held ? v.velocity : FloatType (0);
+                    if (target == FloatType (0) && v.breath == FloatType (0))
+                        return;
+
+                    // 20 ms breath ramps
+                    const FloatType step = FloatType (50) / this->getSampleRate();
+                    for (std::size_t t = 0; t < count; ++t)
+                    {
+                        v.breath = v.breath < target ? std::min (v.breath + step, target) : std::max (v.breath - step, target);
+                        loop[t] += kBreathLevel * v.breath * noise (v);
+                    }
+                }
+
+                /** @brief Uniform noise in [-1, 1). */
+                static FloatType noise (Voice& v) noexcept
+                {
+                    return static_cast<FloatType> (v.rng.next() >> 8) * FloatType (2.0 / 16777216.0) - FloatType (1);
+                }
+
+                void initParameters() CASPI_ALLOCATING
+                {
+                    amplitude.setRange (FloatType (0), FloatType (1));
+                    amplitude.setBaseNormalised (FloatType (1));
+                    amplitude.skip (1000);
+
+                    decay.setRange (FloatType (0.01), FloatType (60), Core::ParameterScale::Logarithmic);
+                    setDecay (FloatType (2));
+                }
+
+                /*************************************************************************
+                 * State
+                 *************************************************************************/
+
+                static constexpr FloatType kBreathLevel = FloatType (0.1);
+
+                std::array<Voice, MaxVoices>         voices {};
+                LoopFilter<FloatType>                loopFilter;
+                Oscillators::detail::Xoshiro128Plus  rng {};
+                std::uint64_t                        seed { 0x57A1B0u };
+                std::uint64_t                        noteCounter { 0 };
+                FloatType                            releaseSeconds { FloatType (0.1) };
+                WaveguideModel                       model { WaveguideModel::PluckedString };
+                DelayInterpolation                   interpolation { DelayInterpolation::Lagrange };
+
+                alignas (16) FloatType taps[kChunk + 2 + kLanes] {};
+                alignas (16) FloatType loop[kChunk] {};
+        };
+
+    } // namespace Physical
+} // namespace CASPI
+
+#endif // CASPI_WAVEGUIDE_H
@@ -0,0 +1,785 @@
+/************************************************************************
+ .d8888b.                             d8b
+d88P  Y88b                            Y8P
+888    888
+888         8888b.  .d8888b  88888b.  888
+888            "88b 88K      888 "88b 888
+888    888 .d888888 "Y8888b. 888  888 888
+Y88b  d88P 888  888      X88 888 d88P 888
+ "Y8888P"  "Y888888  88888P' 88888P"  888
+                             888
+                             888
+                             888
+
+ * @file   caspi_Granulator.h
+ * @author CS Islay
+ * @brief  Granular synthesis from an in-memory source, with a fixed grain
+ *         pool and SIMD grain rendering.
+ *
+ * @details
+ * Granulator<FloatType, MaxGrains> scatters short windowed grains read
+ * from a source buffer. A scheduler spawns grains at a fixed rate
+ * (density); each grain draws its source position, pitch and pan from a
+ * seeded xoshiro128+ stream, so the same seed and settings always render
+ * the same output.
+ *
+ * ### Grain pool
+ * Grains live in a MaxGrains-long array that is never resized. A stack of
+ * free slots and a dense list of active slots make spawn and retire O(1):
+ * @code
+ *   spawn:   slot = free[--numFree];   active[numActive++] = slot;
+ *   retire:  free[numFree++] = slot;   active[i] = active[--numActive];
+ * @endcode
+ * Each block first renders the grains already playing, retiring those that
+ * end, and then spawns and renders the block's new grains, so slots freed
+ * mid-block are reused at once. If every slot is busy, the grain is dropped
+ * and counted in getDroppedGrains(). A new grain starts at its exact
+ * sample within the block.
+ *
+ * ### Rendering
+ * Each grain renders kLanes output samples per step (4 float / 2 double):
+ * @code
+ *   y[t] = source(start + t * rate) * window(t * W / length) * gain
+ * @endcode
+ * The window comes from a precomputed W = 2048 point table, read with
+ * SIMD::gather and linear interpolation. Grains at unity rate read the
+ * source with contiguous vector loads. Other rates gather two taps and
+ * interpolate linearly. Grains are clamped to lie inside the source, so
+ * neither path needs bounds checks.
+ *
+ * ### Modulatable parameters
+ * | Parameter      | Range           | Scale       | Notes                                  |
+ * |----------------|-----------------|-------------|----------------------------------------|
+ * | amplitude      | [0, 1]          | Linear      | Output gain                            |
+ * | density        | [1, 20000] Hz   | Logarithmic | Grains spawned per second              |
+ * | grainSize      | [1, 1000] ms    | Logarithmic | Grain length                           |
+ * | position       | [0, 1]          | Linear      | Grain start, as a fraction of the source |
+ * | positionSpread | [0, 1]          | Linear      | Random start offset, ± fraction of the source |
+ * | pitch          | [-24, 24] st    | Linear      | Transposition of every grain           |
+ * | pitchSpread    | [0, 24] st      | Linear      | Random ± transposition per grain       |
+ * | panSpread      | [0, 1]          | Linear      | Random equal-power pan width           |
+ *
+ * All are stepped once per renderBlock() call; grains keep the values
+ * they were spawned with.
+ *
+ * ### Thread safety
+ * setSource() allocates: call it before streaming. Setters and rendering
+ * run on the audio thread; parameter base values can be set from any
+ * thread.
+ *
+ * ### Typical usage
+ * @code
+ *   CASPI::Samplers::Granulator<float> cloud (48000.f);
+ *   cloud.setSource (recording.data(), recording.size(), 44100.f);
+ *   cloud.setDensity (400.f);
+ *   cloud.setGrainSize (60.f);
+ *   cloud.setPositionSpread (0.05f);
+ *   cloud.setPanSpread (0.7f);
+ *
+ *   float left[512], right[512];
+ *   cloud.renderBlock (left, right, 512);
+ * @endcode
+ ************************************************************************/
+
+#ifndef CASPI_GRANULATOR_H
+#define CASPI_GRANULATOR_H
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "base/caspi_Assert.h"
+#include "base/caspi_Constants.h"
+#include "base/caspi_SIMD.h"
+#include "core/caspi_Parameter.h"
+#include "core/caspi_Producer.h"
+#include "oscillators/caspi_Noise.h"
+
+namespace CASPI
+{
+    namespace Samplers
+    {
+
+        /**
+         * @brief Grain envelope shape.
+         */
+        enum class GrainWindow
+        {
+            Hann,     ///< Raised cosine. Smooth, the usual choice.
+            Triangle, ///< Linear attack and decay.
+            Gaussian  ///< exp(-0.5 ((x - 0.5) / 0.15)^2); narrower, with soft tails.
+        };
+
+        /*******************************************************************************
+         * Granulator
+         ******************************************************************************/
+
+        /**
+         * @brief Granular cloud generator over a resident source buffer.
+         *
+         * @details
+         * As a graph node the granulator writes left / right into output
+         * channels 0 and 1 (further channels are cleared); with a mono output
+         * buffer it writes the unpanned mono mix.
+         *
+         * Grains are not normalised: with d grains per second of s seconds,
+         * about d * s grains overlap, so reduce amplitude as density rises.
+         *
+         * @tparam FloatType  float or double.
+         * @tparam MaxGrains  Grain pool size; the maximum overlap.
+         */
+        template <CASPI_FLOAT_TYPE FloatType, std::size_t MaxGrains = 1024>
+        class Granulator final
+            : public Core::Producer<Granulator<FloatType, MaxGrains>, FloatType, Core::Traversal::PerFrame>
+        {
+                static_assert (std::is_floating_point<FloatType>::value,
+                               "Granulator requires a floating-point type");
+                static_assert (MaxGrains >= 1, "MaxGrains must be positive");
+
+                using simd_type = typename SIMD::Strategy::simd_type<FloatType, SIMD::Strategy::min_simd_width<FloatType>::value>::type;
+
+                static constexpr std::size_t kLanes      = SIMD::Strategy::min_simd_width<FloatType>::value;
+                static constexpr std::size_t kWindowSize = 2048;
+                static constexpr std::size_t kNumWindows = 3;
+
+            public:
+                /*************************************************************************
+                 * Construction
+                 *************************************************************************/
+
+                /**
+                 * @brief Default constructor. Call setSampleRate() and setSource()
+                 *        before rendering.
+                 */
+                Granulator() CASPI_ALLOCATING
+                {
+                    initParameters();
+                    buildWindows();
+                    reset();
+
+                    // The graph's PerFrame default is mono; grains are panned in stereo
+                    this->setOutputChannelMode (Graph::ChannelMode::Multichannel);
+                }
+
+                /**
+                 * @brief Construct with the output sample rate.
+                 *
+                 * @param sr  Output sample rate in Hz. Must be > 0.
+                 */
+                explicit Granulator (FloatType sr) CASPI_ALLOCATING
+                {
+                    initParameters();
+                    buildWindows();
+                    reset();
+                    this->setSampleRate (sr);
+
+                    // The graph's PerFrame default is mono; grains are panned in stereo
+                    this->setOutputChannelMode (Graph::ChannelMode::Multichannel);
+                }
+
+                /** @brief AudioNode hook; nothing to cache. */
+                void onPrepare (std::size_t /*numChannels*/, std::size_t /*numFrames*/, double /*sampleRate*/) noexcept {}
+
+                /**
+                 * @brief Graph dispatch: stereo into channels 0 / 1, or mono into
+                 *        channel 0 for a single-channel output buffer.
+                 */
+                void processImpl (Graph::AudioContext<FloatType>& ctx) noexcept
+                {
+                    (void) ctx;
+
+                    auto&             buffer   = this->outputBuffer;
+                    const std::size_t channels = buffer.numChannels();
+                    const int         frames   = static_cast<int> (buffer.numFrames());
+
+                    if (channels == 0 || frames == 0)
+                        return;
+
+                    if (channels == 1)
+                    {
+                        renderBlock (buffer.channelData (0), frames);
+                        return;
+                    }
+
+                    renderBlock (buffer.channelData (0), buffer.channelData (1), frames);
+
+                    for (std::size_t ch = 2; ch < channels; ++ch)
+                    {
+                        FloatType* data = buffer.channelData (ch);
+                        for (int i = 0; i < frames; ++i)
+                            data[i] = FloatType (0);
+                    }
+                }
+
+                /*************************************************************************
+                 * Source
+                 *************************************************************************/
+
+                /**
+                 * @brief Copy @p numFrames mono frames to granulate. Clears all grains.
+                 *
+                 * @param data        Source frames.
+                 * @param numFrames   Number of frames. Must be >= 2.
+                 * @param sourceRate  Rate the source was recorded at, in Hz.
+                 */
+                void setSource (const FloatType* data, std::size_t numFrames, FloatType sourceRate) CASPI_ALLOCATING
+                {
+                    CASPI_ASSERT (data != nullptr && numFrames >= 2, "Source needs at least two frames");
+                    CASPI_ASSERT (sourceRate > FloatType (0), "Source rate must be positive");
+
+                    // Zero guard after the end: vector loads of a grain's last group stay in bounds
+                    source.assign (numFrames + kLanes + 1, FloatType (0));
+                    std::copy (data, data + numFrames, source.begin());
+
+                    sourceFrames     = numFrames;
+                    sourceSampleRate = sourceRate;
+                    reset();
+                }
+
+                /** @brief Frames in the current source; 0 before setSource(). */
+                CASPI_NO_DISCARD std::size_t getSourceFrames() const noexcept
+                {
+                    return sourceFrames;
+                }
+
+                /*************************************************************************
+                 * Configuration
+                 *************************************************************************/
+
+                /** @brief Select the envelope of grains spawned from now on. */
+                void setWindow (GrainWindow shape) noexcept CASPI_NON_BLOCKING
+                {
+                    window = shape;
+                }
+
+                CASPI_NO_DISCARD GrainWindow getWindow() const noexcept
+                {
+                    return window;
+                }
+
+                /**
+                 * @brief Seed the scheduler's random stream. Takes effect at reset().
+                 */
+                void setSeed (std::uint64_t newSeed) noexcept CASPI_NON_BLOCKING
+                {
+                    seed = newSeed;
+                }
+
+                /**
+                 * @brief Retire every grain, reseed, and spawn the next grain on the
+                 *        first sample of the next block.
+                 */
+                void reset() noexcept CASPI_NON_BLOCKING
+                {
+                    numActive = 0;
+                    numFree   = MaxGrains;
+                    for (std::size_t k = 0; k < MaxGrains; ++k)
+                        freeList[k] = MaxGrains - 1 - k;
+
+                    rng.seed (seed);
+                    nextSpawn = 0.0;
+                    dropped   = 0;
+                }
+
+                /** @brief Set the spawn rate in grains per second, bypassing smoothing. */
+                void setDensity (FloatType grainsPerSecond) noexcept CASPI_NON_BLOCKING
+                {
+                    setLog (density, grainsPerSecond);
+                }
+
+                /** @brief Set the grain length in milliseconds, bypassing smoothing. */
+                void setGrainSize (FloatType ms) noexcept CASPI_NON_BLOCKING
+                {
+                    setLog (grainSize, ms);
+                }
+
+                /** @brief Set the grain start as a fraction of the source, bypassing smoothing. */
+                void setPosition (FloatType fraction) noexcept CASPI_NON_BLOCKING
+                {
+                    setLinear (position, fraction);
+                }
+
+                /** @brief Set the random start offset, ± fraction of the source. */
+                void setPositionSpread (FloatType fraction) noexcept CASPI_NON_BLOCKING
+                {
+                    setLinear (positionSpread, fraction);
+                }
+
+                /** @brief Set the transposition in semitones, bypassing smoothing. */
+                void setPitch (FloatType semitones) noexcept CASPI_NON_BLOCKING
+                {
+                    setLinear (pitch, semitones);
+                }
+
+                /** @brief Set the random ± transposition in semitones. */
+                void setPitchSpread (FloatType semitones) noexcept CASPI_NON_BLOCKING
+                {
+                    setLinear (pitchSpread, semitones);
+                }
+
+                /** @brief Set the random pan width: 0 centred, 1 anywhere hard left to right. */
+                void setPanSpread (FloatType amount) noexcept CASPI_NON_BLOCKING
+                {
+                    setLinear (panSpread, amount);
+                }
+
+                /*************************************************************************
+                 * Statistics
+                 *************************************************************************/
+
+                /** @brief Grains currently sounding. */
+                CASPI_NO_DISCARD std::size_t getNumActiveGrains() const noexcept
+                {
+                    return numActive;
+                }
+
+                /** @brief Grains not spawned because the pool was full, since reset(). */
+                CASPI_NO_DISCARD std::uint64_t getDroppedGrains() const noexcept
+                {
+                    return dropped;
+                }
+
+                /*************************************************************************
+                 * Rendering
+                 *************************************************************************/
+
+                /** @brief Render one mono sample; prefer renderBlock(). */
+                FloatType renderSample() noexcept CASPI_NON_BLOCKING override
+                {
+                    // A full vector of storage, so the compiler sees no out-of-bounds
+                    // access through the vector paths for a one-sample block.
+                    alignas (16) FloatType out[kLanes] {};
+                    renderBlock (out, 1);
+                    return out[0];
+                }
+
+                /**
+                 * @brief Render the unpanned mono mix.
+                 *
+                 * @param output      Buffer of at least @p numSamples elements.
+                 * @param numSamples  Number of samples. Must be > 0.
+                 */
+                void renderBlock (FloatType* CASPI_RESTRICT output, int numSamples) noexcept CASPI_NON_BLOCKING
+                {
+                    CASPI_ASSERT (output != nullptr, "Output buffer must not be null");
+                    CASPI_ASSERT (numSamples > 0, "numSamples must be positive");
+
+                    dispatch<false> (output, nullptr, static_cast<std::size_t> (numSamples));
+                }
+
+                /**
+                 * @brief Render the panned stereo mix.
+                 *
+                 * @param left        Left channel, at least @p numSamples elements.
+                 * @param right       Right channel, at least @p numSamples elements.
+                 *                    Must not alias @p left.
+                 * @param numSamples  Number of samples. Must be > 0.
+                 */
+                void renderBlock (FloatType* CASPI_RESTRICT left,
+                                  FloatType* CASPI_RESTRICT right,
+                                  int                       numSamples) noexcept CASPI_NON_BLOCKING
+                {
+                    CASPI_ASSERT (left != nullptr && right != nullptr, "Output buffers must not be null");
+                    CASPI_ASSERT (numSamples > 0, "numSamples must be positive");
+
+                    dispatch<true> (left, right, static_cast<std::size_t> (numSamples));
+                }
+
+                /*************************************************************************
+                 * Public modulatable parameters
+                 *************************************************************************/
+
+                Core::ModulatableParameter<FloatType> amplitude;      ///< Output gain in [0, 1].
+                Core::ModulatableParameter<FloatType> density;        ///< Grains per second, log scale [1, 20000].
+                Core::ModulatableParameter<FloatType> grainSize;      ///< Grain length in ms, log scale [1, 1000].
+                Core::ModulatableParameter<FloatType> position;       ///< Start as a fraction of the source, [0, 1].
+                Core::ModulatableParameter<FloatType> positionSpread; ///< Random ± start offset, [0, 1].
+                Core::ModulatableParameter<FloatType> pitch;          ///< Transposition in semitones, [-24, 24].
+                Core::ModulatableParameter<FloatType> pitchSpread;    ///< Random ± transposition in semitones, [0, 24].
+                Core::ModulatableParameter<FloatType> panSpread;      ///< Random pan width in [0, 1].
+
+            private:
+                /*************************************************************************
+                 * Types
+                 *************************************************************************/
+
+                struct Grain
+                {
+                    double           position { 0.0 };  ///< Source read head in frames.
+                    double           rate { 1.0 };      ///< Source frames per output sample.
+                    FloatType        phaseInc { 0 };    ///< Window table step per sample.
+                    FloatType        gainLeft { 0 };
+                    FloatType        gainRight { 0 };
+                    const FloatType* window { nullptr };
+                    std::size_t      elapsed { 0 };     ///< Samples rendered so far.
+                    std::size_t      remaining { 0 };   ///< Samples left to render.
+                    std::size_t      delay { 0 };       ///< First sample within the current block.
+                };
+
+                /*************************************************************************
+                 * Block
+                 *************************************************************************/
+
+                template <bool Stereo>
+                void dispatch (FloatType* CASPI_RESTRICT left, FloatType* CASPI_RESTRICT right, std::size_t n) noexcept
+                    CASPI_NON_BLOCKING
+                {
+                    amplitude.process();
+                    density.process();
+                    grainSize.process();
+                    position.process();
+                    positionSpread.process();
+                    pitch.process();
+                    pitchSpread.process();
+                    panSpread.process();
+
+                    for (std::size_t i = 0; i < n; ++i)
+                        left[i] = FloatType (0);
+                    CASPI_CPP17_IF_CONSTEXPR (Stereo)
+                    {
+                        for (std::size_t i = 0; i < n; ++i)
+                            right[i] = FloatType (0);
+                    }
+
+                    if (sourceFrames == 0)
+                        return;
+
+                    const FloatType gain = amplitude.value();
+
+                    // Grains that finish in this block free their slots before
+                    // this block's grains are spawned
+                    renderActive<Stereo> (0, left, right, n, gain);
+
+                    const std::size_t firstNew = numActive;
+                    scheduleBlock (n);
+                    renderActive<Stereo> (firstNew, left, right, n, gain);
+                }
+
+                /**
+                 * @brief Render active grains from list index @p first on, retiring
+                 *        those that finish.
+                 */
+                template <bool Stereo>
+                void renderActive (std::size_t               first,
+                                   FloatType* CASPI_RESTRICT left,
+                                   FloatType* CASPI_RESTRICT right,
+                                   std::size_t               n,
+                                   FloatType                 gain) noexcept CASPI_NON_BLOCKING
+                {
+                    for (std::size_t i = first; i < numActive;)
+                    {
+                        Grain& grain = pool[activeList[i]];
+
+                        const std::size_t count = std::min (grain.remaining, n - grain.delay);
+                        renderGrain<Stereo> (grain, left + grain.delay, Stereo ? right + grain.delay : nullptr, count, gain);
+
+                        grain.remaining -= count;
+                        grain.delay      = 0;
+
+                        if (grain.remaining == 0)
+                        {
+                            freeList[numFree++] = activeList[i];
+                            activeList[i]       = activeList[--numActive];
+                        }
+                        else
+                        {
+                            ++i;
+                        }
+                    }
+                }
+
+                /**
+                 * @brief Spawn every grain due in the next @p n samples.
+                 */
+                void scheduleBlock (std::size_t n) noexcept CASPI_NON_BLOCKING
+                {
+                    const double sr       = static_cast<double> (this->getSampleRate());
+                    const double interval = sr / static_cast<double> (density.value());
+
+                    const auto length = static_cast<std::size_t> (std::max (2.0, std::round (static_cast<double> (grainSize.value()) * sr / 1000.0)));
+
+                    while (nextSpawn < static_cast<double> (n))
+                    {
+                        spawn (static_cast<std::size_t> (nextSpawn), length, sr);
+                        nextSpawn += interval;
+                    }
+                    nextSpawn -= static_cast<double> (n);
+                }
+
+                /**
+                 * @brief Draw a grain's start, pitch and pan and put it in the pool.
+                 *
+                 * @details
+                 * The random draws happen even when the pool is full, so dropping
+                 * a grain does not shift the stream for the grains after it.
+                 */
+                void spawn (std::size_t delay, std::size_t length, double sr) noexcept CASPI_NON_BLOCKING
+                {
+                    const double uPosition = bipolar();
+                    const double uPitch    = bipolar();
+                    const double uPan      = bipolar();
+
+                    if (numFree == 0)
+                    {
+                        ++dropped;
+                        return;
+                    }
+
+                    const double semitones = static_cast<double> (pitch.value()) + static_cast<double> (pitchSpread.value()) * uPitch;
+                    const double rate      = std::exp2 (semitones / 12.0) * static_cast<double> (sourceSampleRate) / sr;
+
+                    // Keep every tap inside the source: shorten grains longer than it
+                    const double lastFrame = static_cast<double> (sourceFrames - 1);
+                    const auto   fits      = static_cast<std::size_t> ((lastFrame - 1.0) / rate) + 1;
+                    length                 = std::min (length, fits);
+                    if (length < 2)
+                        return;
+
+                    const double span  = static_cast<double> (length - 1) * rate;
+                    const double start = (static_cast<double> (position.value()) + static_cast<double> (positionSpread.value()) * uPosition) * lastFrame;
+
+                    const std::size_t slot  = freeList[--numFree];
+                    activeList[numActive++] = slot;
+
+                    const double pan = static_cast<double> (panSpread.value()) * uPan;
+                    const double arg = (pan + 1.0) * Constants::PI<double> / 4.0;
+
+                    Grain& grain    = pool[slot];
+                    grain.position  = std::floor (std::max (0.0, std::min (start, lastFrame - 1.0 - span)));
+                    grain.rate      = rate;
+                    grain.elapsed   = 0;
+                    grain.phaseInc  = static_cast<FloatType> (static_cast<double> (kWindowSize) / static_cast<double> (length));
+                    grain.gainLeft  = static_cast<FloatType> (std::cos (arg));
+                    grain.gainRight = static_cast<FloatType> (std::sin (arg));
+                    grain.window    = windows[static_cast<std::size_t> (window)].data();
+                    grain.remaining = length;
+                    grain.delay     = delay;
+                }
+
+                /** @brief Uniform in [-1, 1) from the top 24 bits of the stream. */
+                double bipolar() noexcept
+                {
+                    return static_cast<double> (rng.next() >> 8) * (2.0 / 16777216.0) - 1.0;
+                }
+
+                /*************************************************************************
+                 * Grain rendering
+                 *************************************************************************/
+
+                /**
+                 * @brief Mix @p count samples of @p grain into the outputs.
+                 *
+                 * @details
+                 * Mono renders at unit gain; stereo applies the grain's pan gains.
+                 */
+                template <bool Stereo>
+                void renderGrain (Grain&                    grain,
+                                  FloatType* CASPI_RESTRICT left,
+                                  FloatType* CASPI_RESTRICT right,
+                                  std::size_t               count,
+                                  FloatType                 gain) const noexcept CASPI_NON_BLOCKING
+                {
+                    const FloatType* src = source.data();
+                    const FloatType* win = grain.window;
+
+                    const simd_type one     = SIMD::set1<FloatType> (FloatType (1));
+                    const simd_type winStep = SIMD::set1<FloatType> (grain.phaseInc);
+                    const simd_type srcStep = SIMD::set1<FloatType> (static_cast<FloatType> (grain.rate));
+                    const simd_type gainL   = SIMD::set1<FloatType> (gain * (Stereo ? grain.gainLeft : FloatType (1)));
+                    const simd_type gainR   = SIMD::set1<FloatType> (gain * grain.gainRight);
+                    const bool      unity   = grain.rate == 1.0;
+
+                    simd_type ramp = laneRamp();
+
+                    alignas (16) FloatType tail[2][kLanes];
+
+                    for (std::size_t i = 0; i < count; i += kLanes)
+                    {
+                        const std::size_t m = std::min (kLanes, count - i);
+
+                        // Lanes past the grain's end repeat its last sample, keeping reads in bounds
+                        if (m < kLanes)
+                            ramp = SIMD::min (ramp, SIMD::set1<FloatType> (static_cast<FloatType> (m - 1)));
+
+                        // Window: linear read of the table. The phase is derived from the
+                        // sample count, so it cannot drift past the table's end.
+                        const simd_type w    = SIMD::mul (SIMD::add (SIMD::set1<FloatType> (static_cast<FloatType> (grain.elapsed)), ramp), winStep);
+                        const simd_type wIdx = SIMD::floor (w);
+                        const simd_type w0   = SIMD::gather (win, wIdx);
+                        const simd_type w1   = SIMD::gather (win, SIMD::add (wIdx, one));
+                        const simd_type env  = SIMD::mul_add (SIMD::sub (w1, w0), SIMD::sub (w, wIdx), w0);
+
+                        // Source: contiguous at unity rate, two-tap gather otherwise
+                        const auto base = static_cast<std::size_t> (grain.position);
+                        simd_type  s;
+                        if (unity)
+                        {
+                            s = SIMD::load_unaligned<FloatType> (src + base);
+                        }
+                        else
+                        {
+                            const simd_type rel  = SIMD::mul_add (ramp, srcStep, SIMD::set1<FloatType> (static_cast<FloatType> (grain.position - static_cast<double> (base))));
+                            const simd_type sIdx = SIMD::floor (rel);
+                            const simd_type s0   = SIMD::gather (src + base, sIdx);
+                            const simd_type s1   = SIMD::gather (src + base, SIMD::add (sIdx, one));
+                            s                    = SIMD::mul_add (SIMD::sub (s1, s0), SIMD::sub (rel, sIdx), s0);
+                        }
+
+                        const simd_type y = SIMD::mul (s, env);
+
+                        if (m == kLanes)
+                        {
+                            SIMD::store_unaligned (left + i, SIMD::mul_add (y, gainL, SIMD::load_unaligned<FloatType> (left + i)));
+                            CASPI_CPP17_IF_CONSTEXPR (Stereo)
+                            {
+                                SIMD::store_unaligned (right + i, SIMD::mul_add (y, gainR, SIMD::load_unaligned<FloatType> (right + i)));
+                            }
+                        }
+                        else
+                        {
+                            SIMD::store_aligned (tail[0], SIMD::mul (y, gainL));
+                            SIMD::store_aligned (tail[1], SIMD::mul (y, gainR));
+                            for (std::size_t l = 0; l < m; ++l)
+                                left[i + l] += tail[0][l];
+                            CASPI_CPP17_IF_CONSTEXPR (Stereo)
+                            {
+                                for (std::size_t l = 0; l < m; ++l)
+                                    right[i + l] += tail[1][l];
+                            }
+                        }
+
+                        grain.elapsed  += m;
+                        grain.position += grain.rate * static_cast<double> (m);
+                    }
+                }
+
+                /** @brief {0, 1, ..., kLanes - 1}. */
+                static simd_type laneRamp() noexcept
+                {
+                    alignas (16) FloatType lanes[kLanes];
+                    for (std::size_t l = 0; l < kLanes; ++l)
+                        lanes[l] = static_cast<FloatType> (l);
+                    return SIMD::load_aligned<FloatType> (lanes);
+                }
+
+                /*************************************************************************
+                 * Initialisation
+                 *************************************************************************/
+
+                /**
+                 * @brief Fill the window tables. Entry kWindowSize and the guard
+                 *        after it are 0, the end of every window.
+                 */
+                void buildWindows() noexcept
+                {
+                    for (std::size_t k = 0; k < kNumWindows; ++k)
+                    {
+                        auto& table = windows[k];
+                        for (std::size_t i = 0; i < kWindowSize; ++i)
+                        {
+                            const double x = static_cast<double> (i) / static_cast<double> (kWindowSize);
+                            double       v = 0.0;
+
+                            switch (static_cast<GrainWindow> (k))
+                            {
+                                case GrainWindow::Hann:
+                                    v = 0.5 - 0.5 * std::cos (2.0 * Constants::PI<double> * x);
+                                    break;
+                                case GrainWindow::Triangle:
+                                    v = 1.0 - std::abs (2.0 * x - 1.0);
+                                    break;
+                                case GrainWindow::Gaussian:
+                                    v = std::exp (-0.5 * ((x - 0.5) / 0.15) * ((x - 0.5) / 0.15));
+                                    break;
+                            }
+                            table[i] = static_cast<FloatType> (v);
+                        }
+                        table[kWindowSize]     = FloatType (0);
+                        table[kWindowSize + 1] = FloatType (0);
+                    }
+                }
+
+                void initParameters() CASPI_ALLOCATING
+                {
+                    amplitude.setRange (FloatType (0), FloatType (1));
+                    amplitude.setBaseNormalised (FloatType (1));
+
+                    density.setRange (FloatType (1), FloatType (20000), Core::ParameterScale::Logarithmic);
+                    grainSize.setRange (FloatType (1), FloatType (1000), Core::ParameterScale::Logarithmic);
+                    setLog (density, FloatType (20));
+                    setLog (grainSize, FloatType (50));
+
+                    position.setRange (FloatType (0), FloatType (1));
+                    position.setBaseNormalised (FloatType (0));
+
+                    positionSpread.setRange (FloatType (0), FloatType (1));
+                    positionSpread.setBaseNormalised (FloatType (0));
+
+                    pitch.setRange (FloatType (-24), FloatType (24));
+                    pitch.setBaseNormalised (FloatType (0.5));
+
+                    pitchSpread.setRange (FloatType (0), FloatType (24));
+                    pitchSpread.setBaseNormalised (FloatType (0));
+
+                    panSpread.setRange (FloatType (0), FloatType (1));
+                    panSpread.setBaseNormalised (FloatType (0));
+
+                    amplitude.skip (1000);
+                    position.skip (1000);
+                    positionSpread.skip (1000);
+                    pitch.skip (1000);
+                    pitchSpread.skip (1000);
+                    panSpread.skip (1000);
+                }
+
+                /** @brief Set a linear parameter in its own units, clamped, bypassing smoothing. */
+                static void setLinear (Core::ModulatableParameter<FloatType>& param, FloatType value) noexcept
+                {
+                    const FloatType lo = param.getMinValue();
+                    const FloatType hi = param.getMaxValue();
+                    param.setBaseNormalised (std::max (FloatType (0), std::min ((value - lo) / (hi - lo), FloatType (1))));
+                    param.skip (1000);
+                }
+
+                /** @brief Set a log-scale parameter in its own units, clamped, bypassing smoothing. */
+                static void setLog (Core::ModulatableParameter<FloatType>& param, FloatType value) noexcept
+                {
+                    CASPI_ASSERT (value > FloatType (0), "Log-scale value must be positive");
+                    const FloatType lo   = std::log (param.getMinValue());
+                    const FloatType hi   = std::log (param.getMaxValue());
+                    const FloatType norm = (std::log (value) - lo) / (hi - lo);
+                    param.setBaseNormalised (std::max (FloatType (0), std::min (norm, FloatType (1))));
+                    param.skip (1000);
+                }
+
+                /*************************************************************************
+                 * State
+                 *************************************************************************/
+
+                std::vector<FloatType> source;
+                std::size_t            sourceFrames { 0 };
+                FloatType              sourceSampleRate { FloatType (48000) };
+
+                std::array<std::array<FloatType, kWindowSize + 2>, kNumWindows> windows {};
+                GrainWindow                                                     window { GrainWindow::Hann };
+
+                std::array<Grain, MaxGrains>       pool {};
+                std::array<std::size_t, MaxGrains> freeList {};
+                std::array<std::size_t, MaxGrains> activeList {};
+                std::size_t                        numFree { 0 };
+                std::size_t                        numActive { 0 };
+
+                Oscillators::detail::Xoshiro128Plus rng {};
+                std::uint64_t                       seed { 0x6772616E756C6172ull };
+                double                              nextSpawn { 0.0 };
+                std::uint64_t                       dropped { 0 };
+        };
+
+    } // namespace Samplers
+} // namespace CASPI
+
+#endif // CASPI_GRANULATOR_H
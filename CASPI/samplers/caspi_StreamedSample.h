@@ -0,0 +1,264 @@
+/*****************************************************************************
+ .d8888b.                             d8b
+d88P  Y88b                            Y8P
+888    888
+888         8888b.  .d8888b  88888b.  888
+888            "88b 88K      888 "88b 888
+888    888 .d888888 "Y8888b. 888  888 888
+Y88b  d88P 888  888      X88 888 d88P 888
+ "Y8888P"  "Y888888  88888P' 88888P"  888
+                             888
+                             888
+                             888
+
+ * @file   caspi_StreamedSample.h
+ * @author CS Islay
+ * @brief  A sample on disk: its first frames held in RAM, the rest read
+ *         on demand with positional reads.
+ *
+ * @details
+ * Multisampled instruments are far larger than RAM, so StreamingSampler
+ * keeps only the start ("head") of each sample resident and streams the
+ * remainder. StreamedSample is that split for one file: open() reads the
+ * head into memory, and read() fetches any later range with pread()
+ * (ReadFile with an offset on Windows), which needs no shared file
+ * position and is safe from one I/O thread while other threads read the
+ * head.
+ *
+ * ### File layout
+ * Mono native-endian float32 frames starting at dataOffset and running to
+ * the end of the file. A WAV file with float data works by passing the
+ * byte offset of its data chunk; other formats are converted offline.
+ *
+ * ### Head length
+ * The head must cover the time between a note-on and the first refill of
+ * that voice's stream: the I/O thread period plus the worst disk latency.
+ * 100-500 ms is typical; samples shorter than the head are fully resident
+ * and never touch the disk after open().
+ *
+ * ### Thread safety
+ * - open() — setup thread only; blocks on I/O and allocates.
+ * - head() and the accessors — any thread, the data is immutable.
+ * - read() — any thread, but it blocks: the streaming thread, never audio.
+ *****************************************************************************/
+
+#ifndef CASPI_STREAMEDSAMPLE_H
+#define CASPI_STREAMEDSAMPLE_H
+
+#include "base/caspi_Assert.h"
+#include "base/caspi_Features.h"
+#include "base/caspi_Platform.h"
+#include "core/caspi_Expected.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(CASPI_PLATFORM_WINDOWS)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace CASPI
+{
+namespace Samplers
+{
+
+/**
+ * @brief Why a sample file could not be opened or read.
+ */
+enum class SampleStreamError
+{
+    OpenFailed,  ///< File could not be opened
+    ReadFailed,  ///< Short or failed read
+    Empty,       ///< No frames after dataOffset
+    BadLayout    ///< Data is not a whole number of float32 frames
+};
+
+/*******************************************************************************
+ * StreamedSample
+ ******************************************************************************/
+
+/**
+ * @brief One on-disk sample with a RAM-resident head.
+ *
+ * @tparam FloatType  Sample type of the resident head; the file is float32.
+ */
+template <typename FloatType>
+class StreamedSample
+{
+public:
+    using Ptr    = std::shared_ptr<const StreamedSample>;
+    using Result = expected<Ptr, SampleStreamError>;
+
+    StreamedSample (const StreamedSample&)            = delete;
+    StreamedSample& operator= (const StreamedSample&) = delete;
+
+    ~StreamedSample()
+    {
+        close();
+    }
+
+    /**
+     * @brief Open @p path and read its first @p headFrames frames into RAM.
+     *
+     * @param path        File of float32 frames.
+     * @param sampleRate  Rate the sample was recorded at, in Hz.
+     * @param headFrames  Frames to keep resident; clamped to the sample length.
+     * @param dataOffset  Byte offset of the first frame.
+     * @return            The sample, or why it failed.
+     */
+    static Result open (const std::string& path,
+                        double             sampleRate,
+                        std::size_t        headFrames,
+                        std::uint64_t      dataOffset = 0) CASPI_BLOCKING
+    {
+        using Error = SampleStreamError;
+
+        std::shared_ptr<StreamedSample> sample (new StreamedSample (path, sampleRate, dataOffset));
+
+        std::uint64_t fileBytes = 0;
+        if (! sample->openFile (fileBytes))
+            return make_unexpected<Ptr, Error> (Error::OpenFailed);
+
+        if (fileBytes <= dataOffset)
+            return make_unexpected<Ptr, Error> (Error::Empty);
+        if ((fileBytes - dataOffset) % sizeof (float) != 0)
+            return make_unexpected<Ptr, Error> (Error::BadLayout);
+
+        sample->frames = (fileBytes - dataOffset) / sizeof (float);
+
+        const auto resident = static_cast<std::size_t> (std::min<std::uint64_t> (headFrames, sample->frames));
+        std::vector<float> raw (resident);
+        if (! sample->read (0, raw.data(), resident))
+            return make_unexpected<Ptr, Error> (Error::ReadFailed);
+
+        sample->headSamples.assign (raw.begin(), raw.end());
+
+        return make_expected<Ptr, Error> (Ptr (std::move (sample)));
+    }
+
+    /**
+     * @brief Read @p count raw frames starting at @p frame.
+     *
+     * @details
+     * Blocking positional read; call from the streaming thread only.
+     *
+     * @return false on a short or failed read, or a range past the end.
+     */
+    bool read (std::uint64_t frame, float* dst, std::size_t count) const CASPI_BLOCKING
+    {
+        if (frame + count > frames)
+            return false;
+
+        auto*         bytes     = reinterpret_cast<char*> (dst);
+        std::uint64_t offset    = dataOffset + frame * sizeof (float);
+        std::size_t   remaining = count * sizeof (float);
+
+        while (remaining > 0)
+        {
+#if defined(CASPI_PLATFORM_WINDOWS)
+            OVERLAPPED at {};
+            at.Offset     = static_cast<DWORD> (offset & 0xFFFFFFFFu);
+            at.OffsetHigh = static_cast<DWORD> (offset >> 32);
+
+            DWORD got = 0;
+            const DWORD want = static_cast<DWORD> (std::min<std::size_t> (remaining, 1u << 30));
+            if (! ::ReadFile (fileHandle, bytes, want, &got, &at) || got == 0)
+                return false;
+#else
+            const ssize_t got = ::pread (fd, bytes, remaining, static_cast<off_t> (offset));
+            if (got <= 0)
+                return false;
+#endif
+            bytes     += got;
+            offset    += static_cast<std::uint64_t> (got);
+            remaining -= static_cast<std::size_t> (got);
+        }
+        return true;
+    }
+
+    /** @brief Total frames in the sample. */
+    CASPI_NO_DISCARD std::uint64_t numFrames() const noexcept { return frames; }
+
+    /** @brief Frames resident in head(). */
+    CASPI_NO_DISCARD std::size_t headFrames() const noexcept { return headSamples.size(); }
+
+    /** @brief The resident first headFrames() frames. */
+    CASPI_NO_DISCARD const FloatType* head() const noexcept { return headSamples.data(); }
+
+    /** @brief Recording sample rate in Hz. */
+    CASPI_NO_DISCARD double sampleRate() const noexcept { return rate; }
+
+    /** @brief Path the sample was opened from. */
+    CASPI_NO_DISCARD const std::string& path() const noexcept { return filePath; }
+
+private:
+    StreamedSample (std::string pathIn, double sampleRateIn, std::uint64_t dataOffsetIn)
+        : filePath (std::move (pathIn)), dataOffset (dataOffsetIn), rate (sampleRateIn)
+    {
+    }
+
+    bool openFile (std::uint64_t& bytes) noexcept
+    {
+#if defined(CASPI_PLATFORM_WINDOWS)
+        fileHandle = ::CreateFileA (filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE)
+            return false;
+
+        LARGE_INTEGER size;
+        if (! ::GetFileSizeEx (fileHandle, &size))
+            return false;
+        bytes = static_cast<std::uint64_t> (size.QuadPart);
+#else
+        fd = ::open (filePath.c_str(), O_RDONLY);
+        if (fd < 0)
+            return false;
+
+        struct stat info;
+        if (::fstat (fd, &info) != 0)
+            return false;
+        bytes = static_cast<std::uint64_t> (info.st_size);
+#endif
+        return true;
+    }
+
+    void close() noexcept
+    {
+#if defined(CASPI_PLATFORM_WINDOWS)
+        if (fileHandle != INVALID_HANDLE_VALUE)
+            ::CloseHandle (fileHandle);
+        fileHandle = INVALID_HANDLE_VALUE;
+#else
+        if (fd >= 0)
+            ::close (fd);
+        fd = -1;
+#endif
+    }
+
+    std::string            filePath;
+    std::uint64_t          dataOffset { 0 };
+    std::uint64_t          frames { 0 };
+    double                 rate { 0.0 };
+    std::vector<FloatType> headSamples;
+#if defined(CASPI_PLATFORM_WINDOWS)
+    HANDLE fileHandle { INVALID_HANDLE_VALUE };
+#else
+    int fd { -1 };
+#endif
+};
+
+} // namespace Samplers
+} // namespace CASPI
+
+#endif // CASPI_STREAMEDSAMPLE_H
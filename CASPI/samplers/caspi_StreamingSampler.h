@@ -0,0 +1,806 @@
+/************************************************************************
+ .d8888b.                             d8b
+d88P  Y88b                            Y8P
+888    888
+888         8888b.  .d8888b  88888b.  888
+888            "88b 88K      888 "88b 888
+888    888 .d888888 "Y8888b. 888  888 888
+Y88b  d88P 888  888      X88 888 d88P 888
+ "Y8888P"  "Y888888  88888P' 88888P"  888
+                             888
+                             888
+                             888
+
+ * @file   caspi_StreamingSampler.h
+ * @author CS Islay
+ * @brief  Polyphonic disk-streaming sampler: resident sample heads, one
+ *         lock-free ring per voice refilled by a background I/O thread.
+ *
+ * @details
+ * StreamingSampler<FloatType, MaxVoices, RingFrames> plays StreamedSamples
+ * at any pitch. A note starts from the sample's RAM-resident head; while
+ * the head plays, the I/O thread reads the following frames into that
+ * voice's ring, staying up to RingFrames ahead of the play head. Only the
+ * heads and MaxVoices rings live in memory, however large the sample set.
+ *
+ * ### Streams
+ * Each voice owns a single-producer / single-consumer ring of RingFrames
+ * frames. Both sides count in absolute sample frames, and frame f lives in
+ * slot f & (RingFrames - 1):
+ * @code
+ *   audio thread:  publishes readFrame  = lowest frame it still needs
+ *   I/O thread:    fills frames [writeFrame, readFrame + RingFrames)
+ *                  publishes writeFrame, tagged with the note's generation
+ * @endcode
+ * A note-on bumps the voice's generation, so frames the I/O thread was
+ * still reading for the previous note are never played for the new one.
+ *
+ * ### Underruns
+ * If the frames a voice needs have not arrived, it outputs silence for
+ * that stretch and keeps moving, so it stays in time. The I/O thread sees
+ * the read position pass its write position and resumes from there.
+ * getUnderrunFrames() counts the silent voice-frames, getUnderrunEvents()
+ * the times a voice went from playing to starved.
+ *
+ * ### Interpolation
+ * Pitch-shifted playback uses the 4-point Catmull-Rom cubic of
+ * WavetableOscillator, kLanes output samples at a time: the taps are
+ * gathered with SIMD::gather straight from the head or the ring (the ring
+ * mask wraps the index), and the cubic runs on whole vectors. Only the
+ * group that straddles the head / ring boundary or the sample end takes a
+ * scalar tap path.
+ *
+ * ### Modulatable parameters
+ * | Parameter | Range  | Scale  | Notes                          |
+ * |-----------|--------|--------|--------------------------------|
+ * | amplitude | [0, 1] | Linear | Output gain, stepped per block |
+ *
+ * ### Thread safety
+ * - addSample(), startStreaming(), stopStreaming() — setup thread, with
+ *   rendering stopped for addSample().
+ * - noteOn(), noteOff(), renderBlock() — audio thread. Lock-free; they
+ *   never touch the disk.
+ * - serviceStreams() — the I/O thread that startStreaming() runs, or one
+ *   thread of the host's choosing if streaming is not started. Blocking.
+ * - Statistics getters — any thread.
+ *
+ * ### Typical usage
+ * @code
+ *   using Sampler = CASPI::Samplers::StreamingSampler<float>;
+ *   auto sampler = std::make_unique<Sampler> (48000.f);
+ *
+ *   auto piano = Sampler::Sample::open ("C4.f32", 48000.0, 24000);   // 500 ms head
+ *   const std::size_t c4 = sampler->addSample (piano.value());
+ *   sampler->startStreaming();
+ *
+ *   // Audio thread
+ *   const int voice = sampler->noteOn (c4, std::exp2 (3.f / 12.f), 0.8f);   // D#4
+ *   sampler->renderBlock (out, 256);
+ *   sampler->noteOff (voice);
+ * @endcode
+ ************************************************************************/
+
+#ifndef CASPI_STREAMINGSAMPLER_H
+#define CASPI_STREAMINGSAMPLER_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "base/caspi_Assert.h"
+#include "base/caspi_SIMD.h"
+#include "core/caspi_Parameter.h"
+#include "core/caspi_Producer.h"
+#include "samplers/caspi_StreamedSample.h"
+
+namespace CASPI
+{
+    namespace Samplers
+    {
+
+        /*******************************************************************************
+         * StreamingSampler
+         ******************************************************************************/
+
+        /**
+         * @brief MaxVoices-voice sampler streaming from StreamedSamples.
+         *
+         * @details
+         * Voices take their pitch and gain at note-on; noteOff() fades the
+         * voice over the release time, and a voice also ends at the end of
+         * its sample. When every voice is busy, noteOn() steals the oldest.
+         *
+         * Ring memory is MaxVoices x RingFrames samples (8 MB for the float
+         * defaults), allocated at construction.
+         *
+         * @tparam FloatType   float or double.
+         * @tparam MaxVoices   Polyphony.
+         * @tparam RingFrames  Frames buffered ahead per voice; power of two.
+         */
+        template <CASPI_FLOAT_TYPE FloatType, std::size_t MaxVoices = 128, std::size_t RingFrames = 16384>
+        class StreamingSampler final
+            : public Core::Producer<StreamingSampler<FloatType, MaxVoices, RingFrames>, FloatType, Core::Traversal::PerFrame>
+        {
+                static_assert (std::is_floating_point<FloatType>::value,
+                               "StreamingSampler requires a floating-point type");
+                static_assert (RingFrames >= 1024 && (RingFrames & (RingFrames - 1)) == 0,
+                               "RingFrames must be a power of two >= 1024");
+                static_assert (MaxVoices >= 1, "MaxVoices must be positive");
+
+                using simd_type = typename SIMD::Strategy::simd_type<FloatType, SIMD::Strategy::min_simd_width<FloatType>::value>::type;
+
+                static constexpr std::size_t   kLanes     = SIMD::Strategy::min_simd_width<FloatType>::value;
+                static constexpr std::size_t   kRingMask  = RingFrames - 1;
+                static constexpr unsigned      kFrameBits = 40;                           ///< writeTag: frame in the low bits
+                static constexpr std::uint64_t kFrameMask = (std::uint64_t (1) << kFrameBits) - 1;
+                static constexpr std::uint32_t kGenMask   = (std::uint32_t (1) << 24) - 1; ///< ... generation in the high 24
+
+            public:
+                using Sample = StreamedSample<FloatType>;
+
+                /// Largest single read issued by serviceStreams(), in frames.
+                static constexpr std::size_t kReadChunk = 4096;
+
+                /*************************************************************************
+                 * Construction
+                 *************************************************************************/
+
+                /**
+                 * @brief Default constructor. Call setSampleRate() before playing.
+                 */
+                StreamingSampler() CASPI_ALLOCATING
+                    : rings (MaxVoices * RingFrames), ioBuffer (kReadChunk)
+                {
+                    initParameters();
+                }
+
+                /**
+                 * @brief Construct with the output sample rate.
+                 *
+                 * @param sr  Output sample rate in Hz. Must be > 0.
+                 */
+                explicit StreamingSampler (FloatType sr)
+                    : rings (MaxVoices * RingFrames), ioBuffer (kReadChunk)
+                {
+                    initParameters();
+                    this->setSampleRate (sr);
+                }
+
+                ~StreamingSampler()
+                {
+                    stopStreaming();
+                }
+
+                /** @brief AudioNode hook; nothing to cache. */
+                void onPrepare (std::size_t /*numChannels*/, std::size_t /*numFrames*/, double /*sampleRate*/) noexcept {}
+
+                /**
+                 * @brief Graph dispatch: renders into the mono output buffer;
+                 *        consumers broadcast it.
+                 */
+                void processImpl (Graph::AudioContext<FloatType>& ctx) noexcept
+                {
+                    (void) ctx;
+
+                    auto&     buffer = this->outputBuffer;
+                    const int frames = static_cast<int> (buffer.numFrames());
+
+                    if (buffer.numChannels() == 0 || frames == 0)
+                        return;
+
+                    renderBlock (buffer.channelData (0), frames);
+                }
+
+                /*************************************************************************
+                 * Sample set
+                 *************************************************************************/
+
+                /**
+                 * @brief Add a sample to the playable set.
+                 *
+                 * @param sample  Opened sample; the sampler keeps it alive.
+                 * @return        Index to pass to noteOn().
+                 */
+                std::size_t addSample (typename Sample::Ptr sample) CASPI_ALLOCATING
+                {
+                    CASPI_ASSERT (sample != nullptr, "Sample must not be null");
+                    samples.push_back (std::move (sample));
+                    return samples.size() - 1;
+                }
+
+                /** @brief Number of samples in the set. */
+                CASPI_NO_DISCARD std::size_t getNumSamples() const noexcept
+                {
+                    return samples.size();
+                }
+
+                /*************************************************************************
+                 * Voices
+                 *************************************************************************/
+
+                /**
+                 * @brief Start a voice playing sample @p sampleIndex.
+                 *
+                 * @param sampleIndex  Index from addSample().
+                 * @param pitchRatio   Playback speed relative to the recorded pitch;
+                 *                     the recording / output rate ratio is applied on top.
+                 * @param gain         Linear voice gain.
+                 * @return             Voice index for noteOff(), or -1 for an unknown sample.
+                 */
+                int noteOn (std::size_t sampleIndex, FloatType pitchRatio = FloatType (1), FloatType gain = FloatType (1)) noexcept
+                    CASPI_NON_BLOCKING
+                {
+                    CASPI_ASSERT (pitchRatio > FloatType (0), "Pitch ratio must be positive");
+                    if (sampleIndex >= samples.size())
+                        return -1;
+
+                    std::size_t chosen = 0;
+                    for (std::size_t k = 0; k < MaxVoices; ++k)
+                    {
+                        if (! voices[k].active)
+                        {
+                            chosen = k;
+                            break;
+                        }
+                        if (voices[k].started < voices[chosen].started)
+                            chosen = k;
+                    }
+
+                    const Sample* sample = samples[sampleIndex].get();
+                    Voice&        voice  = voices[chosen];
+
+                    voice.sample      = sample;
+                    voice.position    = 0.0;
+                    voice.increment   = static_cast<double> (pitchRatio) * sample->sampleRate() / static_cast<double> (this->getSampleRate());
+                    voice.gain        = gain;
+                    voice.envelope    = FloatType (1);
+                    voice.releaseStep = FloatType (0);
+                    voice.started     = ++noteCounter;
+                    voice.starved     = false;
+                    voice.active      = true;
+
+                    restartStream (chosen, sample);
+                    return static_cast<int> (chosen);
+                }
+
+                /**
+                 * @brief Release a voice: it fades out over the release time.
+                 *
+                 * @param voice  Index returned by noteOn(). Ignored if out of range.
+                 */
+                void noteOff (int voice) noexcept CASPI_NON_BLOCKING
+                {
+                    if (voice < 0 || static_cast<std::size_t> (voice) >= MaxVoices)
+                        return;
+
+                    Voice& v = voices[static_cast<std::size_t> (voice)];
+                    if (v.active && v.releaseStep == FloatType (0))
+                        v.releaseStep = FloatType (1) / std::max (FloatType (1), releaseSeconds * this->getSampleRate());
+                }
+
+                /** @brief Release every sounding voice. */
+                void allNotesOff() noexcept CASPI_NON_BLOCKING
+                {
+                    for (std::size_t k = 0; k < MaxVoices; ++k)
+                        noteOff (static_cast<int> (k));
+                }
+
+                /**
+                 * @brief Fade-out time after noteOff().
+                 *
+                 * @param ms  Milliseconds >= 0. Default 10.
+                 */
+                void setReleaseTime (FloatType ms) noexcept CASPI_NON_BLOCKING
+                {
+                    releaseSeconds = std::max (FloatType (0), ms) / FloatType (1000);
+                }
+
+                /** @brief Voices currently sounding. */
+                CASPI_NO_DISCARD std::size_t getNumActiveVoices() const noexcept CASPI_NON_BLOCKING
+                {
+                    std::size_t n = 0;
+                    for (const auto& v : voices)
+                        n += v.active ? 1 : 0;
+                    return n;
+                }
+
+                /*************************************************************************
+                 * Streaming
+                 *************************************************************************/
+
+                /**
+                 * @brief Start the background I/O thread.
+                 *
+                 * @details
+                 * The thread calls serviceStreams() back to back while it finds
+                 * work and sleeps for @p idlePeriod when every ring is full.
+                 * Does nothing if already running.
+                 */
+                void startStreaming (std::chrono::microseconds idlePeriod = std::chrono::microseconds (1000)) CASPI_ALLOCATING
+                {
+                    if (ioThread.joinable())
+                        return;
+
+                    streaming.store (true, std::memory_order_release);
+                    ioThread = std::thread ([this, idlePeriod]
+                                            {
+                                                while (streaming.load (std::memory_order_acquire))
+                                                {
+                                                    if (serviceStreams() == 0)
+                                                        std::this_thread::sleep_for (idlePeriod);
+                                                }
+                                            });
+                }
+
+                /** @brief Stop and join the I/O thread. */
+                void stopStreaming() CASPI_BLOCKING
+                {
+                    streaming.store (false, std::memory_order_release);
+                    if (ioThread.joinable())
+                        ioThread.join();
+                }
+
+                /** @brief Whether the I/O thread is running. */
+                CASPI_NO_DISCARD bool isStreaming() const noexcept
+                {
+                    return ioThread.joinable();
+                }
+
+                /**
+                 * @brief Top up every voice's ring from disk. One pass.
+                 *
+                 * @details
+                 * Called by the I/O thread; call it yourself from a single
+                 * thread of your choosing if startStreaming() is not used.
+                 * Reads are issued in chunks of up to kReadChunk frames; a
+                 * failed read plays as silence and counts in getReadErrors().
+                 *
+                 * @return Frames read in this pass.
+                 */
+                std::size_t serviceStreams() CASPI_BLOCKING
+                {
+                    std::size_t total = 0;
+
+                    for (std::size_t k = 0; k < MaxVoices; ++k)
+                    {
+                        Stream& stream = streams[k];
+
+                        const std::uint32_t generation = stream.generation.load (std::memory_order_acquire);
+                        if (generation != stream.seenGeneration)
+                        {
+                            stream.seenGeneration = generation;
+                            stream.filling        = stream.source.load (std::memory_order_relaxed);
+                            stream.writeFrame     = stream.filling != nullptr ? stream.filling->headFrames() : 0;
+                        }
+
+                        if (stream.filling != nullptr)
+                            total += fillStream (k, stream);
+                    }
+
+                    return total;
+                }
+
+                /*************************************************************************
+                 * Statistics
+                 *************************************************************************/
+
+                /** @brief Voice-frames rendered as silence because data was late. */
+                CASPI_NO_DISCARD std::uint64_t getUnderrunFrames() const noexcept
+                {
+                    return underrunFrames.load (std::memory_order_relaxed);
+                }
+
+                /** @brief Times a voice went from playing to starved. */
+                CASPI_NO_DISCARD std::uint64_t getUnderrunEvents() const noexcept
+                {
+                    return underrunEvents.load (std::memory_order_relaxed);
+                }
+
+                /** @brief Disk reads that failed and were played as silence. */
+                CASPI_NO_DISCARD std::uint64_t getReadErrors() const noexcept
+                {
+                    return readErrors.load (std::memory_order_relaxed);
+                }
+
+                /** @brief Zero every counter. */
+                void resetStatistics() noexcept
+                {
+                    underrunFrames.store (0, std::memory_order_relaxed);
+                    underrunEvents.store (0, std::memory_order_relaxed);
+                    readErrors.store (0, std::memory_order_relaxed);
+                }
+
+                /*************************************************************************
+                 * Rendering
+                 *************************************************************************/
+
+                /** @brief Render one sample; prefer renderBlock(). */
+                FloatType renderSample() noexcept CASPI_NON_BLOCKING override
+                {
+                    FloatType out = FloatType (0);
+                    renderBlock (&out, 1);
+                    return out;
+                }
+
+                /**
+                 * @brief Render the mix of every sounding voice.
+                 *
+                 * @param output      Buffer of at least @p numSamples elements.
+                 * @param numSamples  Number of samples. Must be > 0.
+                 */
+                void renderBlock (FloatType* CASPI_RESTRICT output, int numSamples) noexcept CASPI_NON_BLOCKING
+                {
+                    CASPI_ASSERT (output != nullptr, "Output buffer must not be null");
+                    CASPI_ASSERT (numSamples > 0, "numSamples must be positive");
+
+                    amplitude.process();
+
+                    const auto n = static_cast<std::size_t> (numSamples);
+                    for (std::size_t i = 0; i < n; ++i)
+                        output[i] = FloatType (0);
+
+                    BlockStats stats;
+                    for (std::size_t k = 0; k < MaxVoices; ++k)
+                    {
+                        if (voices[k].active)
+                            renderVoice (k, output, n, stats);
+                    }
+
+                    if (stats.frames > 0)
+                        underrunFrames.fetch_add (stats.frames, std::memory_order_relaxed);
+                    if (stats.events > 0)
+                        underrunEvents.fetch_add (stats.events, std::memory_order_relaxed);
+                }
+
+                /*************************************************************************
+                 * Public modulatable parameters
+                 *************************************************************************/
+
+                Core::ModulatableParameter<FloatType> amplitude; ///< Output gain in [0, 1].
+
+            private:
+                /*************************************************************************
+                 * Types
+                 *************************************************************************/
+
+                /** @brief Audio-thread state of one voice. */
+                struct Voice
+                {
+                    const Sample* sample { nullptr };
+                    double        position { 0.0 };  ///< Play head in sample frames.
+                    double        increment { 1.0 }; ///< Frames per output sample.
+                    FloatType     gain { FloatType (1) };
+                    FloatType     envelope { FloatType (1) };
+                    FloatType     releaseStep { FloatType (0) }; ///< 0 while held.
+                    std::uint64_t started { 0 };                 ///< Note-on order, for stealing.
+                    std::uint32_t generation { 0 };
+                    bool          starved { false };
+                    bool          active { false };
+                };
+
+                /** @brief The ring handshake of one voice; one cache line per voice. */
+                struct alignas (64) Stream
+                {
+                    std::atomic<std::uint32_t> generation { 0 };    ///< Written by audio on note-on / stop.
+                    std::atomic<const Sample*> source { nullptr };  ///< Published with generation.
+                    std::atomic<std::uint64_t> readFrame { 0 };     ///< Lowest frame audio still needs.
+                    std::atomic<std::uint64_t> writeTag { 0 };      ///< generation << 40 | end of written frames.
+
+                    // I/O thread only
+                    std::uint32_t seenGeneration { 0 };
+                    const Sample* filling { nullptr };
+                    std::uint64_t writeFrame { 0 };
+                };
+
+                struct BlockStats
+                {
+                    std::uint64_t frames { 0 };
+                    std::uint64_t events { 0 };
+                };
+
+                /*************************************************************************
+                 * Stream handshake
+                 *************************************************************************/
+
+                static std::uint64_t makeTag (std::uint32_t generation, std::uint64_t frame) noexcept
+                {
+                    return (static_cast<std::uint64_t> (generation) << kFrameBits) | (frame & kFrameMask);
+                }
+
+                /** @brief Point voice @p k's stream at @p sample (nullptr to stop it). */
+                void restartStream (std::size_t k, const Sample* sample) noexcept CASPI_NON_BLOCKING
+                {
+                    Voice&  voice  = voices[k];
+                    Stream& stream = streams[k];
+
+                    voice.generation = (voice.generation + 1) & kGenMask;
+
+                    stream.source.store (sample, std::memory_order_relaxed);
+                    stream.readFrame.store (0, std::memory_order_relaxed);
+                    stream.generation.store (voice.generation, std::memory_order_release);
+                }
+
+                void stopVoice (std::size_t k) noexcept CASPI_NON_BLOCKING
+                {
+                    voices[k].active = false;
+                    voices[k].sample = nullptr;
+                    restartStream (k, nullptr);
+                }
+
+                /** @brief I/O side: read until the ring is full or the sample ends. */
+                std::size_t fillStream (std::size_t k, Stream& stream) CASPI_BLOCKING
+                {
+                    const Sample*       sample = stream.filling;
+                    const std::uint64_t frames = sample->numFrames();
+                    FloatType*          ring   = rings.data() + k * RingFrames;
+                    std::size_t         total  = 0;
+
+                    for (;;)
+                    {
+                        // Audio skipped ahead after an underrun: resume where it is
+                        const std::uint64_t readFrame = stream.readFrame.load (std::memory_order_acquire);
+                        stream.writeFrame             = std::max (stream.writeFrame, readFrame);
+
+                        const std::uint64_t limit = std::min<std::uint64_t> (readFrame + RingFrames, frames);
+                        if (stream.writeFrame >= limit)
+                            break;
+
+                        const auto count = static_cast<std::size_t> (std::min<std::uint64_t> (limit - stream.writeFrame, kReadChunk));
+
+                        if (! sample->read (stream.writeFrame, ioBuffer.data(), count))
+                        {
+                            std::fill (ioBuffer.begin(), ioBuffer.begin() + static_cast<std::ptrdiff_t> (count), 0.f);
+                            readErrors.fetch_add (1, std::memory_order_relaxed);
+                        }
+
+                        for (std::size_t i = 0; i < count; ++i)
+                            ring[(stream.writeFrame + i) & kRingMask] = static_cast<FloatType> (ioBuffer[i]);
+
+                        stream.writeFrame += count;
+                        total             += count;
+                        stream.writeTag.store (makeTag (stream.seenGeneration, stream.writeFrame), std::memory_order_release);
+                    }
+
+                    return total;
+                }
+
+                /*************************************************************************
+                 * Voice rendering
+                 *************************************************************************/
+
+                /**
+                 * @brief Mix voice @p k into @p output, kLanes samples per step.
+                 */
+                void renderVoice (std::size_t k, FloatType* CASPI_RESTRICT output, std::size_t n, BlockStats& stats) noexcept
+                    CASPI_NON_BLOCKING
+                {
+                    Voice&        voice  = voices[k];
+                    Stream&       stream = streams[k];
+                    const Sample* sample = voice.sample;
+
+                    const FloatType*    head     = sample->head();
+                    const FloatType*    ring     = rings.data() + k * RingFrames;
+                    const auto          headEnd  = static_cast<std::int64_t> (sample->headFrames());
+                    const auto          frameEnd = static_cast<std::int64_t> (sample->numFrames());
+
+                    // Frames [headEnd, writeEnd) are in the ring for this note
+                    const std::uint64_t tag      = stream.writeTag.load (std::memory_order_acquire);
+                    const std::int64_t  writeEnd = (tag >> kFrameBits) == voice.generation
+                                                       ? static_cast<std::int64_t> (tag & kFrameMask)
+                                                       : headEnd;
+
+                    const FloatType gain = voice.gain * amplitude.value();
+                    const simd_type one  = SIMD::set1<FloatType> (FloatType (1));
+                    const simd_type two  = SIMD::set1<FloatType> (FloatType (2));
+
+                    alignas (16) FloatType lanes[kLanes];
+                    alignas (16) FloatType gains[kLanes];
+
+                    for (std::size_t i = 0; i < n; i += kLanes)
+                    {
+                        const std::size_t  m    = std::min (kLanes, n - i);
+                        const auto         base = static_cast<std::int64_t> (voice.position);
+
+                        if (base >= frameEnd)
+                        {
+                            stopVoice (k);
+                            return;
+                        }
+
+                        const double offset = voice.position - static_cast<double> (base);
+                        for (std::size_t l = 0; l < kLanes; ++l)
+                            lanes[l] = static_cast<FloatType> (offset + voice.increment * static_cast<double> (l < m ? l : 0));
+
+                        const simd_type rel  = SIMD::load_aligned<FloatType> (lanes);
+                        const simd_type idx  = SIMD::floor (rel);
+                        const simd_type frac = SIMD::sub (rel, idx);
+
+                        // Tap span of the group; one frame of slack on top in case a
+                        // lane's index rounds up when narrowed to FloatType
+                        const std::int64_t lo = base - 1;
+                        const std::int64_t hi = base + static_cast<std::int64_t> (offset + voice.increment * static_cast<double> (m - 1)) + 3;
+
+                        simd_type   y0, y1, y2, y3;
+                        std::size_t starved = 0;
+
+                        if (lo >= 0 && hi < headEnd)
+                        {
+                            const FloatType* at = head + base;
+                            y0 = SIMD::gather (at, SIMD::sub (idx, one));
+                            y1 = SIMD::gather (at, idx);
+                            y2 = SIMD::gather (at, SIMD::add (idx, one));
+                            y3 = SIMD::gather (at, SIMD::add (idx, two));
+                        }
+                        else if (lo >= headEnd && hi < writeEnd)
+                        {
+                            const auto      mask = static_cast<std::int32_t> (kRingMask);
+                            const simd_type slot = SIMD::add (idx, SIMD::set1<FloatType> (static_cast<FloatType> (static_cast<std::uint64_t> (base) & kRingMask)));
+                            y0 = SIMD::gather (ring, SIMD::sub (slot, one), mask);
+                            y1 = SIMD::gather (ring, slot, mask);
+                            y2 = SIMD::gather (ring, SIMD::add (slot, one), mask);
+                            y3 = SIMD::gather (ring, SIMD::add (slot, two), mask);
+                        }
+                        else
+                        {
+                            starved = gatherScalar (head, ring, base, idx, m, headEnd, writeEnd, frameEnd, y0, y1, y2, y3);
+                        }
+
+                        if (starved > 0)
+                        {
+                            stats.frames += starved;
+                            stats.events += voice.starved ? 0 : 1;
+                        }
+
+                        for (std::size_t l = 0; l < kLanes; ++l)
+                            gains[l] = std::max (FloatType (0), voice.envelope - voice.releaseStep * static_cast<FloatType> (l)) * gain;
+
+                        const simd_type y = SIMD::mul (hermite (y0, y1, y2, y3, frac), SIMD::load_aligned<FloatType> (gains));
+
+                        if (m == kLanes)
+                        {
+                            SIMD::store_unaligned (output + i, SIMD::add (SIMD::load_unaligned<FloatType> (output + i), y));
+                        }
+                        else
+                        {
+                            SIMD::store_aligned (lanes, y);
+                            for (std::size_t l = 0; l < m; ++l)
+                                output[i + l] += lanes[l];
+                        }
+
+                        voice.starved   = starved > 0;
+                        voice.position += voice.increment * static_cast<double> (m);
+                        voice.envelope -= voice.releaseStep * static_cast<FloatType> (m);
+
+                        if (voice.envelope <= FloatType (0))
+                        {
+                            stopVoice (k);
+                            return;
+                        }
+                    }
+
+                    const auto needed = static_cast<std::int64_t> (voice.position) - 1;
+                    stream.readFrame.store (static_cast<std::uint64_t> (std::max<std::int64_t> (0, needed)), std::memory_order_release);
+                }
+
+                /**
+                 * @brief Tap-by-tap fetch for groups that straddle the head, the
+                 *        ring or the sample end. Frames outside the sample read 0.
+                 *
+                 * @details
+                 * A lane whose taps have not been streamed yet gets all-zero
+                 * taps, so it renders silence.
+                 *
+                 * @return Number of starved lanes among the first @p m.
+                 */
+                std::size_t gatherScalar (const FloatType* head,
+                                          const FloatType* ring,
+                                          std::int64_t     base,
+                                          simd_type        idx,
+                                          std::size_t      m,
+                                          std::int64_t     headEnd,
+                                          std::int64_t     writeEnd,
+                                          std::int64_t     frameEnd,
+                                          simd_type&       y0,
+                                          simd_type&       y1,
+                                          simd_type&       y2,
+                                          simd_type&       y3) const noexcept CASPI_NON_BLOCKING
+                {
+                    alignas (16) FloatType idxLanes[kLanes];
+                    alignas (16) FloatType taps[4][kLanes];
+                    SIMD::store_aligned (idxLanes, idx);
+
+                    std::size_t starved = 0;
+
+                    for (std::size_t l = 0; l < kLanes; ++l)
+                    {
+                        bool missing = false;
+
+                        for (std::size_t t = 0; t < 4; ++t)
+                        {
+                            const std::int64_t f = base + static_cast<std::int64_t> (idxLanes[l]) - 1 + static_cast<std::int64_t> (t);
+
+                            if (f < 0 || f >= frameEnd)
+                                taps[t][l] = FloatType (0);
+                            else if (f < headEnd)
+                                taps[t][l] = head[f];
+                            else if (f < writeEnd)
+                                taps[t][l] = ring[static_cast<std::uint64_t> (f) & kRingMask];
+                            else
+                                missing = true;
+                        }
+
+                        if (missing)
+                        {
+                            for (std::size_t t = 0; t < 4; ++t)
+                                taps[t][l] = FloatType (0);
+                            starved += l < m ? 1 : 0;
+                        }
+                    }
+
+                    y0 = SIMD::load_aligned<FloatType> (taps[0]);
+                    y1 = SIMD::load_aligned<FloatType> (taps[1]);
+                    y2 = SIMD::load_aligned<FloatType> (taps[2]);
+                    y3 = SIMD::load_aligned<FloatType> (taps[3]);
+                    return starved;
+                }
+
+                /** @brief Catmull-Rom, same coefficients as WavetableOscillator. */
+                CASPI_ALWAYS_INLINE static simd_type hermite (simd_type y0, simd_type y1, simd_type y2, simd_type y3, simd_type frac) noexcept
+                    CASPI_NON_BLOCKING
+                {
+                    const simd_type half = SIMD::set1<FloatType> (FloatType (0.5));
+
+                    const simd_type c3 = SIMD::mul_add (SIMD::set1<FloatType> (FloatType (1.5)), SIMD::sub (y1, y2),
+                                                        SIMD::mul (half, SIMD::sub (y3, y0)));
+                    const simd_type c2 = SIMD::sub (SIMD::add (y0, SIMD::mul (SIMD::set1<FloatType> (FloatType (2)), y2)),
+                                                    SIMD::mul_add (SIMD::set1<FloatType> (FloatType (2.5)), y1,
+                                                                   SIMD::mul (half, y3)));
+                    const simd_type c1 = SIMD::mul (half, SIMD::sub (y2, y0));
+
+                    simd_type out = SIMD::mul_add (c3, frac, c2);
+                    out           = SIMD::mul_add (out, frac, c1);
+                    return SIMD::mul_add (out, frac, y1);
+                }
+
+                /*************************************************************************
+                 * Parameter initialisation
+                 *************************************************************************/
+
+                void initParameters() CASPI_ALLOCATING
+                {
+                    amplitude.setRange (FloatType (0), FloatType (1));
+                    amplitude.setBaseNormalised (FloatType (1));
+                    amplitude.skip (1000);
+                }
+
+                /*************************************************************************
+                 * State
+                 *************************************************************************/
+
+                std::vector<typename Sample::Ptr> samples;
+                std::vector<FloatType>            rings;    ///< MaxVoices x RingFrames.
+                std::vector<float>                ioBuffer; ///< I/O thread scratch, kReadChunk frames.
+
+                Voice  voices[MaxVoices] {};
+                Stream streams[MaxVoices] {};
+
+                std::uint64_t noteCounter { 0 };
+                FloatType     releaseSeconds { FloatType (0.01) };
+
+                std::atomic<std::uint64_t> underrunFrames { 0 };
+                std::atomic<std::uint64_t> underrunEvents { 0 };
+                std::atomic<std::uint64_t> readErrors { 0 };
+                std::atomic<bool>          streaming { false };
+                std::thread                ioThread;
+        };
+
+    } // namespace Samplers
+} // namespace CASPI
+
+#endif // CASPI_STREAMINGSAMPLER_H
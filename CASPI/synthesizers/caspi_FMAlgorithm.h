@@ -0,0 +1,628 @@
+#ifndef CASPI_FMALGORITHM_H
+#define CASPI_FMALGORITHM_H
+/*************************************************************************
+ * @file caspi_FMAlgorithm.h
+ * @brief FM algorithms with a compile-time topology
+ *
+ * ARCHITECTURE OVERVIEW:
+ *
+ *   FMTopology<Ops, Edges, Outputs> (constexpr edge list + carriers)
+ *        |
+ *        v
+ *   FMAlgorithmDSP<F, Algorithm> (fully unrolled, RT-safe rendering)
+ *
+ * An Algorithm is any type with a `static constexpr FMTopology topology`
+ * member. The execution order is computed at compile time and the
+ * renderer is expanded per operator and per edge, so rendering walks no
+ * adjacency tables. Structural errors (cycles, self-modulation, bad
+ * indices, no carriers) are compile errors.
+ *
+ * FMGraphBuilder::compileAs<Algorithm>() selects the specialised renderer
+ * for a builder graph whose structure matches the algorithm, carrying over
+ * operator configuration and connection depths.
+ *
+ * FMAlgorithms::Dx7<1..32> provides the classic 6-operator layouts.
+ ************************************************************************/
+
+#include "synthesizers/caspi_FMGraph.h"
+
+#include <array>
+#include <utility>
+
+namespace CASPI
+{
+
+    // ============================================================================
+    // Compile-time Topology
+    // ============================================================================
+
+    /**
+     * @brief Structural modulation edge: sourceOperator → targetOperator
+     */
+    struct FMEdge
+    {
+            size_t source;
+            size_t target;
+    };
+
+    /**
+     * @brief constexpr description of an FM operator graph
+     *
+     * Edges are applied in array order; their depths are runtime parameters
+     * of FMAlgorithmDSP (index = position in @c edges).
+     *
+     * @code
+     * struct Stack2
+     * {
+     *     static constexpr FMTopology<2, 1, 1> topology { { { { 1, 0 } } }, { { 0 } } };
+     * };
+     * FMAlgorithmDSP<float, Stack2> dsp (48000.f);
+     * @endcode
+     */
+    template <size_t NumOperators, size_t NumEdges, size_t NumOutputs>
+    struct FMTopology
+    {
+            static constexpr size_t numOperators = NumOperators;
+            static constexpr size_t numEdges     = NumEdges;
+            static constexpr size_t numOutputs   = NumOutputs;
+
+            std::array<FMEdge, NumEdges> edges;
+            std::array<size_t, NumOutputs> outputs;
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Kahn topological order of a constexpr topology.
+         *
+         * Same queue discipline as computeFMExecutionOrder(). Entries past the
+         * processed count are left at numOperators when the graph has a cycle.
+         */
+        template <typename Topology>
+        constexpr std::array<size_t, Topology::numOperators> fmTopologyOrder (const Topology& t)
+        {
+            constexpr size_t n = Topology::numOperators;
+
+            std::array<size_t, n> order {};
+            std::array<size_t, n> inDegree {};
+            std::array<size_t, n> queue {};
+            size_t head = 0;
+            size_t tail = 0;
+            size_t processed = 0;
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                order[i] = n;
+            }
+
+            for (size_t e = 0; e < Topology::numEdges; ++e)
+            {
+                if (t.edges[e].target < n)
+                {
+                    ++inDegree[t.edges[e].target];
+                }
+            }
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                if (inDegree[i] == 0)
+                {
+                    queue[tail++] = i;
+                }
+            }
+
+            while (head < tail)
+            {
+                const size_t current = queue[head++];
+                order[processed++]   = current;
+
+                for (size_t e = 0; e < Topology::numEdges; ++e)
+                {
+                    if (t.edges[e].source == current && t.edges[e].target < n && --inDegree[t.edges[e].target] == 0)
+                    {
+                        queue[tail++] = t.edges[e].target;
+                    }
+                }
+            }
+
+            return order;
+        }
+
+        /**
+         * @brief True when every index is in range, there is no self-modulation,
+         *        no duplicate edge, at least one output, and the graph is acyclic.
+         */
+        template <typename Topology>
+        constexpr bool fmTopologyIsValid (const Topology& t)
+        {
+            constexpr size_t n = Topology::numOperators;
+
+            if (n == 0 || Topology::numOutputs == 0)
+            {
+                return false;
+            }
+
+            for (size_t e = 0; e < Topology::numEdges; ++e)
+            {
+                if (t.edges[e].source >= n || t.edges[e].target >= n || t.edges[e].source == t.edges[e].target)
+                {
+                    return false;
+                }
+                for (size_t f = 0; f < e; ++f)
+                {
+                    if (t.edges[f].source == t.edges[e].source && t.edges[f].target == t.edges[e].target)
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            for (size_t o = 0; o < Topology::numOutputs; ++o)
+            {
+                if (t.outputs[o] >= n)
+                {
+                    return false;
+                }
+            }
+
+            const auto order = fmTopologyOrder (t);
+            return order[n - 1] != n;
+        }
+    } // namespace detail
+
+    // ============================================================================
+    // FMAlgorithmDSP
+    // ============================================================================
+
+    /**
+     * @class FMAlgorithmDSP
+     * @brief FM engine specialised for one compile-time topology
+     *
+     * OVERVIEW:
+     *  Renders the same signal as an FMGraphDSP built from the same graph, but
+     *  the execution order, routing and output mix are expanded at compile
+     *  time. Operators are held by value; per-sample modulation lives in a
+     *  local array the compiler can keep in registers.
+     *
+     * REAL-TIME SAFETY / THREADING:
+     *  - Same model as FMGraphDSP: no allocation, locking or system calls;
+     *    not thread-safe.
+     *
+     * NUMERICAL NOTES:
+     *  - Accumulation and mixing order follow FMGraphDSP, so output matches
+     *    it sample for sample (up to FMA contraction).
+     *
+     * @tparam FloatType  float or double.
+     * @tparam Algorithm  Type with a static constexpr FMTopology member named topology.
+     */
+    template <CASPI_FLOAT_TYPE FloatType, typename Algorithm>
+    class FMAlgorithmDSP
+        : public Core::Producer<FMAlgorithmDSP<FloatType, Algorithm>, FloatType, Core::Traversal::PerFrame>
+    {
+            using TopologyType = typename std::decay<decltype (Algorithm::topology)>::type;
+
+        public:
+            static constexpr size_t kNumOperators = TopologyType::numOperators;
+            static constexpr size_t kNumEdges     = TopologyType::numEdges;
+            static constexpr size_t kNumOutputs   = TopologyType::numOutputs;
+
+            CASPI_STATIC_ASSERT (detail::fmTopologyIsValid (Algorithm::topology),
+                                 "FMAlgorithmDSP: topology must be acyclic, in range, free of self-modulation and have an output");
+
+            /// Operator execution order, computed at compile time.
+            static constexpr std::array<size_t, kNumOperators> kExecutionOrder = detail::fmTopologyOrder (Algorithm::topology);
+
+            /**
+             * @brief Constructs with default operators (440 Hz, index 1, depth 1, PM) and unit edge depths.
+             */
+            explicit FMAlgorithmDSP (FloatType sampleRate)
+                : FMAlgorithmDSP (defaultConfigs(), unitDepths(), sampleRate)
+            {
+            }
+
+            /**
+             * @brief Constructs from operator configurations and per-edge depths.
+             *
+             * @param operatorConfigs One configuration per operator.
+             * @param edgeDepths Modulation depth per topology edge.
+             * @param sampleRate Initial sample rate in Hz.
+             */
+            FMAlgorithmDSP (const std::vector<OperatorConfig<FloatType>>& operatorConfigs,
+                            const std::array<float, kNumEdges>& edgeDepths,
+                            FloatType sampleRate)
+                : edgeDepths_ (edgeDepths),
+                  baseFrequency_ (FloatType (440)),
+                  outputGain_ (FloatType (1)),
+                  autoScaleOutputs_ (true)
+            {
+                CASPI_ASSERT (sampleRate > 0 && std::isfinite (sampleRate),
+                              "Sample rate must be positive and finite");
+                CASPI_ASSERT (operatorConfigs.size() == kNumOperators,
+                              "Operator config count must match the topology");
+
+                for (size_t i = 0; i < kNumOperators && i < operatorConfigs.size(); ++i)
+                {
+                    const auto& config = operatorConfigs[i];
+                    auto& op           = operators_[i];
+                    op.setSampleRate (sampleRate);
+                    op.setFrequency (config.frequency);
+                    op.setModulationIndex (config.modulationIndex);
+                    op.setModulationDepth (config.modulationDepth);
+                    op.setModulationFeedback (config.modulationFeedback);
+                    op.setModulationMode (config.modulationMode);
+                }
+
+                updateEffectiveGain();
+
+                // Store sample rate via NodeBase (fires onSampleRateChanged).
+                this->setSampleRate (sampleRate);
+            }
+
+            FMAlgorithmDSP (const FMAlgorithmDSP&)            = delete;
+            FMAlgorithmDSP& operator= (const FMAlgorithmDSP&) = delete;
+            FMAlgorithmDSP (FMAlgorithmDSP&&)                 = default;
+            FMAlgorithmDSP& operator= (FMAlgorithmDSP&&)      = default;
+
+            /**
+             * @brief Returns true if a runtime graph has exactly this topology.
+             *
+             * Edges and outputs are compared as sets; edge order and output order
+             * may differ.
+             */
+            static bool matchesGraph (const size_t numOperators,
+                                      const std::vector<ModulationConnection>& connections,
+                                      const std::vector<size_t>& outputOperators) CASPI_NON_BLOCKING
+            {
+                if (numOperators != kNumOperators || connections.size() != kNumEdges
+                    || outputOperators.size() != kNumOutputs)
+                {
+                    return false;
+                }
+
+                for (const auto& edge : Algorithm::topology.edges)
+                {
+                    if (findConnection (connections, edge) == connections.size())
+                    {
+                        return false;
+                    }
+                }
+
+                for (size_t out : Algorithm::topology.outputs)
+                {
+                    if (std::find (outputOperators.begin(), outputOperators.end(), out) == outputOperators.end())
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            /**
+             * @brief Collects per-edge depths from a graph accepted by matchesGraph().
+             */
+            static std::array<float, kNumEdges> edgeDepthsFrom (const std::vector<ModulationConnection>& connections) CASPI_NON_BLOCKING
+            {
+                std::array<float, kNumEdges> depths {};
+                for (size_t e = 0; e < kNumEdges; ++e)
+                {
+                    const size_t c = findConnection (connections, Algorithm::topology.edges[e]);
+                    depths[e]      = (c < connections.size()) ? connections[c].modulationDepth : 0.0f;
+                }
+                return depths;
+            }
+
+            /*------------------------------------------------------------------
+             * NodeBase hooks
+             *-----------------------------------------------------------------*/
+
+            void onSampleRateChanged (FloatType newRate) noexcept override
+            {
+                for (auto& op : operators_)
+                {
+                    op.setSampleRate (newRate);
+                }
+            }
+
+            void onPrepare (std::size_t, std::size_t, double) noexcept {}
+
+            /*------------------------------------------------------------------
+             * Parameters
+             *-----------------------------------------------------------------*/
+
+            CASPI_NO_DISCARD
+            Operator<FloatType>* getOperator (const size_t index) CASPI_NON_BLOCKING
+            {
+                CASPI_EXPECT (index < kNumOperators, "Operator index out of range in getOperator");
+                return (index < kNumOperators) ? &operators_[index] : nullptr;
+            }
+
+            CASPI_NO_DISCARD
+            const Operator<FloatType>* getOperator (const size_t index) const CASPI_NON_BLOCKING
+            {
+                return (index < kNumOperators) ? &operators_[index] : nullptr;
+            }
+
+            /**
+             * @brief Sets the base frequency applied to all operators.
+             */
+            void setFrequency (const FloatType frequency) CASPI_NON_BLOCKING
+            {
+                baseFrequency_ = frequency;
+                for (auto& op : operators_)
+                {
+                    op.setFrequency (frequency);
+                }
+            }
+
+            CASPI_NO_DISCARD
+            FloatType getFrequency() const CASPI_NON_BLOCKING
+            {
+                return baseFrequency_;
+            }
+
+            /**
+             * @brief Updates the depth of a topology edge.
+             *
+             * @param edgeIndex Position of the edge in Algorithm::topology.edges.
+             * @param depth New modulation depth.
+             */
+            void setEdgeDepth (const size_t edgeIndex, const FloatType depth) CASPI_NON_BLOCKING
+            {
+                CASPI_EXPECT (edgeIndex < kNumEdges, "Edge index out of range in setEdgeDepth");
+                if (edgeIndex < kNumEdges)
+                {
+                    edgeDepths_[edgeIndex] = static_cast<float> (depth);
+                }
+            }
+
+            CASPI_NO_DISCARD
+            FloatType getEdgeDepth (const size_t edgeIndex) const CASPI_NON_BLOCKING
+            {
+                return (edgeIndex < kNumEdges) ? static_cast<FloatType> (edgeDepths_[edgeIndex]) : FloatType (0);
+            }
+
+            void noteOn() CASPI_NON_BLOCKING
+            {
+                for (auto& op : operators_)
+                {
+                    op.noteOn();
+                }
+            }
+
+            void noteOff() CASPI_NON_BLOCKING
+            {
+                for (auto& op : operators_)
+                {
+                    op.noteOff();
+                }
+            }
+
+            void setOutputGain (const FloatType gain) CASPI_NON_BLOCKING
+            {
+                outputGain_ = gain;
+                updateEffectiveGain();
+            }
+
+            CASPI_NO_DISCARD
+            FloatType getOutputGain() const CASPI_NON_BLOCKING
+            {
+                return outputGain_;
+            }
+
+            void setAutoScaleOutputs (const bool enable) CASPI_NON_BLOCKING
+            {
+                autoScaleOutputs_ = enable;
+                updateEffectiveGain();
+            }
+
+            /**
+             * @brief Resets all operator state.
+             */
+            void reset() CASPI_NON_BLOCKING
+            {
+                for (auto& op : operators_)
+                {
+                    op.reset();
+                }
+            }
+
+            /*------------------------------------------------------------------
+             * Rendering
+             *-----------------------------------------------------------------*/
+
+            CASPI_NO_DISCARD
+            FloatType renderSample() CASPI_NON_BLOCKING override
+            {
+                Core::ScopedFlushDenormals flush{};
+                return computeFrame (std::make_index_sequence<kNumOperators> {},
+                                     std::make_index_sequence<kNumOutputs> {});
+            }
+
+            CASPI_NO_DISCARD
+            FloatType renderSample (const std::size_t channel,
+                                    const std::size_t frame) CASPI_NON_BLOCKING override
+            {
+                (void) channel;
+                (void) frame;
+                return renderSample();
+            }
+
+            /**
+             * @brief Renders a block of samples. The denormal guard is held once for the call.
+             */
+            void renderBlock (FloatType* buffer, const size_t numSamples) CASPI_NON_BLOCKING
+            {
+                Core::ScopedFlushDenormals flush{};
+                for (size_t i = 0; i < numSamples; ++i)
+                {
+                    buffer[i] = computeFrame (std::make_index_sequence<kNumOperators> {},
+                                              std::make_index_sequence<kNumOutputs> {});
+                }
+            }
+
+            CASPI_NO_DISCARD
+            static constexpr size_t getNumOperators() noexcept
+            {
+                return kNumOperators;
+            }
+
+        private:
+            using Signals = std::array<FloatType, kNumOperators>;
+
+            static size_t findConnection (const std::vector<ModulationConnection>& connections, const FMEdge& edge) noexcept
+            {
+                for (size_t c = 0; c < connections.size(); ++c)
+                {
+                    if (connections[c].sourceOperator == edge.source && connections[c].targetOperator == edge.target)
+                    {
+                        return c;
+                    }
+                }
+                return connections.size();
+            }
+
+            static std::vector<OperatorConfig<FloatType>> defaultConfigs()
+            {
+                return std::vector<OperatorConfig<FloatType>> (
+                    kNumOperators,
+                    OperatorConfig<FloatType> { FloatType (440), FloatType (1), FloatType (1), FloatType (0), ModulationMode::Phase });
+            }
+
+            static std::array<float, kNumEdges> unitDepths() noexcept
+            {
+                std::array<float, kNumEdges> depths {};
+                depths.fill (1.0f);
+                return depths;
+            }
+
+            template <size_t... Step, size_t... Out>
+            CASPI_ALWAYS_INLINE FloatType computeFrame (std::index_sequence<Step...>,
+                                                        std::index_sequence<Out...>) CASPI_NON_BLOCKING
+            {
+                Signals modulation {};
+                Signals outputs {};
+
+                (renderOperator<kExecutionOrder[Step]> (modulation, outputs), ...);
+
+                FloatType mix = FloatType (0);
+                ((mix += outputs[Algorithm::topology.outputs[Out]]), ...);
+                return mix * effectiveGain_;
+            }
+
+            template <size_t Op>
+            CASPI_ALWAYS_INLINE void renderOperator (Signals& modulation, Signals& outputs) CASPI_NON_BLOCKING
+            {
+                outputs[Op] = operators_[Op].renderSampleUnguarded (modulation[Op]);
+                routeEdges<Op> (outputs[Op], modulation, std::make_index_sequence<kNumEdges> {});
+            }
+
+            template <size_t Op, size_t... Edge>
+            CASPI_ALWAYS_INLINE void routeEdges (CASPI_MAYBE_UNUSED const FloatType out, CASPI_MAYBE_UNUSED Signals& modulation, std::index_sequence<Edge...>) CASPI_NON_BLOCKING
+            {
+                (routeEdge<Op, Edge> (out, modulation), ...);
+            }
+
+            template <size_t Op, size_t Edge>
+            CASPI_ALWAYS_INLINE void routeEdge (const FloatType out, Signals& modulation) CASPI_NON_BLOCKING
+            {
+                CASPI_CPP17_IF_CONSTEXPR (Algorithm::topology.edges[Edge].source == Op)
+                {
+                    modulation[Algorithm::topology.edges[Edge].target] += out * static_cast<FloatType> (edgeDepths_[Edge]);
+                }
+            }
+
+            void updateEffectiveGain() CASPI_NON_BLOCKING
+            {
+                FloatType scale = FloatType (1);
+
+                if (autoScaleOutputs_ && kNumOutputs > 1)
+                {
+                    scale = FloatType (1) / static_cast<FloatType> (kNumOutputs);
+                }
+
+                effectiveGain_ = outputGain_ * scale;
+            }
+
+            // ====================================================================
+            // Member Variables
+            // ====================================================================
+
+            std::array<Operator<FloatType>, kNumOperators> operators_;
+            std::array<float, kNumEdges> edgeDepths_;
+
+            FloatType baseFrequency_;
+            FloatType outputGain_;
+            FloatType effectiveGain_ = FloatType (1);
+            bool autoScaleOutputs_;
+    };
+
+    // ============================================================================
+    // DX7 Algorithms
+    // ============================================================================
+
+    /**
+     * @brief The 32 Yamaha DX7 6-operator algorithms as constexpr topologies.
+     *
+     * Operators are 0-based here: DX7 operator k is index k - 1 (index 0 is the
+     * bottom carrier). feedbackOperator is the operator carrying the algorithm's
+     * feedback loop. Algorithms 4 and 6 loop through several operators on the
+     * DX7; an acyclic graph approximates that with self-feedback on the top
+     * operator of the loop.
+     */
+    namespace FMAlgorithms
+    {
+        template <int Number>
+        struct Dx7;
+
+#define CASPI_DX7_ALGORITHM(number, numEdges, numOutputs, feedback, edgeList, outputList)  \
+    template <>                                                                           \
+    struct Dx7<number>                                                                    \
+    {                                                                                     \
+            static constexpr FMTopology<6, numEdges, numOutputs> topology { edgeList, outputList }; \
+            static constexpr size_t feedbackOperator = feedback;                          \
+    }
+
+#define CASPI_DX7_EDGES(...)   { { __VA_ARGS__ } }
+#define CASPI_DX7_OUTPUTS(...) { { __VA_ARGS__ } }
+
+        CASPI_DX7_ALGORITHM (1, 4, 2, 5, CASPI_DX7_EDGES ({ 1, 0 }, { 5, 4 }, { 4, 3 }, { 3, 2 }), CASPI_DX7_OUTPUTS (0, 2));
+        CASPI_DX7_ALGORITHM (2, 4, 2, 1, CASPI_DX7_EDGES ({ 1, 0 }, { 5, 4 }, { 4, 3 }, { 3, 2 }), CASPI_DX7_OUTPUTS (0, 2));
+        CASPI_DX7_ALGORITHM (3, 4, 2, 5, CASPI_DX7_EDGES ({ 2, 1 }, { 1, 0 }, { 5, 4 }, { 4, 3 }), CASPI_DX7_OUTPUTS (0, 3));
+        CASPI_DX7_ALGORITHM (4, 4, 2, 5, CASPI_DX7_EDGES ({ 2, 1 }, { 1, 0 }, { 5, 4 }, { 4, 3 }), CASPI_DX7_OUTPUTS (0, 3));
+        CASPI_DX7_ALGORITHM (5, 3, 3, 5, CASPI_DX7_EDGES ({ 1, 0 }, { 3, 2 }, { 5, 4 }), CASPI_DX7_OUTPUTS (0, 2, 4));
+        CASPI_DX7_ALGORITHM (6, 3, 3, 5, CASPI_DX7_EDGES ({ 1, 0 }, { 3, 2 }, { 5, 4 }), CASPI_DX7_OUTPUTS (0, 2, 4));
+        CASPI_DX7_ALGORITHM (7, 4, 2, 5, CASPI_DX7_EDGES ({ 1, 0 }, { 3, 2 }, { 4, 2 }, { 5, 4 }), CASPI_DX7_OUTPUTS (0, 2));
+        CASPI_DX7_ALGORITHM (8, 4, 2, 3, CASPI_DX7_EDGES ({ 1, 0 }, { 3, 2 }, { 4, 2 }, { 5, 4 }), CASPI_DX7_OUTPUTS (0, 2));
+        CASPI_DX7_ALGORITHM (9, 4, 2, 1, CASPI_DX7_EDGES ({ 1, 0 }, { 3, 2 }, { 4, 2 }, { 5, 4 }), CASPI_DX7_OUTPUTS (0, 2));
+        CASPI_DX7_ALGORITHM (10, 4, 2, 2, CASPI_DX7_EDGES ({ 2, 1 }, { 1, 0 }, { 4, 3 }, { 5, 3 }), CASPI_DX7_OUTPUTS (0, 3));
+        CASPI_DX7_ALGORITHM (11, 4, 2, 5, CASPI_DX7_EDGES ({ 2, 1 }, { 1, 0 }, { 4, 3 }, { 5, 3 }), CASPI_DX7_OUTPUTS (0, 3));
+        CASPI_DX7_ALGORITHM (12, 4, 2, 1, CASPI_DX7_EDGES ({ 1, 0 }, { 3, 2 }, { 4, 2 }, { 5, 2 }), CASPI_DX7_OUTPUTS (0, 2));
+        CASPI_DX7_ALGORITHM (13, 4, 2, 5, CASPI_DX7_EDGES ({ 1, 0 }, { 3, 2 }, { 4, 2 }, { 5, 2 }), CASPI_DX7_OUTPUTS (0, 2));
+        CASPI_DX7_ALGORITHM (14, 4, 2, 5, CASPI_DX7_EDGES ({ 1, 0 }, { 3, 2 }, { 4, 3 }, { 5, 3 }), CASPI_DX7_OUTPUTS (0, 2));
+        CASPI_DX7_ALGORITHM (15, 4, 2, 1, CASPI_DX7_EDGES ({ 1, 0 }, { 3, 2 }, { 4, 3 }, { 5, 3 }), CASPI_DX7_OUTPUTS (0, 2));
+        CASPI_DX7_ALGORITHM (16, 5, 1, 5, CASPI_DX7_EDGES ({ 1, 0 }, { 2, 0 }, { 3, 2 }, { 4, 0 }, { 5, 4 }), CASPI_DX7_OUTPUTS (0));
+        CASPI_DX7_ALGORITHM (17, 5, 1, 1, CASPI_DX7_EDGES ({ 1, 0 }, { 2, 0 }, { 3, 2 }, { 4, 0 }, { 5, 4 }), CASPI_DX7_OUTPUTS (0));
+        CASPI_DX7_ALGORITHM (18, 5, 1, 2, CASPI_DX7_EDGES ({ 1, 0 }, { 2, 0 }, { 3, 0 }, { 4, 3 }, { 5, 4 }), CASPI_DX7_OUTPUTS (0));
+        CASPI_DX7_ALGORITHM (19, 4, 3, 5, CASPI_DX7_EDGES ({ 2, 1 }, { 1, 0 }, { 5, 3 }, { 5, 4 }), CASPI_DX7_OUTPUTS (0, 3, 4));
+        CASPI_DX7_ALGORITHM (20, 4, 3, 2, CASPI_DX7_EDGES ({ 2, 0 }, { 2, 1 }, { 4, 3 }, { 5, 3 }), CASPI_DX7_OUTPUTS (0, 1, 3));
+        CASPI_DX7_ALGORITHM (21, 4, 4, 2, CASPI_DX7_EDGES ({ 2, 0 }, { 2, 1 }, { 5, 3 }, { 5, 4 }), CASPI_DX7_OUTPUTS (0, 1, 3, 4));
+        CASPI_DX7_ALGORITHM (22, 4, 4, 5, CASPI_DX7_EDGES ({ 1, 0 }, { 5, 2 }, { 5, 3 }, { 5, 4 }), CASPI_DX7_OUTPUTS (0, 2, 3, 4));
+        CASPI_DX7_ALGORITHM (23, 3, 4, 5, CASPI_DX7_EDGES ({ 2, 1 }, { 5, 3 }, { 5, 4 }), CASPI_DX7_OUTPUTS (0, 1, 3, 4));
+        CASPI_DX7_ALGORITHM (24, 3, 5, 5, CASPI_DX7_EDGES ({ 5, 2 }, { 5, 3 }, { 5, 4 }), CASPI_DX7_OUTPUTS (0, 1, 2, 3, 4));
+        CASPI_DX7_ALGORITHM (25, 2, 5, 5, CASPI_DX7_EDGES ({ 5, 3 }, { 5, 4 }), CASPI_DX7_OUTPUTS (0, 1, 2, 3, 4));
+        CASPI_DX7_ALGORITHM (26, 3, 3, 5, CASPI_DX7_EDGES ({ 2, 1 }, { 4, 3 }, { 5, 3 }), CASPI_DX7_OUTPUTS (0, 1, 3));
+        CASPI_DX7_ALGORITHM (27, 3, 3, 2, CASPI_DX7_EDGES ({ 2, 1 }, { 4, 3 }, { 5, 3 }), CASPI_DX7_OUTPUTS (0, 1, 3));
+        CASPI_DX7_ALGORITHM (28, 3, 3, 4, CASPI_DX7_EDGES ({ 1, 0 }, { 3, 2 }, { 4, 3 }), CASPI_DX7_OUTPUTS (0, 2, 5));
+        CASPI_DX7_ALGORITHM (29, 2, 4, 5, CASPI_DX7_EDGES ({ 3, 2 }, { 5, 4 }), CASPI_DX7_OUTPUTS (0, 1, 2, 4));
+        CASPI_DX7_ALGORITHM (30, 2, 4, 4, CASPI_DX7_EDGES ({ 3, 2 }, { 4, 3 }), CASPI_DX7_OUTPUTS (0, 1, 2, 5));
+        CASPI_DX7_ALGORITHM (31, 1, 5, 5, CASPI_DX7_EDGES ({ 5, 4 }), CASPI_DX7_OUTPUTS (0, 1, 2, 3, 4));
+        CASPI_DX7_ALGORITHM (32, 0, 6, 5, {}, CASPI_DX7_OUTPUTS (0, 1, 2, 3, 4, 5));
+
+#undef CASPI_DX7_OUTPUTS
+#undef CASPI_DX7_EDGES
+#undef CASPI_DX7_ALGORITHM
+    } // namespace FMAlgorithms
+
+} // namespace CASPI
+
+#endif // CASPI_FMALGORITHM_H
@@ -10,6 +10,7 @@
  *        |
  *        v
  *   FMGraphDSP (Immutable topology, RT-safe rendering)
+ *   FMGraphPolyDSP (Same topology, MaxVoices voices in SIMD lanes)
  *
  * FMGraphBuilder:
  *  - Intended for configuration and validation only
@@ -33,12 +34,17 @@
 
 #include "base/caspi_Compatibility.h"
 #include "base/caspi_Denormals.h"
+#include "base/caspi_SIMD.h"
+#include "controls/caspi_EnvelopeBank.h"
 #include "core/caspi_Producer.h"
 #include "core/caspi_Expected.h"
+#include "filters/caspi_HalfbandDecimator.h"
 #include "oscillators/caspi_Operator.h"
 
 #include <algorithm>
-#include <memory>
+#include <array>
+#include <cstdint>
+#include <limits>
 #include <queue>
 #include <vector>
 
@@ -64,7 +70,8 @@ namespace CASPI
         InvalidConnection,
         NoOutputOperators,
         AllocationFailure,
-        GraphNotCompiled
+        GraphNotCompiled,
+        TopologyMismatch
     };
 
     inline const char* errorToString (FMGraphError error)
@@ -85,11 +92,30 @@ namespace CASPI
                 return "Memory allocation failure";
             case FMGraphError::GraphNotCompiled:
                 return "Graph not compiled";
+            case FMGraphError::TopologyMismatch:
+                return "Graph does not match the requested algorithm topology";
             default:
                 return "Unknown error";
         }
     }
 
+    // ============================================================================
+    // Oversampling
+    // ============================================================================
+
+    /**
+     * @brief Rate at which FMGraphDSP runs its operators, relative to the host
+     *
+     * Only the operators pay for the higher rate; the result is brought back
+     * to the host rate by cascaded polyphase halfband decimators.
+     */
+    enum class FMOversampling : size_t
+    {
+        None = 1, ///< Operators run at the host rate
+        X2   = 2, ///< One 2:1 halfband stage
+        X4   = 4  ///< Two cascaded 2:1 halfband stages
+    };
+
     // ============================================================================
     // Connection Representation
     // ============================================================================
@@ -131,13 +157,147 @@ namespace CASPI
             ModulationMode modulationMode;
     };
 
+    // ============================================================================
+    // Topology helpers (shared by the compiled runtimes)
+    // ============================================================================
+
+    namespace detail
+    {
+        /**
+         * @brief Flat (CSR) outgoing-edge table for a modulation graph.
+         *
+         * Edges leaving operator i occupy [offsets[i], offsets[i + 1]) in
+         * targets/depths. connectionToFlat maps an index into the builder's
+         * connection list to its slot, for O(1) depth updates.
+         */
+        struct FMAdjacency
+        {
+                std::vector<size_t> targets;
+                std::vector<float> depths;
+                std::vector<size_t> offsets;
+                std::vector<size_t> connectionToFlat;
+        };
+
+        /**
+         * @brief Kahn topological sort of the operators. Requires an acyclic graph.
+         */
+        inline std::vector<size_t> computeFMExecutionOrder (const size_t n,
+                                                            const std::vector<ModulationConnection>& connections) CASPI_ALLOCATING
+        {
+            std::vector<size_t> order;
+            if (n == 0)
+            {
+                return order;
+            }
+
+            std::vector<int> inDegree (n, 0);
+            std::vector<std::vector<size_t>> adjacencyList (n);
+
+            for (const auto& conn : connections)
+            {
+                CASPI_ASSERT (conn.sourceOperator < n,
+                              "Connection source out of range in computeFMExecutionOrder");
+                CASPI_ASSERT (conn.targetOperator < n,
+                              "Connection target out of range in computeFMExecutionOrder");
+                adjacencyList[conn.sourceOperator].push_back (conn.targetOperator);
+                ++inDegree[conn.targetOperator];
+            }
+
+            std::queue<size_t> queue;
+            for (size_t i = 0; i < n; ++i)
+            {
+                if (inDegree[i] == 0)
+                {
+                    queue.push (i);
+                }
+            }
+
+            order.reserve (n);
+
+            while (! queue.empty())
+            {
+                const size_t current = queue.front();
+                queue.pop();
+                order.push_back (current);
+
+                for (size_t neighbor : adjacencyList[current])
+                {
+                    if (--inDegree[neighbor] == 0)
+                    {
+                        queue.push (neighbor);
+                    }
+                }
+            }
+            CASPI_ENSURE (order.size() == n,
+                          "Topological sort didn't process all nodes");
+            return order;
+        }
+
+        /**
+         * @brief Builds the CSR outgoing-edge table, preserving connection order per source.
+         */
+        inline FMAdjacency buildFMAdjacency (const size_t n,
+                                             const std::vector<ModulationConnection>& connections) CASPI_ALLOCATING
+        {
+            FMAdjacency adjacency;
+            if (n == 0)
+            {
+                return adjacency;
+            }
+
+            // Count outgoing connections per operator
+            std::vector<size_t> counts (n, 0);
+            for (const auto& conn : connections)
+            {
+                CASPI_ASSERT (conn.sourceOperator < n,
+                              "Connection source out of range in buildFMAdjacency");
+                ++counts[conn.sourceOperator];
+            }
+
+            // Build offset array (prefix sum)
+            adjacency.offsets.resize (n + 1);
+            adjacency.offsets[0] = 0;
+            for (size_t i = 0; i < n; ++i)
+            {
+                adjacency.offsets[i + 1] = adjacency.offsets[i] + counts[i];
+            }
+
+            const size_t totalConnections = connections.size();
+            adjacency.targets.resize (totalConnections);
+            adjacency.depths.resize (totalConnections);
+            adjacency.connectionToFlat.resize (totalConnections);
+
+            // Fill flat arrays
+            std::vector<size_t> positions = adjacency.offsets; // Working copy for insertion
+            for (size_t connIdx = 0; connIdx < totalConnections; ++connIdx)
+            {
+                const auto& conn     = connections[connIdx];
+                const size_t flatIdx = positions[conn.sourceOperator]++;
+
+                CASPI_ASSERT (flatIdx < totalConnections, "Flat index out of range");
+                CASPI_ASSERT (conn.targetOperator < n, "Connection target out of range");
+
+                adjacency.targets[flatIdx]          = conn.targetOperator;
+                adjacency.depths[flatIdx]           = conn.modulationDepth;
+                adjacency.connectionToFlat[connIdx] = flatIdx;
+            }
+            return adjacency;
+        }
+    } // namespace detail
+
     // ============================================================================
     // Forward Declarations
     // ============================================================================
 
-    template <typename FloatType>
+    template <CASPI_FLOAT_TYPE FloatType>
     class FMGraphDSP;
 
+    template <CASPI_FLOAT_TYPE FloatType, size_t MaxVoices>
+    class FMGraphPolyDSP;
+
+    template <CASPI_FLOAT_TYPE FloatType, typename Algorithm>
+    class FMAlgorithmDSP;
+
     // ============================================================================
     // FMGraphBuilder
     // ============================================================================
@@ -494,6 +654,69 @@ namespace CASPI
                 }
             }
 
+            /**
+             * @brief Compile into a polyphonic FMGraphPolyDSP with MaxVoices SIMD lanes
+             *
+             * Same validation and allocation rules as compile().
+             */
+            template <size_t MaxVoices>
+            ResultValue<FMGraphPolyDSP<FloatType, MaxVoices>>
+                compilePoly (const FloatType sampleRate) const
+            {
+                auto validationResult = validate();
+                if (! validationResult.has_value())
+                    return make_unexpected<FMGraphPolyDSP<FloatType, MaxVoices>, Error, NonRealTimeSafe> (
+                        validationResult.error());
+
+                try
+                {
+                    FMGraphPolyDSP<FloatType, MaxVoices> dsp (
+                        operators_,
+                        connections_,
+                        outputOperators_,
+                        sampleRate);
+
+                    return ResultValue<FMGraphPolyDSP<FloatType, MaxVoices>> (std::move (dsp));
+                }
+                catch (...)
+                {
+                    return make_unexpected<FMGraphPolyDSP<FloatType, MaxVoices>, Error, NonRealTimeSafe> (
+                        Error::AllocationFailure);
+                }
+            }
+
+            /**
+             * @brief Compile into the unrolled FMAlgorithmDSP for a compile-time topology
+             *
+             * Requires caspi_FMAlgorithm.h. The builder graph must have exactly the
+             * operators, edges and outputs of Algorithm::topology; otherwise
+             * TopologyMismatch is returned. Operator configuration and connection
+             * depths are carried over.
+             */
+            template <typename Algorithm>
+            ResultValue<FMAlgorithmDSP<FloatType, Algorithm>>
+                compileAs (const FloatType sampleRate) const
+            {
+                using DSP = FMAlgorithmDSP<FloatType, Algorithm>;
+
+                auto validationResult = validate();
+                if (! validationResult.has_value())
+                    return make_unexpected<DSP, Error, NonRealTimeSafe> (validationResult.error());
+
+                if (! DSP::matchesGraph (operators_.size(), connections_, outputOperators_))
+                    return make_unexpected<DSP, Error, NonRealTimeSafe> (Error::TopologyMismatch);
+
+                try
+                {
+                    DSP dsp (operators_, DSP::edgeDepthsFrom (connections_), sampleRate);
+                    return ResultValue<DSP> (std::move (dsp));
+                }
+                catch (...)
+                {
+                    return make_unexpected<DSP, Error, NonRealTimeSafe> (Error::AllocationFailure);
+                }
+            }
+
             // ====================================================================
             // Inspection
             // ====================================================================
@@ -550,9 +773,24 @@ namespace CASPI
      *  - Denormal handling is the responsibility of the caller or platform
      *
      * SIMD / OPTIMIZATION NOTES:
-     *  - Current implementation is scalar
-     *  - Internal layout is intentionally contiguous to allow future SIMD
-     *    or block-based vectorization without changing public API
+     *  - renderSample() is sample-major: every operator is evaluated once per
+     *    sample, in execution order.
+     *  - renderBlock() is operator-major: the block is split into chunks of
+     *    kRenderChunk frames and each operator renders a whole chunk before
+     *    the next operator runs. Modulation routing and output mixing are
+     *    then SIMD span operations rather than per-sample scatters.
+     *  - Operator-major order is always valid because the builder rejects
+     *    cycles; operator self-feedback stays inside Operator's own loop.
+     *  - Both paths produce the same output (up to FMA contraction).
+     *
+     * OVERSAMPLING:
+     *  - setOversampling() runs the operators at 2× or 4× the host rate to
+     *    keep high modulation indices from aliasing. The oversampled chunk
+     *    is decimated back with polyphase halfband FIRs (SIMD across output
+     *    frames); nothing outside the graph runs at the higher rate.
+     *  - While oversampling, renderSample() goes through the block path one
+     *    frame at a time, so both paths still agree.
+     *  - The decimators add getLatency() frames of delay at the host rate.
      *
      * ERROR HANDLING:
      *  - Construction is expected to be validated by FMGraphBuilder
@@ -592,19 +830,19 @@ namespace CASPI
 
                 for (const auto& config : operatorConfigs)
                 {
-                    auto op = CASPI::make_unique<Operator<FloatType>> (
-                        sampleRate,
-                        config.frequency,
-                        config.modulationIndex,
-                        config.modulationDepth,
-                        config.modulationFeedback,
-                        config.modulationMode);
-                    CASPI_ASSERT (op != nullptr, "Failed to create operator");
-                    operators_.push_back (std::move (op));
+                    operators_.emplace_back (sampleRate,
+                                             config.frequency,
+                                             config.modulationIndex,
+                                             config.modulationDepth,
+                                             config.modulationFeedback,
+                                             config.modulationMode);
                 }
 
                 modulationSignals_.resize (n, FloatType (0));
                 operatorOutputs_.resize   (n, FloatType (0));
+                blockModulation_.resize   (n * kRenderChunk, FloatType (0));
+                blockOutputs_.resize      (n * kRenderChunk, FloatType (0));
+                oversampledBlock_.resize  (kRenderChunk * static_cast<size_t> (FMOversampling::X4), FloatType (0));
 
                 computeExecutionOrder();
                 buildAdjacencyList();
@@ -614,6 +852,9 @@ namespace CASPI
                 this->setSampleRate (sampleRate);
             }
 
+            /// Frames rendered per operator before moving to the next one in renderBlock().
+            static constexpr size_t kRenderChunk = 64;
+
             FMGraphDSP (const FMGraphDSP&)            = delete;
             FMGraphDSP& operator= (const FMGraphDSP&) = delete;
             FMGraphDSP (FMGraphDSP&&)                 = default;
@@ -629,12 +870,10 @@ namespace CASPI
              */
             void onSampleRateChanged (FloatType newRate) noexcept override
             {
+                const FloatType operatorRate = newRate * static_cast<FloatType> (getOversamplingFactor());
                 for (auto& op : operators_)
                 {
-                    if (op != nullptr)
-                    {
-                        op->setSampleRate (newRate);
-                    }
+                    op.setSampleRate (operatorRate);
                 }
             }
 
@@ -652,7 +891,7 @@ namespace CASPI
             Operator<FloatType>* getOperator (const size_t index) CASPI_NON_BLOCKING
             {
                 CASPI_EXPECT(index < operators_.size(), "Operator index out of range in getOperator");
-                return (index < operators_.size()) ? operators_[index].get() : nullptr;
+                return (index < operators_.size()) ? &operators_[index] : nullptr;
             }
 
             /**
@@ -664,7 +903,7 @@ namespace CASPI
             CASPI_NO_DISCARD 
             const Operator<FloatType>* getOperator (const size_t index) const CASPI_NON_BLOCKING
             {
-                return (index < operators_.size()) ? operators_[index].get() : nullptr;
+                return (index < operators_.size()) ? &operators_[index] : nullptr;
             }
 
             /**
@@ -677,7 +916,7 @@ namespace CASPI
                 baseFrequency_ = frequency;
                 for (auto& op : operators_)
                 {
-                    op->setFrequency (frequency);
+                    op.setFrequency (frequency);
                 }
             }
 
@@ -691,6 +930,59 @@ namespace CASPI
                 return baseFrequency_;
             }
 
+            /**
+             * @brief Selects the sine evaluation of every operator.
+             *
+             * @param evaluation SineEvaluation::Exact (std::sin) or SineEvaluation::Polynomial.
+             */
+            void setSineEvaluation (const SineEvaluation evaluation) CASPI_NON_BLOCKING
+            {
+                for (auto& op : operators_)
+                {
+                    op.setSineEvaluation (evaluation);
+                }
+            }
+
+            /**
+             * @brief Runs the operators at 1×, 2× or 4× the host sample rate.
+             *
+             * Re-rates every operator and clears the decimator history. No
+             * allocation: the oversampled scratch is sized for X4 at construction.
+             *
+             * @param factor Oversampling factor.
+             */
+            void setOversampling (const FMOversampling factor) CASPI_NON_BLOCKING
+            {
+                oversampling_ = factor;
+                finalDecimator_.reset();
+                firstDecimator_.reset();
+                onSampleRateChanged (this->getSampleRate());
+            }
+
+            CASPI_NO_DISCARD
+            FMOversampling getOversampling() const CASPI_NON_BLOCKING
+            {
+                return oversampling_;
+            }
+
+            /**
+             * @brief Decimator group delay in host-rate frames (0 without oversampling).
+             */
+            CASPI_NO_DISCARD
+            FloatType getLatency() const CASPI_NON_BLOCKING
+            {
+                switch (oversampling_)
+                {
+                    case FMOversampling::X2:
+                        return FloatType (FinalDecimator::getLatency()) / FloatType (2);
+                    case FMOversampling::X4:
+                        return FloatType (FirstDecimator::getLatency()) / FloatType (4)
+                               + FloatType (FinalDecimator::getLatency()) / FloatType (2);
+                    default:
+                        return FloatType (0);
+                }
+            }
+
             /**
              * @brief Updates the modulation depth of a connection.
              *
@@ -773,7 +1065,7 @@ namespace CASPI
             {
                 for (auto& op : operators_)
                 {
-                    op->noteOn();
+                    op.noteOn();
                 }
             }
 
@@ -784,7 +1076,7 @@ namespace CASPI
             {
                 for (auto& op : operators_)
                 {
-                    op->noteOff();
+                    op.noteOff();
                 }
             }
 
@@ -840,7 +1132,7 @@ namespace CASPI
             {
                 for (auto& op : operators_)
                 {
-                    op->reset();
+                    op.reset();
                 }
 
                 std::fill (modulationSignals_.begin(),
@@ -850,6 +1142,9 @@ namespace CASPI
                 std::fill (operatorOutputs_.begin(),
                            operatorOutputs_.end(),
                            FloatType (0));
+
+                finalDecimator_.reset();
+                firstDecimator_.reset();
             }
 
             /**
@@ -863,6 +1158,13 @@ namespace CASPI
             CASPI_NO_DISCARD 
             FloatType renderSample() CASPI_NON_BLOCKING override 
             {
+                if (oversampling_ != FMOversampling::None)
+                {
+                    FloatType output;
+                    renderBlock (&output, 1);
+                    return output;
+                }
+
                 Core::ScopedFlushDenormals flush{};
 
                 std::fill (modulationSignals_.begin(),
@@ -872,12 +1174,11 @@ namespace CASPI
                 for (size_t opIndex : executionOrder_)
                 {
                     CASPI_RT_ASSERT(opIndex < operators_.size());
-                    CASPI_RT_ASSERT(operators_[opIndex] != nullptr);
                     CASPI_RT_ASSERT(opIndex < modulationSignals_.size());
                     CASPI_RT_ASSERT(opIndex < operatorOutputs_.size());
-                    operators_[opIndex]->setModulationInput (modulationSignals_[opIndex]);
+                    operators_[opIndex].setModulationInput (modulationSignals_[opIndex]);
 
-                    operatorOutputs_[opIndex] = operators_[opIndex]->renderSample();
+                    operatorOutputs_[opIndex] = operators_[opIndex].renderSample();
 
 
                     CASPI_RT_ASSERT(std::isfinite(operatorOutputs_[opIndex]));
@@ -927,14 +1228,38 @@ namespace CASPI
             /**
              * @brief Renders a block of audio samples.
              *
+             * Operator-major: each operator renders kRenderChunk frames at a time
+             * in execution order, and its output is routed to its targets with
+             * SIMD multiply-accumulates. The denormal guard is held once for the
+             * whole call. Output matches a renderSample() loop. When oversampling,
+             * each chunk is rendered at the operator rate and decimated in place.
+             *
              * @param buffer Output buffer.
              * @param numSamples Number of samples to render.
              */
                 void renderBlock (FloatType* buffer, const size_t numSamples) CASPI_NON_BLOCKING
             {
-                for (size_t i = 0; i < numSamples; ++i)
+                CASPI_EXPECT(!outputOperators_.empty(), "renderBlock called on graph with no output operators");
+                if (outputOperators_.empty())
+                {
+                    std::fill (buffer, buffer + numSamples, FloatType (0));
+                    return;
+                }
+
+                Core::ScopedFlushDenormals flush{};
+
+                for (size_t offset = 0; offset < numSamples; offset += kRenderChunk)
                 {
-                    buffer[i] = renderSample();
+                    const size_t numFrames = std::min (kRenderChunk, numSamples - offset);
+
+                    if (oversampling_ == FMOversampling::None)
+                    {
+                        renderChunk (buffer + offset, numFrames);
+                    }
+                    else
+                    {
+                        renderOversampledChunk (buffer + offset, numFrames);
+                    }
                 }
             }
 
@@ -990,113 +1315,96 @@ namespace CASPI
             }
 
         private:
-            /**
-             * @brief Computes a topological execution order for the modulation graph.
-             */
-        void computeExecutionOrder() CASPI_ALLOCATING
-        {
-            const size_t n = operators_.size();
-            if (n == 0)
-            {
-                return;
-            }
-
-            std::vector<int> inDegree (n, 0);
-            std::vector<std::vector<size_t>> adjacencyList (n);
+            using FirstDecimator = Filters::HalfbandDecimator<FloatType, 16>; // 4× → 2×, wide transition band
+            using FinalDecimator = Filters::HalfbandDecimator<FloatType, 32>; // 2× → 1×
 
-            for (const auto& conn : connections_)
+            CASPI_NO_DISCARD size_t getOversamplingFactor() const CASPI_NON_BLOCKING
             {
-                CASPI_ASSERT(conn.sourceOperator < n,
-             "Connection source out of range in computeExecutionOrder");
-                CASPI_ASSERT(conn.targetOperator < n,
-                             "Connection target out of range in computeExecutionOrder");
-                adjacencyList[conn.sourceOperator].push_back (
-                    conn.targetOperator);
-                ++inDegree[conn.targetOperator];
+                return static_cast<size_t> (oversampling_);
             }
 
-            std::queue<size_t> queue;
-            for (size_t i = 0; i < n; ++i)
+            /**
+             * @brief Renders up to kRenderChunk host-rate frames through the oversampled operators.
+             *
+             * Caller holds the denormal guard.
+             */
+            void renderOversampledChunk (FloatType* buffer, const size_t numFrames) CASPI_NON_BLOCKING
             {
-                if (inDegree[i] == 0)
-                {
-                    queue.push (i);
-                }
-            }
+                FloatType* oversampled = oversampledBlock_.data();
+                const size_t numOversampled = numFrames * getOversamplingFactor();
 
-            executionOrder_.clear();
-            executionOrder_.reserve (n);
+                CASPI_RT_ASSERT(numOversampled <= oversampledBlock_.size());
 
-            while (! queue.empty())
-            {
-                const size_t current = queue.front();
-                queue.pop();
-                executionOrder_.push_back (current);
+                for (size_t offset = 0; offset < numOversampled; offset += kRenderChunk)
+                {
+                    renderChunk (oversampled + offset, std::min (kRenderChunk, numOversampled - offset));
+                }
 
-                for (size_t neighbor : adjacencyList[current])
+                if (oversampling_ == FMOversampling::X4)
                 {
-                    if (--inDegree[neighbor] == 0)
-                    {
-                        queue.push (neighbor);
-                    }
+                    firstDecimator_.process (oversampled, oversampled, 2 * numFrames);
                 }
+
+                finalDecimator_.process (oversampled, buffer, numFrames);
             }
-            CASPI_ENSURE(executionOrder_.size() == n,
-                 "Topological sort didn't process all nodes");
-        }
 
             /**
-             * @brief Builds an adjacency list for fast modulation routing during rendering.
+             * @brief Renders up to kRenderChunk frames operator by operator.
+             *
+             * Caller holds the denormal guard.
              */
-            void buildAdjacencyList()
+            void renderChunk (FloatType* buffer, const size_t numFrames) CASPI_NON_BLOCKING
             {
-                const size_t n = operators_.size();
-                if (n == 0)
-                {
-                    return;
-                }
+                CASPI_RT_ASSERT(numFrames <= kRenderChunk);
 
-                // Count outgoing connections per operator
-                std::vector<size_t> counts (n, 0);
-                for (const auto& conn : connections_)
-                {
-                    CASPI_ASSERT(conn.sourceOperator < n,
-                     "Connection source out of range in buildAdjacencyList");
-                    ++counts[conn.sourceOperator];
-                }
+                std::fill (blockModulation_.begin(), blockModulation_.end(), FloatType (0));
 
-                // Build offset array (prefix sum)
-                outgoingOffsets_.resize (n + 1);
-                outgoingOffsets_[0] = 0;
-                for (size_t i = 0; i < n; ++i)
+                for (size_t opIndex : executionOrder_)
                 {
-                    outgoingOffsets_[i + 1] = outgoingOffsets_[i] + counts[i];
-                }
+                    FloatType* out       = blockOutputs_.data() + opIndex * kRenderChunk;
+                    const FloatType* mod = blockModulation_.data() + opIndex * kRenderChunk;
 
-                // Allocate flat arrays
-                const size_t totalConnections = connections_.size();
-                outgoingTargets_.resize (totalConnections);
-                outgoingDepths_.resize (totalConnections);
-                connectionIndexToFlatIndex_.resize (totalConnections);
+                    operators_[opIndex].renderBlockUnguarded (out, mod, numFrames);
 
-                // Fill flat arrays
-                std::vector<size_t> positions = outgoingOffsets_; // Working copy for insertion
-                for (size_t connIdx = 0; connIdx < connections_.size(); ++connIdx)
-                {
-                    const auto& conn = connections_[connIdx];
+                    const size_t end = outgoingOffsets_[opIndex + 1];
+                    for (size_t i = outgoingOffsets_[opIndex]; i < end; ++i)
+                    {
+                        SIMD::ops::accumulate_with_gain (blockModulation_.data() + outgoingTargets_[i] * kRenderChunk,
+                                                         out,
+                                                         numFrames,
+                                                         static_cast<FloatType> (outgoingDepths_[i]));
+                    }
+                }
 
-                    CASPI_ASSERT(conn.sourceOperator < n, "Connection source out of range");
+                // Mix output operators in the same order as renderSample()
+                SIMD::ops::copy (buffer, blockOutputs_.data() + outputOperators_[0] * kRenderChunk, numFrames);
+                for (size_t k = 1; k < outputOperators_.size(); ++k)
+                {
+                    SIMD::ops::add (buffer, blockOutputs_.data() + outputOperators_[k] * kRenderChunk, numFrames);
+                }
 
-                    const size_t flatIdx = positions[conn.sourceOperator]++;
+                SIMD::ops::scale (buffer, numFrames, effectiveGain_);
+            }
 
-                    CASPI_ASSERT(flatIdx < totalConnections, "Flat index out of range");
+            /**
+             * @brief Computes a topological execution order for the modulation graph.
+             */
+            void computeExecutionOrder() CASPI_ALLOCATING
+            {
+                executionOrder_ = detail::computeFMExecutionOrder (operators_.size(), connections_);
+            }
 
-                    outgoingTargets_[flatIdx] = conn.targetOperator;
-                    outgoingDepths_[flatIdx] = conn.modulationDepth;
-                    connectionIndexToFlatIndex_[connIdx] = flatIdx;
+            /**
+             * @brief Builds an adjacency list for fast modulation routing during rendering.
+             */
+            void buildAdjacencyList() CASPI_ALLOCATING
+            {
+                auto adjacency = detail::buildFMAdjacency (operators_.size(), connections_);
 
-                    CASPI_ASSERT(conn.targetOperator < n, "Connection target out of range");
-                }
+                outgoingTargets_            = std::move (adjacency.targets);
+                outgoingDepths_             = std::move (adjacency.depths);
+                outgoingOffsets_            = std::move (adjacency.offsets);
+                connectionIndexToFlatIndex_ = std::move (adjacency.connectionToFlat);
             }
 
         /**
@@ -1118,8 +1426,8 @@ namespace CASPI
         // Member Variables
         // ====================================================================
 
-        // Operators
-        std::vector<std::unique_ptr<Operator<FloatType>>> operators_;
+        // Operators, stored contiguously by value
+        std::vector<Operator<FloatType>> operators_;
 
         // Flat adjacency structure (render-optimized)
         std::vector<size_t> outgoingTargets_;           // All target operators, concatenated
@@ -1138,6 +1446,16 @@ namespace CASPI
         std::vector<FloatType> modulationSignals_;
         std::vector<FloatType> operatorOutputs_;
 
+        // Block render state: one kRenderChunk-frame slot per operator
+        std::vector<FloatType> blockModulation_;
+        std::vector<FloatType> blockOutputs_;
+
+        // Oversampling: operator-rate scratch (sized for X4) and the decimator cascade
+        FMOversampling oversampling_ = FMOversampling::None;
+        std::vector<FloatType> oversampledBlock_;
+        FirstDecimator firstDecimator_;
+        FinalDecimator finalDecimator_;
+
         // Parameters
         FloatType baseFrequency_;
         FloatType outputGain_;
@@ -1145,6 +1463,768 @@ namespace CASPI
         bool autoScaleOutputs_;
     };
 
+    /**
+     * @class FMGraphPolyDSP
+     * @brief Polyphonic FM engine: one modulation graph, MaxVoices voices in SIMD lanes
+     *
+     * OVERVIEW:
+     *  FMGraphPolyDSP renders the same operator topology as FMGraphDSP for up to
+     *  MaxVoices voices at once. Operator state is stored structure-of-arrays:
+     *  for every operator, the phase, increment and feedback history of all
+     *  voices are contiguous, so one SIMD register holds one operator of
+     *  several voices. Sine evaluation uses SIMD::kernels::SinKernel.
+     *
+     * VOICES:
+     *  - Each voice is one SIMD lane. Voices are tracked in a bitmask; lane
+     *    groups with no active voice are skipped entirely.
+     *  - noteOn() restarts the voice's phases, feedback history and operator
+     *    envelopes. noteOff() releases the voice; its lane stays active until
+     *    the release has finished, then is freed.
+     *  - Operator parameters (index, depth, feedback, mode, frequency ratio,
+     *    envelope settings) are shared by all voices; frequency, gain and
+     *    envelope state are per voice. Ratios default to 1, matching
+     *    FMGraphDSP::setFrequency().
+     *
+     * ENVELOPES AND RELEASE:
+     *  - setOperatorEnvelope() gives an operator an ADSR, the counterpart of
+     *    Operator::setADSR() + enableEnvelope(). Each operator owns an
+     *    Envelope::EnvelopeBank with one envelope per voice, rendered
+     *    kEnvelopeChunk samples at a time in structure-of-arrays form.
+     *  - If every output operator has an envelope, a released voice is freed
+     *    once those envelopes are idle.
+     *  - Otherwise a carrier would sound forever, so noteOff() fades the voice
+     *    out linearly over kReleaseRampSeconds and then frees it.
+     *
+     * REAL-TIME SAFETY / THREADING:
+     *  - Same model as FMGraphDSP: no allocation, locking or system calls after
+     *    construction; not thread-safe.
+     *
+     * NUMERICAL NOTES:
+     *  - With the same operator envelopes and note timing, output matches a
+     *    FMGraphDSP per voice to within the SinKernel approximation error
+     *    (~1e-7 per operator), not bit-exactly.
+     *  - The exception is noteOff() on a patch whose output operators are not
+     *    all enveloped: FMGraphDSP keeps sounding, this runtime fades out.
+     *
+     * @tparam FloatType  float or double.
+     * @tparam MaxVoices  Voice capacity; a multiple of the SIMD width, at most 64.
+     */
+    template <CASPI_FLOAT_TYPE FloatType, size_t MaxVoices>
+    class FMGraphPolyDSP
+        : public Core::Producer<FMGraphPolyDSP<FloatType, MaxVoices>, FloatType, Core::Traversal::PerFrame>
+    {
+            using simd_type = typename SIMD::Strategy::simd_type<FloatType, SIMD::Strategy::min_simd_width<FloatType>::value>::type;
+
+        public:
+            /// Voices processed per SIMD register.
+            static constexpr size_t kLanes = SIMD::Strategy::min_simd_width<FloatType>::value;
+
+            /// Number of lane groups (SIMD registers) per operator.
+            static constexpr size_t kGroups = MaxVoices / kLanes;
+
+            /// Sentinel returned by findFreeVoice() when every lane is in use.
+            static constexpr size_t INVALID_VOICE = std::numeric_limits<size_t>::max();
+
+            /// Samples of operator envelope rendered per EnvelopeBank call.
+            static constexpr size_t kEnvelopeChunk = 32;
+
+            /// Fade applied by noteOff() when an output operator has no envelope.
+            static constexpr FloatType kReleaseRampSeconds = FloatType (0.005);
+
+            CASPI_STATIC_ASSERT (MaxVoices > 0 && MaxVoices % kLanes == 0,
+                                 "FMGraphPolyDSP: MaxVoices must be a non-zero multiple of the SIMD width");
+            CASPI_STATIC_ASSERT (MaxVoices <= 64,
+                                 "FMGraphPolyDSP: voice mask is 64 bits wide");
+
+            /**
+             * @brief Constructs a polyphonic engine from a validated modulation graph.
+             *
+             * @param operatorConfigs Operator definitions (frequency is ignored; see setOperatorRatio()).
+             * @param connections Modulation connections between operators.
+             * @param outputOperators Indices of operators mixed to the output.
+             * @param sampleRate Initial sample rate in Hz.
+             */
+            FMGraphPolyDSP (const std::vector<OperatorConfig<FloatType>>& operatorConfigs,
+                            const std::vector<ModulationConnection>& connections,
+                            const std::vector<size_t>& outputOperators,
+                            FloatType sampleRate)
+                : outputOperators_ (outputOperators),
+                  outputGain_ (FloatType (1)),
+                  autoScaleOutputs_ (true)
+            {
+                CASPI_ASSERT (sampleRate > 0 && std::isfinite (sampleRate),
+                              "Sample rate must be positive and finite");
+
+                const size_t n = operatorConfigs.size();
+
+                modulationIndex_.resize (n);
+                modulationDepth_.resize (n);
+                modulationFeedback_.resize (n);
+                modulationMode_.resize (n);
+                frequencyRatio_.resize (n, FloatType (1));
+                isOutput_.resize (n, 0);
+
+                for (size_t i = 0; i < n; ++i)
+                {
+                    modulationIndex_[i]    = operatorConfigs[i].modulationIndex;
+                    modulationDepth_[i]    = operatorConfigs[i].modulationDepth;
+                    modulationFeedback_[i] = operatorConfigs[i].modulationFeedback;
+                    modulationMode_[i]     = operatorConfigs[i].modulationMode;
+                }
+
+                for (size_t outIdx : outputOperators_)
+                {
+                    CASPI_ASSERT (outIdx < n, "Output operator out of range");
+                    isOutput_[outIdx] = 1;
+                }
+
+                executionOrder_ = detail::computeFMExecutionOrder (n, connections);
+
+                auto adjacency   = detail::buildFMAdjacency (n, connections);
+                outgoingTargets_ = std::move (adjacency.targets);
+                outgoingOffsets_ = std::move (adjacency.offsets);
+                outgoingDepths_.assign (adjacency.depths.begin(), adjacency.depths.end());
+
+                phase_.resize (n * MaxVoices, FloatType (0));
+                increment_.resize (n * MaxVoices, FloatType (0));
+                previousOutput_.resize (n * MaxVoices, FloatType (0));
+                groupModulation_.resize (n * kLanes, FloatType (0));
+
+                envelopes_.resize (n);
+                envelopeSettings_.resize (n);
+                envelopeEnabled_.resize (n, 0);
+                envelopeLevels_.resize (n * kEnvelopeChunk * MaxVoices, FloatType (0));
+
+                voiceFrequency_.fill (FloatType (0));
+                voiceGain_.fill (FloatType (0));
+                voiceFade_.fill (FloatType (1));
+
+                updateEffectiveGain();
+
+                // Store sample rate via NodeBase (fires onSampleRateChanged).
+                this->setSampleRate (sampleRate);
+            }
+
+            FMGraphPolyDSP (const FMGraphPolyDSP&)            = delete;
+            FMGraphPolyDSP& operator= (const FMGraphPolyDSP&) = delete;
+            FMGraphPolyDSP (FMGraphPolyDSP&&)                 = default;
+            FMGraphPolyDSP& operator= (FMGraphPolyDSP&&)      = default;
+
+            /*------------------------------------------------------------------
+             * NodeBase hooks
+             *-----------------------------------------------------------------*/
+
+            void onSampleRateChanged (FloatType newRate) noexcept override
+            {
+                radiansPerHz_ = Constants::TWO_PI<FloatType> / newRate;
+                fadeStep_     = FloatType (1) / (kReleaseRampSeconds * newRate);
+                for (size_t op = 0; op < frequencyRatio_.size(); ++op)
+                {
+                    updateIncrements (op);
+
+                    // EnvelopeBank keeps its coefficients; recompute them at the new rate
+                    envelopes_[op].setSampleRate (newRate);
+                    const auto& e = envelopeSettings_[op];
+                    if (envelopeEnabled_[op] != 0)
+                    {
+                        envelopes_[op].setADSR (e.attack, e.decay, e.sustain, e.release);
+                    }
+                }
+            }
+
+            void onPrepare (std::size_t, std::size_t, double) noexcept {}
+
+            /*------------------------------------------------------------------
+             * Voice allocation
+             *-----------------------------------------------------------------*/
+
+            /**
+             * @brief Returns the lowest free voice, or INVALID_VOICE if all are active.
+             */
+            CASPI_NO_DISCARD
+            size_t findFreeVoice() const CASPI_NON_BLOCKING
+            {
+                for (size_t v = 0; v < MaxVoices; ++v)
+                {
+                    if ((activeMask_ & voiceBit (v)) == 0)
+                    {
+                        return v;
+                    }
+                }
+                return INVALID_VOICE;
+            }
+
+            /**
+             * @brief Starts a voice: restarts its phases, feedback and envelopes, sets frequency and gain.
+             *
+             * Retriggering a releasing voice cancels its release.
+             *
+             * @param voice Voice (lane) index.
+             * @param frequency Voice frequency in Hz.
+             * @param gain Linear voice gain (e.g. velocity).
+             */
+            void noteOn (const size_t voice, const FloatType frequency, const FloatType gain = FloatType (1)) CASPI_NON_BLOCKING
+            {
+                CASPI_EXPECT (voice < MaxVoices, "Voice index out of range in noteOn");
+                if (voice >= MaxVoices)
+                {
+                    return;
+                }
+
+                for (size_t op = 0; op < frequencyRatio_.size(); ++op)
+                {
+                    phase_[op * MaxVoices + voice]          = FloatType (0);
+                    previousOutput_[op * MaxVoices + voice] = FloatType (0);
+                    envelopes_[op].noteOn (voice);
+                }
+
+                activeMask_ |= voiceBit (voice);
+                releasingMask_ &= ~voiceBit (voice);
+                fadingMask_ &= ~voiceBit (voice);
+                voiceFade_[voice] = FloatType (1);
+                voiceGain_[voice] = gain;
+                setVoiceFrequency (voice, frequency);
+            }
+
+            /**
+             * @brief Releases a voice.
+             *
+             * Operator envelopes enter their release. The lane stays active
+             * until the release ends (see ENVELOPES AND RELEASE) and is then
+             * freed. Ignored for a voice that is not active.
+             */
+            void noteOff (const size_t voice) CASPI_NON_BLOCKING
+            {
+                if (! isVoiceActive (voice))
+                {
+                    return;
+                }
+
+                for (auto& envelope : envelopes_)
+                {
+                    envelope.noteOff (voice);
+                }
+
+                releasingMask_ |= voiceBit (voice);
+                if (! outputsAreEnveloped())
+                {
+                    fadingMask_ |= voiceBit (voice);
+                }
+            }
+
+            /**
+             * @brief Releases every active voice.
+             */
+            void allNotesOff() CASPI_NON_BLOCKING
+            {
+                for (size_t v = 0; v < MaxVoices; ++v)
+                {
+                    noteOff (v);
+                }
+            }
+
+            /**
+             * @brief True while the voice holds its lane, release included.
+             */
+            CASPI_NO_DISCARD
+            bool isVoiceActive (const size_t voice) const CASPI_NON_BLOCKING
+            {
+                return voice < MaxVoices && (activeMask_ & voiceBit (voice)) != 0;
+            }
+
+            /**
+             * @brief True between noteOff() and the end of the voice's release.
+             */
+            CASPI_NO_DISCARD
+            bool isVoiceReleasing (const size_t voice) const CASPI_NON_BLOCKING
+            {
+                return voice < MaxVoices && (releasingMask_ & voiceBit (voice)) != 0;
+            }
+
+            /**
+             * @brief Bit v is set while voice v is active, release included.
+             */
+            CASPI_NO_DISCARD
+            uint64_t getActiveVoiceMask() const CASPI_NON_BLOCKING
+            {
+                return activeMask_;
+            }
+
+            CASPI_NO_DISCARD
+            size_t getNumActiveVoices() const CASPI_NON_BLOCKING
+            {
+                size_t count = 0;
+                for (uint64_t m = activeMask_; m != 0; m &= m - 1)
+                {
+                    ++count;
+                }
+                return count;
+            }
+
+            /*------------------------------------------------------------------
+             * Per-voice parameters
+             *-----------------------------------------------------------------*/
+
+            void setVoiceFrequency (const size_t voice, const FloatType frequency) CASPI_NON_BLOCKING
+            {
+                if (voice >= MaxVoices)
+                {
+                    return;
+                }
+                voiceFrequency_[voice] = frequency;
+                for (size_t op = 0; op < frequencyRatio_.size(); ++op)
+                {
+                    increment_[op * MaxVoices + voice] = frequencyRatio_[op] * frequency * radiansPerHz_;
+                }
+            }
+
+            void setVoiceGain (const size_t voice, const FloatType gain) CASPI_NON_BLOCKING
+            {
+                if (voice < MaxVoices && isVoiceActive (voice))
+                {
+                    voiceGain_[voice] = gain;
+                }
+            }
+
+            /*------------------------------------------------------------------
+             * Shared operator parameters
+             *-----------------------------------------------------------------*/
+
+            /**
+             * @brief Sets an operator's frequency as a multiple of the voice frequency.
+             */
+            void setOperatorRatio (const size_t op, const FloatType ratio) CASPI_NON_BLOCKING
+            {
+                if (op < frequencyRatio_.size())
+                {
+                    frequencyRatio_[op] = ratio;
+                    updateIncrements (op);
+                }
+            }
+
+            void setOperatorModulationIndex (const size_t op, const FloatType index) CASPI_NON_BLOCKING
+            {
+                if (op < modulationIndex_.size())
+                {
+                    modulationIndex_[op] = index;
+                }
+            }
+
+            void setOperatorModulationDepth (const size_t op, const FloatType depth) CASPI_NON_BLOCKING
+            {
+                if (op < modulationDepth_.size())
+                {
+                    modulationDepth_[op] = depth;
+                }
+            }
+
+            void setOperatorFeedback (const size_t op, const FloatType feedback) CASPI_NON_BLOCKING
+            {
+                if (op < modulationFeedback_.size())
+                {
+                    modulationFeedback_[op] = feedback;
+                }
+            }
+
+            void setOperatorMode (const size_t op, const ModulationMode mode) CASPI_NON_BLOCKING
+            {
+                if (op < modulationMode_.size())
+                {
+                    modulationMode_[op] = mode;
+                }
+            }
+
+            /**
+             * @brief Gives an operator an ADSR envelope, run separately for every voice.
+             *
+             * Same parameters as Operator::setADSR(). A voice picks the new
+             * settings up at its next envelope stage; enabling an envelope takes
+             * effect from the next noteOn().
+             */
+            void setOperatorEnvelope (const size_t op,
+                                      const FloatType attackTime_s,
+                                      const FloatType decayTime_s,
+                                      const FloatType sustainLevel,
+                                      const FloatType releaseTime_s) CASPI_NON_BLOCKING
+            {
+                if (op < envelopes_.size())
+                {
+                    envelopeSettings_[op] = { attackTime_s, decayTime_s, sustainLevel, releaseTime_s };
+                    envelopeEnabled_[op]  = 1;
+                    envelopes_[op].setADSR (attackTime_s, decayTime_s, sustainLevel, releaseTime_s);
+                }
+            }
+
+            /**
+             * @brief Removes an operator's envelope; it plays at full level again.
+             */
+            void disableOperatorEnvelope (const size_t op) CASPI_NON_BLOCKING
+            {
+                if (op < envelopeEnabled_.size())
+                {
+                    envelopeEnabled_[op] = 0;
+                }
+            }
+
+            CASPI_NO_DISCARD
+            bool isOperatorEnvelopeEnabled (const size_t op) const CASPI_NON_BLOCKING
+            {
+                return op < envelopeEnabled_.size() && envelopeEnabled_[op] != 0;
+            }
+
+            void setOutputGain (const FloatType gain) CASPI_NON_BLOCKING
+            {
+                outputGain_ = gain;
+                updateEffectiveGain();
+            }
+
+            void setAutoScaleOutputs (const bool enable) CASPI_NON_BLOCKING
+            {
+                autoScaleOutputs_ = enable;
+                updateEffectiveGain();
+            }
+
+            /**
+             * @brief Clears all phases, feedback history and envelopes and frees every voice at once.
+             */
+            void reset() CASPI_NON_BLOCKING
+            {
+                std::fill (phase_.begin(), phase_.end(), FloatType (0));
+                std::fill (previousOutput_.begin(), previousOutput_.end(), FloatType (0));
+                for (auto& envelope : envelopes_)
+                {
+                    envelope.reset();
+                }
+
+                activeMask_    = 0;
+                releasingMask_ = 0;
+                fadingMask_    = 0;
+                voiceGain_.fill (FloatType (0));
+                voiceFade_.fill (FloatType (1));
+            }
+
+            /*------------------------------------------------------------------
+             * Rendering
+             *-----------------------------------------------------------------*/
+
+            /**
+             * @brief Renders one sample: the sum of all active voices.
+             */
+            CASPI_NO_DISCARD
+            FloatType renderSample() CASPI_NON_BLOCKING override
+            {
+                Core::ScopedFlushDenormals flush{};
+                renderEnvelopes (1);
+                const FloatType out = computeFrame (0);
+                retireReleasedVoices();
+                return out;
+            }
+
+            CASPI_NO_DISCARD
+            FloatType renderSample (const std::size_t channel,
+                                    const std::size_t frame) CASPI_NON_BLOCKING override
+            {
+                (void) channel;
+                (void) frame;
+                return renderSample();
+            }
+
+            /**
+             * @brief Renders a block of the summed voices.
+             *
+             * The denormal guard is held once for the whole call.
+             */
+            void renderBlock (FloatType* buffer, const size_t numSamples) CASPI_NON_BLOCKING
+            {
+                Core::ScopedFlushDenormals flush{};
+                for (size_t start = 0; start < numSamples; start += kEnvelopeChunk)
+                {
+                    const size_t count = std::min (kEnvelopeChunk, numSamples - start);
+
+                    renderEnvelopes (count);
+                    for (size_t t = 0; t < count; ++t)
+                    {
+                        buffer[start + t] = computeFrame (t);
+                    }
+                    retireReleasedVoices();
+                }
+            }
+
+            CASPI_NO_DISCARD
+            size_t getNumOperators() const CASPI_NON_BLOCKING
+            {
+                return frequencyRatio_.size();
+            }
+
+            CASPI_NO_DISCARD
+            const std::vector<size_t>& getExecutionOrder() const CASPI_NON_BLOCKING
+            {
+                return executionOrder_;
+            }
+
+        private:
+            static constexpr uint64_t voiceBit (const size_t voice) noexcept
+            {
+                return uint64_t (1) << voice;
+            }
+
+            static constexpr uint64_t groupMask (const size_t group) noexcept
+            {
+                return ((kLanes == 64) ? ~uint64_t (0) : ((uint64_t (1) << kLanes) - 1)) << (group * kLanes);
+            }
+
+            void updateIncrements (const size_t op) CASPI_NON_BLOCKING
+            {
+                for (size_t v = 0; v < MaxVoices; ++v)
+                {
+                    increment_[op * MaxVoices + v] = frequencyRatio_[op] * voiceFrequency_[v] * radiansPerHz_;
+                }
+            }
+
+            /** @brief True when every output operator has an envelope to end its release. */
+            bool outputsAreEnveloped() const CASPI_NON_BLOCKING
+            {
+                for (size_t op : outputOperators_)
+                {
+                    if (envelopeEnabled_[op] == 0)
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            /**
+             * @brief Renders @p count samples of every enabled operator envelope into envelopeLevels_.
+             */
+            void renderEnvelopes (const size_t count) CASPI_NON_BLOCKING
+            {
+                for (size_t op = 0; op < envelopes_.size(); ++op)
+                {
+                    if (envelopeEnabled_[op] != 0)
+                    {
+                        envelopes_[op].renderBlock (envelopeLevels_.data() + op * kEnvelopeChunk * MaxVoices,
+                                                    static_cast<int> (count));
+                    }
+                }
+            }
+
+            /**
+             * @brief Frees the lanes of released voices whose fade or output envelopes have ended.
+             *
+             * Called once per envelope chunk: a voice that finished inside the
+             * chunk rendered silence for the rest of it.
+             */
+            void retireReleasedVoices() CASPI_NON_BLOCKING
+            {
+                for (uint64_t m = releasingMask_; m != 0; m &= m - 1)
+                {
+                    size_t voice = 0;
+                    while ((m & voiceBit (voice)) == 0)
+                    {
+                        ++voice;
+                    }
+
+                    bool finished = true;
+                    if ((fadingMask_ & voiceBit (voice)) != 0)
+                    {
+                        finished = voiceFade_[voice] <= FloatType (0);
+                    }
+                    else
+                    {
+                        for (size_t op : outputOperators_)
+                        {
+                            if (envelopeEnabled_[op] != 0 && ! envelopes_[op].isIdle (voice))
+                            {
+                                finished = false;
+                            }
+                        }
+                    }
+
+                    if (finished)
+                    {
+                        activeMask_ &= ~voiceBit (voice);
+                        releasingMask_ &= ~voiceBit (voice);
+                        fadingMask_ &= ~voiceBit (voice);
+                        voiceGain_[voice] = FloatType (0);
+                        voiceFade_[voice] = FloatType (1);
+                    }
+                }
+            }
+
+            /**
+             * @brief Advances every active lane group by one sample. Caller holds the denormal guard.
+             *
+             * Operators run in execution order within each lane group; modulation
+             * is accumulated into groupModulation_, one register per operator.
+             *
+             * @param frame Frame within the current envelope chunk.
+             */
+            FloatType computeFrame (const size_t frame) CASPI_NON_BLOCKING
+            {
+                const simd_type twoPi    = SIMD::set1<FloatType> (Constants::TWO_PI<FloatType>);
+                const simd_type invTwoPi = SIMD::set1<FloatType> (FloatType (1) / Constants::TWO_PI<FloatType>);
+                simd_type mix            = SIMD::set1<FloatType> (FloatType (0));
+
+                for (size_t g = 0; g < kGroups; ++g)
+                {
+                    if ((activeMask_ & groupMask (g)) == 0)
+                    {
+                        continue;
+                    }
+
+                    std::fill (groupModulation_.begin(), groupModulation_.end(), FloatType (0));
+                    simd_type carriers = SIMD::set1<FloatType> (FloatType (0));
+
+                    for (size_t op : executionOrder_)
+                    {
+                        FloatType* phasePtr = phase_.data() + op * MaxVoices + g * kLanes;
+                        FloatType* prevPtr  = previousOutput_.data() + op * MaxVoices + g * kLanes;
+                        const FloatType* incPtr = increment_.data() + op * MaxVoices + g * kLanes;
+                        FloatType* modPtr   = groupModulation_.data() + op * kLanes;
+
+                        const simd_type phase = SIMD::load_unaligned<FloatType> (phasePtr);
+                        const simd_type mod   = SIMD::load_unaligned<FloatType> (modPtr);
+                        const simd_type inc   = SIMD::load_unaligned<FloatType> (incPtr);
+                        const simd_type fb    = SIMD::mul (SIMD::set1<FloatType> (modulationFeedback_[op]),
+                                                        SIMD::load_unaligned<FloatType> (prevPtr));
+                        const simd_type index = SIMD::set1<FloatType> (modulationIndex_[op]);
+
+                        simd_type argument;
+                        simd_type nextPhase;
+
+                        if (modulationMode_[op] == ModulationMode::Frequency)
+                        {
+                            argument  = SIMD::add (phase, fb);
+                            nextPhase = SIMD::add (phase,
+                                                   SIMD::add (inc, SIMD::mul (SIMD::mul (mod, index),
+                                                                              SIMD::set1<FloatType> (radiansPerHz_))));
+                        }
+                        else
+                        {
+                            argument  = SIMD::add (SIMD::add (phase, SIMD::mul (mod, index)), fb);
+                            nextPhase = SIMD::add (phase, inc);
+                        }
+
+                        simd_type amount = SIMD::set1<FloatType> (modulationDepth_[op]);
+                        if (envelopeEnabled_[op] != 0)
+                        {
+                            const FloatType* envPtr = envelopeLevels_.data() + (op * kEnvelopeChunk + frame) * MaxVoices + g * kLanes;
+                            amount                  = SIMD::mul (SIMD::load_unaligned<FloatType> (envPtr), amount);
+                        }
+
+                        const simd_type out = SIMD::mul (amount, sine_ (argument));
+
+                        nextPhase = SIMD::sub (nextPhase, SIMD::mul (twoPi, SIMD::floor (SIMD::mul (nextPhase, invTwoPi))));
+
+                        SIMD::store_unaligned (phasePtr, nextPhase);
+                        SIMD::store_unaligned (prevPtr, out);
+
+                        const size_t end = outgoingOffsets_[op + 1];
+                        for (size_t i = outgoingOffsets_[op]; i < end; ++i)
+                        {
+                            FloatType* targetPtr = groupModulation_.data() + outgoingTargets_[i] * kLanes;
+                            SIMD::store_unaligned (targetPtr,
+                                                   SIMD::mul_add (out,
+                                                                  SIMD::set1<FloatType> (outgoingDepths_[i]),
+                                                                  SIMD::load_unaligned<FloatType> (targetPtr)));
+                        }
+
+                        if (isOutput_[op] != 0)
+                        {
+                            carriers = SIMD::add (carriers, out);
+                        }
+                    }
+
+                    // Inactive lanes carry zero gain, so they drop out of the mix.
+                    const simd_type gain = SIMD::mul (SIMD::load_unaligned<FloatType> (voiceGain_.data() + g * kLanes),
+                                                      SIMD::load_unaligned<FloatType> (voiceFade_.data() + g * kLanes));
+                    mix = SIMD::mul_add (carriers, gain, mix);
+                }
+
+                for (uint64_t m = fadingMask_; m != 0; m &= m - 1)
+                {
+                    size_t voice = 0;
+                    while ((m & voiceBit (voice)) == 0)
+                    {
+                        ++voice;
+                    }
+                    voiceFade_[voice] = std::max (FloatType (0), voiceFade_[voice] - fadeStep_);
+                }
+
+                return SIMD::hsum (mix) * effectiveGain_;
+            }
+
+            void updateEffectiveGain() CASPI_NON_BLOCKING
+            {
+                FloatType scale = FloatType (1);
+
+                if (autoScaleOutputs_ && outputOperators_.size() > 1)
+                {
+                    scale = FloatType (1) / static_cast<FloatType> (outputOperators_.size());
+                }
+
+                effectiveGain_ = outputGain_ * scale;
+            }
+
+            // ====================================================================
+            // Member Variables
+            // ====================================================================
+
+            // Topology
+            std::vector<size_t> executionOrder_;
+            std::vector<size_t> outgoingTargets_;
+            std::vector<FloatType> outgoingDepths_;
+            std::vector<size_t> outgoingOffsets_;
+            std::vector<size_t> outputOperators_;
+            std::vector<uint8_t> isOutput_;
+
+            // Shared per-operator parameters
+            std::vector<FloatType> modulationIndex_;
+            std::vector<FloatType> modulationDepth_;
+            std::vector<FloatType> modulationFeedback_;
+            std::vector<ModulationMode> modulationMode_;
+            std::vector<FloatType> frequencyRatio_;
+
+            // Per-operator, per-voice state: index op * MaxVoices + voice
+            std::vector<FloatType> phase_;
+            std::vector<FloatType> increment_;
+            std::vector<FloatType> previousOutput_;
+
+            // Modulation inputs of the lane group being rendered: index op * kLanes + lane
+            std::vector<FloatType> groupModulation_;
+
+            // Operator envelopes: one bank per operator, one envelope per voice
+            struct EnvelopeSettings
+            {
+                    FloatType attack;
+                    FloatType decay;
+                    FloatType sustain;
+                    FloatType release;
+            };
+            std::vector<Envelope::EnvelopeBank<FloatType, MaxVoices>> envelopes_;
+            std::vector<EnvelopeSettings> envelopeSettings_;
+            std::vector<uint8_t> envelopeEnabled_;
+
+            // Levels of the current envelope chunk: index (op * kEnvelopeChunk + frame) * MaxVoices + voice
+            std::vector<FloatType> envelopeLevels_;
+
+            // Voices
+            std::array<FloatType, MaxVoices> voiceFrequency_ {};
+            std::array<FloatType, MaxVoices> voiceGain_ {};
+            std::array<FloatType, MaxVoices> voiceFade_ {};
+            uint64_t activeMask_    = 0;
+            uint64_t releasingMask_ = 0;
+            uint64_t fadingMask_    = 0;
+            FloatType fadeStep_     = FloatType (0);
+
+            SIMD::kernels::SinKernel<FloatType> sine_;
+            FloatType radiansPerHz_ = FloatType (0);
+            FloatType outputGain_;
+            FloatType effectiveGain_ = FloatType (1);
+            bool autoScaleOutputs_;
+    };
+
 } // namespace CASPI
 
 #endif // CASPI_FMGRAPH_H
\ No newline at end of file
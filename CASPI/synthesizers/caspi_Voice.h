@@ -360,16 +360,7 @@ namespace CASPI
                         continue;
                     }
 
-                    const std::size_t C = outputBuffer.numChannels();
-                    const std::size_t F = outputBuffer.numFrames();
-
-                    for (std::size_t ch = 0; ch < C; ++ch)
-                    {
-                        for (std::size_t fr = 0; fr < F; ++fr)
-                        {
-                            outputBuffer.sample (ch, fr) += src->sample (ch, fr);
-                        }
-                    }
+                    Graph::addBroadcast (*src, outputBuffer);
                 }
             }
 
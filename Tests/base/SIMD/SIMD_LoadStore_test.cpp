@@ -68,4 +68,27 @@ TEST(SIMD_Correctness, LoadStoreRoundtrip) {
     for (int i = 0; i < 4; i++) {
         EXPECT_FLOAT_EQ(original[i], roundtrip[i]);
     }
-}
\ No newline at end of file
+}
+TEST(SIMD_float32x4, GatherWrapsThroughMask)
+{
+    float table[8] = { 10.f, 11.f, 12.f, 13.f, 14.f, 15.f, 16.f, 17.f };
+    CASPI::SIMD::float32x4 index = { 0.f, 7.f, 8.f, -1.f };
+
+    float out[4];
+    CASPI::SIMD::store (out, CASPI::SIMD::gather (table, index, 7));
+    EXPECT_FLOAT_EQ(out[0], 10.f);
+    EXPECT_FLOAT_EQ(out[1], 17.f);
+    EXPECT_FLOAT_EQ(out[2], 10.f);
+    EXPECT_FLOAT_EQ(out[3], 17.f);
+}
+
+TEST(SIMD_float64x2, GatherWrapsThroughMask)
+{
+    double table[4] = { 1.0, 2.0, 3.0, 4.0 };
+    CASPI::SIMD::float64x2 index = { 2.0, -1.0 };
+
+    double out[2];
+    CASPI::SIMD::store (out, CASPI::SIMD::gather (table, index, 3));
+    EXPECT_EQ(out[0], 3.0);
+    EXPECT_EQ(out[1], 4.0);
+}
@@ -13,6 +13,7 @@
  *      - in-place (dst==src) alias safety
  *      - alignment: aligned, misaligned, odd-length, single element
  *   7. Block kernel composability with block_op_unary directly
+ *   8. SinKernel full-range sine (range reduction, SIMD/scalar agreement)
  */
 
 #include "base/SIMD/caspi_Blocks.h"
@@ -719,4 +720,74 @@ TEST (PolyKernel_Block, custom_kernel_odd_size)
 
     for (std::size_t i = 0; i < N; ++i)
         EXPECT_NEAR (dst[i], src[i] * src[i], kF32Eps);
-}
\ No newline at end of file
+}
+// ============================================================================
+// 8. SinKernel: full-range sine with Cody–Waite reduction
+// ============================================================================
+
+static constexpr float  kSinKernelF32 = 5e-7f;  // reduction adds ~1 ulp of |x| to the poly error
+static constexpr double kSinKernelF64 = 1e-7;
+
+TEST (SinKernel, float_scalar_full_range)
+{
+    kernels::SinKernel<float> s;
+    float max_err = 0.f;
+    for (int i = -4000; i <= 4000; ++i)
+    {
+        const float x = static_cast<float> (i) * 0.00314159f;  // [-4π, 4π]
+        max_err       = std::max (max_err, std::abs (s (x) - static_cast<float> (std::sin (static_cast<double> (x)))));
+    }
+    EXPECT_LT (max_err, kSinKernelF32);
+}
+
+TEST (SinKernel, double_scalar_full_range)
+{
+    kernels::SinKernel<double> s;
+    double max_err = 0.0;
+    for (int i = -4000; i <= 4000; ++i)
+    {
+        const double x = static_cast<double> (i) * 0.00314159;
+        max_err        = std::max (max_err, std::abs (s (x) - std::sin (x)));
+    }
+    EXPECT_LT (max_err, kSinKernelF64);
+}
+
+TEST (SinKernel, float_simd_matches_scalar)
+{
+    kernels::SinKernel<float> s;
+    for (int i = -64; i < 64; ++i)
+    {
+        const float base = static_cast<float> (i) * 0.2f;
+        float out[4];
+        store4f (s (load4f (base, base + 0.05f, base + 0.1f, base + 0.15f)), out);
+        for (int lane = 0; lane < 4; ++lane)
+        {
+            const float x = base + 0.05f * static_cast<float> (lane);
+            EXPECT_NEAR (out[lane], s (x), 1e-7f) << "x=" << x;
+            EXPECT_NEAR (out[lane], std::sin (x), kSinKernelF32) << "x=" << x;
+        }
+    }
+}
+
+TEST (SinKernel, double_simd_matches_scalar)
+{
+    kernels::SinKernel<double> s;
+    for (int i = -64; i < 64; ++i)
+    {
+        const double base = static_cast<double> (i) * 0.2;
+        double out[2];
+        store2d (s (load2d (base, base + 0.1)), out);
+        EXPECT_NEAR (out[0], std::sin (base), kSinKernelF64);
+        EXPECT_NEAR (out[1], std::sin (base + 0.1), kSinKernelF64);
+    }
+}
+
+TEST (SinKernel, odd_symmetry_and_zeros)
+{
+    kernels::SinKernel<double> s;
+    EXPECT_EQ (s (0.0), 0.0);
+    EXPECT_NEAR (s (2.0 * kPi2), 0.0, 1e-12);
+    EXPECT_NEAR (s (4.0 * kPi2), 0.0, 1e-12);
+    for (double x = 0.1; x < 10.0; x += 0.37)
+        EXPECT_DOUBLE_EQ (s (-x), -s (x));
+}
@@ -0,0 +1,205 @@
+/*******************************************************************************
+ * @file  EnvelopeBank_test.cpp
+ * @brief Unit tests for EnvelopeBank.
+ *
+ * TEST GROUPS
+ * -----------
+ *   EnvelopeBank — agreement with independent ADSRs across block sizes,
+ *                  idle / active masks, quietest-voice lookup, reset and
+ *                  advance-only rendering
+ *
+ ******************************************************************************/
+
+#include "controls/caspi_EnvelopeBank.h"
+#include <gtest/gtest.h>
+#include <array>
+#include <memory>
+#include <vector>
+
+using namespace CASPI::Envelope;
+
+/*******************************************************************************
+ * Helpers
+ ******************************************************************************/
+
+static constexpr int kVoices = 7; // one partial SIMD group for both float and double
+
+/**
+ * Drives a bank and kVoices ADSRs with the same staggered notes and
+ * different settings per voice, comparing every sample.
+ */
+template <typename FloatType>
+static void expectBankMatchesAdsrs (int blockSize, double tolerance)
+{
+    using Bank = EnvelopeBank<FloatType, kVoices>;
+
+    auto bank = std::make_unique<Bank>();
+    bank->setSampleRate (FloatType (48000));
+
+    std::array<ADSR<FloatType>, kVoices> adsrs;
+    for (int v = 0; v < kVoices; ++v)
+    {
+        const auto a = FloatType (0.002 + 0.003 * v);
+        const auto d = FloatType (0.01 + 0.01 * v);
+        const auto s = FloatType (0.2 + 0.1 * v);
+        const auto r = FloatType (0.005 + 0.004 * v);
+        bank->setADSR (static_cast<std::size_t> (v), a, d, s, r);
+        adsrs[v].setSampleRate (FloatType (48000));
+        adsrs[v].setADSR (a, d, s, r);
+    }
+
+    const int              total = 9000;
+    std::vector<FloatType> out (static_cast<std::size_t> (blockSize) * Bank::kStride);
+    for (int start = 0; start < total; start += blockSize)
+    {
+        // Events at block starts: voice v plays from 100 v to 2500 + 700 v
+        for (int v = 0; v < kVoices; ++v)
+        {
+            if (start == (100 * v) / blockSize * blockSize)
+            {
+                bank->noteOn (static_cast<std::size_t> (v));
+                adsrs[v].noteOn();
+            }
+            if (start == (2500 + 700 * v) / blockSize * blockSize)
+            {
+                bank->noteOff (static_cast<std::size_t> (v));
+                adsrs[v].noteOff();
+            }
+        }
+
+        const int n = std::min (blockSize, total - start);
+        bank->renderBlock (out.data(), n);
+        for (int t = 0; t < n; ++t)
+            for (int v = 0; v < kVoices; ++v)
+                ASSERT_NEAR (out[static_cast<std::size_t> (t) * Bank::kStride + v], adsrs[v].render(), tolerance)
+                    << "block " << blockSize << ", voice " << v << ", sample " << start + t;
+
+        for (int v = 0; v < kVoices; ++v)
+        {
+            ASSERT_EQ (bank->getState (static_cast<std::size_t> (v)), adsrs[v].getState()) << "voice " << v;
+            ASSERT_EQ (bank->isIdle (static_cast<std::size_t> (v)), adsrs[v].isIdle()) << "voice " << v;
+        }
+    }
+
+    EXPECT_EQ (bank->getIdleMask(), Bank::kAllVoices);
+}
+
+/*******************************************************************************
+ * EnvelopeBank
+ ******************************************************************************/
+
+TEST (EnvelopeBank, MatchesIndependentAdsrsDouble)
+{
+    for (int block : { 1, 5, 16, 64, 512 })
+        expectBankMatchesAdsrs<double> (block, 1e-12);
+}
+
+TEST (EnvelopeBank, MatchesIndependentAdsrsFloat)
+{
+    for (int block : { 1, 5, 16, 64, 512 })
+        expectBankMatchesAdsrs<float> (block, 1e-6);
+}
+
+TEST (EnvelopeBank, IdleAndActiveMasksFollowNotes)
+{
+    using Bank = EnvelopeBank<float, 40>;
+    auto bank  = std::make_unique<Bank>();
+    bank->setSampleRate (48000.f);
+    bank->setADSR (0.001f, 0.001f, 0.5f, 0.001f);
+
+    EXPECT_EQ (bank->getIdleMask(), (Bank::Mask (1) << 40) - 1);
+    EXPECT_EQ (bank->getActiveMask(), 0u);
+
+    bank->noteOn (3);
+    bank->noteOn (39);
+    EXPECT_EQ (bank->getActiveMask(), (Bank::Mask (1) << 3) | (Bank::Mask (1) << 39));
+    EXPECT_FALSE (bank->isIdle (3));
+
+    // Held notes stay active through sustain
+    bank->advance (1000);
+    EXPECT_EQ (bank->getState (3), State::sustain);
+    EXPECT_EQ (bank->getActiveMask(), (Bank::Mask (1) << 3) | (Bank::Mask (1) << 39));
+
+    // A release keeps the voice active until it reaches zero
+    bank->noteOff (39);
+    EXPECT_FALSE (bank->isIdle (39));
+    bank->advance (1000);
+    EXPECT_TRUE (bank->isIdle (39));
+    EXPECT_EQ (bank->getActiveMask(), Bank::Mask (1) << 3);
+
+    // noteOff on an idle voice does nothing
+    bank->noteOff (10);
+    EXPECT_TRUE (bank->isIdle (10));
+    EXPECT_EQ (bank->getState (10), State::idle);
+}
+
+TEST (EnvelopeBank, QuietestVoiceAmongCandidates)
+{
+    using Bank = EnvelopeBank<double, 64>;
+    auto bank  = std::make_unique<Bank>();
+    bank->setSampleRate (48000.0);
+    bank->setADSR (0.1, 0.1, 0.5, 0.1);
+
+    // Later notes have had less attack time: voice 63 is the quietest
+    for (std::size_t v : { 0u, 20u, 63u })
+    {
+        bank->noteOn (v);
+        bank->advance (100);
+    }
+    EXPECT_EQ (bank->getActiveMask(), (Bank::Mask (1) << 0) | (Bank::Mask (1) << 20) | (Bank::Mask (1) << 63));
+    EXPECT_LT (bank->getLevel (63), bank->getLevel (20));
+    EXPECT_LT (bank->getLevel (20), bank->getLevel (0));
+
+    EXPECT_EQ (bank->getQuietestVoice (bank->getActiveMask()), 63u);
+    EXPECT_EQ (bank->getQuietestVoice ((Bank::Mask (1) << 0) | (Bank::Mask (1) << 20)), 20u);
+    EXPECT_EQ (bank->getQuietestVoice (0), 64u);
+}
+
+TEST (EnvelopeBank, AdvanceMatchesRenderBlock)
+{
+    using Bank = EnvelopeBank<float, 8>;
+    auto a     = std::make_unique<Bank>();
+    auto b     = std::make_unique<Bank>();
+    for (auto* bank : { a.get(), b.get() })
+    {
+        bank->setSampleRate (48000.f);
+        bank->setADSR (0.01f, 0.02f, 0.3f, 0.05f);
+        for (std::size_t v = 0; v < 8; v += 2)
+            bank->noteOn (v);
+    }
+
+    std::vector<float> out (300 * Bank::kStride);
+    a->renderBlock (out.data(), 300);
+    b->advance (300);
+    for (std::size_t v = 0; v < 8; ++v)
+    {
+        EXPECT_EQ (a->getLevel (v), b->getLevel (v));
+        EXPECT_EQ (a->getState (v), b->getState (v));
+        EXPECT_EQ (out[299 * Bank::kStride + v], a->getLevel (v));
+    }
+}
+
+TEST (EnvelopeBank, ResetSilencesVoices)
+{
+    using Bank = EnvelopeBank<float, 4>;
+    auto bank  = std::make_unique<Bank>();
+    bank->setSampleRate (48000.f);
+    bank->setADSR (0.01f, 0.02f, 0.3f, 0.05f);
+    bank->noteOn (0);
+    bank->noteOn (1);
+    bank->advance (64);
+    EXPECT_GT (bank->getLevel (1), 0.f);
+
+    bank->reset (1);
+    EXPECT_TRUE (bank->isIdle (1));
+    EXPECT_EQ (bank->getLevel (1), 0.f);
+    EXPECT_FALSE (bank->isIdle (0));
+
+    bank->reset();
+    EXPECT_EQ (bank->getIdleMask(), Bank::kAllVoices);
+
+    std::vector<float> out (64 * Bank::kStride);
+    bank->renderBlock (out.data(), 64);
+    for (float s : out)
+        ASSERT_EQ (s, 0.f);
+}
@@ -224,3 +224,73 @@ TEST(AdsrTests, render_test)
     }
 }
 
+
+/// Renders the same note through render() and renderBlock() at several block sizes.
+template <typename FloatType>
+static void expectBlockMatchesScalar (FloatType tolerance)
+{
+    const int blockSizes[] = { 1, 3, 4, 7, 64, 512 };
+    for (int blockSize : blockSizes)
+    {
+        CASPI::Envelope::ADSR<FloatType> scalar, block;
+        for (auto* env : { &scalar, &block })
+        {
+            env->setSampleRate (FloatType (48000));
+            env->setADSR (FloatType (0.01), FloatType (0.1), FloatType (0.5), FloatType (0.2));
+            env->noteOn();
+        }
+
+        // 0.3 s held, then a release that runs out to idle
+        std::vector<FloatType> expected (48000), actual (48000);
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            if (i == 14400)
+                scalar.noteOff();
+            expected[i] = scalar.render();
+        }
+
+        for (std::size_t done = 0; done < actual.size();)
+        {
+            if (done == 14400)
+                block.noteOff();
+            const auto end = std::min ({ actual.size(), done + static_cast<std::size_t> (blockSize), done < 14400 ? std::size_t (14400) : actual.size() });
+            block.renderBlock (actual.data() + done, static_cast<int> (end - done));
+            done = end;
+        }
+
+        for (std::size_t i = 0; i < expected.size(); ++i)
+            ASSERT_NEAR (actual[i], expected[i], tolerance) << "block " << blockSize << " sample " << i;
+        EXPECT_EQ (block.getStateString(), scalar.getStateString());
+        EXPECT_TRUE (block.isIdle());
+    }
+}
+
+TEST(AdsrTests, renderBlock_matches_render_double_test)
+{
+    expectBlockMatchesScalar<double> (1e-12);
+}
+
+TEST(AdsrTests, renderBlock_matches_render_float_test)
+{
+    expectBlockMatchesScalar<float> (1e-3f);
+}
+
+TEST(AdsrTests, renderBlock_sustain_and_idle_test)
+{
+    CASPI::Envelope::ADSR<float> ADSR;
+    std::vector<float> output (37, 1.0f);
+
+    ADSR.renderBlock (output.data(), 37);
+    for (float s : output)
+        EXPECT_EQ (s, 0.0f);
+
+    ADSR.setADSR (0.001f, 0.001f, 0.25f, 0.1f);
+    ADSR.noteOn();
+    std::vector<float> skip (1000);
+    ADSR.renderBlock (skip.data(), 1000);
+    EXPECT_EQ (ADSR.getStateString(), "sustain");
+
+    ADSR.renderBlock (output.data(), 37);
+    for (float s : output)
+        EXPECT_EQ (s, 0.25f);
+}
@@ -0,0 +1,225 @@
+/*******************************************************************************
+ * @file  MSEG_test.cpp
+ * @brief Unit tests for MsegTable, MsegPlayhead, MsegPublisher and MSEG.
+ *
+ * TEST GROUPS
+ * -----------
+ *   MSEG — table validation, straight and curved segments against the
+ *          scalar reference, sustain and loop behaviour, block-size
+ *          invariance, shared tables, publishing to a running node
+ *
+ ******************************************************************************/
+
+#include "controls/caspi_MSEG.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+
+using namespace CASPI::Envelope;
+
+/*******************************************************************************
+ * Helpers
+ ******************************************************************************/
+
+static constexpr double kSR = 48000.0;
+
+template <typename FloatType>
+static typename MsegTable<FloatType>::Ptr makeTable (const std::vector<MsegPoint<FloatType>>& points,
+                                                     int loopStart = MsegTable<FloatType>::kNoLoop,
+                                                     int loopEnd   = MsegTable<FloatType>::kNoLoop)
+{
+    auto result = MsegTable<FloatType>::create (points, loopStart, loopEnd);
+    EXPECT_TRUE (result.has_value());
+    return result.value();
+}
+
+/** Attack, two curved falls and a straight tail. */
+template <typename FloatType>
+static std::vector<MsegPoint<FloatType>> curvedPoints()
+{
+    return { { FloatType (0), FloatType (0), FloatType (0) },
+             { FloatType (0.01), FloatType (1), FloatType (-0.7) },
+             { FloatType (0.025), FloatType (0.3), FloatType (1) },
+             { FloatType (0.04), FloatType (0.6), FloatType (0.35) },
+             { FloatType (0.05), FloatType (0), FloatType (0) } };
+}
+
+/** Renders a whole note in blocks of blockSize. */
+template <typename FloatType>
+static std::vector<FloatType> renderNote (const MsegTable<FloatType>& table, int total, int blockSize, int noteOffAt = -1)
+{
+    std::vector<FloatType> out (static_cast<std::size_t> (total));
+    MsegPlayhead           playhead;
+    table.noteOn (playhead);
+    for (int start = 0; start < total; start += blockSize)
+    {
+        if (noteOffAt >= 0 && start == noteOffAt / blockSize * blockSize)
+            table.noteOff (playhead);
+        table.render (playhead, out.data() + start, std::min (blockSize, total - start), kSR);
+    }
+    return out;
+}
+
+/*******************************************************************************
+ * MSEG
+ ******************************************************************************/
+
+TEST (MSEG, CreateRejectsBadInput)
+{
+    using Table = MsegTable<float>;
+
+    EXPECT_EQ (Table::create ({ { 0.f, 1.f, 0.f } }).error(), MsegError::TooFewPoints);
+    EXPECT_EQ (Table::create ({ { 0.1f, 0.f, 0.f }, { 0.2f, 1.f, 0.f } }).error(), MsegError::BadTimes);
+    EXPECT_EQ (Table::create ({ { 0.f, 0.f, 0.f }, { 0.2f, 1.f, 0.f }, { 0.1f, 0.f, 0.f } }).error(), MsegError::BadTimes);
+
+    const std::vector<MsegPoint<float>> points = { { 0.f, 0.f, 0.f }, { 0.1f, 1.f, 0.f }, { 0.1f, 0.5f, 0.f }, { 0.3f, 0.f, 0.f } };
+    EXPECT_EQ (Table::create (points, 2, 1).error(), MsegError::BadLoop);
+    EXPECT_EQ (Table::create (points, 0, 4).error(), MsegError::BadLoop);
+    EXPECT_EQ (Table::create (points, 0, 0).error(), MsegError::BadLoop);
+    EXPECT_EQ (Table::create (points, 1, 2).error(), MsegError::ZeroLengthLoop);
+
+    const auto ok = Table::create (points, 0, 2);
+    ASSERT_TRUE (ok.has_value());
+    EXPECT_EQ (ok.value()->numSegments(), 3u);
+    EXPECT_FLOAT_EQ (ok.value()->getLength(), 0.3f);
+}
+
+TEST (MSEG, StraightSegmentsMatchReference)
+{
+    const auto table = makeTable<double> ({ { 0.0, 0.0, 0.0 }, { 0.01, 1.0, 0.0 }, { 0.03, 0.25, 0.0 }, { 0.05, 0.0, 0.0 } });
+
+    const auto out = renderNote (*table, 3000, 256);
+    for (std::size_t n = 0; n < out.size(); ++n)
+        ASSERT_NEAR (out[n], table->valueAt (static_cast<double> (n) / kSR), 1e-9) << "sample " << n;
+}
+
+TEST (MSEG, CurvedSegmentsMatchExp2Reference)
+{
+    const auto tableD = makeTable<double> (curvedPoints<double>());
+    const auto outD   = renderNote (*tableD, 2600, 100);
+    for (std::size_t n = 0; n < outD.size(); ++n)
+        ASSERT_NEAR (outD[n], tableD->valueAt (static_cast<double> (n) / kSR), 1e-9) << "sample " << n;
+
+    const auto tableF = makeTable<float> (curvedPoints<float>());
+    const auto outF   = renderNote (*tableF, 2600, 100);
+    for (std::size_t n = 0; n < outF.size(); ++n)
+        ASSERT_NEAR (outF[n], tableF->valueAt (static_cast<double> (n) / kSR), 1e-5) << "sample " << n;
+
+    // Positive curves start slowly, negative ones quickly
+    EXPECT_LT (tableD->valueAt (0.0325), 0.45);
+    EXPECT_GT (tableD->valueAt (0.005), 0.5);
+}
+
+TEST (MSEG, SustainHoldsUntilNoteOff)
+{
+    const auto table = makeTable<double> ({ { 0.0, 0.0, 0.0 }, { 0.01, 1.0, 0.0 }, { 0.02, 0.5, 0.0 }, { 0.03, 0.0, 0.0 } }, 2, 2);
+
+    const auto out = renderNote (*table, 4800, 64, 3200);
+
+    // Held at the sustain point from sample 960 until the noteOff block
+    for (std::size_t n = 960; n < 3200 / 64 * 64; ++n)
+        ASSERT_DOUBLE_EQ (out[n], 0.5) << "sample " << n;
+
+    // Then the last 10 ms segment falls to zero and stays there
+    const std::size_t off = 3200 / 64 * 64;
+    EXPECT_NEAR (out[off + 240], 0.25, 1e-9);
+    for (std::size_t n = off + 480; n < out.size(); ++n)
+        ASSERT_EQ (out[n], 0.0) << "sample " << n;
+}
+
+TEST (MSEG, LoopRepeatsWhileGateHeld)
+{
+    const auto table = makeTable<double> ({ { 0.0, 0.0, 0.0 }, { 0.01, 1.0, 0.5 }, { 0.02, 0.0, -0.5 }, { 0.03, 0.2, 0.0 } }, 0, 2);
+
+    MsegPlayhead        playhead;
+    std::vector<double> out (4400);
+    table->noteOn (playhead);
+    table->render (playhead, out.data(), 2880, kSR);
+
+    // Three identical 960-sample cycles
+    for (std::size_t n = 960; n < 2880; ++n)
+        ASSERT_NEAR (out[n], out[n - 960], 1e-9) << "sample " << n;
+
+    // Released on a cycle boundary: one more pass, then on to the last point
+    table->noteOff (playhead);
+    table->render (playhead, out.data() + 2880, 1520, kSR);
+    for (std::size_t n = 2880; n < 3840; ++n)
+        ASSERT_NEAR (out[n], out[n - 960], 1e-9) << "sample " << n;
+    EXPECT_NEAR (out[3840 + 240], 0.1, 1e-9);
+    EXPECT_FALSE (playhead.running);
+    EXPECT_EQ (out.back(), 0.2);
+}
+
+TEST (MSEG, BlockSizeDoesNotChangeOutput)
+{
+    const auto table     = makeTable<float> (curvedPoints<float>(), 1, 3);
+    const auto reference = renderNote (*table, 6000, 4000, 4000);
+
+    // Block sizes that divide the noteOff sample, so every run releases at 4000
+    for (int block : { 1, 5, 64, 500 })
+    {
+        const auto out = renderNote (*table, 6000, block, 4000);
+        for (std::size_t n = 0; n < out.size(); ++n)
+            ASSERT_NEAR (out[n], reference[n], 1e-6) << "block " << block << ", sample " << n;
+    }
+}
+
+TEST (MSEG, VoicesShareOneTable)
+{
+    const auto table = makeTable<double> (curvedPoints<double>());
+
+    constexpr int             kVoices = 16;
+    std::vector<MsegPlayhead> playheads (kVoices);
+    std::vector<double>       out (static_cast<std::size_t> (kVoices) * 3000, -1.0);
+
+    // Voice v starts 32 v samples late
+    for (int start = 0; start < 3000; start += 32)
+    {
+        for (int v = 0; v < kVoices; ++v)
+        {
+            auto& ph = playheads[static_cast<std::size_t> (v)];
+            if (start == 32 * v)
+                table->noteOn (ph);
+            if (start >= 32 * v)
+                table->render (ph, out.data() + v * 3000 + start, std::min (32, 3000 - start), kSR);
+        }
+    }
+
+    for (int v = 1; v < kVoices; ++v)
+        for (int n = 32 * v; n < 3000; ++n)
+            ASSERT_NEAR (out[static_cast<std::size_t> (v * 3000 + n)], out[static_cast<std::size_t> (n - 32 * v)], 1e-12)
+                << "voice " << v << ", sample " << n;
+}
+
+TEST (MSEG, NodePicksUpPublishedTableAtNextBlock)
+{
+    MsegPublisher<float> publisher;
+    MSEG<float>          node;
+    node.setSampleRate (48000.f);
+
+    publisher.publish (makeTable<float> ({ { 0.f, 1.f, 0.f }, { 1.f, 1.f, 0.f } }));
+    node.setPublisher (&publisher);
+    node.noteOn();
+
+    std::vector<float> out (64);
+    node.renderBlock (out.data(), 64);
+    for (float s : out)
+        ASSERT_EQ (s, 1.f);
+
+    // The node still holds the first table until its next block
+    publisher.publish (makeTable<float> ({ { 0.f, 0.5f, 0.f }, { 1.f, 0.5f, 0.f } }));
+    EXPECT_EQ (publisher.numRetired(), 1u);
+    EXPECT_EQ (publisher.collect(), 0u);
+
+    node.renderBlock (out.data(), 64);
+    for (float s : out)
+        ASSERT_EQ (s, 0.5f);
+    EXPECT_EQ (publisher.collect(), 1u);
+    EXPECT_FALSE (node.isIdle());
+
+    // A fixed table replaces the publisher
+    node.setTable (makeTable<float> ({ { 0.f, 0.f, 0.f }, { 0.001f, 0.f, 0.f } }));
+    node.renderBlock (out.data(), 64);
+    EXPECT_TRUE (node.isIdle());
+    EXPECT_EQ (out.back(), 0.f);
+}
@@ -261,12 +261,60 @@
  *      Same routing and source value, process() called 100 times.
  *      valueNormalised() must be the same on every call (no drift).
  *
+ * -----------------------------------------------------------------------
+ * Section 12: Audio-rate Routing
+ * -----------------------------------------------------------------------
+ *
+ * 12.1 AudioRoutingWritesPerSampleModulation
+ *      Audio-rate routing, depth=0.5, ramp source buffer. Every sample of
+ *      getModulationBuffer(destA) equals 0.5 * source; the parameter's
+ *      block modulation stays 0.
+ *
+ * 12.2 BlockAndAudioRoutingsShareDestination
+ *      Block routing (0.2) and audio routing on the same destination.
+ *      The buffer holds 0.2 + audio per sample; the parameter gets 0.2.
+ *
+ * 12.3 DestinationWithoutAudioRoutingHasNoBuffer
+ *      getModulationBuffer returns nullptr for block-only destinations
+ *      and after process() with no frames.
+ *
+ * 12.4 AudioModulationIsClamped
+ *      Two full-depth audio routings on a source at 0.8 clamp to 1.
+ *
+ * 12.5 AudioRoutingWithoutBufferHoldsSourceValue
+ *      No setSourceBuffer: the row is the source value times depth.
+ *      Source buffers are forgotten after each process().
+ *
+ * 12.6 CurvedAudioRoutingShapesEverySample
+ *      Exponential audio routing matches applyCurve per sample.
+ *
+ * -----------------------------------------------------------------------
+ * Section 13: Vectorised Curves
+ * -----------------------------------------------------------------------
+ *
+ * 13.1 SimdCurvesMatchScalarApplyCurve
+ *      detail::applyCurve agrees with ModulationRouting::applyCurve on a
+ *      dense grid over [-1.25, 1.25] for every curve, float and double.
+ *
+ * 13.2 MixedCurveRoutingsMatchScalarReference
+ *      1024 routings of all four curves, some disabled, onto 32
+ *      parameters. Each parameter's modulation equals the scalar sum of
+ *      applyCurve(source) * depth over its enabled routings.
+ *
+ * 13.3 CurvePlanFollowsRoutingChanges
+ *      A group whose size is not a multiple of the SIMD width, then
+ *      disable, remove and an audio-rate curved routing, which must not
+ *      reach the block-rate sum.
+ *
  ************************************************************************/
 
 #include <gtest/gtest.h>
 #include "controls/caspi_ModMatrix.h"
 #include "core/caspi_Parameter.h"
 
+#include <memory>
+#include <vector>
+
 using namespace CASPI::Controls;
 using namespace CASPI::Core;
 
@@ -1463,4 +1511,327 @@ TEST_F (ModMatrixFixture, ModulationIsStableAcross100Blocks)
         EXPECT_NEAR (paramA.valueNormalised(), expected, 1e-5f)
             << "Drift detected at block " << block;
     }
-}
\ No newline at end of file
+}
+
+/*======================================================================
+ * Section 12: Audio-rate Routing
+ *====================================================================*/
+
+namespace
+{
+    constexpr size_t kAudioFrames = 64;
+
+    ModulationRouting<float> audioRouting (size_t src, size_t dst, float depth,
+                                           ModulationCurve curve = ModulationCurve::Linear)
+    {
+        ModulationRouting<float> r (src, dst, depth);
+        r.curve = curve;
+        r.rate  = ModulationRate::Audio;
+        return r;
+    }
+
+    /** Ramp from -1 towards 1 over kAudioFrames samples. */
+    std::array<float, kAudioFrames> rampBuffer()
+    {
+        std::array<float, kAudioFrames> ramp {};
+        for (size_t i = 0; i < kAudioFrames; ++i)
+        {
+            ramp[i] = -1.f + 2.f * static_cast<float> (i) / kAudioFrames;
+        }
+        return ramp;
+    }
+} // namespace
+
+/*
+ * 12.1 AudioRoutingWritesPerSampleModulation
+ *
+ * An audio-rate routing scales the source buffer sample by sample.
+ * It contributes nothing to the parameter's block modulation.
+ */
+TEST_F (ModMatrixFixture, AudioRoutingWritesPerSampleModulation)
+{
+    /* Arrange */
+    const auto ramp = rampBuffer();
+    matrix.setMaxBlockSize (kAudioFrames);
+    matrix.addRouting (audioRouting (0, destA, 0.5f));
+
+    /* Act */
+    matrix.setSourceBuffer (0, ramp.data());
+    matrix.process (kAudioFrames);
+
+    /* Assert */
+    const float* mod = matrix.getModulationBuffer (destA);
+    ASSERT_NE (mod, nullptr);
+    for (size_t i = 0; i < kAudioFrames; ++i)
+    {
+        EXPECT_NEAR (mod[i], 0.5f * ramp[i], 1e-6f) << "sample " << i;
+    }
+    EXPECT_FLOAT_EQ (paramA.getModulationAmount(), 0.f);
+}
+
+/*
+ * 12.2 BlockAndAudioRoutingsShareDestination
+ *
+ * The per-sample buffer starts from the block-rate sum.
+ */
+TEST_F (ModMatrixFixture, BlockAndAudioRoutingsShareDestination)
+{
+    /* Arrange */
+    const auto ramp = rampBuffer();
+    matrix.setMaxBlockSize (kAudioFrames);
+    matrix.setSourceValue (1, 1.f);
+    matrix.addRouting (ModulationRouting<float> (1, destB, 0.2f));
+    matrix.addRouting (audioRouting (0, destB, 0.25f));
+
+    /* Act */
+    matrix.setSourceBuffer (0, ramp.data());
+    matrix.process (kAudioFrames);
+
+    /* Assert */
+    const float* mod = matrix.getModulationBuffer (destB);
+    ASSERT_NE (mod, nullptr);
+    for (size_t i = 0; i < kAudioFrames; ++i)
+    {
+        EXPECT_NEAR (mod[i], 0.2f + 0.25f * ramp[i], 1e-6f) << "sample " << i;
+    }
+    EXPECT_NEAR (paramB.getModulationAmount(), 0.2f, 1e-6f);
+}
+
+/*
+ * 12.3 DestinationWithoutAudioRoutingHasNoBuffer
+ */
+TEST_F (ModMatrixFixture, DestinationWithoutAudioRoutingHasNoBuffer)
+{
+    /* Arrange */
+    const auto ramp = rampBuffer();
+    matrix.setMaxBlockSize (kAudioFrames);
+    matrix.addRouting (ModulationRouting<float> (1, destA, 0.2f));
+    matrix.addRouting (audioRouting (0, destB, 0.5f));
+
+    /* Act / Assert */
+    matrix.setSourceBuffer (0, ramp.data());
+    matrix.process (kAudioFrames);
+    EXPECT_EQ (matrix.getModulationBuffer (destA), nullptr);
+    EXPECT_NE (matrix.getModulationBuffer (destB), nullptr);
+
+    matrix.process();
+    EXPECT_EQ (matrix.getModulationBuffer (destB), nullptr);
+}
+
+/*
+ * 12.4 AudioModulationIsClamped
+ */
+TEST_F (ModMatrixFixture, AudioModulationIsClamped)
+{
+    /* Arrange */
+    std::array<float, kAudioFrames> source {};
+    source.fill (0.8f);
+    matrix.setMaxBlockSize (kAudioFrames);
+    matrix.addRouting (audioRouting (0, destA, 1.f));
+    matrix.addRouting (audioRouting (0, destA, 1.f));
+
+    /* Act */
+    matrix.setSourceBuffer (0, source.data());
+    matrix.process (kAudioFrames);
+
+    /* Assert */
+    const float* mod = matrix.getModulationBuffer (destA);
+    ASSERT_NE (mod, nullptr);
+    for (size_t i = 0; i < kAudioFrames; ++i)
+    {
+        EXPECT_FLOAT_EQ (mod[i], 1.f) << "sample " << i;
+    }
+}
+
+/*
+ * 12.5 AudioRoutingWithoutBufferHoldsSourceValue
+ *
+ * Block 1 supplies a buffer; block 2 does not, so the row falls back
+ * to the held source value.
+ */
+TEST_F (ModMatrixFixture, AudioRoutingWithoutBufferHoldsSourceValue)
+{
+    /* Arrange */
+    const auto ramp = rampBuffer();
+    matrix.setMaxBlockSize (kAudioFrames);
+    matrix.setSourceValue (0, 0.4f);
+    matrix.addRouting (audioRouting (0, destA, 0.5f));
+
+    /* Act */
+    matrix.setSourceBuffer (0, ramp.data());
+    matrix.process (kAudioFrames);
+    matrix.process (kAudioFrames);
+
+    /* Assert */
+    const float* mod = matrix.getModulationBuffer (destA);
+    ASSERT_NE (mod, nullptr);
+    for (size_t i = 0; i < kAudioFrames; ++i)
+    {
+        EXPECT_FLOAT_EQ (mod[i], 0.2f) << "sample " << i;
+    }
+}
+
+/*
+ * 12.6 CurvedAudioRoutingShapesEverySample
+ */
+TEST_F (ModMatrixFixture, CurvedAudioRoutingShapesEverySample)
+{
+    /* Arrange */
+    const auto ramp = rampBuffer();
+    const auto r    = audioRouting (0, destA, 0.75f, ModulationCurve::Exponential);
+    matrix.setMaxBlockSize (kAudioFrames);
+    matrix.addRouting (r);
+
+    /* Act */
+    matrix.setSourceBuffer (0, ramp.data());
+    matrix.process (kAudioFrames);
+
+    /* Assert */
+    const float* mod = matrix.getModulationBuffer (destA);
+    ASSERT_NE (mod, nullptr);
+    for (size_t i = 0; i < kAudioFrames; ++i)
+    {
+        EXPECT_NEAR (mod[i], r.applyCurve (ramp[i]) * 0.75f, 1e-6f) << "sample " << i;
+    }
+}
+
+/*======================================================================
+ * Section 13: Vectorised Curves
+ *====================================================================*/
+
+namespace
+{
+    /** Every value of a grid through detail::applyCurve<C>, compared with the scalar curve. */
+    template <ModulationCurve C, typename FloatType>
+    void expectSimdCurveMatchesScalar()
+    {
+        namespace SIMD      = CASPI::SIMD;
+        constexpr size_t W  = SIMD::Strategy::min_simd_width<FloatType>::value;
+        constexpr size_t kN = 1000;
+
+        ModulationRouting<FloatType> r;
+        r.curve = C;
+
+        std::vector<FloatType> x (kN);
+        std::vector<FloatType> y (kN);
+        for (size_t i = 0; i < kN; ++i)
+        {
+            x[i] = FloatType (-1.25) + FloatType (2.5) * static_cast<FloatType> (i) / FloatType (kN - 1);
+        }
+        for (size_t i = 0; i < kN; i += W)
+        {
+            SIMD::store_unaligned (y.data() + i, detail::applyCurve<C, FloatType> (SIMD::load_unaligned<FloatType> (x.data() + i)));
+        }
+
+        for (size_t i = 0; i < kN; ++i)
+        {
+            if constexpr (std::is_same_v<FloatType, float>)
+            {
+                ASSERT_FLOAT_EQ (y[i], r.applyCurve (x[i])) << "curve " << static_cast<int> (C) << ", x " << x[i];
+            }
+            else
+            {
+                ASSERT_DOUBLE_EQ (y[i], r.applyCurve (x[i])) << "curve " << static_cast<int> (C) << ", x " << x[i];
+            }
+        }
+    }
+} // namespace
+
+/*
+ * 13.1 SimdCurvesMatchScalarApplyCurve
+ */
+TEST (ModMatrixCurves, SimdCurvesMatchScalarApplyCurve)
+{
+    expectSimdCurveMatchesScalar<ModulationCurve::Exponential, float>();
+    expectSimdCurveMatchesScalar<ModulationCurve::Logarithmic, float>();
+    expectSimdCurveMatchesScalar<ModulationCurve::SCurve, float>();
+    expectSimdCurveMatchesScalar<ModulationCurve::Exponential, double>();
+    expectSimdCurveMatchesScalar<ModulationCurve::Logarithmic, double>();
+    expectSimdCurveMatchesScalar<ModulationCurve::SCurve, double>();
+}
+
+/*
+ * 13.2 MixedCurveRoutingsMatchScalarReference
+ *
+ * Depths are small so no destination reaches the [-1, 1] clamp.
+ */
+TEST (ModMatrixCurves, MixedCurveRoutingsMatchScalarReference)
+{
+    /* Arrange */
+    constexpr size_t kParams   = 32;
+    constexpr size_t kRoutings = 1024;
+
+    auto matrix = std::make_unique<ModMatrix<float>>();
+    std::vector<ModulatableParameter<float>> params (kParams);
+    for (auto& p : params)
+    {
+        (void) matrix->registerParameter (&p);
+    }
+
+    for (size_t s = 0; s < MAX_MOD_SOURCES; ++s)
+    {
+        matrix->setSourceValue (s, -1.f + 2.f * static_cast<float> ((s * 37) % 63) / 62.f);
+    }
+
+    const ModulationCurve curves[] = { ModulationCurve::Exponential, ModulationCurve::Logarithmic, ModulationCurve::SCurve, ModulationCurve::Linear };
+    std::vector<double> expected (kParams, 0.0);
+    for (size_t i = 0; i < kRoutings; ++i)
+    {
+        ModulationRouting<float> r ((i * 11) % MAX_MOD_SOURCES, (i * 7) % kParams, -0.03f + 0.06f * static_cast<float> ((i * 13) % 17) / 16.f);
+        r.curve   = curves[(i * 5) % 4];
+        r.enabled = (i % 9) != 0;
+        matrix->addRouting (r);
+
+        if (r.enabled)
+        {
+            expected[r.destinationId] += static_cast<double> (r.applyCurve (matrix->getSourceValue (r.sourceId)) * r.depth);
+        }
+    }
+
+    /* Act */
+    matrix->process();
+
+    /* Assert */
+    EXPECT_EQ (matrix->getNumLinearRoutings(), 256u);
+    EXPECT_EQ (matrix->getNumNonLinearRoutings(), 768u);
+    for (size_t d = 0; d < kParams; ++d)
+    {
+        ASSERT_LT (std::abs (expected[d]), 1.0);
+        EXPECT_NEAR (params[d].getModulationAmount(), expected[d], 2e-6) << "destination " << d;
+    }
+}
+
+/*
+ * 13.3 CurvePlanFollowsRoutingChanges
+ */
+TEST_F (ModMatrixFixture, CurvePlanFollowsRoutingChanges)
+{
+    /* Arrange: five S-curve routings, not a multiple of any SIMD width */
+    ModulationRouting<float> r (0, destB, 0.1f);
+    r.curve = ModulationCurve::SCurve;
+    matrix.setSourceValue (0, 0.5f);
+    for (int i = 0; i < 5; ++i)
+    {
+        matrix.addRouting (r);
+    }
+    const float one = r.applyCurve (0.5f) * 0.1f;
+
+    /* Act / Assert */
+    matrix.process();
+    EXPECT_NEAR (paramB.getModulationAmount(), 5.f * one, 1e-6f);
+
+    matrix.setRoutingEnabled<ModulationCurve::SCurve> (1, false);
+    matrix.process();
+    EXPECT_NEAR (paramB.getModulationAmount(), 4.f * one, 1e-6f);
+
+    matrix.removeRouting<ModulationCurve::SCurve> (0);
+    matrix.process();
+    EXPECT_NEAR (paramB.getModulationAmount(), 3.f * one, 1e-6f);
+
+    auto audio = r;
+    audio.rate = ModulationRate::Audio;
+    matrix.addRouting (audio);
+    matrix.process();
+    EXPECT_EQ (matrix.getNumNonLinearRoutings(), 5u);
+    EXPECT_NEAR (paramB.getModulationAmount(), 3.f * one, 1e-6f);
+}
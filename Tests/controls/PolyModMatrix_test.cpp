@@ -0,0 +1,412 @@
+/*************************************************************************
+ * @file PolyModMatrix_test.cpp
+ *
+ * Unit tests for:
+ *   CASPI::Controls::PolyModMatrix<float, N>
+ *
+ * TEST PLAN SUMMARY
+ * =================
+ *
+ * As with ModMatrix, routing mutations are applied by process(); tests
+ * call process() before asserting. Parameter smoothers are converged in
+ * the fixture so valueNormalised() reflects base + modulation.
+ *
+ * -----------------------------------------------------------------------
+ * Section 1: Registration
+ * -----------------------------------------------------------------------
+ *
+ * 1.1  RegisterReturnsSequentialIdsAcrossKinds
+ *      Voice and global registrations share one id space.
+ *
+ * 1.2  RegisterWithNullParameterReturnsError
+ *      A null pointer in either form returns NullParameter.
+ *
+ * -----------------------------------------------------------------------
+ * Section 2: Voice Lanes
+ * -----------------------------------------------------------------------
+ *
+ * 2.1  PerVoiceSourceReachesOnlyItsVoice
+ *      Source values differ per voice; each voice's parameter gets
+ *      its own source * depth.
+ *
+ * 2.2  BroadcastSourceReachesEveryVoice
+ *
+ * 2.3  CurvedRoutingShapesEachLane
+ *      S-curve routing matches applyCurve per voice.
+ *
+ * 2.4  InactiveVoicesAreNotWritten
+ *      Voices outside setActiveVoices() keep their old modulation.
+ *
+ * 2.5  MatchesOneModMatrixPerVoice
+ *      Mixed linear and curved routings onto three destinations agree
+ *      with a ModMatrix per voice driven with the same source values.
+ *
+ * -----------------------------------------------------------------------
+ * Section 3: Global Destinations
+ * -----------------------------------------------------------------------
+ *
+ * 3.1  GlobalParameterReceivesSingleUpdate
+ *      A global destination is modulated from the source's first lane
+ *      and reads the same for every voice.
+ *
+ * -----------------------------------------------------------------------
+ * Section 4: Shared Routing Table
+ * -----------------------------------------------------------------------
+ *
+ * 4.1  RoutingCommandsApplyToAllVoices
+ *      Disable, re-enable, remove and clear change every voice at once.
+ *
+ * 4.2  ResetZerosSourcesAndModulation
+ *
+ ************************************************************************/
+
+#include <gtest/gtest.h>
+#include "controls/caspi_ModMatrix.h"
+#include "controls/caspi_PolyModMatrix.h"
+#include "core/caspi_Parameter.h"
+
+#include <array>
+#include <memory>
+#include <vector>
+
+using namespace CASPI::Controls;
+using namespace CASPI::Core;
+
+/*======================================================================
+ * Shared fixture
+ *
+ * A PolyModMatrix<float, 6> (one full and one partial SIMD group of
+ * float lanes) with:
+ *   cutoff : per-voice parameter, base = 0.5, destination voiceDest
+ *   master : global parameter,    base = 0.5, destination globalDest
+ *====================================================================*/
+struct PolyModMatrixFixture : ::testing::Test
+{
+    static constexpr size_t kVoices = 6;
+    using Matrix                    = PolyModMatrix<float, kVoices>;
+
+    std::unique_ptr<Matrix> matrix = std::make_unique<Matrix>();
+    std::array<ModulatableParameter<float>, kVoices> cutoff {};
+    ModulatableParameter<float> master { 0.f, 1.f, 0.5f };
+    size_t voiceDest {};
+    size_t globalDest {};
+
+    static Matrix::VoiceParameters pointersTo (std::array<ModulatableParameter<float>, kVoices>& params)
+    {
+        Matrix::VoiceParameters ptrs {};
+        for (size_t v = 0; v < kVoices; ++v)
+        {
+            ptrs[v] = &params[v];
+        }
+        return ptrs;
+    }
+
+    void SetUp() override
+    {
+        voiceDest  = matrix->registerVoiceParameter (pointersTo (cutoff)).value();
+        globalDest = matrix->registerGlobalParameter (&master).value();
+        for (auto& p : cutoff)
+        {
+            p.setBaseNormalised (0.5f);
+            p.process();
+        }
+        master.process();
+    }
+};
+
+/*======================================================================
+ * Section 1: Registration
+ *====================================================================*/
+
+/*
+ * 1.1 RegisterReturnsSequentialIdsAcrossKinds
+ */
+TEST_F (PolyModMatrixFixture, RegisterReturnsSequentialIdsAcrossKinds)
+{
+    /* Assert */
+    EXPECT_EQ (voiceDest, 0u);
+    EXPECT_EQ (globalDest, 1u);
+    EXPECT_EQ (matrix->getNumParameters(), 2u);
+    EXPECT_FALSE (matrix->isGlobalParameter (voiceDest));
+    EXPECT_TRUE (matrix->isGlobalParameter (globalDest));
+}
+
+/*
+ * 1.2 RegisterWithNullParameterReturnsError
+ */
+TEST_F (PolyModMatrixFixture, RegisterWithNullParameterReturnsError)
+{
+    /* Arrange */
+    auto ptrs = pointersTo (cutoff);
+    ptrs[3]   = nullptr;
+
+    /* Act */
+    const auto voiceResult  = matrix->registerVoiceParameter (ptrs);
+    const auto globalResult = matrix->registerGlobalParameter (nullptr);
+
+    /* Assert */
+    ASSERT_FALSE (voiceResult.has_value());
+    EXPECT_EQ (voiceResult.error(), Matrix::ParamRegistrationError::NullParameter);
+    ASSERT_FALSE (globalResult.has_value());
+    EXPECT_EQ (globalResult.error(), Matrix::ParamRegistrationError::NullParameter);
+    EXPECT_EQ (matrix->getNumParameters(), 2u);
+}
+
+/*======================================================================
+ * Section 2: Voice Lanes
+ *====================================================================*/
+
+/*
+ * 2.1 PerVoiceSourceReachesOnlyItsVoice
+ */
+TEST_F (PolyModMatrixFixture, PerVoiceSourceReachesOnlyItsVoice)
+{
+    /* Arrange */
+    for (size_t v = 0; v < kVoices; ++v)
+    {
+        matrix->setSourceValue (0, v, 0.1f * static_cast<float> (v));
+    }
+    matrix->addRouting (ModulationRouting<float> (0, voiceDest, 0.5f));
+
+    /* Act */
+    matrix->process();
+
+    /* Assert */
+    for (size_t v = 0; v < kVoices; ++v)
+    {
+        EXPECT_NEAR (cutoff[v].getModulationAmount(), 0.05f * static_cast<float> (v), 1e-6f) << "voice " << v;
+        EXPECT_NEAR (matrix->getModulation (voiceDest, v), 0.05f * static_cast<float> (v), 1e-6f) << "voice " << v;
+    }
+}
+
+/*
+ * 2.2 BroadcastSourceReachesEveryVoice
+ */
+TEST_F (PolyModMatrixFixture, BroadcastSourceReachesEveryVoice)
+{
+    /* Arrange */
+    matrix->setSourceValue (2, 0.8f);
+    matrix->addRouting (ModulationRouting<float> (2, voiceDest, -0.25f));
+
+    /* Act */
+    matrix->process();
+
+    /* Assert */
+    for (size_t v = 0; v < kVoices; ++v)
+    {
+        EXPECT_NEAR (cutoff[v].valueNormalised(), 0.3f, 1e-6f) << "voice " << v;
+    }
+}
+
+/*
+ * 2.3 CurvedRoutingShapesEachLane
+ */
+TEST_F (PolyModMatrixFixture, CurvedRoutingShapesEachLane)
+{
+    /* Arrange */
+    ModulationRouting<float> r (1, voiceDest, 0.9f);
+    r.curve = ModulationCurve::SCurve;
+    for (size_t v = 0; v < kVoices; ++v)
+    {
+        matrix->setSourceValue (1, v, -0.9f + 0.35f * static_cast<float> (v));
+    }
+    matrix->addRouting (r);
+
+    /* Act */
+    matrix->process();
+
+    /* Assert */
+    for (size_t v = 0; v < kVoices; ++v)
+    {
+        const float expected = r.applyCurve (matrix->getSourceValue (1, v)) * 0.9f;
+        EXPECT_NEAR (cutoff[v].getModulationAmount(), expected, 1e-6f) << "voice " << v;
+    }
+}
+
+/*
+ * 2.4 InactiveVoicesAreNotWritten
+ */
+TEST_F (PolyModMatrixFixture, InactiveVoicesAreNotWritten)
+{
+    /* Arrange */
+    matrix->setSourceValue (0, 1.f);
+    matrix->addRouting (ModulationRouting<float> (0, voiceDest, 0.2f));
+    matrix->process();
+
+    /* Act: only voices 1 and 4 active, source changes */
+    matrix->setActiveVoices ((Matrix::Mask (1) << 1) | (Matrix::Mask (1) << 4));
+    matrix->setSourceValue (0, 0.5f);
+    matrix->process();
+
+    /* Assert */
+    for (size_t v = 0; v < kVoices; ++v)
+    {
+        const float expected = (v == 1 || v == 4) ? 0.1f : 0.2f;
+        EXPECT_NEAR (cutoff[v].getModulationAmount(), expected, 1e-6f) << "voice " << v;
+    }
+}
+
+/*
+ * 2.5 MatchesOneModMatrixPerVoice
+ */
+TEST_F (PolyModMatrixFixture, MatchesOneModMatrixPerVoice)
+{
+    /* Arrange: a second and third per-voice destination, and one ModMatrix per voice */
+    std::array<ModulatableParameter<float>, kVoices> resonance {};
+    std::array<ModulatableParameter<float>, kVoices> drive {};
+    const size_t resDest   = matrix->registerVoiceParameter (pointersTo (resonance)).value();
+    const size_t driveDest = matrix->registerVoiceParameter (pointersTo (drive)).value();
+
+    std::vector<std::unique_ptr<ModMatrix<float>>> mono;
+    std::array<ModulatableParameter<float>, 3 * kVoices> monoParams {};
+    for (size_t v = 0; v < kVoices; ++v)
+    {
+        mono.push_back (std::make_unique<ModMatrix<float>>());
+        for (size_t d = 0; d < 3; ++d)
+        {
+            (void) mono[v]->registerParameter (&monoParams[3 * v + d]);
+        }
+    }
+
+    const ModulationCurve curves[] = { ModulationCurve::Linear, ModulationCurve::Exponential, ModulationCurve::Logarithmic, ModulationCurve::SCurve };
+    const size_t polyDests[]       = { voiceDest, resDest, driveDest };
+    for (size_t i = 0; i < 24; ++i)
+    {
+        ModulationRouting<float> r (i % 5, 0, -0.9f + 0.077f * static_cast<float> (i));
+        r.curve = curves[i % 4];
+
+        r.destinationId = polyDests[(i * 2) % 3];
+        matrix->addRouting (r);
+
+        r.destinationId = (i * 2) % 3;
+        for (auto& m : mono)
+        {
+            m->addRouting (r);
+        }
+    }
+
+    for (size_t s = 0; s < 5; ++s)
+    {
+        for (size_t v = 0; v < kVoices; ++v)
+        {
+            const float value = -1.f + 2.f * static_cast<float> ((s * 7 + v * 3) % 11) / 10.f;
+            matrix->setSourceValue (s, v, value);
+            mono[v]->setSourceValue (s, value);
+        }
+    }
+
+    /* Act */
+    matrix->process();
+    for (auto& m : mono)
+    {
+        m->process();
+    }
+
+    /* Assert */
+    for (size_t v = 0; v < kVoices; ++v)
+    {
+        for (size_t d = 0; d < 3; ++d)
+        {
+            EXPECT_NEAR (matrix->getModulation (polyDests[d], v), monoParams[3 * v + d].getModulationAmount(), 1e-6f)
+                << "voice " << v << ", destination " << d;
+        }
+    }
+}
+
+/*======================================================================
+ * Section 3: Global Destinations
+ *====================================================================*/
+
+/*
+ * 3.1 GlobalParameterReceivesSingleUpdate
+ */
+TEST_F (PolyModMatrixFixture, GlobalParameterReceivesSingleUpdate)
+{
+    /* Arrange */
+    matrix->setSourceValue (3, 0.6f);
+    matrix->addRouting (ModulationRouting<float> (3, globalDest, 0.5f));
+    matrix->addRouting (ModulationRouting<float> (3, voiceDest, 0.25f));
+
+    /* Act */
+    matrix->process();
+
+    /* Assert */
+    EXPECT_NEAR (master.getModulationAmount(), 0.3f, 1e-6f);
+    EXPECT_NEAR (master.valueNormalised(), 0.8f, 1e-6f);
+    for (size_t v = 0; v < kVoices; ++v)
+    {
+        EXPECT_NEAR (matrix->getModulation (globalDest, v), 0.3f, 1e-6f) << "voice " << v;
+        EXPECT_NEAR (cutoff[v].getModulationAmount(), 0.15f, 1e-6f) << "voice " << v;
+    }
+}
+
+/*======================================================================
+ * Section 4: Shared Routing Table
+ *====================================================================*/
+
+/*
+ * 4.1 RoutingCommandsApplyToAllVoices
+ */
+TEST_F (PolyModMatrixFixture, RoutingCommandsApplyToAllVoices)
+{
+    /* Arrange */
+    ModulationRouting<float> curved (0, voiceDest, 0.5f);
+    curved.curve = ModulationCurve::Exponential;
+    matrix->setSourceValue (0, 1.f);
+    matrix->addRouting (ModulationRouting<float> (0, voiceDest, 0.2f));
+    matrix->addRouting (curved);
+    matrix->process();
+    ASSERT_EQ (matrix->getNumLinearRoutings(), 1u);
+    ASSERT_EQ (matrix->getNumNonLinearRoutings(), 1u);
+
+    /* Act / Assert: disable the linear routing */
+    matrix->setRoutingEnabled (0, false);
+    matrix->process();
+    for (size_t v = 0; v < kVoices; ++v)
+    {
+        EXPECT_NEAR (cutoff[v].getModulationAmount(), 0.5f, 1e-6f) << "voice " << v;
+    }
+
+    /* Remove the curved routing, re-enable the linear one */
+    matrix->removeRouting<ModulationCurve::Exponential> (0);
+    matrix->setRoutingEnabled (0, true);
+    matrix->process();
+    EXPECT_EQ (matrix->getNumRoutings(), 1u);
+    for (size_t v = 0; v < kVoices; ++v)
+    {
+        EXPECT_NEAR (cutoff[v].getModulationAmount(), 0.2f, 1e-6f) << "voice " << v;
+    }
+
+    /* Clear */
+    matrix->clearRoutings();
+    matrix->process();
+    EXPECT_EQ (matrix->getNumRoutings(), 0u);
+    for (size_t v = 0; v < kVoices; ++v)
+    {
+        EXPECT_FLOAT_EQ (cutoff[v].getModulationAmount(), 0.f) << "voice " << v;
+    }
+}
+
+/*
+ * 4.2 ResetZerosSourcesAndModulation
+ */
+TEST_F (PolyModMatrixFixture, ResetZerosSourcesAndModulation)
+{
+    /* Arrange */
+    matrix->setSourceValue (0, 1.f);
+    matrix->addRouting (ModulationRouting<float> (0, voiceDest, 0.4f));
+    matrix->addRouting (ModulationRouting<float> (0, globalDest, 0.4f));
+    matrix->process();
+
+    /* Act */
+    matrix->reset();
+
+    /* Assert */
+    EXPECT_FLOAT_EQ (matrix->getSourceValue (0, 2), 0.f);
+    EXPECT_FLOAT_EQ (master.getModulationAmount(), 0.f);
+    for (size_t v = 0; v < kVoices; ++v)
+    {
+        EXPECT_FLOAT_EQ (cutoff[v].getModulationAmount(), 0.f) << "voice " << v;
+    }
+    EXPECT_EQ (matrix->getNumRoutings(), 2u);
+}
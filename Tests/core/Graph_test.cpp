@@ -152,6 +152,20 @@
  * Section 13: Graph vs standalone equivalence
  * -----------------------------------------------------------------------
  * 13.1  GraphSineRMSMatchesStandaloneRMSWithinFivePercent
+ *
+ * -----------------------------------------------------------------------
+ * Section 14: Output channel count
+ * -----------------------------------------------------------------------
+ * 14.1  NodesDefaultToMultichannel
+ * 14.2  MonoNodePreparesSingleChannel
+ * 14.3  FollowInputMatchesMonoInput
+ * 14.4  FollowInputWidensForMultichannelInput
+ * 14.5  FollowInputWithoutInputsUsesGraphWidth
+ * 14.6  MultichannelConsumerBroadcastsMonoInput
+ * 14.7  CopyBroadcastExpandsMonoAndKeepsStereo
+ * 14.8  PerFrameProducersDeclareMono
+ * 14.9  MixedWidthInputsAreBroadcastPerLink
+ * 14.10 MonoSinkReadsBackAtGraphWidth
  */
 
 #include "analysis/caspi_SpectralProfile.h"
@@ -164,6 +178,7 @@
 #include "oscillators/caspi_Noise.h"
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <memory>
@@ -1519,4 +1534,192 @@ TEST_F (GraphIntegrationFixture, GraphSineRMSMatchesStandaloneRMSWithinFivePerce
     EXPECT_GT (rmsGraph,      0.1f);
     EXPECT_GT (rmsStandalone, 0.1f);
     EXPECT_NEAR (rmsGraph, rmsStandalone, rmsStandalone * 0.05f);
-}
\ No newline at end of file
+}
+
+/*======================================================================
+ * Section 14: Output channel count
+ *====================================================================*/
+
+TEST_F (AudioGraphFixture, NodesDefaultToMultichannel)
+{
+    NodeId id = addConstant (1.0f);
+    EXPECT_EQ (graph.getNode (id)->getOutputChannelMode (0), ChannelMode::Multichannel);
+
+    prepareGraph();
+    EXPECT_EQ (graph.getNode (id)->getOutputBuffer (0)->numChannels(), kChannels);
+}
+
+TEST_F (AudioGraphFixture, MonoNodePreparesSingleChannel)
+{
+    NodeId id = addConstant (1.0f);
+    graph.getNodeAs<ConstantNode<float>> (id)->setOutputChannelMode (ChannelMode::Mono);
+
+    prepareGraph();
+    graph.process();
+
+    const auto* buf = graph.getNode (id)->getOutputBuffer (0);
+    ASSERT_EQ (buf->numChannels(), 1u);
+    EXPECT_EQ (buf->numFrames(), kFrames);
+    EXPECT_FLOAT_EQ (buf->sample (0, kFrames - 1), 1.0f);
+}
+
+TEST_F (AudioGraphFixture, FollowInputMatchesMonoInput)
+{
+    NodeId src   = addConstant (1.0f);
+    NodeId sumId = addSum (1);
+    graph.getNodeAs<ConstantNode<float>> (src)->setOutputChannelMode (ChannelMode::Mono);
+    graph.getNodeAs<SumNode<float>> (sumId)->setOutputChannelMode (ChannelMode::FollowInput);
+    ASSERT_TRUE (connectAudio (src, 0, sumId, 0).has_value());
+
+    prepareGraph();
+    graph.process();
+
+    const auto* buf = graph.getNode (sumId)->getOutputBuffer (0);
+    ASSERT_EQ (buf->numChannels(), 1u);
+    EXPECT_FLOAT_EQ (buf->sample (0, 0), 1.0f);
+}
+
+TEST_F (AudioGraphFixture, FollowInputWidensForMultichannelInput)
+{
+    NodeId mono   = addConstant (0.25f);
+    NodeId stereo = addConstant (0.5f);
+    NodeId sumId  = addSum (2);
+    graph.getNodeAs<ConstantNode<float>> (mono)->setOutputChannelMode (ChannelMode::Mono);
+    graph.getNodeAs<SumNode<float>> (sumId)->setOutputChannelMode (ChannelMode::FollowInput);
+    ASSERT_TRUE (connectAudio (mono, 0, sumId, 0).has_value());
+    ASSERT_TRUE (connectAudio (stereo, 0, sumId, 1).has_value());
+
+    prepareGraph();
+    graph.process();
+
+    const auto* buf = graph.getNode (sumId)->getOutputBuffer (0);
+    ASSERT_EQ (buf->numChannels(), kChannels);
+    for (std::size_t ch = 0; ch < kChannels; ++ch)
+    {
+        EXPECT_FLOAT_EQ (buf->sample (ch, 0), 0.75f) << "ch=" << ch;
+    }
+}
+
+TEST_F (AudioGraphFixture, FollowInputWithoutInputsUsesGraphWidth)
+{
+    NodeId sumId = addSum (1);
+    graph.getNodeAs<SumNode<float>> (sumId)->setOutputChannelMode (ChannelMode::FollowInput);
+
+    prepareGraph();
+    EXPECT_EQ (graph.getNode (sumId)->getOutputBuffer (0)->numChannels(), kChannels);
+}
+
+TEST_F (AudioGraphFixture, MultichannelConsumerBroadcastsMonoInput)
+{
+    NodeId src   = addConstant (0.3f);
+    NodeId sumId = addSum (1);
+    graph.getNodeAs<ConstantNode<float>> (src)->setOutputChannelMode (ChannelMode::Mono);
+    ASSERT_TRUE (connectAudio (src, 0, sumId, 0).has_value());
+
+    prepareGraph();
+    graph.process();
+
+    const auto* buf = graph.getNode (sumId)->getOutputBuffer (0);
+    ASSERT_EQ (buf->numChannels(), kChannels);
+    for (std::size_t ch = 0; ch < kChannels; ++ch)
+    {
+        for (std::size_t fr = 0; fr < kFrames; ++fr)
+        {
+            ASSERT_FLOAT_EQ (buf->sample (ch, fr), 0.3f) << "ch=" << ch << " fr=" << fr;
+        }
+    }
+}
+
+TEST (ChannelBroadcastTest, CopyBroadcastExpandsMonoAndKeepsStereo)
+{
+    AudioBuffer<float, ChannelMajorLayout> mono (1, 37);
+    AudioBuffer<float, ChannelMajorLayout> stereo (2, 37);
+    AudioBuffer<float, ChannelMajorLayout> dst (2, 37);
+
+    for (std::size_t fr = 0; fr < 37; ++fr)
+    {
+        mono.sample (0, fr)   = static_cast<float> (fr);
+        stereo.sample (0, fr) = static_cast<float> (fr);
+        stereo.sample (1, fr) = -static_cast<float> (fr);
+    }
+
+    copyBroadcast (mono, dst);
+    for (std::size_t fr = 0; fr < 37; ++fr)
+    {
+        EXPECT_FLOAT_EQ (dst.sample (0, fr), static_cast<float> (fr));
+        EXPECT_FLOAT_EQ (dst.sample (1, fr), static_cast<float> (fr));
+    }
+
+    copyBroadcast (stereo, dst);
+    addBroadcast (mono, dst);
+    for (std::size_t fr = 0; fr < 37; ++fr)
+    {
+        EXPECT_FLOAT_EQ (dst.sample (0, fr), 2.0f * static_cast<float> (fr));
+        EXPECT_FLOAT_EQ (dst.sample (1, fr), 0.0f);
+    }
+}
+
+TEST (ChannelBroadcastTest, PerFrameProducersDeclareMono)
+{
+    AudioGraph<float> g;
+    auto osc = g.emplace<Oscillators::BlepOscillator<float>>();
+    auto env = g.emplace<Envelope::ADSR<float>>();
+    ASSERT_TRUE (g.prepare (2, 64, 44100.0).has_value());
+
+    EXPECT_EQ (osc.node.getOutputChannelMode (0), ChannelMode::Mono);
+    EXPECT_EQ (g.getNode (osc.id)->getOutputBuffer (0)->numChannels(), 1u);
+    EXPECT_EQ (g.getNode (env.id)->getOutputBuffer (0)->numChannels(), 1u);
+}
+
+TEST_F (AudioGraphFixture, MixedWidthInputsAreBroadcastPerLink)
+{
+    NodeId mono   = addConstant (0.5f);
+    NodeId stereo = addConstant (4.0f);
+    auto   mulH   = graph.emplace<MultiplyNode<float>>();
+    graph.getNodeAs<ConstantNode<float>> (mono)->setOutputChannelMode (ChannelMode::Mono);
+    ASSERT_TRUE (connectAudio (mono, 0, mulH.id, 0).has_value());
+    ASSERT_TRUE (connectAudio (stereo, 0, mulH.id, 1).has_value());
+
+    prepareGraph();
+    graph.process();
+    graph.process();
+
+    // The source stays mono; only the multiply node sees two channels
+    EXPECT_EQ (graph.getNode (mono)->getOutputBuffer (0)->numChannels(), 1u);
+    const auto* buf = graph.getNode (mulH.id)->getOutputBuffer (0);
+    ASSERT_EQ (buf->numChannels(), kChannels);
+    for (std::size_t ch = 0; ch < kChannels; ++ch)
+    {
+        for (std::size_t fr = 0; fr < kFrames; ++fr)
+        {
+            ASSERT_FLOAT_EQ (buf->sample (ch, fr), 2.0f) << "ch=" << ch << " fr=" << fr;
+        }
+    }
+}
+
+TEST (ChannelBroadcastTest, MonoSinkReadsBackAtGraphWidth)
+{
+    AudioGraph<float> g;
+    auto osc = g.emplace<Oscillators::BlepOscillator<float>>();
+    osc.node.setFrequency (440.0f);
+    ASSERT_TRUE (g.prepare (2, 64, 44100.0).has_value());
+    g.process();
+
+    // The sink is narrower than the graph; a host broadcasts it instead of
+    // reading channel 1 past the end of the buffer.
+    const auto* sink = g.getNode (osc.id)->getOutputBuffer (0);
+    ASSERT_EQ (g.getNumChannels(), 2u);
+    ASSERT_EQ (sink->numChannels(), 1u);
+
+    AudioBuffer<float, ChannelMajorLayout> host (g.getNumChannels(), 64);
+    copyBroadcast (*sink, host);
+
+    float peak = 0.0f;
+    for (std::size_t fr = 0; fr < 64; ++fr)
+    {
+        EXPECT_FLOAT_EQ (host.sample (0, fr), sink->sample (0, fr));
+        EXPECT_FLOAT_EQ (host.sample (1, fr), sink->sample (0, fr));
+        peak = std::max (peak, std::abs (host.sample (1, fr)));
+    }
+    EXPECT_GT (peak, 0.1f);
+}
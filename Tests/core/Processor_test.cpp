@@ -56,6 +56,8 @@
  * 6.3  GainProcessorInGraphScalesUpstreamAudio
  * 6.4  ProcessorProcessImplCalledEachBlock
  * 6.5  ProcessorOutputBufferUpdatedEachBlock
+ * 6.6  ProcessorFollowsMonoUpstream
+ * 6.7  MultichannelProcessorBroadcastsMonoUpstream
  *
  ************************************************************************/
 
@@ -512,4 +514,47 @@ TEST_F (ProcessorFixture, ProcessorOutputBufferUpdatedEachBlock)
 
     graph.process();
     EXPECT_FLOAT_EQ (rawProc->getOutputBuffer (0)->sample (0, 0), 2.0f);
-}
\ No newline at end of file
+}
+
+TEST_F (ProcessorFixture, ProcessorFollowsMonoUpstream)
+{
+    auto srcNode = std::make_unique<ConstantSource<float>> (0.5f);
+    srcNode->setOutputChannelMode (ChannelMode::Mono);
+    NodeId srcId = graph.addNode (std::move (srcNode)).value();
+
+    auto procNode = std::make_unique<GainProcessor<float>> (2.0f);
+    auto* rawProc = procNode.get();
+    NodeId procId = graph.addNode (std::move (procNode)).value();
+
+    ASSERT_TRUE (graph.connect (srcId, 0, procId, 0, ConnectionType::Audio).has_value());
+    prepareGraph();
+    graph.process();
+
+    const auto* buf = rawProc->getOutputBuffer (0);
+    ASSERT_EQ (buf->numChannels(), 1u);
+    for (std::size_t f = 0; f < kFrames; ++f)
+        EXPECT_FLOAT_EQ (buf->sample (0, f), 1.0f) << "f=" << f;
+}
+
+TEST_F (ProcessorFixture, MultichannelProcessorBroadcastsMonoUpstream)
+{
+    auto srcNode = std::make_unique<ConstantSource<float>> (0.5f);
+    srcNode->setOutputChannelMode (ChannelMode::Mono);
+    NodeId srcId = graph.addNode (std::move (srcNode)).value();
+
+    auto procNode = std::make_unique<GainProcessor<float>> (2.0f);
+    procNode->setOutputChannelMode (ChannelMode::Multichannel);
+    auto* rawProc = procNode.get();
+    NodeId procId = graph.addNode (std::move (procNode)).value();
+
+    ASSERT_TRUE (graph.connect (srcId, 0, procId, 0, ConnectionType::Audio).has_value());
+    prepareGraph();
+    graph.process();
+
+    const auto* buf = rawProc->getOutputBuffer (0);
+    ASSERT_EQ (buf->numChannels(), kChannels);
+    for (std::size_t ch = 0; ch < kChannels; ++ch)
+        for (std::size_t f = 0; f < kFrames; ++f)
+            EXPECT_FLOAT_EQ (buf->sample (ch, f), 1.0f)
+                << "ch=" << ch << " f=" << f;
+}
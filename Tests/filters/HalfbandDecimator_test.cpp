@@ -0,0 +1,279 @@
+/*
+ * @file HalfbandDecimator_test.cpp
+ *
+ * Unit tests for:
+ *   CASPI::Filters::HalfbandDecimator<FloatType, PhaseTaps>
+ *
+ * TEST STRATEGY
+ *
+ * Coefficient tests (Section 1)
+ *   Check the halfband design directly: symmetry and unity DC gain.
+ *
+ * Streaming tests (Section 2)
+ *   Verify the SIMD block path against a direct-form FIR reference, and
+ *   that chunking, single-sample and in-place use give identical output.
+ *
+ * Response tests (Section 3)
+ *   Decimate sinusoids and measure steady-state gain at passband and
+ *   stopband frequencies, expressed relative to the input sample rate.
+ *
+ * TEST PLAN SUMMARY
+ *
+ * Section 1: Design
+ *   1.1  CoefficientsAreSymmetric
+ *   1.2  DcGainIsUnity
+ *
+ * Section 2: Streaming
+ *   2.1  MatchesDirectFormReference
+ *   2.2  ChunkingDoesNotChangeOutput
+ *   2.3  ProcessSampleMatchesBlock
+ *   2.4  InPlaceMatchesOutOfPlace
+ *   2.5  ResetClearsHistory
+ *
+ * Section 3: Frequency response
+ *   3.1  PassbandIsFlat
+ *   3.2  StopbandIsRejected
+ *   3.3  FloatMatchesDouble
+ */
+
+#include "filters/caspi_HalfbandDecimator.h"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace CASPI::Filters;
+
+/*
+ * Test helpers
+ */
+
+static std::vector<double> makeNoise (std::size_t n)
+{
+    std::mt19937 rng (7u);
+    std::uniform_real_distribution<double> dist (-1.0, 1.0);
+
+    std::vector<double> out (n);
+    for (auto& s : out)
+    {
+        s = dist (rng);
+    }
+    return out;
+}
+
+/*
+ * gainDb
+ *
+ * Steady-state gain in dB of a sinusoid at `cyclesPerSample` of the input
+ * rate, measured over the second half of the decimated output.
+ */
+template <typename FloatType, std::size_t PhaseTaps>
+static double gainDb (double cyclesPerSample)
+{
+    const std::size_t numOutputs = 4096;
+
+    std::vector<FloatType> input (2 * numOutputs);
+    for (std::size_t i = 0; i < input.size(); ++i)
+    {
+        input[i] = static_cast<FloatType> (std::sin (2.0 * CASPI::Constants::PI<double> * cyclesPerSample * static_cast<double> (i)));
+    }
+
+    HalfbandDecimator<FloatType, PhaseTaps> decimator;
+    std::vector<FloatType> output (numOutputs);
+    decimator.process (input.data(), output.data(), numOutputs);
+
+    double power = 0.0;
+    for (std::size_t i = numOutputs / 2; i < numOutputs; ++i)
+    {
+        power += static_cast<double> (output[i]) * static_cast<double> (output[i]);
+    }
+    power /= static_cast<double> (numOutputs / 2);
+
+    // A unit sinusoid has power 1/2
+    return 10.0 * std::log10 (2.0 * power + 1e-300);
+}
+
+/*
+ * Section 1: Design
+ */
+
+TEST (HalfbandDecimator, CoefficientsAreSymmetric)
+{
+    HalfbandDecimator<double> decimator;
+    const auto& g = decimator.getCoefficients();
+
+    for (std::size_t i = 0; i < g.size(); ++i)
+    {
+        EXPECT_DOUBLE_EQ (g[i], g[g.size() - 1 - i]) << "tap " << i;
+    }
+}
+
+TEST (HalfbandDecimator, DcGainIsUnity)
+{
+    HalfbandDecimator<double> decimator;
+
+    double sum = 0.0;
+    for (double c : decimator.getCoefficients())
+    {
+        sum += c;
+    }
+    EXPECT_NEAR (sum, 0.5, 1e-15);
+
+    std::vector<double> ones (512, 1.0);
+    std::vector<double> out (256);
+    decimator.process (ones.data(), out.data(), out.size());
+
+    EXPECT_NEAR (out.back(), 1.0, 1e-12);
+}
+
+/*
+ * Section 2: Streaming
+ */
+
+TEST (HalfbandDecimator, MatchesDirectFormReference)
+{
+    HalfbandDecimator<double> decimator;
+    const auto& g = decimator.getCoefficients();
+
+    // Expand to the full prototype: even taps from g, centre tap 1/2
+    const std::size_t length = 2 * g.size() - 1;
+    std::vector<double> h (length, 0.0);
+    for (std::size_t i = 0; i < g.size(); ++i)
+    {
+        h[2 * i] = g[i];
+    }
+    h[g.size() - 1] = 0.5;
+
+    const auto input = makeNoise (1000);
+    std::vector<double> output (input.size() / 2);
+    decimator.process (input.data(), output.data(), output.size());
+
+    for (std::size_t m = 0; m < output.size(); ++m)
+    {
+        double expected = 0.0;
+        for (std::size_t k = 0; k < length; ++k)
+        {
+            if (2 * m >= k)
+            {
+                expected += h[k] * input[2 * m - k];
+            }
+        }
+        ASSERT_NEAR (output[m], expected, 1e-13) << "output " << m;
+    }
+}
+
+TEST (HalfbandDecimator, ChunkingDoesNotChangeOutput)
+{
+    const auto input = makeNoise (2 * 700);
+
+    HalfbandDecimator<double> whole;
+    std::vector<double> expected (700);
+    whole.process (input.data(), expected.data(), expected.size());
+
+    HalfbandDecimator<double> chunked;
+    std::vector<double> actual (700);
+    const std::size_t sizes[] = { 1, 3, 64, 65, 127, 200 };
+
+    std::size_t done = 0;
+    for (std::size_t i = 0; done < actual.size(); ++i)
+    {
+        const std::size_t n = std::min (sizes[i % 6], actual.size() - done);
+        chunked.process (input.data() + 2 * done, actual.data() + done, n);
+        done += n;
+    }
+
+    for (std::size_t i = 0; i < actual.size(); ++i)
+    {
+        ASSERT_DOUBLE_EQ (actual[i], expected[i]) << "output " << i;
+    }
+}
+
+TEST (HalfbandDecimator, ProcessSampleMatchesBlock)
+{
+    const auto input = makeNoise (2 * 300);
+
+    HalfbandDecimator<double> block;
+    std::vector<double> expected (300);
+    block.process (input.data(), expected.data(), expected.size());
+
+    HalfbandDecimator<double> single;
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        ASSERT_DOUBLE_EQ (single.processSample (input[2 * i], input[2 * i + 1]), expected[i]) << "output " << i;
+    }
+}
+
+TEST (HalfbandDecimator, InPlaceMatchesOutOfPlace)
+{
+    auto input = makeNoise (2 * 500);
+
+    HalfbandDecimator<double> outOfPlace;
+    std::vector<double> expected (500);
+    outOfPlace.process (input.data(), expected.data(), expected.size());
+
+    HalfbandDecimator<double> inPlace;
+    inPlace.process (input.data(), input.data(), expected.size());
+
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        ASSERT_DOUBLE_EQ (input[i], expected[i]) << "output " << i;
+    }
+}
+
+TEST (HalfbandDecimator, ResetClearsHistory)
+{
+    const auto input = makeNoise (2 * 200);
+
+    HalfbandDecimator<double> decimator;
+    std::vector<double> first (200), second (200);
+
+    decimator.process (input.data(), first.data(), first.size());
+    decimator.reset();
+    decimator.process (input.data(), second.data(), second.size());
+
+    for (std::size_t i = 0; i < first.size(); ++i)
+    {
+        ASSERT_DOUBLE_EQ (first[i], second[i]) << "output " << i;
+    }
+}
+
+/*
+ * Section 3: Frequency response
+ */
+
+TEST (HalfbandDecimator, PassbandIsFlat)
+{
+    for (double f : { 0.01, 0.05, 0.1, 0.15, 0.2 })
+    {
+        EXPECT_NEAR ((gainDb<double, 32> (f)), 0.0, 0.01) << "f = " << f;
+    }
+
+    // The 4x first stage only needs to keep up to ~0.1 of its input rate
+    for (double f : { 0.01, 0.05, 0.1 })
+    {
+        EXPECT_NEAR ((gainDb<double, 16> (f)), 0.0, 0.01) << "f = " << f;
+    }
+}
+
+TEST (HalfbandDecimator, StopbandIsRejected)
+{
+    for (double f : { 0.3, 0.35, 0.4, 0.45, 0.49 })
+    {
+        EXPECT_LT ((gainDb<double, 32> (f)), -80.0) << "f = " << f;
+    }
+
+    for (double f : { 0.35, 0.4, 0.45, 0.49 })
+    {
+        EXPECT_LT ((gainDb<double, 16> (f)), -80.0) << "f = " << f;
+    }
+}
+
+TEST (HalfbandDecimator, FloatMatchesDouble)
+{
+    for (double f : { 0.1, 0.25, 0.3 })
+    {
+        EXPECT_NEAR ((gainDb<float, 32> (f)), (gainDb<double, 32> (f)), 0.05) << "f = " << f;
+    }
+}
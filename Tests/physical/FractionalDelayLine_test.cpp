@@ -0,0 +1,143 @@
+/*******************************************************************************
+ * @file  FractionalDelayLine_test.cpp
+ * @brief Unit tests for FractionalDelayLine.
+ *
+ * TEST GROUPS
+ * -----------
+ *   FractionalDelayLine — integer and Lagrange reads, allpass delay and
+ *                         magnitude, block reads against sample reads
+ *                         across the wrap, block limits
+ *
+ ******************************************************************************/
+
+#include "physical/caspi_FractionalDelayLine.h"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace CASPI::Physical;
+
+/*******************************************************************************
+ * Helpers
+ ******************************************************************************/
+
+static constexpr double kTwoPi = 6.283185307179586;
+
+using LineD = FractionalDelayLine<double, 1024, 64>;
+using LineF = FractionalDelayLine<float, 1024, 64>;
+
+/** Cubic test signal; third-order Lagrange reproduces it exactly. */
+static double cubic (double n)
+{
+    const double x = n / 100.0;
+    return 0.3 * x * x * x - 1.2 * x * x + 0.5 * x - 0.25;
+}
+
+/*******************************************************************************
+ * FractionalDelayLine
+ ******************************************************************************/
+
+TEST (FractionalDelayLine, IntegerDelaysReadExactSamples)
+{
+    auto line = std::make_unique<LineD>();
+    for (int n = 0; n < 500; ++n)
+    {
+        if (n >= 40)
+        {
+            ASSERT_EQ (line->read (2.0), static_cast<double> (n - 2));
+            ASSERT_EQ (line->read (37.0), static_cast<double> (n - 37));
+        }
+        line->write (static_cast<double> (n));
+    }
+}
+
+TEST (FractionalDelayLine, LagrangeIsExactForCubics)
+{
+    auto line = std::make_unique<LineD>();
+    for (int n = 0; n < 300; ++n)
+    {
+        if (n >= 100)
+        {
+            for (double d : { 2.0, 2.25, 7.5, 13.999, 60.7 })
+                ASSERT_NEAR (line->read (d), cubic (n - d), 1e-12) << "n " << n << " delay " << d;
+        }
+        line->write (cubic (n));
+    }
+}
+
+TEST (FractionalDelayLine, AllpassDelaysLowFrequenciesWithUnitGain)
+{
+    auto line = std::make_unique<LineD>();
+    line->setInterpolation (DelayInterpolation::Allpass);
+
+    // At low frequencies the Thiran allpass delay is the requested delay
+    const double delay = 10.3;
+    const double w     = kTwoPi * 0.005;
+    double       peak  = 0.0;
+    for (int n = 0; n < 2000; ++n)
+    {
+        const double y = line->read (delay);
+        line->write (std::sin (w * n));
+        if (n > 1000)
+        {
+            ASSERT_NEAR (y, std::sin (w * (n - delay)), 1e-4) << "n " << n;
+            peak = std::max (peak, std::abs (y));
+        }
+    }
+    EXPECT_NEAR (peak, 1.0, 1e-4);
+}
+
+TEST (FractionalDelayLine, BlockReadsMatchSampleReadsAcrossTheWrap)
+{
+    for (auto method : { DelayInterpolation::Lagrange, DelayInterpolation::Allpass })
+    {
+        auto perSample = std::make_unique<LineF>();
+        auto perBlock  = std::make_unique<LineF>();
+        perSample->setInterpolation (method);
+        perBlock->setInterpolation (method);
+
+        // A feedback loop, so reads depend on earlier writes; 3000 samples wrap 1024 twice
+        const float     delay = 23.6f;
+        const auto      block = perBlock->maxBlockFor (delay);
+        std::vector<float> a (3000), b (3000);
+
+        for (std::size_t n = 0; n < a.size(); ++n)
+        {
+            const float x = n < 30 ? std::sin (0.7f * static_cast<float> (n)) : 0.f;
+            a[n]          = x + 0.99f * perSample->read (delay);
+            perSample->write (a[n]);
+        }
+
+        std::vector<float> delayed (block);
+        for (std::size_t n = 0; n < b.size();)
+        {
+            const std::size_t count = std::min (block, b.size() - n);
+            perBlock->readBlock (delay, delayed.data(), count);
+            for (std::size_t t = 0; t < count; ++t)
+            {
+                const float x = n + t < 30 ? std::sin (0.7f * static_cast<float> (n + t)) : 0.f;
+                b[n + t]      = x + 0.99f * delayed[t];
+            }
+            perBlock->writeBlock (b.data() + n, count);
+            n += count;
+        }
+
+        for (std::size_t n = 0; n < a.size(); ++n)
+            ASSERT_NEAR (a[n], b[n], 1e-5f) << "sample " << n;
+        EXPECT_GT (std::abs (a[2990]), 1e-3f);
+    }
+}
+
+TEST (FractionalDelayLine, BlockLimitFollowsTheDelay)
+{
+    auto line = std::make_unique<LineD>();
+    EXPECT_EQ (line->maxBlockFor (2.0), 1u);
+    EXPECT_EQ (line->maxBlockFor (10.9), 9u);
+    EXPECT_EQ (line->maxBlockFor (500.0), 64u);
+    EXPECT_EQ (line->maxBlockFor (0.5), 1u); // clamped to minDelay()
+
+    line->setInterpolation (DelayInterpolation::Allpass);
+    EXPECT_EQ (line->maxBlockFor (10.4), 9u);
+    EXPECT_EQ (line->maxBlockFor (10.6), 10u);
+}
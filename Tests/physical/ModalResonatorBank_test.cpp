@@ -0,0 +1,184 @@
+/*******************************************************************************
+ * @file  ModalResonatorBank_test.cpp
+ * @brief Unit tests for ModalResonatorBank.
+ *
+ * TEST GROUPS
+ * -----------
+ *   ModalResonatorBank — impulse response, T60, superposition across the
+ *                        SIMD groupings, input excitation, block-rate
+ *                        coefficient updates, Nyquist culling
+ *
+ ******************************************************************************/
+
+#include "physical/caspi_ModalResonatorBank.h"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace CASPI::Physical;
+
+/*******************************************************************************
+ * Helpers
+ ******************************************************************************/
+
+static constexpr double kSR    = 48000.0;
+static constexpr double kTwoPi = 6.283185307179586;
+
+using BankD = ModalResonatorBank<double, 64>;
+using BankF = ModalResonatorBank<float, 64>;
+
+/** g r^n sin((n + 1) theta) for one mode. */
+static double modeImpulse (double hz, double t60, double gain, std::size_t n)
+{
+    const double theta = kTwoPi * hz / kSR;
+    const double r     = std::pow (10.0, -3.0 / (t60 * kSR));
+    return gain * std::pow (r, static_cast<double> (n)) * std::sin (static_cast<double> (n + 1) * theta);
+}
+
+/*******************************************************************************
+ * ModalResonatorBank
+ ******************************************************************************/
+
+TEST (ModalResonatorBank, StrikeRingsAsDecayingSine)
+{
+    auto bank = std::make_unique<BankD> (kSR);
+    bank->setMode (0, 1000.0, 0.5, 0.7);
+
+    bank->strike (1.0);
+    std::vector<double> out (1000);
+    bank->processBlock (nullptr, out.data(), 1000);
+
+    for (std::size_t n = 0; n < out.size(); ++n)
+        ASSERT_NEAR (out[n], modeImpulse (1000.0, 0.5, 0.7, n), 1e-9) << "sample " << n;
+}
+
+TEST (ModalResonatorBank, DecaysSixtyDecibelsInT60)
+{
+    auto bank = std::make_unique<BankD> (kSR);
+    bank->setMode (0, 440.0, 0.25, 1.0);
+    bank->strike();
+
+    // 0.25 s = 12000 samples; compare peaks of the first and last cycles
+    std::vector<double> out (12000 + 110);
+    bank->processBlock (nullptr, out.data(), static_cast<int> (out.size()));
+
+    double first = 0.0, last = 0.0;
+    for (std::size_t n = 0; n < 110; ++n)
+    {
+        first = std::max (first, std::abs (out[n]));
+        last  = std::max (last, std::abs (out[12000 + n]));
+    }
+    EXPECT_NEAR (last / first, 1e-3, 2e-5);
+}
+
+TEST (ModalResonatorBank, ManyModesSumLikeSingleModes)
+{
+    // 37 modes: whole groups of four vectors, a single vector and a partial one
+    std::vector<BankF::Mode> modes;
+    for (int k = 0; k < 37; ++k)
+        modes.push_back ({ 90.f * static_cast<float> (k + 1) + 13.f, 0.1f + 0.01f * static_cast<float> (k), 1.f / static_cast<float> (k + 1) });
+
+    auto bank = std::make_unique<BankF> (static_cast<float> (kSR));
+    bank->setModes (modes.data(), modes.size());
+    EXPECT_EQ (bank->getNumModes(), 37u);
+
+    bank->strike();
+    std::vector<float> out (700);
+    // Both blocks span more than one 256-sample chunk
+    bank->processBlock (nullptr, out.data(), 300);
+    bank->processBlock (nullptr, out.data() + 300, 400);
+
+    std::vector<double> expected (700, 0.0);
+    for (const auto& m : modes)
+        for (std::size_t n = 0; n < expected.size(); ++n)
+            expected[n] += modeImpulse (m.frequency, m.decay, m.gain, n);
+
+    // Float coefficients detune each mode slightly; the error grows with n
+    for (std::size_t n = 0; n < out.size(); ++n)
+        ASSERT_NEAR (out[n], expected[n], 1e-3) << "sample " << n;
+}
+
+TEST (ModalResonatorBank, InputExcitesLikeStrikes)
+{
+    auto a = std::make_unique<BankD> (kSR);
+    auto b = std::make_unique<BankD> (kSR);
+    for (auto* bank : { a.get(), b.get() })
+    {
+        bank->setMode (0, 300.0, 0.2, 1.0);
+        bank->setMode (3, 1234.0, 0.1, 0.5); // modes 1 and 2 are left silent
+    }
+    EXPECT_EQ (a->getNumModes(), 4u);
+
+    // Impulse of 0.5 at sample 10 through the input, processed in place
+    std::vector<double> viaInput (512, 0.0);
+    viaInput[10] = 0.5;
+    a->processBlock (viaInput.data(), viaInput.data(), 512);
+
+    std::vector<double> viaStrike (512, 0.0);
+    b->processBlock (nullptr, viaStrike.data(), 10);
+    b->strike (0.5);
+    b->processBlock (nullptr, viaStrike.data() + 10, 502);
+
+    for (std::size_t n = 0; n < 512; ++n)
+        ASSERT_NEAR (viaInput[n], viaStrike[n], 1e-12) << "sample " << n;
+}
+
+TEST (ModalResonatorBank, RetuneTakesEffectAtTheNextBlock)
+{
+    auto bank = std::make_unique<BankD> (kSR);
+    bank->setMode (0, 500.0, 1.0, 1.0);
+    bank->strike();
+
+    std::vector<double> out (256);
+    bank->processBlock (nullptr, out.data(), 128);
+
+    // Same decay and gain: only a1 changes, so the state carries straight over
+    bank->setMode (0, 700.0, 1.0, 1.0);
+    bank->processBlock (nullptr, out.data() + 128, 128);
+
+    const double r     = std::pow (10.0, -3.0 / kSR);
+    const double theta = kTwoPi * 700.0 / kSR;
+    for (std::size_t n = 130; n < 256; ++n)
+    {
+        const double predicted = 2.0 * r * std::cos (theta) * out[n - 1] - r * r * out[n - 2];
+        ASSERT_NEAR (out[n], predicted, 1e-12) << "sample " << n;
+    }
+}
+
+TEST (ModalResonatorBank, ModesAboveNyquistAreSilent)
+{
+    auto bank = std::make_unique<BankD> (kSR);
+    bank->setMode (0, 30000.0, 1.0, 1.0);
+    bank->setMode (1, -5.0, 1.0, 1.0);
+    bank->strike();
+
+    std::vector<double> out (128);
+    bank->processBlock (nullptr, out.data(), 128);
+    for (double s : out)
+        ASSERT_EQ (s, 0.0);
+
+    // A lower rate pushes a valid mode past Nyquist: 20 kHz at 32 kHz
+    bank->setMode (0, 20000.0, 1.0, 1.0);
+    bank->setSampleRate (32000.0);
+    bank->strike();
+    bank->processBlock (nullptr, out.data(), 128);
+    for (double s : out)
+        ASSERT_EQ (s, 0.0);
+}
+
+TEST (ModalResonatorBank, ResetSilencesRingingModes)
+{
+    auto bank = std::make_unique<BankF> (static_cast<float> (kSR));
+    bank->setMode (0, 200.f, 2.f, 1.f);
+    bank->strike();
+
+    std::vector<float> out (64);
+    bank->processBlock (nullptr, out.data(), 64);
+    EXPECT_NE (out[63], 0.f);
+
+    bank->reset();
+    bank->processBlock (nullptr, out.data(), 64);
+    for (float s : out)
+        ASSERT_EQ (s, 0.f);
+}
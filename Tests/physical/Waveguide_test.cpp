@@ -0,0 +1,235 @@
+/*******************************************************************************
+ * @file  Waveguide_test.cpp
+ * @brief Unit tests for LoopFilter and WaveguideBank.
+ *
+ * TEST GROUPS
+ * -----------
+ *   LoopFilter    — FIR response and coefficient range
+ *   WaveguideBank — string and tube tuning, decay, release, voice
+ *                   stealing, block-size invariance
+ *
+ ******************************************************************************/
+
+#include "physical/caspi_Waveguide.h"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace CASPI::Physical;
+
+/*******************************************************************************
+ * Helpers
+ ******************************************************************************/
+
+static constexpr double kSR = 48000.0;
+
+using BankD = WaveguideBank<double, 8>;
+using BankF = WaveguideBank<float, 4>;
+
+template <typename Bank>
+static std::vector<double> render (Bank& bank, std::size_t frames, int block = 512)
+{
+    using F = std::remove_reference_t<decltype (bank.renderSample())>;
+    std::vector<F> out (frames);
+    for (std::size_t done = 0; done < frames;)
+    {
+        const int count = static_cast<int> (std::min<std::size_t> (static_cast<std::size_t> (block), frames - done));
+        bank.renderBlock (out.data() + done, count);
+        done += static_cast<std::size_t> (count);
+    }
+    return std::vector<double> (out.begin(), out.end());
+}
+
+/** Normalised autocorrelation of x[start, start + len) at @p lag. */
+static double correlation (const std::vector<double>& x, std::size_t start, std::size_t len, double lag)
+{
+    const auto   whole = static_cast<std::size_t> (lag);
+    const double frac  = lag - static_cast<double> (whole);
+
+    double xy = 0.0, xx = 0.0, yy = 0.0;
+    for (std::size_t n = start; n < start + len; ++n)
+    {
+        const double y = x[n + whole] + frac * (x[n + whole + 1] - x[n + whole]);
+        xy += x[n] * y;
+        xx += x[n] * x[n];
+        yy += y * y;
+    }
+    return xy / std::sqrt (xx * yy);
+}
+
+/** Lag of the autocorrelation peak nearest @p guess, refined by a parabola. */
+static double measurePeriod (const std::vector<double>& x, std::size_t start, double guess)
+{
+    std::size_t best  = 0;
+    double      value = -2.0;
+    for (auto lag = static_cast<std::size_t> (guess) - 3; lag <= static_cast<std::size_t> (guess) + 3; ++lag)
+    {
+        const double r = correlation (x, start, 4000, static_cast<double> (lag));
+        if (r > value)
+        {
+            value = r;
+            best  = lag;
+        }
+    }
+    const double l = correlation (x, start, 4000, best - 1.0);
+    const double c = correlation (x, start, 4000, static_cast<double> (best));
+    const double r = correlation (x, start, 4000, best + 1.0);
+    return static_cast<double> (best) + 0.5 * (l - r) / (l - 2.0 * c + r);
+}
+
+/*******************************************************************************
+ * LoopFilter
+ ******************************************************************************/
+
+TEST (LoopFilter, LosesOneDecibelAtTheCutoff)
+{
+    const double oneDb = std::pow (10.0, -1.0 / 20.0);
+    LoopFilter<double> filter (kSR, 8000.0);
+
+    EXPECT_NEAR (filter.getFrequencyResponse (1e-3), 1.0, 1e-9);
+    EXPECT_NEAR (filter.getFrequencyResponse (8000.0), oneDb, 1e-9);
+
+    // Impulse response is { b, 1 - 2b, b }
+    const auto& c = filter.getCoefficients();
+    EXPECT_EQ (filter.processSample (1.0), c[0]);
+    EXPECT_EQ (filter.processSample (0.0), c[1]);
+    EXPECT_EQ (filter.processSample (0.0), c[0]);
+    EXPECT_EQ (filter.processSample (0.0), 0.0);
+
+    // Beyond what three taps can do: clamped at both ends
+    filter.setCutoff (100.0);
+    EXPECT_DOUBLE_EQ (filter.getCoefficients()[0], 0.25);
+    filter.setCutoff (30000.0);
+    EXPECT_NEAR (filter.getFrequencyResponse (24000.0), oneDb, 1e-9);
+}
+
+/*******************************************************************************
+ * WaveguideBank
+ ******************************************************************************/
+
+TEST (WaveguideBank, PluckedStringIsInTune)
+{
+    for (auto method : { DelayInterpolation::Lagrange, DelayInterpolation::Allpass })
+    {
+        for (double hz : { 110.0, 441.3, 1234.5 })
+        {
+            auto bank = std::make_unique<BankD> (kSR);
+            bank->setInterpolation (method);
+            bank->setDecay (5.0);
+            bank->setBrightness (8000.0);
+            bank->noteOn (hz);
+
+            const auto   out    = render (*bank, 12000);
+            const double period = measurePeriod (out, 2000, kSR / hz);
+            EXPECT_NEAR (period, kSR / hz, 0.002 * kSR / hz) << hz << " Hz";
+        }
+    }
+}
+
+TEST (WaveguideBank, TubeRingsOddHarmonics)
+{
+    auto bank = std::make_unique<BankD> (kSR);
+    bank->setModel (WaveguideModel::Tube);
+    bank->setDecay (2.0);
+    bank->noteOn (300.0, 0.8);
+
+    const auto   out    = render (*bank, 20000);
+    const double period = kSR / 300.0;
+
+    // Inverted every half period: no even harmonics
+    EXPECT_LT (correlation (out, 10000, 4000, period / 2.0), -0.9);
+    EXPECT_GT (correlation (out, 10000, 4000, period), 0.9);
+    EXPECT_NEAR (measurePeriod (out, 10000, period), period, 0.002 * period);
+}
+
+TEST (WaveguideBank, FundamentalDecaysSixtyDecibelsInT60)
+{
+    auto bank = std::make_unique<BankD> (kSR);
+    bank->setDecay (0.5);
+    bank->setBrightness (2000.0); // harmonics die early; the fundamental is left
+    bank->noteOn (200.0);
+
+    const auto out = render (*bank, 36000);
+
+    auto peakAround = [&] (std::size_t centre)
+    {
+        double peak = 0.0;
+        for (std::size_t n = centre - 240; n < centre + 240; ++n)
+            peak = std::max (peak, std::abs (out[n]));
+        return peak;
+    };
+
+    // -60 dB between 0.2 s and 0.7 s; the FIR costs the fundamental ~0.2 dB a pass
+    const double ratio = peakAround (33600) / peakAround (9600);
+    EXPECT_GT (ratio, 0.5e-3);
+    EXPECT_LT (ratio, 1.1e-3);
+}
+
+TEST (WaveguideBank, ReleasedVoicesFallSilentAndRetire)
+{
+    auto bank = std::make_unique<BankF> (static_cast<float> (kSR));
+    bank->setDecay (10.f);
+    bank->setReleaseTime (0.05f);
+
+    const int voice = bank->noteOn (220.f);
+    render (*bank, 4800);
+    EXPECT_EQ (bank->getNumActiveVoices(), 1u);
+
+    bank->noteOff (voice);
+    const auto tail = render (*bank, 9600);
+    EXPECT_EQ (bank->getNumActiveVoices(), 0u);
+    for (std::size_t n = 7200; n < tail.size(); ++n)
+        ASSERT_EQ (tail[n], 0.0);
+
+    // A tube keeps breathing until released
+    bank->setModel (WaveguideModel::Tube);
+    const int tube = bank->noteOn (220.f);
+    render (*bank, 48000);
+    EXPECT_EQ (bank->getNumActiveVoices(), 1u);
+    bank->noteOff (tube);
+    render (*bank, 9600);
+    EXPECT_EQ (bank->getNumActiveVoices(), 0u);
+}
+
+TEST (WaveguideBank, FullBankStealsTheOldestVoice)
+{
+    auto bank = std::make_unique<BankF> (static_cast<float> (kSR));
+    bank->setDecay (10.f);
+
+    std::vector<int> voices;
+    for (int k = 0; k < 4; ++k)
+    {
+        voices.push_back (bank->noteOn (100.f * static_cast<float> (k + 1)));
+        render (*bank, 64);
+    }
+    EXPECT_EQ (bank->getNumActiveVoices(), 4u);
+
+    EXPECT_EQ (bank->noteOn (1000.f), voices[0]);
+    EXPECT_EQ (bank->noteOn (1100.f), voices[1]);
+    EXPECT_EQ (bank->getNumActiveVoices(), 4u);
+}
+
+TEST (WaveguideBank, OutputDoesNotDependOnBlockSize)
+{
+    auto play = [] (int block)
+    {
+        auto bank = std::make_unique<BankD> (kSR);
+        bank->setSeed (42);
+        bank->reset();
+        bank->setBrightness (5000.0);
+        bank->noteOn (97.0, 0.7);     // sub-blocks capped by the block size
+        bank->noteOn (3100.0, 0.5);   // sub-blocks capped by the 14-sample delay
+        bank->setModel (WaveguideModel::Tube);
+        bank->noteOn (523.0, 0.6);
+        return render (*bank, 6000, block);
+    };
+
+    const auto reference = play (512);
+    for (int block : { 1, 7, 100 })
+    {
+        const auto out = play (block);
+        for (std::size_t n = 0; n < out.size(); ++n)
+            ASSERT_NEAR (out[n], reference[n], 1e-12) << "block " << block << " sample " << n;
+    }
+}
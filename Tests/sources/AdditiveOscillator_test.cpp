@@ -0,0 +1,184 @@
+/*******************************************************************************
+ * @file  AdditiveOscillator_test.cpp
+ * @brief Unit tests for AdditiveOscillator.
+ *
+ * TEST GROUPS
+ * -----------
+ *   AdditiveOscillator — partials vs std::sin, amplitude ramps, culling,
+ *                        frame changes, long-run phasor stability
+ *
+ ******************************************************************************/
+
+#include "oscillators/caspi_AdditiveOscillator.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace CASPI::Oscillators;
+
+/*******************************************************************************
+ * Helpers
+ ******************************************************************************/
+
+static constexpr double kSR    = 48000.0;
+static constexpr double kTwoPi = 6.283185307179586;
+
+using AdditiveD = AdditiveOscillator<double, 64>;
+using AdditiveF = AdditiveOscillator<float, 64>;
+
+/*******************************************************************************
+ * AdditiveOscillator
+ ******************************************************************************/
+
+TEST (AdditiveOscillator, SinglePartialMatchesSine)
+{
+    auto osc = std::make_unique<AdditiveD> (kSR);
+    osc->setPartial (0, 1000.0, 0.5);
+
+    // First block fades the partial in from silence
+    std::vector<double> buf (700);
+    osc->renderBlock (buf.data(), 300);
+    osc->renderBlock (buf.data(), 700);
+
+    for (int i = 0; i < 700; ++i)
+    {
+        const double expected = 0.5 * std::sin (kTwoPi * 1000.0 * static_cast<double> (300 + i) / kSR);
+        ASSERT_NEAR (buf[static_cast<std::size_t> (i)], expected, 1e-9) << "sample " << i;
+    }
+}
+
+TEST (AdditiveOscillator, AmplitudeRampsLinearlyOverTheBlock)
+{
+    auto osc = std::make_unique<AdditiveD> (kSR);
+    osc->setPartial (0, 440.0, 1.0);
+
+    std::vector<double> buf (480);
+    osc->renderBlock (buf.data(), 480);
+
+    for (int i = 0; i < 480; ++i)
+    {
+        const double gain     = static_cast<double> (i + 1) / 480.0;
+        const double expected = gain * std::sin (kTwoPi * 440.0 * static_cast<double> (i) / kSR);
+        ASSERT_NEAR (buf[static_cast<std::size_t> (i)], expected, 1e-9) << "sample " << i;
+    }
+}
+
+TEST (AdditiveOscillator, StretchedHarmonicsMatchSumOfSines)
+{
+    auto osc = std::make_unique<AdditiveD> (kSR);
+
+    const double f0 = 220.0, B = 2e-4;
+    double       amps[9];
+    for (int n = 0; n < 9; ++n)
+        amps[n] = 1.0 / static_cast<double> (n + 1);
+
+    osc->setHarmonics (f0, amps, 9, B);
+
+    std::vector<double> buf (512);
+    osc->renderBlock (buf.data(), 64);
+    osc->renderBlock (buf.data(), 512);
+
+    for (int i = 0; i < 512; ++i)
+    {
+        const double t        = static_cast<double> (64 + i) / kSR;
+        double       expected = 0.0;
+        for (int n = 1; n <= 9; ++n)
+            expected += amps[n - 1] * std::sin (kTwoPi * n * f0 * std::sqrt (1.0 + B * n * n) * t);
+
+        ASSERT_NEAR (buf[static_cast<std::size_t> (i)], expected, 1e-8) << "sample " << i;
+    }
+}
+
+TEST (AdditiveOscillator, CullsAboveNyquistAndBelowFloor)
+{
+    auto osc = std::make_unique<AdditiveF> (static_cast<float> (kSR));
+    osc->setAmplitudeFloor (1e-4f);
+
+    // 40 harmonics of 1 kHz: 23 lie below 24 kHz; every third one is below the floor
+    float amps[40];
+    for (int n = 0; n < 40; ++n)
+        amps[n] = (n % 3 == 2) ? 1e-6f : 0.02f;
+
+    osc->setHarmonics (1000.f, amps, 40);
+
+    std::vector<float> buf (256);
+    osc->renderBlock (buf.data(), 256);
+
+    std::size_t expected = 0;
+    for (int n = 0; n < 23; ++n)
+        expected += (n % 3 == 2) ? 0 : 1;
+
+    EXPECT_EQ (osc->getNumActivePartials(), expected);
+    for (float s : buf)
+        ASSERT_TRUE (std::isfinite (s));
+}
+
+TEST (AdditiveOscillator, ShorterFrameFadesOutTheRest)
+{
+    auto osc = std::make_unique<AdditiveD> (kSR);
+
+    const double hz3[]   = { 300.0, 600.0, 900.0 };
+    const double amps3[] = { 0.3, 0.3, 0.3 };
+    osc->setPartials (hz3, amps3, 3);
+
+    std::vector<double> buf (256);
+    osc->renderBlock (buf.data(), 256);
+    EXPECT_EQ (osc->getNumActivePartials(), 3u);
+
+    // Partials 1 and 2 ramp to zero over this block, then drop out
+    osc->setPartials (hz3, amps3, 1);
+    osc->renderBlock (buf.data(), 256);
+    EXPECT_EQ (osc->getNumActivePartials(), 3u);
+
+    osc->renderBlock (buf.data(), 256);
+    EXPECT_EQ (osc->getNumActivePartials(), 1u);
+
+    for (int i = 0; i < 256; ++i)
+    {
+        const double expected = 0.3 * std::sin (kTwoPi * 300.0 * static_cast<double> (512 + i) / kSR);
+        ASSERT_NEAR (buf[static_cast<std::size_t> (i)], expected, 1e-9) << "sample " << i;
+    }
+}
+
+TEST (AdditiveOscillator, FloatPhasorsStayOnTheUnitCircle)
+{
+    // Ten seconds of float rotation; without renormalisation |z| would drift
+    auto osc = std::make_unique<AdditiveF> (static_cast<float> (kSR));
+    for (std::size_t k = 0; k < 64; ++k)
+        osc->setPartial (k, 97.f * static_cast<float> (k + 1) + 0.37f, 1.f / 64.f);
+
+    std::vector<float> buf (480);
+    for (int block = 0; block < 1000; ++block)
+        osc->renderBlock (buf.data(), 480);
+
+    // A lone partial must still peak at its amplitude
+    osc->setPartials (nullptr, nullptr, 0);
+    osc->setPartial (5, 583.37f, 0.25f);
+    osc->renderBlock (buf.data(), 480);
+    osc->renderBlock (buf.data(), 480);
+
+    float peak = 0.f;
+    for (float s : buf)
+        peak = std::max (peak, std::abs (s));
+
+    EXPECT_NEAR (peak, 0.25f, 1e-3f);
+}
+
+TEST (AdditiveOscillator, FrequencyChangeKeepsPhaseContinuous)
+{
+    auto osc = std::make_unique<AdditiveD> (kSR);
+    osc->setPartial (0, 500.0, 1.0);
+
+    std::vector<double> a (100), b (100);
+    osc->renderBlock (a.data(), 100);
+    const double phaseBefore = osc->getPartialPhase (0);
+
+    osc->setPartial (0, 800.0, 1.0);
+    osc->renderBlock (b.data(), 100);
+
+    const double expectedPhase = std::remainder (phaseBefore + kTwoPi * 800.0 * 100.0 / kSR, kTwoPi);
+    EXPECT_NEAR (osc->getPartialPhase (0), expectedPhase, 1e-9);
+    EXPECT_NEAR (b[0], std::sin (phaseBefore), 1e-9);
+}
@@ -0,0 +1,209 @@
+/*******************************************************************************
+ * @file  BlepOscillatorBank_test.cpp
+ * @brief Unit tests for BlepOscillatorBank.
+ *
+ * TEST GROUPS
+ * -----------
+ *   BlepOscillatorBank — one voice vs BlepOscillator, N voices vs a stack of
+ *                        BlepOscillators, padded lanes, stereo spread,
+ *                        voice count changes
+ *
+ ******************************************************************************/
+
+#include "oscillators/caspi_BlepOscillatorBank.h"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace CASPI::Oscillators;
+
+/*******************************************************************************
+ * Helpers
+ ******************************************************************************/
+
+static constexpr double kSR   = 48000.0;
+static constexpr double kFreq = 1234.5;
+static constexpr int    kN    = 777;
+
+using BankD = BlepOscillatorBank<double>;
+using OscD  = BlepOscillator<double>;
+
+/*
+ * stackReference
+ *
+ * Mono mix of N independent BlepOscillators laid out as the bank lays out
+ * its voices: offset o(k), detune in cents, phase frac(k / golden ratio).
+ */
+static std::vector<double> stackReference (WaveShape shape, std::size_t voices, double cents, int n)
+{
+    std::vector<double> mix (static_cast<std::size_t> (n), 0.0);
+    std::vector<double> buf (static_cast<std::size_t> (n));
+
+    for (std::size_t k = 0; k < voices; ++k)
+    {
+        const double offset = voices > 1 ? 2.0 * static_cast<double> (k) / static_cast<double> (voices - 1) - 1.0 : 0.0;
+        const double p      = static_cast<double> (k) * 0.6180339887498949;
+
+        OscD osc (shape, kSR, kFreq * std::exp2 (cents * offset / 1200.0));
+        osc.setPhaseOffset (p - std::floor (p));
+        osc.resetPhase();
+        osc.renderBlock (buf.data(), n);
+
+        for (int i = 0; i < n; ++i)
+            mix[static_cast<std::size_t> (i)] += buf[static_cast<std::size_t> (i)] / std::sqrt (static_cast<double> (voices));
+    }
+    return mix;
+}
+
+/*******************************************************************************
+ * BlepOscillatorBank
+ ******************************************************************************/
+
+TEST (BlepOscillatorBank, OneVoiceMatchesBlepOscillator)
+{
+    for (WaveShape shape : { WaveShape::Sine, WaveShape::Saw, WaveShape::Square, WaveShape::Triangle })
+    {
+        BankD bank (shape, kSR, kFreq, 1);
+        OscD  osc (shape, kSR, kFreq);
+
+        std::vector<double> expected (kN), actual (kN);
+        osc.renderBlock (expected.data(), kN);
+        bank.renderBlock (actual.data(), kN);
+
+        // The bank's sine is SinKernel, within ~6e-8 of the oscillator's std::sin
+        const double tolerance = (shape == WaveShape::Sine) ? 1e-7 : 1e-9;
+        for (int i = 0; i < kN; ++i)
+        {
+            ASSERT_NEAR (actual[static_cast<std::size_t> (i)], expected[static_cast<std::size_t> (i)], tolerance)
+                << "shape " << static_cast<int> (shape) << " sample " << i;
+        }
+    }
+}
+
+TEST (BlepOscillatorBank, VoicesMatchAStackOfOscillators)
+{
+    // 7 and 5 voices leave padded lanes in the last vector
+    for (std::size_t voices : { std::size_t (5), std::size_t (7), std::size_t (16) })
+    {
+        for (WaveShape shape : { WaveShape::Saw, WaveShape::Pulse, WaveShape::Triangle })
+        {
+            BankD bank (shape, kSR, kFreq, voices);
+            bank.setDetune (35.0);
+
+            const auto expected = stackReference (shape, voices, 35.0, kN);
+
+            std::vector<double> actual (kN);
+            bank.renderBlock (actual.data(), kN);
+
+            for (int i = 0; i < kN; ++i)
+            {
+                ASSERT_NEAR (actual[static_cast<std::size_t> (i)], expected[static_cast<std::size_t> (i)], 1e-7)
+                    << voices << " voices, shape " << static_cast<int> (shape) << " sample " << i;
+            }
+        }
+    }
+}
+
+TEST (BlepOscillatorBank, FloatLanesTrackDouble)
+{
+    BlepOscillatorBank<float> bankF (WaveShape::Saw, 48000.f, 1234.5f, 7);
+    BankD                     bankD (WaveShape::Saw, kSR, kFreq, 7);
+    bankF.setDetune (20.f);
+    bankD.setDetune (20.0);
+
+    std::vector<float>  f (512);
+    std::vector<double> d (512);
+    bankF.renderBlock (f.data(), 512);
+    bankD.renderBlock (d.data(), 512);
+
+    for (std::size_t i = 0; i < f.size(); ++i)
+    {
+        ASSERT_NEAR (f[i], d[i], 1e-3) << "sample " << i;
+    }
+}
+
+TEST (BlepOscillatorBank, ZeroSpreadIsCentred)
+{
+    BankD bank (WaveShape::Saw, kSR, kFreq, 7);
+    bank.setDetune (25.0);
+
+    BankD mono (WaveShape::Saw, kSR, kFreq, 7);
+    mono.setDetune (25.0);
+
+    std::vector<double> left (kN), right (kN), centre (kN);
+    bank.renderBlock (left.data(), right.data(), kN);
+    mono.renderBlock (centre.data(), kN);
+
+    const double kCentreGain = std::sqrt (0.5);
+    for (int i = 0; i < kN; ++i)
+    {
+        const auto s = static_cast<std::size_t> (i);
+        ASSERT_NEAR (left[s], right[s], 1e-12) << "sample " << i;
+        ASSERT_NEAR (left[s], centre[s] * kCentreGain, 1e-12) << "sample " << i;
+    }
+}
+
+TEST (BlepOscillatorBank, FullSpreadHardPansTheOuterVoices)
+{
+    // Two voices: voice 0 hard left, voice 1 hard right
+    BankD bank (WaveShape::Saw, kSR, kFreq, 2);
+    bank.setDetune (50.0);
+    bank.setStereoSpread (1.0);
+
+    std::vector<double> left (kN), right (kN);
+    bank.renderBlock (left.data(), right.data(), kN);
+
+    OscD voice0 (WaveShape::Saw, kSR, kFreq * std::exp2 (-50.0 / 1200.0));
+    OscD voice1 (WaveShape::Saw, kSR, kFreq * std::exp2 (50.0 / 1200.0));
+    voice1.setPhaseOffset (0.6180339887498949);
+    voice1.resetPhase();
+
+    std::vector<double> v0 (kN), v1 (kN);
+    voice0.renderBlock (v0.data(), kN);
+    voice1.renderBlock (v1.data(), kN);
+
+    const double norm = 1.0 / std::sqrt (2.0);
+    for (int i = 0; i < kN; ++i)
+    {
+        const auto s = static_cast<std::size_t> (i);
+        ASSERT_NEAR (left[s], v0[s] * norm, 1e-7) << "sample " << i;
+        ASSERT_NEAR (right[s], v1[s] * norm, 1e-7) << "sample " << i;
+    }
+}
+
+TEST (BlepOscillatorBank, GrowingTheStackKeepsExistingPhases)
+{
+    BankD bank (WaveShape::Saw, kSR, kFreq, 3);
+
+    std::vector<double> buf (100);
+    bank.renderBlock (buf.data(), 100);
+
+    const double phase0 = bank.getVoicePhase (0);
+    bank.setNumVoices (9);
+    EXPECT_EQ (bank.getNumVoices(), 9u);
+    EXPECT_EQ (bank.getVoicePhase (0), phase0);
+
+    bank.renderBlock (buf.data(), 100);
+    for (double s : buf)
+    {
+        ASSERT_TRUE (std::isfinite (s));
+        ASSERT_LE (std::abs (s), 1.1 * 3.0); // 9 voices at 1/sqrt(9)
+    }
+}
+
+TEST (BlepOscillatorBank, RenderSampleMatchesBlock)
+{
+    BankD block (WaveShape::Square, kSR, kFreq, 6);
+    BankD single (WaveShape::Square, kSR, kFreq, 6);
+    block.setDetune (10.0);
+    single.setDetune (10.0);
+
+    std::vector<double> expected (200);
+    block.renderBlock (expected.data(), 200);
+
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        ASSERT_DOUBLE_EQ (single.renderSample(), expected[i]) << "sample " << i;
+    }
+}
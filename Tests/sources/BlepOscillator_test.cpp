@@ -386,4 +386,127 @@ TEST (BlepVsNaive, SquareAliasReduction)
     const auto naiveBuf = naiveSquare (kHighFreq, kSR, n);
 
     EXPECT_LT (binEnergy (blepBuf, binFreq, kSR), binEnergy (naiveBuf, binFreq, kSR));
-}
\ No newline at end of file
+}
+/*******************************************************************************
+ * SincBlep
+ ******************************************************************************/
+
+using BlepMode = CASPI::Oscillators::BlepMode;
+
+/*
+ * aliasPower — total energy at the alias frequencies of a 2500 Hz tone at
+ * 48 kHz. 4800 samples hold exactly 250 periods, so every harmonic and every
+ * alias (500 + 2500m, 2000 + 2500m Hz) sits on an integer DFT bin.
+ */
+static constexpr float kAliasSR   = 48000.f;
+static constexpr float kAliasFreq = 2500.f;
+static constexpr int kAliasN      = 4800;
+
+static double aliasPower (const std::vector<float>& buf)
+{
+    double power = 0.0;
+    for (float f = 500.f; f < kAliasSR / 2.f; f += kAliasFreq)
+    {
+        for (const float alias : { f, f + 1500.f })
+        {
+            if (alias < kAliasSR / 2.f)
+            {
+                const double e  = binEnergy (buf, alias, kAliasSR);
+                power          += e * e;
+            }
+        }
+    }
+    return power;
+}
+
+static std::vector<float> renderAliasTest (Shape shape, BlepMode mode)
+{
+    Osc osc (shape, kAliasSR, kAliasFreq);
+    osc.setBlepMode (mode);
+    return renderN (osc, kAliasN);
+}
+
+TEST (SincBlep, TableIsABandLimitedUnitStep)
+{
+    using Table          = CASPI::Oscillators::detail::SincBlepTable<float>;
+    const auto& table    = Table::instance();
+    const float halfWide = static_cast<float> (Table::kHalfWidth);
+
+    // Zero outside the kernel, ±1 either side of the step, odd-symmetric
+    EXPECT_EQ (table.residual (-halfWide), 0.f);
+    EXPECT_EQ (table.residual (halfWide), 0.f);
+    EXPECT_NEAR (table.residual (-halfWide + 0.01f), 0.f, 1e-5f);
+    EXPECT_NEAR (table.residual (halfWide - 0.01f), 0.f, 1e-5f);
+    EXPECT_NEAR (table.residual (-1e-4f), 1.f, 1e-3f);
+    EXPECT_NEAR (table.residual (1e-4f), -1.f, 1e-3f);
+
+    for (float t = 0.05f; t < halfWide; t += 0.37f)
+    {
+        EXPECT_NEAR (table.residual (-t), -table.residual (t), 1e-5f) << "t = " << t;
+    }
+}
+
+TEST (SincBlep, SawAliasBelowPolyBlep)
+{
+    const double poly = aliasPower (renderAliasTest (Shape::Saw, BlepMode::PolyBlep));
+    const double sinc = aliasPower (renderAliasTest (Shape::Saw, BlepMode::SincBlep));
+
+    // PolyBLEP ≈ -36 dB, SincBlep ≈ -59 dB relative to full scale
+    EXPECT_LT (10.0 * std::log10 (sinc / poly), -15.0);
+}
+
+TEST (SincBlep, SquareAliasBelowPolyBlep)
+{
+    const double poly = aliasPower (renderAliasTest (Shape::Square, BlepMode::PolyBlep));
+    const double sinc = aliasPower (renderAliasTest (Shape::Square, BlepMode::SincBlep));
+
+    EXPECT_LT (10.0 * std::log10 (sinc / poly), -15.0);
+}
+
+TEST (SincBlep, FundamentalMatchesPolyBlep)
+{
+    const auto poly = renderAliasTest (Shape::Saw, BlepMode::PolyBlep);
+    const auto sinc = renderAliasTest (Shape::Saw, BlepMode::SincBlep);
+
+    const float ePoly = binEnergy (poly, kAliasFreq, kAliasSR);
+    const float eSinc = binEnergy (sinc, kAliasFreq, kAliasSR);
+    EXPECT_NEAR (20.f * std::log10 (eSinc / ePoly), 0.f, 0.1f);
+}
+
+TEST (SincBlep, AmplitudeAndDCBounds)
+{
+    for (const float hz : { kFreq, kHighFreq })
+    {
+        for (const Shape shape : { Shape::Saw, Shape::Square, Shape::Triangle })
+        {
+            Osc osc (shape, kSR, hz);
+            osc.setBlepMode (BlepMode::SincBlep);
+            renderN (osc, static_cast<int> (kSR)); // let Triangle's integrator settle
+
+            // A band-limited step overshoots (Gibbs); at 10 kHz the square is its
+            // fundamental alone, peaking at 4/pi
+            EXPECT_LT (peakOf (osc, kBlock * 4), 1.3f) << static_cast<int> (shape) << " @ " << hz;
+            EXPECT_NEAR (dcOf (osc, kPeriod * 40), 0.f, kDCTol * 2.f) << static_cast<int> (shape) << " @ " << hz;
+        }
+    }
+}
+
+TEST (SincBlep, RenderBlockMatchesRenderSample)
+{
+    for (const Shape shape : { Shape::Saw, Shape::Pulse, Shape::Triangle })
+    {
+        Osc oscA (shape, kSR, kHighFreq);
+        Osc oscB (shape, kSR, kHighFreq);
+        oscA.setBlepMode (BlepMode::SincBlep);
+        oscB.setBlepMode (BlepMode::SincBlep);
+
+        std::vector<float> blockOut (static_cast<std::size_t> (kBlock));
+        oscA.renderBlock (blockOut.data(), kBlock);
+
+        for (int i = 0; i < kBlock; ++i)
+        {
+            ASSERT_NEAR (blockOut[static_cast<std::size_t> (i)], oscB.renderSample(), 1e-5f)
+                << "shape " << static_cast<int> (shape) << " sample " << i;
+        }
+    }
+}
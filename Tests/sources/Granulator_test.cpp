@@ -0,0 +1,254 @@
+/*******************************************************************************
+ * @file  Granulator_test.cpp
+ * @brief Unit tests for Granulator.
+ *
+ * TEST GROUPS
+ * -----------
+ *   Granulator — window shape, unity and pitched grain reads, scheduling,
+ *                pool exhaustion, seeded determinism, panning, stereo
+ *                output through an AudioGraph
+ *
+ ******************************************************************************/
+
+#include "core/caspi_Graph.h"
+#include "samplers/caspi_Granulator.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace CASPI::Samplers;
+
+/*******************************************************************************
+ * Helpers
+ ******************************************************************************/
+
+static constexpr double kSR    = 48000.0;
+static constexpr double kTwoPi = 6.283185307179586;
+
+using GranulatorD = Granulator<double, 256>;
+using GranulatorF = Granulator<float, 64>;
+
+static std::vector<double> makeRamp (std::size_t frames)
+{
+    std::vector<double> data (frames);
+    for (std::size_t i = 0; i < frames; ++i)
+        data[i] = std::sin (0.01 * static_cast<double> (i)) + 0.001 * static_cast<double> (i);
+    return data;
+}
+
+static double hann (double x)
+{
+    return 0.5 - 0.5 * std::cos (kTwoPi * x);
+}
+
+/** One grain per second, so a short render holds exactly one grain. */
+static std::unique_ptr<GranulatorD> makeSingleGrain (const std::vector<double>& source, double sizeMs)
+{
+    auto g = std::make_unique<GranulatorD> (kSR);
+    g->setSource (source.data(), source.size(), kSR);
+    g->setDensity (1.0);
+    g->setGrainSize (sizeMs);
+    return g;
+}
+
+/*******************************************************************************
+ * Granulator
+ ******************************************************************************/
+
+TEST (Granulator, SingleGrainFollowsHannWindow)
+{
+    const std::vector<double> ones (48000, 1.0);
+    auto                      g = makeSingleGrain (ones, 10.0); // 480 samples
+
+    std::vector<double> out (600);
+    g->renderBlock (out.data(), 600);
+
+    for (std::size_t i = 0; i < 480; ++i)
+        ASSERT_NEAR (out[i], hann (static_cast<double> (i) / 480.0), 2e-6) << "sample " << i;
+    for (std::size_t i = 480; i < 600; ++i)
+        ASSERT_EQ (out[i], 0.0);
+
+    EXPECT_EQ (g->getNumActiveGrains(), 0u);
+}
+
+TEST (Granulator, UnityGrainReadsTheSourceInPlace)
+{
+    const auto source = makeRamp (10000);
+    auto       g      = makeSingleGrain (source, 5.0); // 240 samples
+    g->setPosition (0.5);
+
+    // Split over blocks that do not line up with the SIMD width
+    std::vector<double> out (300);
+    g->renderBlock (out.data(), 101);
+    g->renderBlock (out.data() + 101, 199);
+
+    const auto start = static_cast<std::size_t> (std::floor (g->position.value() * 9999.0));
+    for (std::size_t i = 0; i < 240; ++i)
+    {
+        const double expected = source[start + i] * hann (static_cast<double> (i) / 240.0);
+        ASSERT_NEAR (out[i], expected, 1e-5) << "sample " << i;
+    }
+}
+
+TEST (Granulator, PitchedGrainInterpolatesTheSource)
+{
+    const auto source = makeRamp (10000);
+    auto       g      = makeSingleGrain (source, 5.0);
+    g->setPosition (0.25);
+    g->setPitch (7.0);
+
+    std::vector<double> out (240);
+    g->renderBlock (out.data(), 240);
+
+    const double rate  = std::exp2 (7.0 / 12.0);
+    const double start = std::floor (g->position.value() * 9999.0);
+    for (std::size_t i = 0; i < 240; ++i)
+    {
+        const double pos  = start + rate * static_cast<double> (i);
+        const auto   j    = static_cast<std::size_t> (pos);
+        const double frac = pos - static_cast<double> (j);
+        const double s    = source[j] + (source[j + 1] - source[j]) * frac;
+        ASSERT_NEAR (out[i], s * hann (static_cast<double> (i) / 240.0), 1e-5) << "sample " << i;
+    }
+}
+
+TEST (Granulator, GrainsLongerThanTheSourceAreShortened)
+{
+    const std::vector<double> ones (100, 1.0);
+    auto                      g = makeSingleGrain (ones, 100.0); // 4800 samples requested
+
+    std::vector<double> out (256);
+    g->renderBlock (out.data(), 256);
+
+    // 99 samples fit between frame 0 and frame 98
+    EXPECT_GT (out[50], 0.9);
+    for (std::size_t i = 99; i < 256; ++i)
+        ASSERT_EQ (out[i], 0.0) << "sample " << i;
+    EXPECT_EQ (g->getNumActiveGrains(), 0u);
+}
+
+TEST (Granulator, SpawnsAtTheDensityWithOverlap)
+{
+    const auto source = makeRamp (48000);
+    auto       g      = std::make_unique<GranulatorD> (kSR);
+    g->setSource (source.data(), source.size(), kSR);
+    g->setDensity (1000.0);
+    g->setGrainSize (5.0);
+
+    // 48 samples apart, 240 long: at the end of each block the grains
+    // spawned at 288, 336, 384 and 432 are still sounding
+    std::vector<double> out (480);
+    for (int b = 0; b < 10; ++b)
+    {
+        g->renderBlock (out.data(), 480);
+        EXPECT_EQ (g->getNumActiveGrains(), 4u);
+    }
+    EXPECT_EQ (g->getDroppedGrains(), 0u);
+}
+
+TEST (Granulator, FullPoolDropsGrains)
+{
+    const auto source = makeRamp (48000);
+    auto       g      = std::make_unique<GranulatorF> (static_cast<float> (kSR));
+    std::vector<float> sourceF (source.begin(), source.end());
+    g->setSource (sourceF.data(), sourceF.size(), static_cast<float> (kSR));
+    g->setDensity (20000.f);
+    g->setGrainSize (100.f);
+    g->setPositionSpread (1.f);
+    g->setPitchSpread (12.f);
+
+    std::size_t        peak = 0;
+    std::vector<float> out (512);
+    for (int b = 0; b < 40; ++b)
+    {
+        g->renderBlock (out.data(), 512);
+        for (float s : out)
+            ASSERT_TRUE (std::isfinite (s));
+
+        ASSERT_LE (g->getNumActiveGrains(), 64u);
+        peak = std::max (peak, g->getNumActiveGrains());
+    }
+
+    EXPECT_EQ (peak, 64u);
+    EXPECT_GT (g->getDroppedGrains(), 0u);
+}
+
+TEST (Granulator, SameSeedRendersTheSameCloud)
+{
+    const auto source = makeRamp (20000);
+
+    auto render = [&] (std::uint64_t seed)
+    {
+        auto g = std::make_unique<GranulatorD> (kSR);
+        g->setSeed (seed);
+        g->setSource (source.data(), source.size(), 44100.0);
+        g->setDensity (300.0);
+        g->setGrainSize (30.0);
+        g->setPosition (0.5);
+        g->setPositionSpread (0.4);
+        g->setPitchSpread (5.0);
+        g->setPanSpread (1.0);
+
+        std::vector<double> left (4096), right (4096);
+        for (int b = 0; b < 4; ++b)
+            g->renderBlock (left.data() + b * 1024, right.data() + b * 1024, 1024);
+        left.insert (left.end(), right.begin(), right.end());
+        return left;
+    };
+
+    const auto a = render (7);
+    const auto b = render (7);
+    const auto c = render (8);
+
+    EXPECT_EQ (a, b);
+    EXPECT_NE (a, c);
+}
+
+TEST (Granulator, PanSpreadMovesGrainsAcrossTheField)
+{
+    const auto source = makeRamp (20000);
+    auto       g      = std::make_unique<GranulatorD> (kSR);
+    g->setSource (source.data(), source.size(), kSR);
+    g->setDensity (200.0);
+    g->setGrainSize (20.0);
+    g->setPositionSpread (0.3);
+
+    std::vector<double> left (2048), right (2048);
+    g->renderBlock (left.data(), right.data(), 2048);
+    for (std::size_t i = 0; i < left.size(); ++i)
+        ASSERT_NEAR (left[i], right[i], 1e-12); // cos and sin of pi/4 differ in the last bit
+
+    g->setPanSpread (1.0);
+    g->renderBlock (left.data(), right.data(), 2048);
+
+    double diff = 0.0;
+    for (std::size_t i = 0; i < left.size(); ++i)
+        diff += std::abs (left[i] - right[i]);
+    EXPECT_GT (diff, 1.0);
+}
+
+TEST (Granulator, StereoGraphKeepsPerGrainPan)
+{
+    const auto source = makeRamp (20000);
+
+    CASPI::Graph::AudioGraph<double> graph;
+    auto gran = graph.emplace<GranulatorD> (kSR);
+    gran.node.setSource (source.data(), source.size(), kSR);
+    gran.node.setDensity (200.0);
+    gran.node.setGrainSize (20.0);
+    gran.node.setPositionSpread (0.3);
+    gran.node.setPanSpread (1.0);
+
+    ASSERT_TRUE (graph.prepare (2, 2048, kSR).has_value());
+    graph.process();
+
+    const auto* buffer = graph.getNode (gran.id)->getOutputBuffer (0);
+    ASSERT_EQ (buffer->numChannels(), 2u);
+
+    double diff = 0.0;
+    for (std::size_t i = 0; i < 2048; ++i)
+        diff += std::abs (buffer->sample (0, i) - buffer->sample (1, i));
+    EXPECT_GT (diff, 1.0);
+}
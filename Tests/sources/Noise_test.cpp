@@ -1,6 +1,6 @@
 /*******************************************************************************
  * @file Noise_test.cpp
- * @brief Unit tests for Noise (White and Pink).
+ * @brief Unit tests for Noise (White, Pink and VossMcCartney).
  *
  * TEST INVENTORY
  * --------------
@@ -42,6 +42,18 @@
  * Cross-algorithm
  *   Noise_WhiteAndPinkUncorrelated     — Pearson correlation of spectra is low
  *
+ * Lane generator / block engine
+ *   Xoshiro128PlusLanes_EachLaneIsTheScalarStreamJumped — lane k = scalar stream jumped k times
+ *   WhiteNoise_SplitFillsMatchOneFill  — fill()/next() in any split give one stream
+ *
+ * Voss-McCartney
+ *   VossMcCartney_AmplitudeBounds      — peak stays strictly inside [-1, 1]
+ *   VossMcCartney_SeedReproducible     — same seed → identical output
+ *   VossMcCartney_RenderBlockMatchesSample — block and sample loops agree
+ *   VossMcCartney_OctaveDensityRolloff — PSD falls ~3 dB per octave
+ *   VossMcCartney_CentroidBelowWhite   — centroid lower than white
+ *   VossMcCartney_DoubleMatchesFloat   — both precisions share one integer stream
+ *
  * BUILD
  * -----
  *   g++ -O2 -std=c++17 -I../include          \
@@ -75,6 +87,7 @@ static constexpr float  kAmpTol     = 1.0f;
 
 using WhiteOsc = CASPI::Oscillators::NoiseOscillator<float, CASPI::Oscillators::NoiseAlgorithm::White>;
 using PinkOsc  = CASPI::Oscillators::NoiseOscillator<float, CASPI::Oscillators::NoiseAlgorithm::Pink>;
+using VossOsc  = CASPI::Oscillators::NoiseOscillator<float, CASPI::Oscillators::NoiseAlgorithm::VossMcCartney>;
 
 /*******************************************************************************
  * Helpers
@@ -184,8 +197,8 @@ static double spectralFlatness (const std::vector<double>& magnitudes)
 
 /*
  * White noise output must never exceed ±1.0 over a 1-second block.
- * xoshiro128+ maps int32 → float via ×2^-31, so the theoretical ceiling is
- * just below 1.0. The amplitude parameter defaults to 1.0.
+ * Draws map to [1, 2) through the exponent bits and then to [-1, 1), so the
+ * theoretical ceiling is just below 1.0. The amplitude parameter defaults to 1.0.
  */
 TEST (WhiteNoise, AmplitudeBounds)
 {
@@ -629,4 +642,182 @@ TEST (Noise, WhiteAndPinkUncorrelated)
 
     const double corr = CASPI::spectralCorrelation (whiteProfile, pinkProfile);
     EXPECT_LT (corr, 0.5);
-}
\ No newline at end of file
+}
+
+/*******************************************************************************
+ * Lane generator / block engine
+ ******************************************************************************/
+
+/*
+ * Lane k of Xoshiro128PlusLanes must reproduce the scalar generator after k
+ * jumps, output for output. This pins the SoA update to the reference
+ * algorithm and guarantees the lanes are 2^64 steps apart.
+ */
+TEST (Xoshiro128PlusLanes, EachLaneIsTheScalarStreamJumped)
+{
+    using namespace CASPI::Oscillators::detail;
+
+    Xoshiro128Plus root;
+    root.seed (777u);
+
+    Xoshiro128PlusLanes<8> lanes;
+    lanes.seedFrom (root);
+
+    std::vector<std::array<uint32_t, 8>> laneOut (256);
+    for (auto& step : laneOut)
+    {
+        lanes.next (step.data());
+    }
+
+    Xoshiro128Plus scalar = root;
+    for (std::size_t k = 0; k < 8; ++k)
+    {
+        Xoshiro128Plus ref = scalar;
+        for (std::size_t i = 0; i < laneOut.size(); ++i)
+        {
+            ASSERT_EQ (laneOut[i][k], ref.next()) << "lane " << k << " step " << i;
+        }
+        scalar.jump();
+    }
+}
+
+/*
+ * The engine buffers one block of draws. Any mix of fill() sizes and next()
+ * calls must yield the same stream as one large fill().
+ */
+TEST (WhiteNoise, SplitFillsMatchOneFill)
+{
+    CASPI::Oscillators::detail::WhiteNoiseEngine<float> whole, split;
+    whole.seed (5u);
+    split.seed (5u);
+
+    std::vector<float> expected (1000), actual (1000);
+    whole.fill (expected.data(), expected.size());
+
+    std::size_t pos = 0;
+    for (std::size_t chunk : { 3u, 1u, 17u, 64u, 5u, 200u, 7u })
+    {
+        split.fill (actual.data() + pos, chunk);
+        pos += chunk;
+        actual[pos++] = split.next();
+    }
+    split.fill (actual.data() + pos, actual.size() - pos);
+
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        ASSERT_EQ (actual[i], expected[i]) << "sample " << i;
+    }
+}
+
+/*******************************************************************************
+ * Voss-McCartney
+ ******************************************************************************/
+
+/*
+ * Output is a sum of 17 values in [-1, 1) scaled by 1/17, so the bound is
+ * strict rather than empirical.
+ */
+TEST (VossMcCartney, AmplitudeBounds)
+{
+    VossOsc osc;
+    const auto buf = renderBlockF (osc, kLongBlock);
+    EXPECT_LT (peakOf (buf), kAmpTol);
+    EXPECT_LT (std::abs (dcOf (buf)), 0.1);
+}
+
+/*
+ * All Voss state (rows, block counter) comes from the PRNG or is reset by
+ * seed(), so the whole stream is reproducible.
+ */
+TEST (VossMcCartney, SeedReproducible)
+{
+    VossOsc oscA, oscB;
+    oscA.seed (4242u);
+    oscB.seed (4242u);
+
+    const auto a = renderBlockF (oscA, kShortBlock * 3);
+    const auto b = renderBlockF (oscB, kShortBlock * 3);
+    for (std::size_t i = 0; i < a.size(); ++i)
+    {
+        ASSERT_EQ (a[i], b[i]) << "Diverged at sample " << i;
+    }
+}
+
+/*
+ * Rows change on block boundaries inside the engine; renderSample() must
+ * see the same sequence through the pending buffer.
+ */
+TEST (VossMcCartney, RenderBlockMatchesSample)
+{
+    VossOsc oscA, oscB;
+    oscA.seed (42u);
+    oscB.seed (42u);
+
+    const auto blockOut  = renderBlockF (oscA, kShortBlock + 3);
+    const auto sampleOut = renderSampleLoop (oscB, kShortBlock + 3);
+
+    for (std::size_t i = 0; i < blockOut.size(); ++i)
+    {
+        ASSERT_EQ (blockOut[i], sampleOut[i]) << "Mismatch at sample " << i;
+    }
+}
+
+/*
+ * Power density (band energy / bandwidth) should fall about 3 dB per
+ * octave: three octaves apart gives a ratio near 8. Voss ripple is about
+ * 1 dB, so the bounds are loose.
+ */
+TEST (VossMcCartney, OctaveDensityRolloff)
+{
+    VossOsc osc;
+    osc.seed (10u);
+    const auto samples = toDouble (renderBlockF (osc, kFFTBlock));
+
+    CASPI::SpectralProfile profile (samples, static_cast<double> (kSR));
+
+    const double low  = profile.getEnergyInRange (125.0, 250.0) / 125.0;
+    const double high = profile.getEnergyInRange (1000.0, 2000.0) / 1000.0;
+    ASSERT_GT (high, 0.0);
+
+    const double ratio = low / high;
+    EXPECT_GT (ratio, 4.0);
+    EXPECT_LT (ratio, 16.0);
+}
+
+TEST (VossMcCartney, CentroidBelowWhite)
+{
+    WhiteOsc white;
+    VossOsc  voss;
+    white.seed (20u);
+    voss.seed (20u);
+
+    const auto whiteSamples = toDouble (renderBlockF (white, kFFTBlock));
+    const auto vossSamples  = toDouble (renderBlockF (voss, kFFTBlock));
+
+    CASPI::SpectralProfile whiteProfile (whiteSamples, static_cast<double> (kSR));
+    CASPI::SpectralProfile vossProfile  (vossSamples,  static_cast<double> (kSR));
+
+    EXPECT_LT (vossProfile.getSpectralCentroid(), whiteProfile.getSpectralCentroid());
+}
+
+/*
+ * Rows are integers, so float and double engines walk the same stream and
+ * differ only by the final conversion.
+ */
+TEST (VossMcCartney, DoubleMatchesFloat)
+{
+    CASPI::Oscillators::detail::VossMcCartneyEngine<float>  f;
+    CASPI::Oscillators::detail::VossMcCartneyEngine<double> d;
+    f.seed (8u);
+    d.seed (8u);
+
+    std::vector<float>  a (777);
+    std::vector<double> b (777);
+    f.fill (a.data(), a.size());
+    d.fill (b.data(), b.size());
+
+    for (std::size_t i = 0; i < a.size(); ++i)
+    {
+        ASSERT_NEAR (a[i], b[i], 1e-6) << "sample " << i;
+    }
+}
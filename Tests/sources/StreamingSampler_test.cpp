@@ -0,0 +1,302 @@
+/*******************************************************************************
+ * @file  StreamingSampler_test.cpp
+ * @brief Unit tests for StreamedSample and StreamingSampler.
+ *
+ * TEST GROUPS
+ * -----------
+ *   StreamedSample   — head loading, positional reads, open errors
+ *   StreamingSampler — head-to-ring playback, pitched cubic playback,
+ *                      underrun accounting and recovery, background thread,
+ *                      release, voice stealing
+ *
+ ******************************************************************************/
+
+#include "samplers/caspi_StreamingSampler.h"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CASPI::Samplers;
+
+/*******************************************************************************
+ * Helpers
+ ******************************************************************************/
+
+static constexpr double kSR = 48000.0;
+
+static std::string tempPath (const std::string& name)
+{
+    return ::testing::TempDir() + "caspi_sampler_" + name;
+}
+
+/** Writes @p prefixBytes of junk then @p data as raw float32. */
+static std::string writeSampleFile (const std::string& name, const std::vector<float>& data, std::size_t prefixBytes = 0)
+{
+    const std::string path = tempPath (name);
+    std::FILE*        f    = std::fopen (path.c_str(), "wb");
+    for (std::size_t i = 0; i < prefixBytes; ++i)
+        std::fputc (0x5A, f);
+    if (! data.empty())
+        std::fwrite (data.data(), sizeof (float), data.size(), f);
+    std::fclose (f);
+    return path;
+}
+
+/** Deterministic, non-periodic test signal. */
+static std::vector<float> makeSignal (std::size_t frames, float seed = 0.f)
+{
+    std::vector<float> data (frames);
+    for (std::size_t i = 0; i < frames; ++i)
+    {
+        const auto t = static_cast<float> (i);
+        data[i]      = 0.5f * std::sin (0.013f * t + seed) + 0.3f * std::sin (0.0071f * t * (1.f + seed));
+    }
+    return data;
+}
+
+/** Scalar Catmull-Rom over @p data, zero outside it. */
+static double referenceCubic (const std::vector<float>& data, double pos)
+{
+    const auto   i    = static_cast<long long> (std::floor (pos));
+    const double frac = pos - static_cast<double> (i);
+    auto         at   = [&] (long long f)
+    { return (f < 0 || f >= static_cast<long long> (data.size())) ? 0.0 : static_cast<double> (data[static_cast<std::size_t> (f)]); };
+
+    const double y0 = at (i - 1), y1 = at (i), y2 = at (i + 1), y3 = at (i + 2);
+    const double c3 = -0.5 * y0 + 1.5 * y1 - 1.5 * y2 + 0.5 * y3;
+    const double c2 = y0 - 2.5 * y1 + 2.0 * y2 - 0.5 * y3;
+    const double c1 = -0.5 * y0 + 0.5 * y2;
+    return ((c3 * frac + c2) * frac + c1) * frac + y1;
+}
+
+/*******************************************************************************
+ * StreamedSample
+ ******************************************************************************/
+
+TEST (StreamedSample, OpenLoadsHeadAndReadsTheRest)
+{
+    const auto data = makeSignal (5000);
+    const auto path = writeSampleFile ("open.f32", data, 44);
+
+    auto result = StreamedSample<double>::open (path, 44100.0, 1000, 44);
+    ASSERT_TRUE (result.has_value());
+    const auto& sample = *result.value();
+
+    EXPECT_EQ (sample.numFrames(), 5000u);
+    EXPECT_EQ (sample.headFrames(), 1000u);
+    EXPECT_DOUBLE_EQ (sample.sampleRate(), 44100.0);
+    for (std::size_t i = 0; i < 1000; ++i)
+        ASSERT_EQ (sample.head()[i], static_cast<double> (data[i]));
+
+    std::vector<float> chunk (300);
+    ASSERT_TRUE (sample.read (4700, chunk.data(), 300));
+    for (std::size_t i = 0; i < 300; ++i)
+        ASSERT_EQ (chunk[i], data[4700 + i]);
+
+    EXPECT_FALSE (sample.read (4800, chunk.data(), 300));
+}
+
+TEST (StreamedSample, ReportsOpenErrors)
+{
+    using Error = SampleStreamError;
+
+    auto missing = StreamedSample<float>::open (tempPath ("does_not_exist.f32"), kSR, 100);
+    ASSERT_FALSE (missing.has_value());
+    EXPECT_EQ (missing.error(), Error::OpenFailed);
+
+    auto empty = StreamedSample<float>::open (writeSampleFile ("empty.f32", {}), kSR, 100);
+    ASSERT_FALSE (empty.has_value());
+    EXPECT_EQ (empty.error(), Error::Empty);
+
+    auto ragged = StreamedSample<float>::open (writeSampleFile ("ragged.f32", { 1.f }, 2), kSR, 100);
+    ASSERT_FALSE (ragged.has_value());
+    EXPECT_EQ (ragged.error(), Error::BadLayout);
+}
+
+/*******************************************************************************
+ * StreamingSampler
+ ******************************************************************************/
+
+TEST (StreamingSampler, UnitRatePlaysTheFileExactly)
+{
+    using Sampler = StreamingSampler<float, 4, 1024>;
+
+    // Longer than head + ring, so the ring wraps several times
+    const auto data    = makeSignal (10000);
+    auto       sample  = StreamedSample<float>::open (writeSampleFile ("unit.f32", data), kSR, 2000);
+    auto       sampler = std::make_unique<Sampler> (static_cast<float> (kSR));
+
+    const std::size_t index = sampler->addSample (sample.value());
+    ASSERT_EQ (sampler->noteOn (index), 0);
+
+    std::vector<float> out;
+    std::vector<float> block (100);
+    for (int b = 0; b < 110; ++b)
+    {
+        sampler->serviceStreams();
+        sampler->renderBlock (block.data(), 100);
+        out.insert (out.end(), block.begin(), block.end());
+    }
+
+    for (std::size_t i = 0; i < data.size(); ++i)
+        ASSERT_EQ (out[i], data[i]) << "frame " << i;
+    for (std::size_t i = data.size(); i < out.size(); ++i)
+        ASSERT_EQ (out[i], 0.f);
+
+    EXPECT_EQ (sampler->getNumActiveVoices(), 0u);
+    EXPECT_EQ (sampler->getUnderrunFrames(), 0u);
+}
+
+TEST (StreamingSampler, PitchedPlaybackMatchesReferenceCubic)
+{
+    using Sampler = StreamingSampler<double, 4, 1024>;
+
+    const auto data   = makeSignal (6000, 0.3f);
+    auto       sample = StreamedSample<double>::open (writeSampleFile ("pitched.f32", data), kSR, 1500);
+
+    for (const double ratio : { 0.5, 1.5, 2.7183 })
+    {
+        auto sampler = std::make_unique<Sampler> (kSR);
+        sampler->noteOn (sampler->addSample (sample.value()), ratio);
+
+        std::vector<double> block (77);
+        for (int b = 0; b < 60; ++b)
+        {
+            sampler->serviceStreams();
+            sampler->renderBlock (block.data(), 77);
+
+            for (std::size_t i = 0; i < block.size(); ++i)
+            {
+                const double pos = ratio * static_cast<double> (static_cast<std::size_t> (b) * 77 + i);
+                const double ref = pos < static_cast<double> (data.size()) ? referenceCubic (data, pos) : 0.0;
+                ASSERT_NEAR (block[i], ref, 1e-9) << "ratio " << ratio << " block " << b << " sample " << i;
+            }
+        }
+
+        EXPECT_EQ (sampler->getUnderrunFrames(), 0u);
+    }
+}
+
+TEST (StreamingSampler, UnderrunIsSilentCountedAndKeepsTime)
+{
+    using Sampler = StreamingSampler<float, 4, 1024>;
+
+    const auto data    = makeSignal (8000);
+    auto       sample  = StreamedSample<float>::open (writeSampleFile ("underrun.f32", data), kSR, 1000);
+    auto       sampler = std::make_unique<Sampler> (static_cast<float> (kSR));
+    sampler->noteOn (sampler->addSample (sample.value()));
+
+    // No I/O for 2000 samples: frames past the head never arrive
+    std::vector<float> block (100);
+    for (int b = 0; b < 20; ++b)
+    {
+        sampler->renderBlock (block.data(), 100);
+        for (std::size_t i = 0; i < block.size(); ++i)
+        {
+            const std::size_t frame = static_cast<std::size_t> (b) * 100 + i;
+            ASSERT_EQ (block[i], frame + 2 < 1000 ? data[frame] : 0.f) << "frame " << frame;
+        }
+    }
+
+    // Samples 998..1999 each lack their last tap or more
+    EXPECT_EQ (sampler->getUnderrunFrames(), 1002u);
+    EXPECT_EQ (sampler->getUnderrunEvents(), 1u);
+
+    // Once the stream catches up, playback resumes where the voice is now
+    for (int b = 20; b < 60; ++b)
+    {
+        sampler->serviceStreams();
+        sampler->renderBlock (block.data(), 100);
+        for (std::size_t i = 0; i < block.size(); ++i)
+        {
+            const std::size_t frame = static_cast<std::size_t> (b) * 100 + i;
+            ASSERT_EQ (block[i], data[frame]) << "frame " << frame;
+        }
+    }
+
+    EXPECT_EQ (sampler->getUnderrunFrames(), 1002u);
+    sampler->resetStatistics();
+    EXPECT_EQ (sampler->getUnderrunEvents(), 0u);
+}
+
+TEST (StreamingSampler, BackgroundThreadKeepsUp)
+{
+    using Sampler = StreamingSampler<float, 8>;
+
+    auto sampler = std::make_unique<Sampler> (static_cast<float> (kSR));
+    for (int s = 0; s < 8; ++s)
+    {
+        const auto data   = makeSignal (96000, static_cast<float> (s));
+        auto       sample = StreamedSample<float>::open (writeSampleFile ("thread" + std::to_string (s) + ".f32", data), kSR, 4800);
+        sampler->addSample (sample.value());
+    }
+
+    sampler->startStreaming (std::chrono::microseconds (200));
+    EXPECT_TRUE (sampler->isStreaming());
+
+    for (std::size_t s = 0; s < 8; ++s)
+        sampler->noteOn (s, 1.f + 0.02f * static_cast<float> (s), 0.1f);
+
+    // About four times real time
+    std::vector<float> block (256);
+    float              energy = 0.f;
+    for (int b = 0; b < 300; ++b)
+    {
+        sampler->renderBlock (block.data(), 256);
+        for (float s : block)
+            energy += s * s;
+        std::this_thread::sleep_for (std::chrono::milliseconds (1));
+    }
+
+    sampler->stopStreaming();
+    EXPECT_FALSE (sampler->isStreaming());
+
+    EXPECT_EQ (sampler->getNumActiveVoices(), 8u);
+    EXPECT_EQ (sampler->getUnderrunFrames(), 0u);
+    EXPECT_EQ (sampler->getReadErrors(), 0u);
+    EXPECT_GT (energy, 0.f);
+}
+
+TEST (StreamingSampler, ReleaseFadesAndFreesTheVoice)
+{
+    using Sampler = StreamingSampler<float, 4, 1024>;
+
+    auto sample  = StreamedSample<float>::open (writeSampleFile ("release.f32", std::vector<float> (4000, 1.f)), kSR, 4000);
+    auto sampler = std::make_unique<Sampler> (static_cast<float> (kSR));
+    sampler->setReleaseTime (1.f); // 48 samples
+
+    const int voice = sampler->noteOn (sampler->addSample (sample.value()));
+    std::vector<float> block (64);
+    sampler->renderBlock (block.data(), 64);
+    EXPECT_FLOAT_EQ (block[10], 1.f);
+
+    sampler->noteOff (voice);
+    sampler->renderBlock (block.data(), 64);
+
+    for (std::size_t i = 1; i < 48; ++i)
+        ASSERT_LT (block[i], block[i - 1]);
+    for (std::size_t i = 48; i < 64; ++i)
+        ASSERT_NEAR (block[i], 0.f, 1e-6f);
+    EXPECT_EQ (sampler->getNumActiveVoices(), 0u);
+}
+
+TEST (StreamingSampler, StealsTheOldestVoice)
+{
+    using Sampler = StreamingSampler<float, 2, 1024>;
+
+    auto sample  = StreamedSample<float>::open (writeSampleFile ("steal.f32", makeSignal (3000)), kSR, 3000);
+    auto sampler = std::make_unique<Sampler> (static_cast<float> (kSR));
+    const std::size_t index = sampler->addSample (sample.value());
+
+    EXPECT_EQ (sampler->noteOn (index + 1), -1);
+    EXPECT_EQ (sampler->noteOn (index), 0);
+    EXPECT_EQ (sampler->noteOn (index), 1);
+    EXPECT_EQ (sampler->noteOn (index), 0);
+    EXPECT_EQ (sampler->noteOn (index), 1);
+    EXPECT_EQ (sampler->getNumActiveVoices(), 2u);
+}
@@ -0,0 +1,264 @@
+/*******************************************************************************
+ * @file  WavetableFile_test.cpp
+ * @brief Unit tests for the bank file format, MappedWaveTableBank and
+ *        WaveTableBankView.
+ *
+ * TEST GROUPS
+ * -----------
+ *   WaveTableBankView    — bank layout, dimension checks in setBank()
+ *   WaveTableFile        — write / map round trip, header validation
+ *   MappedWaveTableBank  — process-wide sharing, oscillator playback
+ *
+ ******************************************************************************/
+
+#include "oscillators/caspi_WavetableFile.h"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace CASPI::Oscillators;
+
+/*******************************************************************************
+ * Helpers
+ ******************************************************************************/
+
+static std::string tempPath (const std::string& name)
+{
+    return ::testing::TempDir() + "caspi_" + name + ".cwtb";
+}
+
+using MipBank  = WaveTableBank<double, 256, 2, 4>;
+using MorphBank = WaveTableBank<float, 2048, 4>;
+using MorphOsc  = WavetableOscillator<float, 2048, 4>;
+
+static void fillMorphBank (MorphBank& bank)
+{
+    bank[0].fillSine();
+    bank[1].fillSaw();
+    bank[2].fillTriangle();
+    bank[3].fillWith ([] (float t) { return std::sin (4.f * CASPI::Constants::PI<float> * t); });
+}
+
+/*******************************************************************************
+ * WaveTableBankView
+ ******************************************************************************/
+
+TEST (WaveTableBankView, BankViewIsTableMajorWithMipsAdjacent)
+{
+    auto bank = std::make_unique<MipBank>();
+    bank->fillTable (0, [] (double t) { return 2.0 * t - 1.0; });
+    bank->fillTable (1, [] (double t) { return t < 0.5 ? 1.0 : -1.0; });
+
+    const auto view = bank->view();
+    ASSERT_TRUE (view.matches (256, 2, 4));
+
+    for (std::size_t i = 0; i < 2; ++i)
+        for (std::size_t level = 0; level < 4; ++level)
+            EXPECT_EQ (view.table (i, level), bank->mipLevel (i, level).data()) << i << "/" << level;
+}
+
+TEST (WaveTableBankView, SetBankRejectsMismatchedDimensions)
+{
+    auto bank = std::make_unique<MorphBank>();
+    fillMorphBank (*bank);
+    MorphOsc osc (*bank, 48000.f, 440.f);
+
+    WaveTableBank<float, 1024, 4> smaller;
+    EXPECT_FALSE (osc.setBank (smaller.view()));
+    EXPECT_FALSE (osc.setBank (WaveTableBankView<float>()));
+    EXPECT_EQ (osc.getBankView().data(), bank->view().data());
+
+    EXPECT_TRUE (osc.setBank (bank->view()));
+}
+
+/*******************************************************************************
+ * WaveTableFile
+ ******************************************************************************/
+
+TEST (WaveTableFile, RoundTripPreservesEveryLevel)
+{
+    auto bank = std::make_unique<MipBank>();
+    bank->fillTable (0, [] (double t) { return 2.0 * t - 1.0; });
+    bank->fillTable (1, [] (double t) { return t < 0.5 ? 1.0 : -1.0; });
+
+    const std::string path = tempPath ("roundtrip");
+    ASSERT_TRUE (writeWaveTableFile (path, bank->view()).has_value());
+
+    auto mapped = MappedWaveTableBank<double>::open (path);
+    ASSERT_TRUE (mapped.has_value());
+
+    const auto& view = mapped.value()->view();
+    ASSERT_TRUE (view.matches (256, 2, 4));
+
+    for (std::size_t i = 0; i < 2; ++i)
+        for (std::size_t level = 0; level < 4; ++level)
+            for (std::size_t n = 0; n < 256; ++n)
+                ASSERT_EQ (view.table (i, level)[n], bank->mipLevel (i, level)[n]) << i << "/" << level << "/" << n;
+
+    EXPECT_EQ (reinterpret_cast<std::uintptr_t> (view.data()) % kWaveTableFileAlignment, 0u);
+    std::remove (path.c_str());
+}
+
+TEST (WaveTableFile, RejectsWrongSampleType)
+{
+    auto bank = std::make_unique<MipBank>();
+    const std::string path = tempPath ("sampletype");
+    ASSERT_TRUE (writeWaveTableFile (path, bank->view()).has_value());
+
+    auto mapped = MappedWaveTableBank<float>::open (path);
+    ASSERT_FALSE (mapped.has_value());
+    EXPECT_EQ (mapped.error(), WaveTableFileError::SampleTypeMismatch);
+    std::remove (path.c_str());
+}
+
+TEST (WaveTableFile, RejectsCorruptAndShortFiles)
+{
+    const std::string path = tempPath ("corrupt");
+
+    std::vector<char> junk (256, 'x');
+    std::FILE* f = std::fopen (path.c_str(), "wb");
+    std::fwrite (junk.data(), 1, junk.size(), f);
+    std::fclose (f);
+
+    auto bad = MappedWaveTableBank<float>::open (path);
+    ASSERT_FALSE (bad.has_value());
+    EXPECT_EQ (bad.error(), WaveTableFileError::BadHeader);
+
+    // A valid header whose data was cut off
+    auto bank = std::make_unique<MorphBank>();
+    ASSERT_TRUE (writeWaveTableFile (path, bank->view()).has_value());
+
+    std::vector<char> bytes (sizeof (WaveTableFileHeader) + 100);
+    f = std::fopen (path.c_str(), "rb");
+    ASSERT_EQ (std::fread (bytes.data(), 1, bytes.size(), f), bytes.size());
+    std::fclose (f);
+    f = std::fopen (path.c_str(), "wb");
+    std::fwrite (bytes.data(), 1, bytes.size(), f);
+    std::fclose (f);
+
+    auto shortFile = MappedWaveTableBank<float>::open (path);
+    ASSERT_FALSE (shortFile.has_value());
+    EXPECT_EQ (shortFile.error(), WaveTableFileError::Truncated);
+
+    std::remove (path.c_str());
+
+    auto missing = MappedWaveTableBank<float>::open (path);
+    ASSERT_FALSE (missing.has_value());
+    EXPECT_EQ (missing.error(), WaveTableFileError::OpenFailed);
+}
+
+TEST (WaveTableFile, RejectsHeadersWhoseSizesWrap)
+{
+    const std::string path = tempPath ("wrap");
+
+    auto bank = std::make_unique<MorphBank>();
+    ASSERT_TRUE (writeWaveTableFile (path, bank->view()).has_value());
+
+    std::vector<char> bytes;
+    {
+        std::FILE* f = std::fopen (path.c_str(), "rb");
+        char chunk[4096];
+        for (std::size_t n; (n = std::fread (chunk, 1, sizeof (chunk), f)) > 0;)
+            bytes.insert (bytes.end(), chunk, chunk + n);
+        std::fclose (f);
+    }
+
+    WaveTableFileHeader original;
+    std::memcpy (&original, bytes.data(), sizeof (original));
+
+    const auto openWith = [&] (const WaveTableFileHeader& header)
+    {
+        std::memcpy (bytes.data(), &header, sizeof (header));
+        std::FILE* f = std::fopen (path.c_str(), "wb");
+        std::fwrite (bytes.data(), 1, bytes.size(), f);
+        std::fclose (f);
+        return MappedWaveTableBank<float>::open (path);
+    };
+
+    // 2^31 * 2^31 * 16 samples wraps to zero bytes, matching dataBytes
+    WaveTableFileHeader header = original;
+    header.tableSize           = 1u << 31;
+    header.numTables           = 1u << 31;
+    header.numMipLevels        = 16;
+    header.dataBytes           = 0;
+    auto wrappedSize           = openWith (header);
+    ASSERT_FALSE (wrappedSize.has_value());
+    EXPECT_EQ (wrappedSize.error(), WaveTableFileError::BadHeader);
+
+    // dataOffset + dataBytes wraps past the end-of-file check
+    header            = original;
+    header.dataOffset = ~std::uint64_t (0) - 63;
+    auto wrappedEnd   = openWith (header);
+    ASSERT_FALSE (wrappedEnd.has_value());
+    EXPECT_EQ (wrappedEnd.error(), WaveTableFileError::Truncated);
+
+    EXPECT_TRUE (openWith (original).has_value());
+    std::remove (path.c_str());
+}
+
+/*******************************************************************************
+ * MappedWaveTableBank
+ ******************************************************************************/
+
+TEST (MappedWaveTableBank, AcquireSharesOneMappingPerPath)
+{
+    auto bank = std::make_unique<MorphBank>();
+    fillMorphBank (*bank);
+
+    const std::string path = tempPath ("shared");
+    ASSERT_TRUE (writeWaveTableFile (path, bank->view()).has_value());
+
+    auto a = MappedWaveTableBank<float>::acquire (path);
+    auto b = MappedWaveTableBank<float>::acquire (path);
+    ASSERT_TRUE (a.has_value());
+    ASSERT_TRUE (b.has_value());
+    EXPECT_EQ (a.value().get(), b.value().get());
+    EXPECT_EQ (a.value()->view().data(), b.value()->view().data());
+
+    // open() never shares
+    auto c = MappedWaveTableBank<float>::open (path);
+    ASSERT_TRUE (c.has_value());
+    EXPECT_NE (a.value().get(), c.value().get());
+
+    std::remove (path.c_str());
+}
+
+TEST (MappedWaveTableBank, OscillatorRendersMappedBankLikeCompiledBank)
+{
+    auto bank = std::make_unique<MorphBank>();
+    fillMorphBank (*bank);
+
+    const std::string path = tempPath ("playback");
+    ASSERT_TRUE (writeWaveTableFile (path, bank->view()).has_value());
+
+    auto mapped = MappedWaveTableBank<float>::acquire (path);
+    ASSERT_TRUE (mapped.has_value());
+    mapped.value()->prefetch();
+
+    MorphOsc compiled (*bank, 48000.f, 330.f);
+    MorphOsc fromFile;
+    ASSERT_TRUE (fromFile.setBank (mapped.value()->view()));
+    fromFile.setSampleRate (48000.f);
+    fromFile.setFrequency (330.f);
+    fromFile.prepare();
+
+    for (MorphOsc* osc : { &compiled, &fromFile })
+    {
+        osc->setMorphPosition (0.6f);
+        osc->setInterpolationMode (InterpolationMode::Hermite);
+    }
+
+    std::vector<float> expected (301), actual (301);
+    compiled.renderBlock (expected.data(), 301);
+    fromFile.renderBlock (actual.data(), 301);
+
+    for (std::size_t i = 0; i < expected.size(); ++i)
+        ASSERT_EQ (actual[i], expected[i]) << "sample " << i;
+
+    std::remove (path.c_str());
+}
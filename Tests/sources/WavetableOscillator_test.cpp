@@ -16,15 +16,24 @@
  *   WavetableOscillator — amplitude bounds, DC, phase reset, phaseWrapped,
  *                         hard sync, renderBlock vs renderSample parity,
  *                         modulation, morphing, phase mod, bank hot-swap,
- *                         interpolation mode, spectral content
+ *                         interpolation mode, spectral content,
+ *                         per-sample / per-block graph control inputs
+ *   WaveTableBankMip  — FFT band-limiting of mip levels, footprint
+ *   WavetableOscillatorMip — level selection, alias rejection at 1x rate
+ *   WavetableOscillatorSIMD — vector renderBlock vs renderBlockScalar parity
+ *   WaveTableBankPublisher — lock-free bank hand-over, crossfade, reclamation
  *
  ******************************************************************************/
 
+#include "core/caspi_Graph.h"
+#include "oscillators/caspi_LFO.h"
 #include "oscillators/caspi_WavetableOscillator.h"
 #include <gtest/gtest.h>
 #include <cmath>
 #include <limits>
 #include <numeric>
+#include <memory>
+#include <thread>
 #include <vector>
 
 /*******************************************************************************
@@ -719,4 +728,558 @@ TEST (WavetableOscillator, FrequencyChangeShiftsFundamental)
 
     EXPECT_GT (binEnergy (buf440, 440.f, kSR), binEnergy (buf440, 880.f, kSR));
     EXPECT_GT (binEnergy (buf880, 880.f, kSR), binEnergy (buf880, 440.f, kSR));
-}
\ No newline at end of file
+}
+
+/*******************************************************************************
+ * WavetableOscillator — graph control inputs
+ ******************************************************************************/
+
+/*
+ * LFO -> oscillator frequency through the graph. PerSample applies each
+ * value of the LFO's control block on its own frame; PerBlock (default)
+ * applies the block's last value to the whole block.
+ */
+static std::vector<float> renderThroughGraph (Bank1& bank, CASPI::Graph::ControlRate rate, int numBlocks)
+{
+    using LFO = CASPI::Oscillators::LFO<float>;
+
+    CASPI::Graph::AudioGraph<float> graph;
+    auto lfo = graph.emplace<LFO>();
+    auto osc = graph.emplace<Osc1> (bank, kSR, kFreq);
+    osc.node.setModulationRate (rate);
+
+    EXPECT_TRUE (graph.connectControl (lfo.id, osc.id).has_value());
+    EXPECT_TRUE (graph.prepare (1, kBlock, kSR).has_value());
+    lfo.node.setRate (20.f);
+    lfo.node.setAmplitude (0.1f);
+
+    std::vector<float> out;
+    for (int b = 0; b < numBlocks; ++b)
+    {
+        graph.process();
+        const float* data = osc.node.getOutputBuffer (0)->channelData (0);
+        out.insert (out.end(), data, data + kBlock);
+    }
+    return out;
+}
+
+TEST (WavetableOscillator, PerSampleModulationFollowsControlBlock)
+{
+    Bank1 bank;
+    bank[0].fillSine();
+
+    const auto actual = renderThroughGraph (bank, CASPI::Graph::ControlRate::PerSample, 3);
+
+    CASPI::Oscillators::LFO<float> lfo (kSR, 20.f);
+    lfo.setAmplitude (0.1f);
+    Osc1 osc (bank, kSR, kFreq);
+
+    std::vector<float> mod (kBlock);
+    for (int b = 0; b < 3; ++b)
+    {
+        lfo.renderBlock (mod.data(), kBlock);
+        for (int i = 0; i < kBlock; ++i)
+        {
+            osc.frequency.addModulation (mod[static_cast<std::size_t> (i)]);
+            const float expected = osc.renderSample();
+            osc.frequency.clearModulation();
+
+            ASSERT_EQ (actual[static_cast<std::size_t> (b * kBlock + i)], expected) << "block " << b << ", sample " << i;
+        }
+    }
+}
+
+TEST (WavetableOscillator, PerBlockModulationIsTheDefault)
+{
+    Bank1 bank;
+    bank[0].fillSine();
+
+    const auto actual = renderThroughGraph (bank, CASPI::Graph::ControlRate::PerBlock, 2);
+
+    CASPI::Oscillators::LFO<float> lfo (kSR, 20.f);
+    lfo.setAmplitude (0.1f);
+    Osc1 osc (bank, kSR, kFreq);
+
+    std::vector<float> mod (kBlock);
+    std::vector<float> expected (kBlock);
+    for (int b = 0; b < 2; ++b)
+    {
+        lfo.renderBlock (mod.data(), kBlock);
+        osc.frequency.addModulation (mod.back());
+        for (auto& s : expected)
+            s = osc.renderSample();
+        osc.frequency.clearModulation();
+
+        for (int i = 0; i < kBlock; ++i)
+        {
+            ASSERT_EQ (actual[static_cast<std::size_t> (b * kBlock + i)], expected[static_cast<std::size_t> (i)]) << "block " << b << ", sample " << i;
+        }
+    }
+}
+
+/*******************************************************************************
+ * Mipmapped banks
+ ******************************************************************************/
+
+static constexpr std::size_t kMipLevels = CASPI::Oscillators::MaxMipLevels<kTableSize>::value;
+
+using MipBankD  = CASPI::Oscillators::WaveTableBank<double, kTableSize, 1, kMipLevels>;
+using MipOscD   = CASPI::Oscillators::WavetableOscillator<double, kTableSize, 1, kMipLevels>;
+using PlainBankD = CASPI::Oscillators::WaveTableBank<double, kTableSize, 1>;
+using PlainOscD  = CASPI::Oscillators::WavetableOscillator<double, kTableSize, 1>;
+
+static double naiveSaw (double t) { return 2.0 * t - 1.0; }
+
+/*
+ * aliasRatioDb — fraction of output energy outside the harmonic bins.
+ *
+ * The oscillator runs at exactly `fundamentalBin` cycles per `n` samples,
+ * so every harmonic lands on a multiple of fundamentalBin and every
+ * aliased component lands on some other integer bin.
+ */
+template <typename Osc>
+static double aliasRatioDb (Osc& osc, std::size_t n, std::size_t fundamentalBin)
+{
+    std::vector<double> buf (n);
+    osc.renderBlock (buf.data(), static_cast<int> (n));
+
+    CASPI::CArray spectrum = CASPI::fftReal (buf);
+
+    double harmonic = 0.0, alias = 0.0;
+    for (std::size_t b = 1; b < n / 2; ++b)
+    {
+        const double e = std::norm (spectrum[b]);
+        ((b % fundamentalBin) == 0 ? harmonic : alias) += e;
+    }
+    return 10.0 * std::log10 (alias / (harmonic + alias) + 1e-300);
+}
+
+TEST (WaveTableBankMip, LevelZeroIsTheFilledTable)
+{
+    auto bank = std::make_unique<MipBankD>();
+    bank->fillTable (0, naiveSaw);
+
+    for (std::size_t i = 0; i < kTableSize; ++i)
+    {
+        ASSERT_DOUBLE_EQ (bank->mipLevel (0, 0)[i], naiveSaw (static_cast<double> (i) / kTableSize));
+    }
+}
+
+TEST (WaveTableBankMip, LevelsKeepOnlyHarmonicsBelowTheirLimit)
+{
+    auto bank = std::make_unique<MipBankD>();
+    bank->fillTable (0, naiveSaw);
+
+    const auto spectrumOf = [&] (std::size_t level)
+    {
+        std::vector<double> samples (bank->mipLevel (0, level).data(),
+                                     bank->mipLevel (0, level).data() + kTableSize);
+        return CASPI::fftReal (samples);
+    };
+
+    const auto reference = spectrumOf (0);
+
+    for (std::size_t level = 1; level < kMipLevels; ++level)
+    {
+        const auto spectrum    = spectrumOf (level);
+        const std::size_t limit = MipBankD::harmonicLimit (level);
+
+        for (std::size_t b = 1; b < kTableSize / 2; ++b)
+        {
+            if (b <= limit)
+                ASSERT_NEAR (std::abs (spectrum[b] - reference[b]), 0.0, 1e-9) << "level " << level << " bin " << b;
+            else
+                ASSERT_NEAR (std::abs (spectrum[b]), 0.0, 1e-9) << "level " << level << " bin " << b;
+        }
+    }
+
+    // The top level is the fundamental alone
+    EXPECT_EQ (MipBankD::harmonicLimit (kMipLevels - 1), 1u);
+}
+
+TEST (WaveTableBankMip, FootprintMatchesStorage)
+{
+    using MipBankF = CASPI::Oscillators::WaveTableBank<float, kTableSize, 1, kMipLevels>;
+
+    EXPECT_EQ (kMipLevels, 11u);
+    EXPECT_EQ (MipBankF::footprintBytes(), 88u * 1024u);
+    EXPECT_EQ (sizeof (MipBankF), MipBankF::footprintBytes());
+    EXPECT_EQ (sizeof (Bank4), Bank4::footprintBytes());
+}
+
+TEST (WavetableOscillatorMip, SelectsLowestAliasFreeLevel)
+{
+    auto bank = std::make_unique<MipBankD>();
+    bank->fillTable (0, naiveSaw);
+
+    const double sr = 48000.0;
+    MipOscD osc (*bank, sr, 20.0);
+
+    // TableSize * increment < 1: the full table fits below Nyquist
+    EXPECT_DOUBLE_EQ (osc.getMipPosition(), 0.0);
+
+    // TableSize * increment = 3: needs harmonics <= TableSize/6, i.e. level 2
+    osc.setFrequency (3.0 * sr / kTableSize);
+    EXPECT_NEAR (osc.getMipPosition(), 2.0, 1e-9);
+
+    osc.setMipCrossfade (true);
+    EXPECT_NEAR (osc.getMipPosition(), std::log2 (3.0) + 1.0, 1e-9);
+}
+
+TEST (WavetableOscillatorMip, LowNotesMatchThePlainOscillator)
+{
+    auto mipBank = std::make_unique<MipBankD>();
+    mipBank->fillTable (0, naiveSaw);
+    PlainBankD plainBank;
+    plainBank.fillTable (0, naiveSaw);
+
+    MipOscD mip (*mipBank, 48000.0, 20.0);
+    PlainOscD plain (plainBank, 48000.0, 20.0);
+
+    std::vector<double> a (kBlock), b (kBlock);
+    mip.renderBlock (a.data(), kBlock);
+    plain.renderBlock (b.data(), kBlock);
+
+    for (int i = 0; i < kBlock; ++i)
+    {
+        ASSERT_DOUBLE_EQ (a[static_cast<std::size_t> (i)], b[static_cast<std::size_t> (i)]) << "sample " << i;
+    }
+}
+
+TEST (WavetableOscillatorMip, MipmappingRemovesAliasingAtUnitRate)
+{
+    /* Saw at bin 97 of a 4096-point window at 48 kHz (~1.14 kHz): a naive
+     * table folds its upper harmonics back into the band. The increment is
+     * not a multiple of 1/TableSize, so interpolation error is included. */
+    const double sr           = 48000.0;
+    const std::size_t n       = 4096;
+    const std::size_t bin     = 97;
+    const double hz           = sr * static_cast<double> (bin) / static_cast<double> (n);
+
+    PlainBankD plainBank;
+    plainBank.fillTable (0, naiveSaw);
+    PlainOscD plain (plainBank, sr, hz);
+
+    auto mipBank = std::make_unique<MipBankD>();
+    mipBank->fillTable (0, naiveSaw);
+    MipOscD nearest (*mipBank, sr, hz);
+    MipOscD crossfade (*mipBank, sr, hz);
+    crossfade.setMipCrossfade (true);
+
+    const double plainDb     = aliasRatioDb (plain,     n, bin);
+    const double nearestDb   = aliasRatioDb (nearest,   n, bin);
+    const double crossfadeDb = aliasRatioDb (crossfade, n, bin);
+
+    EXPECT_GT (plainDb,     -30.0);
+    EXPECT_LT (nearestDb,   -85.0);
+    EXPECT_LT (crossfadeDb, -85.0);
+}
+
+
+/*******************************************************************************
+ * WavetableOscillatorSIMD — vector renderBlock vs scalar reference
+ ******************************************************************************/
+
+/*
+ * expectBlocksMatch — render the same oscillator setup through renderBlock()
+ * and renderBlockScalar() in blocks of `blockSize` (not a multiple of the
+ * SIMD width, so the scalar tail and phase hand-off are exercised) and
+ * compare sample by sample.
+ */
+template <typename Osc, typename Configure>
+static void expectBlocksMatch (Osc& simd, Osc& scalar, Configure configure, int blockSize, int numBlocks, double tol)
+{
+    configure (simd);
+    configure (scalar);
+
+    using Sample = decltype (simd.renderSample());
+    std::vector<Sample> a (static_cast<std::size_t> (blockSize));
+    std::vector<Sample> b (static_cast<std::size_t> (blockSize));
+
+    for (int blk = 0; blk < numBlocks; ++blk)
+    {
+        simd.renderBlock (a.data(), blockSize);
+        scalar.renderBlockScalar (b.data(), blockSize);
+
+        for (std::size_t i = 0; i < a.size(); ++i)
+        {
+            ASSERT_NEAR (a[i], b[i], tol) << "block " << blk << " sample " << i;
+        }
+    }
+}
+
+static void fillSmoothBank4 (Bank4& bank)
+{
+    bank[0].fillSine();
+    bank[1].fillTriangle();
+    bank[2].fillWith ([] (float t) { return std::sin (4.f * CASPI::Constants::PI<float> * t); });
+    bank[3].fillWith ([] (float t) { return 0.5f * std::cos (6.f * CASPI::Constants::PI<float> * t); });
+}
+
+TEST (WavetableOscillatorSIMD, LinearMorphMatchesScalar)
+{
+    Bank4 bank;
+    fillSmoothBank4 (bank);
+
+    Osc4 simd   (bank, kSR, 1234.5f);
+    Osc4 scalar (bank, kSR, 1234.5f);
+
+    expectBlocksMatch (simd, scalar,
+                       [] (Osc4& o) { o.setMorphPosition (0.37f); o.setPhaseModDepth (0.125f); },
+                       509, 8, 1e-5);
+}
+
+TEST (WavetableOscillatorSIMD, HermiteMorphMatchesScalar)
+{
+    Bank4 bank;
+    fillSmoothBank4 (bank);
+
+    Osc4 simd   (bank, kSR, 3071.f);
+    Osc4 scalar (bank, kSR, 3071.f);
+
+    expectBlocksMatch (simd, scalar,
+                       [] (Osc4& o) { o.setMorphPosition (0.81f); o.setInterpolationMode (IMode::Hermite); },
+                       255, 8, 1e-5);
+}
+
+TEST (WavetableOscillatorSIMD, MipCrossfadeMatchesScalarInDouble)
+{
+    auto bank = std::make_unique<MipBankD>();
+    bank->fillTable (0, naiveSaw);
+
+    MipOscD simd   (*bank, 48000.0, 2345.6);
+    MipOscD scalar (*bank, 48000.0, 2345.6);
+
+    for (IMode mode : { IMode::Linear, IMode::Hermite })
+    {
+        expectBlocksMatch (simd, scalar,
+                           [mode] (MipOscD& o) { o.setMipCrossfade (true); o.setInterpolationMode (mode); },
+                           131, 6, 1e-9);
+    }
+}
+
+TEST (WavetableOscillatorSIMD, PhaseIsHandedBackAfterTheVectorLoop)
+{
+    Bank1 bank;
+    bank[0].fillSine();
+
+    Osc1 simd   (bank, kSR, kFreq);
+    Osc1 scalar (bank, kSR, kFreq);
+
+    // A block that is a whole number of vectors, then single samples
+    std::vector<float> buf (64);
+    simd.renderBlock (buf.data(), 64);
+    scalar.renderBlockScalar (buf.data(), 64);
+
+    for (int i = 0; i < 16; ++i)
+    {
+        ASSERT_NEAR (simd.renderSample(), scalar.renderSample(), 1e-5f) << "sample " << i;
+    }
+}
+
+/*******************************************************************************
+ * WaveTableBankPublisher — lock-free bank hand-over
+ ******************************************************************************/
+
+using Publisher = CASPI::Oscillators::WaveTableBankPublisher<float>;
+
+static std::shared_ptr<Bank1> makeSineBank()
+{
+    auto bank = std::make_shared<Bank1>();
+    (*bank)[0].fillSine();
+    return bank;
+}
+
+TEST (WaveTableBankPublisher, FirstBankIsAdoptedWithoutFade)
+{
+    Publisher publisher;
+    auto bank = makeSineBank();
+    publisher.publish (bank);
+
+    Osc1 osc;
+    osc.setSampleRate (kSR);
+    osc.setFrequency (kFreq);
+    osc.setBankPublisher (&publisher);
+
+    Osc1 reference (*bank, kSR, kFreq);
+
+    std::vector<float> expected (300), actual (300);
+    reference.renderBlock (expected.data(), 300);
+    osc.renderBlock (actual.data(), 300);
+
+    EXPECT_FALSE (osc.isBankCrossfading());
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        ASSERT_EQ (actual[i], expected[i]) << "sample " << i;
+    }
+}
+
+TEST (WaveTableBankPublisher, SwapCrossfadesOverTheConfiguredLength)
+{
+    Publisher publisher;
+    auto sine = makeSineBank();
+    publisher.publish (sine);
+
+    Osc1 osc;
+    osc.setSampleRate (kSR);
+    osc.setFrequency (kFreq);
+    osc.setBankPublisher (&publisher);
+    osc.setBankCrossfade (64);
+
+    Osc1 reference (*sine, kSR, kFreq);
+
+    std::vector<float> expected (200), actual (200);
+    reference.renderBlock (expected.data(), 100);
+    osc.renderBlock (actual.data(), 100);
+
+    // Silent bank: the output is the sine scaled by the falling fade gain
+    publisher.publish (std::make_shared<Bank1>());
+
+    reference.renderBlock (expected.data(), 200);
+    osc.renderBlock (actual.data(), 200);
+
+    for (std::size_t i = 0; i < actual.size(); ++i)
+    {
+        const float gain = i < 64 ? 1.f - static_cast<float> (i + 1) / 64.f : 0.f;
+        ASSERT_NEAR (actual[i], expected[i] * gain, 1e-6f) << "sample " << i;
+    }
+    EXPECT_FALSE (osc.isBankCrossfading());
+}
+
+TEST (WaveTableBankPublisher, OldBankIsFreedOnlyAfterEveryOscillatorMovedOn)
+{
+    Publisher publisher;
+    std::weak_ptr<Bank1> first;
+    {
+        auto bank = makeSineBank();
+        first     = bank;
+        publisher.publish (bank);
+    }
+
+    Osc1 a, b;
+    for (Osc1* osc : { &a, &b })
+    {
+        osc->setSampleRate (kSR);
+        osc->setFrequency (kFreq);
+        osc->setBankPublisher (&publisher);
+        osc->setBankCrossfade (64);
+    }
+
+    std::vector<float> buf (64);
+    a.renderBlock (buf.data(), 16);
+    b.renderBlock (buf.data(), 16);
+
+    publisher.publish (makeSineBank());
+    EXPECT_EQ (publisher.numRetired(), 1u);
+
+    // a is mid-fade, b has not seen the new bank yet
+    a.renderBlock (buf.data(), 32);
+    EXPECT_TRUE (a.isBankCrossfading());
+    EXPECT_EQ (publisher.collect(), 0u);
+
+    a.renderBlock (buf.data(), 64);
+    EXPECT_FALSE (a.isBankCrossfading());
+    EXPECT_EQ (publisher.collect(), 0u);
+    EXPECT_FALSE (first.expired());
+
+    b.renderBlock (buf.data(), 64);
+    EXPECT_EQ (publisher.collect(), 1u);
+    EXPECT_EQ (publisher.numRetired(), 0u);
+    EXPECT_TRUE (first.expired());
+}
+
+TEST (WaveTableBankPublisher, MismatchedBankIsIgnored)
+{
+    Publisher publisher;
+    auto sine = makeSineBank();
+    publisher.publish (sine);
+
+    Osc1 osc;
+    osc.setSampleRate (kSR);
+    osc.setFrequency (kFreq);
+    osc.setBankPublisher (&publisher);
+
+    std::vector<float> buf (64);
+    osc.renderBlock (buf.data(), 64);
+
+    publisher.publish (std::make_shared<CASPI::Oscillators::WaveTableBank<float, 1024, 1>>());
+    osc.renderBlock (buf.data(), 64);
+
+    EXPECT_FALSE (osc.isBankCrossfading());
+    EXPECT_EQ (osc.getBankView().data(), sine->view().data());
+}
+
+TEST (WaveTableBankPublisher, DetachClearsThePublishedBank)
+{
+    Publisher publisher;
+    std::weak_ptr<Bank1> first;
+    {
+        auto bank = makeSineBank();
+        first     = bank;
+        publisher.publish (bank);
+    }
+
+    Osc1 osc;
+    osc.setSampleRate (kSR);
+    osc.setFrequency (kFreq);
+    osc.setBankPublisher (&publisher);
+
+    std::vector<float> buf (64);
+    osc.renderBlock (buf.data(), 64);
+    osc.setBankPublisher (nullptr);
+
+    EXPECT_TRUE (osc.getBankView().empty());
+
+    publisher.publish (makeSineBank());
+    EXPECT_EQ (publisher.numRetired(), 0u);
+    EXPECT_TRUE (first.expired());
+}
+
+TEST (WaveTableBankPublisher, PublishingDuringPlaybackIsSafe)
+{
+    Publisher publisher;
+    publisher.publish (makeSineBank());
+
+    Osc1 osc;
+    osc.setSampleRate (kSR);
+    osc.setFrequency (kFreq);
+    osc.setBankPublisher (&publisher);
+    osc.setBankCrossfade (32);
+
+    std::atomic<bool> loading { true };
+    std::thread loader ([&publisher, &loading]
+    {
+        for (int n = 0; n < 200; ++n)
+        {
+            auto bank = std::make_shared<Bank1>();
+            if (n % 2 == 0)
+                (*bank)[0].fillSaw();
+            else
+                (*bank)[0].fillSine();
+            publisher.publish (bank);
+            publisher.collect();
+        }
+        loading = false;
+    });
+
+    std::vector<float> buf (kBlock);
+    bool bounded = true;
+    while (loading)
+    {
+        osc.renderBlock (buf.data(), 61);
+        for (int i = 0; i < 61; ++i)
+        {
+            bounded = bounded && std::isfinite (buf[static_cast<std::size_t> (i)])
+                   && std::abs (buf[static_cast<std::size_t> (i)]) <= kAmpTol;
+        }
+    }
+    loader.join();
+
+    EXPECT_TRUE (bounded);
+
+    // Pick up the last publication and finish its fade
+    osc.renderBlock (buf.data(), kBlock);
+    osc.renderBlock (buf.data(), kBlock);
+    publisher.collect();
+    EXPECT_EQ (publisher.numRetired(), 0u);
+}
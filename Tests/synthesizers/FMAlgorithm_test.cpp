@@ -0,0 +1,221 @@
+/*************************************************************************
+ * @file FMAlgorithm_test.cpp
+ *
+ * Unit tests for:
+ *   CASPI::FMTopology / detail::fmTopologyOrder / detail::fmTopologyIsValid
+ *   CASPI::FMAlgorithmDSP<FloatType, Algorithm>
+ *   CASPI::FMGraphBuilder::compileAs<Algorithm>()
+ *   CASPI::FMAlgorithms::Dx7<1..32>
+ *
+ * The unrolled renderer must match FMGraphDSP built from the same graph.
+ ************************************************************************/
+
+#include <gtest/gtest.h>
+#include <utility>
+#include <vector>
+
+#include "synthesizers/caspi_FMAlgorithm.h"
+
+using namespace CASPI;
+
+namespace
+{
+    constexpr double SAMPLE_RATE = 48000.0;
+
+    struct Stack2
+    {
+            static constexpr FMTopology<2, 1, 1> topology { { { { 1, 0 } } }, { { 0 } } };
+    };
+
+    /**
+     * @brief Builder holding exactly Algorithm::topology, with distinct operator settings.
+     */
+    template <typename Algorithm>
+    FMGraphBuilder<double> makeBuilder()
+    {
+        constexpr auto& topology = Algorithm::topology;
+
+        FMGraphBuilder<double> builder;
+        for (size_t op = 0; op < topology.numOperators; ++op)
+        {
+            builder.addOperator();
+            (void) builder.configureOperator (op, 220.0 * static_cast<double> (op + 1), 1.0 + 0.25 * static_cast<double> (op), 1.0);
+        }
+
+        for (size_t e = 0; e < topology.numEdges; ++e)
+            (void) builder.connect (topology.edges[e].source, topology.edges[e].target, 0.5 + 0.25 * static_cast<double> (e));
+
+        (void) builder.setOutputOperators (std::vector<size_t> (topology.outputs.begin(), topology.outputs.end()));
+        return builder;
+    }
+
+    template <int Number>
+    void expectDx7MatchesRuntimeGraph()
+    {
+        using Algorithm = FMAlgorithms::Dx7<Number>;
+
+        auto builder  = makeBuilder<Algorithm>();
+        auto runtime  = std::move (builder.compile (SAMPLE_RATE)).value();
+        auto unrolled = std::move (builder.template compileAs<Algorithm> (SAMPLE_RATE)).value();
+
+        runtime.getOperator (Algorithm::feedbackOperator)->setModulationFeedback (0.4);
+        unrolled.getOperator (Algorithm::feedbackOperator)->setModulationFeedback (0.4);
+
+        std::vector<double> block (700);
+        unrolled.renderBlock (block.data(), block.size());
+
+        for (size_t i = 0; i < block.size(); ++i)
+            ASSERT_NEAR (block[i], runtime.renderSample(), 1e-12) << "DX7 algorithm " << Number << ", frame " << i;
+    }
+
+    template <int... Numbers>
+    void expectAllDx7MatchRuntimeGraph (std::integer_sequence<int, Numbers...>)
+    {
+        (expectDx7MatchesRuntimeGraph<Numbers + 1>(), ...);
+    }
+} // namespace
+
+// ============================================================================
+// Compile-time topology
+// ============================================================================
+
+TEST (FMTopologyTest, ExecutionOrderIsComputedAtCompileTime)
+{
+    constexpr auto order = FMAlgorithmDSP<double, FMAlgorithms::Dx7<1>>::kExecutionOrder;
+
+    // Sources (no incoming edges) first, in index order, then the chains below them
+    static_assert (order[0] == 1 && order[1] == 5, "roots first");
+    static_assert (order[2] == 0 && order[3] == 4, "then their targets");
+    static_assert (order[4] == 3 && order[5] == 2, "stack 6-5-4-3 last");
+    SUCCEED();
+}
+
+TEST (FMTopologyTest, ValidityRejectsStructuralErrors)
+{
+    constexpr FMTopology<2, 2, 1> cycle { { { { 0, 1 }, { 1, 0 } } }, { { 0 } } };
+    constexpr FMTopology<2, 1, 1> selfMod { { { { 1, 1 } } }, { { 0 } } };
+    constexpr FMTopology<2, 1, 1> outOfRange { { { { 2, 0 } } }, { { 0 } } };
+    constexpr FMTopology<2, 2, 1> duplicate { { { { 1, 0 }, { 1, 0 } } }, { { 0 } } };
+    constexpr FMTopology<2, 1, 0> noOutputs { { { { 1, 0 } } }, {} };
+
+    static_assert (! detail::fmTopologyIsValid (cycle), "cycle");
+    static_assert (! detail::fmTopologyIsValid (selfMod), "self-modulation");
+    static_assert (! detail::fmTopologyIsValid (outOfRange), "out of range");
+    static_assert (! detail::fmTopologyIsValid (duplicate), "duplicate edge");
+    static_assert (! detail::fmTopologyIsValid (noOutputs), "no outputs");
+    static_assert (detail::fmTopologyIsValid (Stack2::topology), "valid");
+    SUCCEED();
+}
+
+// ============================================================================
+// Equivalence with FMGraphDSP
+// ============================================================================
+
+TEST (FMAlgorithmDSPTest, AllDx7AlgorithmsMatchRuntimeGraph)
+{
+    expectAllDx7MatchRuntimeGraph (std::make_integer_sequence<int, 32> {});
+}
+
+TEST (FMAlgorithmDSPTest, MatchesRuntimeGraphWithEnvelopesAndFrequencyMode)
+{
+    auto builder = makeBuilder<FMAlgorithms::Dx7<5>>();
+    (void) builder.setOperatorMode (2, ModulationMode::Frequency);
+
+    auto runtime  = std::move (builder.compile (SAMPLE_RATE)).value();
+    auto unrolled = std::move (builder.template compileAs<FMAlgorithms::Dx7<5>> (SAMPLE_RATE)).value();
+
+    for (size_t i = 0; i < 6; ++i)
+    {
+        runtime.getOperator (i)->enableEnvelope();
+        runtime.getOperator (i)->setADSR (0.005, 0.02, 0.5, 0.01);
+        unrolled.getOperator (i)->enableEnvelope();
+        unrolled.getOperator (i)->setADSR (0.005, 0.02, 0.5, 0.01);
+    }
+    runtime.noteOn();
+    unrolled.noteOn();
+
+    for (int i = 0; i < 1000; ++i)
+        ASSERT_NEAR (unrolled.renderSample(), runtime.renderSample(), 1e-12) << "frame " << i;
+}
+
+TEST (FMAlgorithmDSPTest, EdgeDepthUpdatesMatchRuntimeGraph)
+{
+    auto builder  = makeBuilder<Stack2>();
+    auto runtime  = std::move (builder.compile (SAMPLE_RATE)).value();
+    auto unrolled = std::move (builder.template compileAs<Stack2> (SAMPLE_RATE)).value();
+
+    EXPECT_DOUBLE_EQ (unrolled.getEdgeDepth (0), 0.5);
+
+    runtime.setConnectionDepth (0, 3.0);
+    unrolled.setEdgeDepth (0, 3.0);
+
+    for (int i = 0; i < 500; ++i)
+        ASSERT_NEAR (unrolled.renderSample(), runtime.renderSample(), 1e-12) << "frame " << i;
+}
+
+// ============================================================================
+// Builder selection
+// ============================================================================
+
+TEST (FMAlgorithmDSPTest, CompileAsAcceptsReorderedEdgesAndOutputs)
+{
+    FMGraphBuilder<double> builder;
+    for (int i = 0; i < 6; ++i)
+        builder.addOperator();
+
+    // DX7 algorithm 5, edges and carriers listed in a different order
+    (void) builder.connect (5, 4, 1.0);
+    (void) builder.connect (3, 2, 1.0);
+    (void) builder.connect (1, 0, 1.0);
+    (void) builder.setOutputOperators ({ 4, 2, 0 });
+
+    auto result = builder.template compileAs<FMAlgorithms::Dx7<5>> (SAMPLE_RATE);
+    EXPECT_TRUE (result.has_value());
+}
+
+TEST (FMAlgorithmDSPTest, CompileAsRejectsMismatchedTopology)
+{
+    auto builder = makeBuilder<FMAlgorithms::Dx7<5>>();
+
+    // 5 and 6 share a graph here; on the DX7 they differ only in feedback routing
+    auto sameGraph = builder.template compileAs<FMAlgorithms::Dx7<6>> (SAMPLE_RATE);
+    EXPECT_TRUE (sameGraph.has_value());
+
+    auto mismatch = builder.template compileAs<FMAlgorithms::Dx7<1>> (SAMPLE_RATE);
+    ASSERT_FALSE (mismatch.has_value());
+    EXPECT_EQ (mismatch.error(), FMGraphError::TopologyMismatch);
+
+    auto stack = builder.template compileAs<Stack2> (SAMPLE_RATE);
+    ASSERT_FALSE (stack.has_value());
+    EXPECT_EQ (stack.error(), FMGraphError::TopologyMismatch);
+}
+
+TEST (FMAlgorithmDSPTest, CompileAsPropagatesValidationErrors)
+{
+    FMGraphBuilder<double> builder;
+    builder.addOperator();
+    builder.addOperator();
+    (void) builder.connect (1, 0, 1.0);
+
+    auto result = builder.template compileAs<Stack2> (SAMPLE_RATE);
+    ASSERT_FALSE (result.has_value());
+    EXPECT_EQ (result.error(), FMGraphError::NoOutputOperators);
+}
+
+TEST (FMAlgorithmDSPTest, DefaultConstructedRendersFiniteAudio)
+{
+    FMAlgorithmDSP<float, FMAlgorithms::Dx7<32>> dsp (48000.f);
+    dsp.setFrequency (261.63f);
+
+    std::vector<float> block (256);
+    dsp.renderBlock (block.data(), block.size());
+
+    float energy = 0.f;
+    for (float s : block)
+    {
+        ASSERT_TRUE (std::isfinite (s));
+        energy += s * s;
+    }
+    EXPECT_GT (energy, 0.f);
+    EXPECT_EQ ((FMAlgorithmDSP<float, FMAlgorithms::Dx7<32>>::getNumOperators()), 6u);
+}
@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <cmath>
 #include <vector>
 #include <fstream>
@@ -1635,4 +1636,485 @@ TEST_F(FMGraphAudioBufferTest, SingleSampleBuffer)
     EXPECT_FALSE(std::isnan(buffer.sample(0, 0)));
     EXPECT_FALSE(std::isnan(buffer.sample(1, 0)));
     EXPECT_DOUBLE_EQ(buffer.sample(0, 0), buffer.sample(1, 0));
-}
\ No newline at end of file
+}
+// ============================================================================
+// Block Rendering (operator-major)
+// renderBlock() must match a renderSample() loop for any block size
+// ============================================================================
+
+class FMGraphBlockRenderTest : public ::testing::Test
+{
+protected:
+    // Diamond with two carriers and self-feedback on the top modulator
+    static FMGraphDSP<double> createDiamond()
+    {
+        FMGraphBuilder<double> builder;
+
+        for (int i = 0; i < 4; ++i)
+            builder.addOperator();
+
+        builder.configureOperator(0, 1320.0, 1.5, 1.0);
+        builder.configureOperator(1, 880.0, 2.0, 1.0);
+        builder.configureOperator(2, 660.0, 1.0, 1.0);
+        builder.configureOperator(3, 440.0, 1.0, 1.0);
+        builder.connect(0, 1, 1.5);
+        builder.connect(0, 2, 0.7);
+        builder.connect(1, 3, 2.0);
+        builder.connect(2, 3, 1.0);
+        builder.setOutputOperators({3, 2});
+
+        auto dsp = std::move(builder.compile(SAMPLE_RATE)).value();
+        dsp.getOperator(0)->setModulationFeedback(0.6);
+        return dsp;
+    }
+};
+
+TEST_F(FMGraphBlockRenderTest, MatchesSampleLoopAcrossBlockSizes)
+{
+    auto reference = createDiamond();
+    auto blockDsp  = createDiamond();
+
+    const std::vector<size_t> blockSizes = {1, 17, 63, 64, 65, 200, 512};
+
+    for (size_t blockSize : blockSizes)
+    {
+        std::vector<double> block(blockSize);
+        blockDsp.renderBlock(block.data(), blockSize);
+
+        for (size_t i = 0; i < blockSize; ++i)
+        {
+            const double expected = reference.renderSample();
+            ASSERT_NEAR(block[i], expected, 1e-12) << "block size " << blockSize << ", frame " << i;
+        }
+    }
+}
+
+TEST_F(FMGraphBlockRenderTest, MatchesSampleLoopWithEnvelopes)
+{
+    auto reference = createDiamond();
+    auto blockDsp  = createDiamond();
+
+    for (auto* dsp : {&reference, &blockDsp})
+    {
+        for (size_t i = 0; i < dsp->getNumOperators(); ++i)
+        {
+            dsp->getOperator(i)->enableEnvelope();
+            dsp->getOperator(i)->setADSR(0.005, 0.02, 0.5, 0.01);
+        }
+        dsp->noteOn();
+    }
+
+    std::vector<double> block(1000);
+    blockDsp.renderBlock(block.data(), block.size());
+
+    for (size_t i = 0; i < block.size(); ++i)
+    {
+        ASSERT_NEAR(block[i], reference.renderSample(), 1e-12) << "frame " << i;
+    }
+}
+
+TEST_F(FMGraphBlockRenderTest, InterleavesWithRenderSample)
+{
+    auto reference = createDiamond();
+    auto mixed     = createDiamond();
+
+    std::vector<double> block(100);
+    for (int round = 0; round < 4; ++round)
+    {
+        mixed.renderBlock(block.data(), block.size());
+        for (double s : block)
+            ASSERT_NEAR(s, reference.renderSample(), 1e-12);
+
+        ASSERT_NEAR(mixed.renderSample(), reference.renderSample(), 1e-12);
+    }
+}
+
+// ============================================================================
+// Polyphonic Rendering (voices in SIMD lanes)
+// FMGraphPolyDSP must track one FMGraphDSP per voice to approximation tolerance
+// ============================================================================
+
+class FMGraphPolyTest : public ::testing::Test
+{
+protected:
+    static FMGraphBuilder<double> createDiamondBuilder()
+    {
+        FMGraphBuilder<double> builder;
+
+        for (int i = 0; i < 4; ++i)
+            builder.addOperator();
+
+        builder.configureOperator(0, 440.0, 1.5, 1.0);
+        builder.configureOperator(1, 440.0, 2.0, 1.0);
+        builder.configureOperator(2, 440.0, 1.0, 1.0);
+        builder.configureOperator(3, 440.0, 1.0, 1.0);
+        builder.connect(0, 1, 1.5);
+        builder.connect(0, 2, 0.7);
+        builder.connect(1, 3, 2.0);
+        builder.connect(2, 3, 1.0);
+        builder.setOutputOperators({3, 2});
+        return builder;
+    }
+
+    // Sine approximation error (~1e-7) compounds through the modulation chain
+    static constexpr double kTolerance = 1e-5;
+};
+
+TEST_F(FMGraphPolyTest, MatchesOneFMGraphDSPPerVoice)
+{
+    const std::vector<double> frequencies = {220.0, 330.0, 523.25};
+
+    auto builder = createDiamondBuilder();
+    builder.setOperatorMode(2, ModulationMode::Frequency);
+
+    auto poly = std::move(builder.template compilePoly<4>(SAMPLE_RATE)).value();
+    poly.setOperatorFeedback(0, 0.6);
+
+    std::vector<FMGraphDSP<double>> references;
+    for (size_t v = 0; v < frequencies.size(); ++v)
+    {
+        references.push_back(std::move(builder.compile(SAMPLE_RATE)).value());
+        references.back().setFrequency(frequencies[v]);
+        references.back().getOperator(0)->setModulationFeedback(0.6);
+        poly.noteOn(v, frequencies[v]);
+    }
+
+    std::vector<double> block(2048);
+    poly.renderBlock(block.data(), block.size());
+
+    for (size_t i = 0; i < block.size(); ++i)
+    {
+        double expected = 0.0;
+        for (auto& ref : references)
+            expected += ref.renderSample();
+
+        ASSERT_NEAR(block[i], expected, kTolerance) << "frame " << i;
+    }
+}
+
+TEST_F(FMGraphPolyTest, RenderSampleMatchesRenderBlock)
+{
+    auto builder = createDiamondBuilder();
+    auto a = std::move(builder.template compilePoly<8>(SAMPLE_RATE)).value();
+    auto b = std::move(builder.template compilePoly<8>(SAMPLE_RATE)).value();
+
+    for (auto* dsp : {&a, &b})
+    {
+        dsp->noteOn(1, 110.0, 0.5);
+        dsp->noteOn(6, 770.0);
+    }
+
+    std::vector<double> block(300);
+    a.renderBlock(block.data(), block.size());
+
+    for (size_t i = 0; i < block.size(); ++i)
+        ASSERT_EQ(block[i], b.renderSample()) << "frame " << i;
+}
+
+TEST_F(FMGraphPolyTest, VoiceAllocationUsesLaneMask)
+{
+    auto poly = std::move(createDiamondBuilder().template compilePoly<4>(SAMPLE_RATE)).value();
+
+    EXPECT_EQ(poly.getActiveVoiceMask(), 0u);
+    EXPECT_EQ(poly.findFreeVoice(), 0u);
+
+    for (size_t v = 0; v < 4; ++v)
+    {
+        const size_t voice = poly.findFreeVoice();
+        ASSERT_EQ(voice, v);
+        poly.noteOn(voice, 220.0 * static_cast<double>(v + 1));
+    }
+
+    EXPECT_EQ(poly.getActiveVoiceMask(), 0xFu);
+    EXPECT_EQ(poly.getNumActiveVoices(), 4u);
+    EXPECT_EQ(poly.findFreeVoice(), decltype(poly)::INVALID_VOICE);
+
+    // The lane is held until the release fade has finished
+    poly.noteOff(2);
+    EXPECT_TRUE(poly.isVoiceActive(2));
+    EXPECT_TRUE(poly.isVoiceReleasing(2));
+    EXPECT_EQ(poly.findFreeVoice(), decltype(poly)::INVALID_VOICE);
+
+    std::vector<double> block(512);
+    poly.renderBlock(block.data(), block.size());
+    EXPECT_FALSE(poly.isVoiceActive(2));
+    EXPECT_EQ(poly.getActiveVoiceMask(), 0xBu);
+    EXPECT_EQ(poly.findFreeVoice(), 2u);
+}
+
+TEST_F(FMGraphPolyTest, InactiveVoicesAreSilent)
+{
+    auto poly = std::move(createDiamondBuilder().template compilePoly<4>(SAMPLE_RATE)).value();
+
+    std::vector<double> block(256);
+    poly.renderBlock(block.data(), block.size());
+    for (double s : block)
+        ASSERT_EQ(s, 0.0);
+
+    poly.noteOn(3, 440.0);
+    poly.renderBlock(block.data(), block.size());
+    double energy = 0.0;
+    for (double s : block)
+        energy += s * s;
+    EXPECT_GT(energy, 0.0);
+
+    // One block for the release fade, then the freed lane is silent
+    poly.noteOff(3);
+    poly.renderBlock(block.data(), block.size());
+    ASSERT_FALSE(poly.isVoiceActive(3));
+    poly.renderBlock(block.data(), block.size());
+    for (double s : block)
+        ASSERT_EQ(s, 0.0);
+}
+
+TEST_F(FMGraphPolyTest, NoteOffFadesOutInsteadOfStepping)
+{
+    auto poly = std::move(createDiamondBuilder().template compilePoly<4>(SAMPLE_RATE)).value();
+    poly.noteOn(0, 440.0);
+
+    std::vector<double> block(1024);
+    poly.renderBlock(block.data(), block.size());
+
+    double largestStep = 0.0;
+    for (size_t i = 1; i < block.size(); ++i)
+        largestStep = std::max(largestStep, std::abs(block[i] - block[i - 1]));
+
+    double previous = block.back();
+    poly.noteOff(0);
+    poly.renderBlock(block.data(), block.size());
+
+    // No discontinuity at the note-off, and the fade ends in silence
+    for (size_t i = 0; i < block.size(); ++i)
+    {
+        ASSERT_LE(std::abs(block[i] - previous), largestStep * 1.01) << "frame " << i;
+        previous = block[i];
+    }
+    EXPECT_GT(std::abs(block[0]), 0.0);
+    EXPECT_EQ(block.back(), 0.0);
+    EXPECT_FALSE(poly.isVoiceActive(0));
+}
+
+TEST_F(FMGraphPolyTest, OperatorEnvelopesMatchFMGraphDSPThroughRelease)
+{
+    auto builder = createDiamondBuilder();
+    auto poly    = std::move(builder.template compilePoly<4>(SAMPLE_RATE)).value();
+    auto ref     = std::move(builder.compile(SAMPLE_RATE)).value();
+
+    for (size_t op = 0; op < 4; ++op)
+    {
+        poly.setOperatorEnvelope(op, 0.01, 0.05, 0.6, 0.03);
+        ref.getOperator(op)->setADSR(0.01, 0.05, 0.6, 0.03);
+        ref.getOperator(op)->enableEnvelope();
+    }
+
+    ref.setFrequency(330.0);
+    ref.noteOn();
+    poly.noteOn(1, 330.0);
+
+    std::vector<double> held(4000);
+    poly.renderBlock(held.data(), held.size());
+    for (size_t i = 0; i < held.size(); ++i)
+        ASSERT_NEAR(held[i], ref.renderSample(), kTolerance) << "held frame " << i;
+
+    ref.noteOff();
+    poly.noteOff(1);
+
+    // The release decays with the envelopes; the lane is held until they end
+    std::vector<double> released(8000);
+    poly.renderBlock(released.data(), released.size());
+    for (size_t i = 0; i < released.size(); ++i)
+        ASSERT_NEAR(released[i], ref.renderSample(), kTolerance) << "release frame " << i;
+
+    EXPECT_GT(std::abs(released[10]), 0.0);
+    EXPECT_FALSE(poly.isVoiceActive(1));
+    EXPECT_EQ(released.back(), 0.0);
+}
+
+TEST_F(FMGraphPolyTest, FloatVoicesMatchDoubleReference)
+{
+    FMGraphBuilder<float> builder;
+    builder.addOperator();
+    builder.addOperator();
+    builder.configureOperator(0, 440.0f, 2.0f, 1.0f);
+    builder.configureOperator(1, 440.0f, 1.0f, 1.0f);
+    builder.connect(0, 1, 1.0f);
+    builder.setOutputOperators({1});
+
+    auto poly = std::move(builder.template compilePoly<8>(static_cast<float>(SAMPLE_RATE))).value();
+    auto ref  = std::move(builder.compile(static_cast<float>(SAMPLE_RATE))).value();
+
+    poly.noteOn(5, 261.63f);
+    ref.setFrequency(261.63f);
+
+    for (int i = 0; i < 1000; ++i)
+        ASSERT_NEAR(poly.renderSample(), ref.renderSample(), 1e-3f) << "frame " << i;
+}
+
+TEST_F(FMGraphPolyTest, CompilePolyPropagatesValidationErrors)
+{
+    FMGraphBuilder<double> builder;
+    builder.addOperator();
+
+    auto result = builder.template compilePoly<4>(SAMPLE_RATE);
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), FMGraphError::NoOutputOperators);
+}
+
+// ============================================================================
+// Operator Storage and Sine Evaluation
+// ============================================================================
+
+TEST_F(FMGraphBlockRenderTest, OperatorsAreStoredContiguously)
+{
+    auto dsp = createDiamond();
+
+    for (size_t i = 1; i < dsp.getNumOperators(); ++i)
+        EXPECT_EQ(dsp.getOperator(i), dsp.getOperator(0) + i);
+}
+
+TEST_F(FMGraphBlockRenderTest, PolynomialSineTracksExact)
+{
+    auto exact      = createDiamond();
+    auto polynomial = createDiamond();
+    polynomial.setSineEvaluation(SineEvaluation::Polynomial);
+
+    for (size_t i = 0; i < polynomial.getNumOperators(); ++i)
+        EXPECT_EQ(polynomial.getOperator(i)->getSineEvaluation(), SineEvaluation::Polynomial);
+
+    std::vector<double> a(2048), b(2048);
+    exact.renderBlock(a.data(), a.size());
+    polynomial.renderBlock(b.data(), b.size());
+
+    for (size_t i = 0; i < a.size(); ++i)
+        ASSERT_NEAR(b[i], a[i], 1e-5) << "frame " << i;
+}
+
+// ============================================================================
+// Oversampling
+// ============================================================================
+
+class FMGraphOversamplingTest : public ::testing::Test
+{
+protected:
+    // PM pair whose sidebands (|fc + k·fm|) reach far past Nyquist at beta = 8
+    static constexpr double kCarrier   = 2000.0;
+    static constexpr double kModulator = 5420.0;
+    static constexpr double kBeta      = 8.0;
+
+    static FMGraphDSP<double> createBrightPair(FMOversampling oversampling)
+    {
+        FMGraphBuilder<double> builder;
+        size_t mod = builder.addOperator();
+        size_t car = builder.addOperator();
+
+        builder.configureOperator(mod, kModulator, 1.0, 1.0);
+        builder.configureOperator(car, kCarrier, kBeta, 1.0);
+        builder.connect(mod, car, 1.0);
+        builder.setOutputOperators({car});
+
+        auto dsp = std::move(builder.compile(SAMPLE_RATE)).value();
+        dsp.setOversampling(oversampling);
+        return dsp;
+    }
+
+    /**
+     * @brief Fraction of the energy below maxFreq that is not on a true sideband
+     *
+     * Aliases of the fc + k·fm series fold to frequencies away from the
+     * series itself for this fc/fm pair, so everything outside a ±100 Hz
+     * window around each sideband counts as aliasing.
+     */
+    static double aliasEnergyRatio(FMGraphDSP<double>& dsp, double maxFreq)
+    {
+        std::vector<double> samples(16384);
+        dsp.renderBlock(samples.data(), samples.size());
+
+        SpectralProfile profile(samples, SAMPLE_RATE);
+
+        double sidebandEnergy = 0.0;
+        for (int k = -40; k <= 40; ++k)
+        {
+            const double f = std::abs(kCarrier + k * kModulator);
+            if (f < maxFreq)
+                sidebandEnergy += profile.getEnergyInRange(f - 100.0, f + 100.0);
+        }
+
+        const double total = profile.getEnergyInRange(0.0, maxFreq);
+        return (total - sidebandEnergy) / total;
+    }
+};
+
+TEST_F(FMGraphOversamplingTest, DefaultsToNone)
+{
+    auto dsp = createBrightPair(FMOversampling::None);
+    EXPECT_EQ(dsp.getOversampling(), FMOversampling::None);
+    EXPECT_EQ(dsp.getLatency(), 0.0);
+    EXPECT_DOUBLE_EQ(dsp.getOperator(0)->getSampleRate(), SAMPLE_RATE);
+}
+
+TEST_F(FMGraphOversamplingTest, OperatorsRunAtOversampledRate)
+{
+    auto dsp = createBrightPair(FMOversampling::X4);
+    EXPECT_DOUBLE_EQ(dsp.getOperator(0)->getSampleRate(), 4.0 * SAMPLE_RATE);
+    EXPECT_DOUBLE_EQ(dsp.getOperator(1)->getSampleRate(), 4.0 * SAMPLE_RATE);
+
+    dsp.setSampleRate(44100.0);
+    EXPECT_DOUBLE_EQ(dsp.getOperator(1)->getSampleRate(), 4.0 * 44100.0);
+
+    dsp.setOversampling(FMOversampling::None);
+    EXPECT_DOUBLE_EQ(dsp.getOperator(1)->getSampleRate(), 44100.0);
+}
+
+TEST_F(FMGraphOversamplingTest, OversamplingReducesAliasing)
+{
+    auto plain = createBrightPair(FMOversampling::None);
+    auto x2    = createBrightPair(FMOversampling::X2);
+    auto x4    = createBrightPair(FMOversampling::X4);
+
+    const double plainDb = 10.0 * std::log10(aliasEnergyRatio(plain, 18000.0));
+    const double x2Db    = 10.0 * std::log10(aliasEnergyRatio(x2, 18000.0));
+    const double x4Db    = 10.0 * std::log10(aliasEnergyRatio(x4, 18000.0));
+
+    // Measured: plain ~ -1.6 dB (aliases dominate), 2x ~ -61 dB, 4x ~ -89 dB
+    EXPECT_GT(plainDb, -10.0);
+    EXPECT_LT(x2Db, -50.0);
+    EXPECT_LT(x4Db, -75.0);
+    EXPECT_LT(x4Db, x2Db);
+}
+
+TEST_F(FMGraphOversamplingTest, InBandToneIsPreserved)
+{
+    // Unmodulated carrier: oversampling must only delay it
+    FMGraphBuilder<double> builder;
+    size_t car = builder.addOperator();
+    builder.configureOperator(car, 1000.0, 1.0, 1.0);
+    builder.setOutputOperators({car});
+
+    auto dsp = std::move(builder.compile(SAMPLE_RATE)).value();
+    dsp.setOversampling(FMOversampling::X4);
+
+    std::vector<double> samples(8192);
+    dsp.renderBlock(samples.data(), samples.size());
+
+    const double latency = dsp.getLatency();
+    const double w       = 2.0 * Constants::PI<double> * 1000.0 / SAMPLE_RATE;
+
+    for (size_t i = 1024; i < samples.size(); ++i)
+        ASSERT_NEAR(samples[i], std::sin(w * (static_cast<double>(i) - latency)), 1e-3) << "frame " << i;
+}
+
+TEST_F(FMGraphOversamplingTest, RenderSampleMatchesRenderBlock)
+{
+    for (FMOversampling factor : {FMOversampling::X2, FMOversampling::X4})
+    {
+        auto reference = createBrightPair(factor);
+        auto blockDsp  = createBrightPair(factor);
+
+        std::vector<double> block(300);
+        blockDsp.renderBlock(block.data(), 100);
+        blockDsp.renderBlock(block.data() + 100, 200);
+
+        for (size_t i = 0; i < block.size(); ++i)
+            ASSERT_NEAR(reference.renderSample(), block[i], 1e-12) << "frame " << i;
+    }
+}
@@ -48,18 +48,25 @@ using F          = float;
 using Graph_t    = AudioGraph<F>;
 using NodeBase_t = NodeBase<F>;
 
+/*
+ * numChannels == 0 returns the node's own channel count. Otherwise the
+ * buffer is broadcast to numChannels rows: a Mono node's channel 0 is
+ * repeated, as AudioGraph does for a wider consumer.
+ */
 static py::array_t<F> node_output_to_numpy (const NodeBase_t& node,
-                                             std::size_t portIndex = 0)
+                                             std::size_t portIndex   = 0,
+                                             std::size_t numChannels = 0)
 {
     const auto* buf = node.getOutputBuffer (portIndex);
-    if (buf == nullptr)
+    if (buf == nullptr || buf->numChannels() == 0)
     {
         return py::array_t<F> (
             { static_cast<py::ssize_t> (0), static_cast<py::ssize_t> (0) });
     }
 
-    const std::size_t C = buf->numChannels();
-    const std::size_t N = buf->numFrames();
+    const std::size_t srcC = buf->numChannels();
+    const std::size_t C    = (numChannels == 0) ? srcC : numChannels;
+    const std::size_t N    = buf->numFrames();
 
     py::array_t<F> out ({
         static_cast<py::ssize_t> (C),
@@ -69,10 +76,11 @@ static py::array_t<F> node_output_to_numpy (const NodeBase_t& node,
 
     for (std::size_t ch = 0; ch < C; ++ch)
     {
+        const std::size_t from = (ch < srcC) ? ch : 0;
         for (std::size_t fr = 0; fr < N; ++fr)
         {
             r (static_cast<py::ssize_t> (ch),
-               static_cast<py::ssize_t> (fr)) = buf->sample (ch, fr);
+               static_cast<py::ssize_t> (fr)) = buf->sample (from, fr);
         }
     }
     return out;
@@ -142,7 +150,10 @@ void bind_graph (py::module_& m)
             [] (const NodeBase_t& self, std::size_t port)
             { return node_output_to_numpy (self, port); },
             py::arg ("port") = 0u,
-            "Return output buffer as numpy array [channels, frames]. Valid after process().");
+            "Return output buffer as numpy array [channels, frames]. Valid after process().\n"
+            "channels is the node's own width: 1 for Mono nodes such as oscillators,\n"
+            "whatever the graph was prepared with. Use AudioGraph.get_output() for\n"
+            "the graph width.");
 
     /*
      * AudioGraph<float>
@@ -346,6 +357,7 @@ void bind_graph (py::module_& m)
         .def ("get_num_nodes",       &Graph_t::getNumNodes)
         .def ("get_num_connections", &Graph_t::getNumConnections)
         .def ("get_sorted_order",    &Graph_t::getSortedOrder)
+        .def ("get_num_channels",    &Graph_t::getNumChannels)
 
         /*
          * get_node
@@ -368,6 +380,24 @@ void bind_graph (py::module_& m)
             py::return_value_policy::reference_internal,
             "Return a reference to the node. Valid while the node is in the graph.")
 
+        /*
+         * get_output — a node's output at the graph width. Mono nodes are
+         * broadcast, so the shape is always [get_num_channels(), frames].
+         */
+        .def ("get_output",
+            [] (Graph_t& self, NodeId id, std::size_t port) -> py::array_t<F>
+            {
+                const NodeBase_t* p = self.getNode (id);
+                if (p == nullptr)
+                {
+                    throw py::value_error ("get_output: node not found");
+                }
+                return node_output_to_numpy (*p, port, self.getNumChannels());
+            },
+            py::arg ("id"),
+            py::arg ("port") = 0u,
+            "Return a node's output as numpy [graph channels, frames]. Valid after process().")
+
         /*
          * render — convenience: prepare if needed, run N blocks, return numpy array.
          */
@@ -408,14 +438,22 @@ void bind_graph (py::module_& m)
                     {
                         continue;
                     }
+                    // A Mono node holds one channel; broadcast it to every
+                    // requested channel rather than reading past its buffer.
+                    const std::size_t nodeChannels = nodeBuf->numChannels();
+                    if (nodeChannels == 0)
+                    {
+                        continue;
+                    }
                     const std::size_t offset = block * frames;
                     for (std::size_t ch = 0; ch < channels; ++ch)
                     {
+                        const std::size_t from = (ch < nodeChannels) ? ch : 0;
                         for (std::size_t fr = 0; fr < frames; ++fr)
                         {
                             buf (static_cast<py::ssize_t> (ch),
                                  static_cast<py::ssize_t> (offset + fr))
-                                = nodeBuf->sample (ch, fr);
+                                = nodeBuf->sample (from, fr);
                         }
                     }
                 }
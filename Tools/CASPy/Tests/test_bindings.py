@@ -578,4 +578,25 @@ class TestAudioGraphRender:
         g.prepare(CHANNELS, FRAMES, SR)
         g.process()
         buf = g.get_node(osc_id).get_output_buffer(0)
-        assert buf.shape == (CHANNELS, FRAMES)
\ No newline at end of file
+        assert buf.shape == (CHANNELS, FRAMES)
+    def test_mono_sink_in_stereo_graph_is_broadcast(self):
+        """An oscillator is a Mono node; rendering it at two channels repeats channel 0."""
+        g      = caspy.AudioGraph()
+        osc_id = add_osc1(g, make_sine_bank())
+        audio  = g.render(osc_id, num_blocks=2, channels=2, frames=FRAMES, sample_rate=SR)
+        assert audio.shape == (2, 2 * FRAMES)
+        assert float(np.max(np.abs(audio[0]))) > 0.1
+        np.testing.assert_array_equal(audio[0], audio[1])
+
+    def test_get_output_uses_graph_width(self):
+        g       = caspy.AudioGraph()
+        osc_id  = add_osc1(g, make_sine_bank())
+        filt_id = add_filter(g)
+        g.connect(osc_id, filt_id)
+        g.prepare(2, FRAMES, SR)
+        g.process()
+        assert g.get_num_channels() == 2
+        assert g.get_node(filt_id).get_output_buffer().shape == (1, FRAMES)
+        out = g.get_output(filt_id)
+        assert out.shape == (2, FRAMES)
+        np.testing.assert_array_equal(out[0], out[1])